@@ -5,9 +5,21 @@
  * @author Jan van de Molengraft [jan@artemisc.eu]
  */
 
+// Expose madvise() and O_CLOEXEC when building with -std=c99
+#define _DEFAULT_SOURCE
+
 // Required headers
+#include <errno.h>
+#include <fcntl.h>
 #include <jni.h>
+#include <pthread.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "sodium.h"
 
 extern int __android_log_print(int prio, const char* tag, const char* fmt, ...);
@@ -69,15 +81,153 @@ extern "C" {
 static jclass    stodium_g_byte_buffer_class;
 static jmethodID stodium_g_byte_buffer_method_array;
 static jmethodID stodium_g_byte_buffer_method_array_offset;
-static jmethodID stodium_g_byte_buffer_method_remaining;
+static jfieldID  stodium_g_buffer_field_position;
+static jfieldID  stodium_g_buffer_field_limit;
+
+/**
+ * stodium_scratch_arenas are per-thread, grow-only blocks of native memory that
+ * hold the copies made while marshalling indirect buffers. Copies are bump
+ * allocated from the arena, and the arena is wiped and rewound as soon as the
+ * last outstanding copy has been released, which happens at the end of every
+ * JNI call. This replaces a malloc/free pair per argument with a pointer bump
+ * once the arena has grown to the working size of the thread.
+ */
+typedef struct stodium_scratch_arenas {
+    unsigned char *base;
+    size_t         size;
+    size_t         used;
+    size_t         outstanding;
+} stodium_scratch_arena;
+
+/**
+ * STODIUM_SCRATCH_ALIGN keeps every allocation aligned for the libsodium state
+ * structs, in the same way malloc would. Allocations above STODIUM_SCRATCH_MAX
+ * bypass the arena, so a single large message does not pin its size for the
+ * lifetime of the thread.
+ */
+#define STODIUM_SCRATCH_ALIGN ((size_t) 16)
+#define STODIUM_SCRATCH_MIN   ((size_t) 4096)
+#define STODIUM_SCRATCH_MAX   ((size_t) 1024 * 1024)
+
+static pthread_key_t stodium_g_scratch_key;
+static bool          stodium_g_scratch_enabled;
+
+/**
+ * stodium_scratch_destroy is the destructor of the thread-local key, releasing
+ * the arena of a thread once it exits.
+ */
+static void stodium_scratch_destroy(void *value) {
+    stodium_scratch_arena *arena = (stodium_scratch_arena *) value;
+    if (arena->base != NULL) {
+        sodium_memzero(arena->base, arena->size);
+        free(arena->base);
+    }
+    free(arena);
+}
+
+/**
+ * stodium_scratch_get returns the arena of the calling thread, creating it on
+ * first use. NULL is returned if no arena could be created.
+ */
+static stodium_scratch_arena *stodium_scratch_get(void) {
+    stodium_scratch_arena *arena;
+
+    if (!stodium_g_scratch_enabled) {
+        return NULL;
+    }
+
+    arena = (stodium_scratch_arena *) pthread_getspecific(stodium_g_scratch_key);
+    if (arena != NULL) {
+        return arena;
+    }
+
+    arena = (stodium_scratch_arena *) calloc(1, sizeof(stodium_scratch_arena));
+    if (arena == NULL) {
+        return NULL;
+    }
+    if (pthread_setspecific(stodium_g_scratch_key, arena) != 0) {
+        free(arena);
+        return NULL;
+    }
+    return arena;
+}
+
+/**
+ * stodium_scratch_alloc bump allocates len bytes from the arena of the calling
+ * thread. The arena only grows while no copies are outstanding, so pointers
+ * handed out earlier in the same call stay valid. NULL is returned if the
+ * request cannot be served from the arena, in which case the caller falls back
+ * to malloc.
+ */
+static unsigned char *stodium_scratch_alloc(size_t len) {
+    stodium_scratch_arena *arena;
+    unsigned char         *grown;
+    size_t                 size;
+    size_t                 need;
+
+    if (len > STODIUM_SCRATCH_MAX || (arena = stodium_scratch_get()) == NULL) {
+        return NULL;
+    }
+
+    need = (len + STODIUM_SCRATCH_ALIGN - 1) & ~(STODIUM_SCRATCH_ALIGN - 1);
+    if (need == 0) {
+        need = STODIUM_SCRATCH_ALIGN;
+    }
+
+    if (arena->size - arena->used < need) {
+        if (arena->outstanding != 0) {
+            return NULL;
+        }
+
+        size = arena->size > STODIUM_SCRATCH_MIN ? arena->size : STODIUM_SCRATCH_MIN;
+        while (size < need) {
+            size *= 2;
+        }
+
+        // The old block has been wiped on the last reset, so it can simply be
+        // dropped instead of copied over
+        grown = (unsigned char *) malloc(size);
+        if (grown == NULL) {
+            return NULL;
+        }
+        free(arena->base);
+        arena->base = grown;
+        arena->size = size;
+        arena->used = 0;
+    }
+
+    arena->outstanding++;
+    arena->used += need;
+    return arena->base + arena->used - need;
+}
+
+/**
+ * stodium_scratch_release marks a copy obtained from stodium_scratch_alloc as
+ * released. Once no copies are outstanding, the used part of the arena is
+ * wiped using sodium_memzero and the arena is rewound.
+ */
+static void stodium_scratch_release(void) {
+    stodium_scratch_arena *arena = (stodium_scratch_arena *) pthread_getspecific(stodium_g_scratch_key);
+    if (arena == NULL || arena->outstanding == 0) {
+        return;
+    }
+
+    if (--arena->outstanding == 0) {
+        sodium_memzero(arena->base, arena->used);
+        arena->used = 0;
+    }
+}
 
 /**
  * JNI_OnLoad caches the methods called on indirect (backing array) versions of
  * ByteBuffers passed to Stodium methods, to avoid repreated calls to
- * GetMethodID.
+ * GetMethodID. The position and limit of every buffer are read straight from
+ * the fields declared by java.nio.Buffer, which both OpenJDK and Android
+ * provide, so resolving a buffer does not need to call back into Java.
  */
 jint JNI_OnLoad(JavaVM* jvm, void* reserved) {
     JNIEnv *jenv;
+    jclass  buffer_class;
     if ((*jvm)->GetEnv(jvm, (void**)(&jenv), JNI_VERSION_1_6) != JNI_OK) {
         return -1;
     }
@@ -97,14 +247,50 @@ jint JNI_OnLoad(JavaVM* jvm, void* reserved) {
         return -1;
     }
 
-    stodium_g_byte_buffer_method_remaining = (*jenv)->GetMethodID(jenv, stodium_g_byte_buffer_class, "remaining", "()I");
+    buffer_class = (*jenv)->FindClass(jenv, "java/nio/Buffer");
+    if ((*jenv)->ExceptionCheck(jenv)) {
+        return -1;
+    }
+
+    stodium_g_buffer_field_position = (*jenv)->GetFieldID(jenv, buffer_class, "position", "I");
+    if ((*jenv)->ExceptionCheck(jenv)) {
+        return -1;
+    }
+
+    stodium_g_buffer_field_limit = (*jenv)->GetFieldID(jenv, buffer_class, "limit", "I");
     if ((*jenv)->ExceptionCheck(jenv)) {
         return -1;
     }
 
+    // Without the key, copies simply fall back to malloc
+    stodium_g_scratch_enabled = pthread_key_create(&stodium_g_scratch_key, stodium_scratch_destroy) == 0;
+
     return JNI_VERSION_1_6;
 }
 
+/**
+ * stodium_buffer_modes describe how the content of a stodium_buffer was made
+ * accessible to the native code, and therefore how it has to be released once
+ * the wrapped libsodium call has completed.
+ *
+ * STODIUM_BUFFER_DIRECT:   direct (or NULL) buffers, nothing to release.
+ * STODIUM_BUFFER_ELEMENTS: Get/ReleaseByteArrayElements, which may copy the
+ *                          entire backing array on every call.
+ * STODIUM_BUFFER_REGION:   Get/SetByteArrayRegion, copying only the window of
+ *                          the backing array that is used by the call into
+ *                          native scratch memory.
+ * STODIUM_BUFFER_CRITICAL: Get/ReleasePrimitiveArrayCritical, which pins the
+ *                          backing array instead of copying it. Only to be used
+ *                          for short, non-blocking primitives, as the VM may
+ *                          suspend garbage collection while the array is pinned.
+ */
+typedef enum stodium_buffer_modes {
+    STODIUM_BUFFER_DIRECT,
+    STODIUM_BUFFER_ELEMENTS,
+    STODIUM_BUFFER_REGION,
+    STODIUM_BUFFER_CRITICAL,
+} stodium_buffer_mode;
+
 /**
  * stodium_buffers represent a C-accessible link to the array held by a
  * ByteBuffer instance. The methods working with stodium_buffers use the fields
@@ -112,72 +298,287 @@ jint JNI_OnLoad(JavaVM* jvm, void* reserved) {
  * Direct buffer, or whether an underling jbyteArray should be addressed.
  */
 typedef struct stodium_buffers {
-    unsigned char *content;
-    size_t         offset;
-    size_t         capacity;
-    bool           is_direct;
-    jbyteArray     backing_array; // Only defined if the buffer was not direct
+    unsigned char     *content;
+    size_t             offset;
+    size_t             capacity;
+    stodium_buffer_mode mode;
+    jbyteArray         backing_array; // Only defined if the buffer was not direct
+    size_t             region_offset; // Only defined for STODIUM_BUFFER_REGION
+    size_t             region_length; // Only defined for STODIUM_BUFFER_REGION
+    bool               region_scratch; // Whether the region lives in the scratch arena
 } stodium_buffer;
 
 /**
+ * stodium_resolve_buffer fills in the location of the data held by jbuffer,
+ * without accessing the content of an indirect buffer yet. For indirect buffers
+ * the content is left NULL, and the mode is updated by the caller once the
+ * backing array is actually accessed.
  *
+ * Both direct and indirect buffers are resolved to the window between their
+ * position and limit, matching the remaining() checks made by the Java layer.
+ * This allows a single large buffer to be used as an arena, by moving its
+ * position and limit between calls instead of slicing it for every argument.
  */
-void stodium_get_buffer(JNIEnv *jenv, stodium_buffer *dst, jobject jbuffer) {
+static void stodium_resolve_buffer(JNIEnv *jenv, stodium_buffer *dst, jobject jbuffer) {
+    jint position, limit;
+
     if (jbuffer == NULL) {
-        dst->content   = 0;
-        dst->offset    = 0;
-        dst->capacity  = 0;
-        dst->is_direct = true; // A null buffer can be treated as direct
-        //__android_log_print(3, "STODIUM", "stodium_get_buffer(NULL)");
+        dst->content       = 0;
+        dst->offset        = 0;
+        dst->capacity      = 0;
+        dst->mode          = STODIUM_BUFFER_DIRECT; // A null buffer can be treated as direct
+        dst->backing_array = NULL;
         return;
     }
 
-    // FIXME can byte[] arrays be passed as jobjects? if so, we could support them as well
+    position = (*jenv)->GetIntField(jenv, jbuffer, stodium_g_buffer_field_position);
+    limit    = (*jenv)->GetIntField(jenv, jbuffer, stodium_g_buffer_field_limit);
 
-    dst->content = (unsigned char *) (*jenv)->GetDirectBufferAddress(jenv, jbuffer);
+    dst->content  = (unsigned char *) (*jenv)->GetDirectBufferAddress(jenv, jbuffer);
+    dst->capacity = (size_t) (limit - position);
     if (dst->content != NULL) {
-        dst->offset    = 0;
-        dst->capacity  = (size_t) (*jenv)->GetDirectBufferCapacity(jenv, jbuffer);
-        dst->is_direct = true;
-        //__android_log_print(3, "STODIUM", "stodium_get_buffer(Direct ByteBuffer, capacity = %d)", dst->capacity);
+        dst->offset        = (size_t) position;
+        dst->mode          = STODIUM_BUFFER_DIRECT;
+        dst->backing_array = NULL;
         return;
     }
 
-    // indirect (backing array). HALP
+    dst->content       = 0;
+    dst->mode          = STODIUM_BUFFER_ELEMENTS;
+    dst->backing_array = (jbyteArray) (*jenv)->CallObjectMethod(jenv, jbuffer, stodium_g_byte_buffer_method_array);
+    dst->offset        = (size_t) (*jenv)->CallIntMethod(jenv, jbuffer, stodium_g_byte_buffer_method_array_offset)
+                       + (size_t) position;
+}
+
+/**
+ * stodium_access_array makes the window of the backing array described by dst
+ * available to native code. When the window only covers part of the backing
+ * array, just that window is copied into the thread's scratch arena, so the
+ * cost of the call scales with the bytes used rather than with the size of the
+ * array. Windows spanning the entire array are handed to the VM, which may
+ * avoid the copy altogether.
+ */
+static void stodium_access_array(JNIEnv *jenv, stodium_buffer *dst) {
+    if ((size_t) (*jenv)->GetArrayLength(jenv, dst->backing_array) > dst->capacity) {
+        dst->content        = stodium_scratch_alloc(dst->capacity);
+        dst->region_scratch = dst->content != NULL;
+        if (dst->content == NULL) {
+            dst->content = (unsigned char *) malloc(dst->capacity > 0 ? dst->capacity : 1);
+        }
+        if (dst->content != NULL) {
+            (*jenv)->GetByteArrayRegion(jenv, dst->backing_array, (jsize) dst->offset, (jsize) dst->capacity, (jbyte *) dst->content);
+            dst->region_offset = dst->offset;
+            dst->region_length = dst->capacity;
+            dst->offset        = 0;
+            dst->mode          = STODIUM_BUFFER_REGION;
+            return;
+        }
+    }
+
     // FIXME is isCopy is stored, we can explicitely call sodium_memzero on the
     // FIXME copied data to avoid leaking sensitive data even in the event of a
     // FIXME copied key value
-    dst->backing_array = (jbyteArray) (*jenv)->CallObjectMethod(jenv, jbuffer, stodium_g_byte_buffer_method_array);
-    dst->content       = (unsigned char *) (*jenv)->GetByteArrayElements(jenv, dst->backing_array, NULL);
-    dst->offset        = (size_t) (*jenv)->CallIntMethod(jenv, jbuffer, stodium_g_byte_buffer_method_array_offset);
-    dst->capacity      = (size_t) (*jenv)->CallIntMethod(jenv, jbuffer, stodium_g_byte_buffer_method_remaining);
-    dst->is_direct     = false;
-    //__android_log_print(3, "STODIUM", "stodium_get_buffer(Indirect ByteBuffer)");
-    return;
+    dst->content = (unsigned char *) (*jenv)->GetByteArrayElements(jenv, dst->backing_array, NULL);
+    dst->mode    = STODIUM_BUFFER_ELEMENTS;
+}
+
+/**
+ * stodium_get_buffer makes the content of jbuffer available to native code,
+ * through stodium_access_array for indirect buffers.
+ */
+void stodium_get_buffer(JNIEnv *jenv, stodium_buffer *dst, jobject jbuffer) {
+    stodium_resolve_buffer(jenv, dst, jbuffer);
+    if (dst->mode == STODIUM_BUFFER_DIRECT) {
+        return;
+    }
+    stodium_access_array(jenv, dst);
+}
+
+/**
+ * stodium_get_buffer_critical prepares jbuffer for access through a critical
+ * section. No JNI methods may be called between pinning and releasing a
+ * critical array, so all buffers of a call are resolved first, after which they
+ * are pinned together through STODIUM_ENTER_CRITICAL.
+ */
+void stodium_get_buffer_critical(JNIEnv *jenv, stodium_buffer *dst, jobject jbuffer) {
+    stodium_resolve_buffer(jenv, dst, jbuffer);
+    if (dst->mode == STODIUM_BUFFER_DIRECT) {
+        return;
+    }
+
+    dst->content = 0;
+    dst->mode    = STODIUM_BUFFER_CRITICAL;
+}
+
+/**
+ * stodium_resolve_array fills in the location of the (arr, off, len) window of
+ * a Java byte[], in the same way stodium_resolve_buffer does for ByteBuffers.
+ */
+static void stodium_resolve_array(stodium_buffer *dst, jbyteArray arr, jint off, jint len) {
+    if (arr == NULL) {
+        dst->content       = 0;
+        dst->offset        = 0;
+        dst->capacity      = 0;
+        dst->mode          = STODIUM_BUFFER_DIRECT;
+        dst->backing_array = NULL;
+        return;
+    }
+
+    dst->content       = 0;
+    dst->offset        = (size_t) off;
+    dst->capacity      = (size_t) len;
+    dst->mode          = STODIUM_BUFFER_ELEMENTS;
+    dst->backing_array = arr;
+}
+
+/**
+ * stodium_get_array is the byte[] counterpart of stodium_get_buffer. As the
+ * window is passed in directly, no calls to the ByteBuffer are made.
+ */
+void stodium_get_array(JNIEnv *jenv, stodium_buffer *dst, jbyteArray arr, jint off, jint len) {
+    stodium_resolve_array(dst, arr, off, len);
+    if (dst->mode == STODIUM_BUFFER_DIRECT) {
+        return;
+    }
+    stodium_access_array(jenv, dst);
+}
+
+/**
+ * stodium_get_array_critical is the byte[] counterpart of
+ * stodium_get_buffer_critical.
+ */
+void stodium_get_array_critical(JNIEnv *jenv, stodium_buffer *dst, jbyteArray arr, jint off, jint len) {
+    stodium_resolve_array(dst, arr, off, len);
+    if (dst->mode == STODIUM_BUFFER_DIRECT) {
+        return;
+    }
+    dst->mode = STODIUM_BUFFER_CRITICAL;
+}
+
+/**
+ * stodium_get_address wraps len bytes of native memory at address, as handed
+ * out by a caller-managed allocator. The memory is treated like a direct buffer,
+ * so no JNI calls are made and nothing has to be released afterwards. An
+ * address of 0 is treated like a NULL buffer.
+ */
+void stodium_get_address(stodium_buffer *dst, jlong address, jint len) {
+    dst->content       = (unsigned char *) (intptr_t) address;
+    dst->offset        = 0;
+    dst->capacity      = address == 0 ? 0 : (size_t) len;
+    dst->mode          = STODIUM_BUFFER_DIRECT;
+    dst->backing_array = NULL;
+}
+
+/**
+ * stodium_key_handle is the layout of the guarded memory behind a KeyHandle:
+ * the key length, followed by the key itself. Handles are allocated through
+ * sodium_malloc and kept read-only for their entire lifetime.
+ */
+typedef struct stodium_key_handles {
+    size_t        length;
+    unsigned char key[];
+} stodium_key_handle;
+
+/**
+ * stodium_get_handle wraps the key held by the stodium_key_handle at address.
+ * Like stodium_get_address, no JNI calls are made and nothing has to be
+ * released afterwards. A handle of 0 is treated like a NULL buffer.
+ */
+void stodium_get_handle(stodium_buffer *dst, jlong handle) {
+    stodium_key_handle *key = (stodium_key_handle *) (intptr_t) handle;
+
+    dst->content       = key == NULL ? NULL : key->key;
+    dst->offset        = 0;
+    dst->capacity      = key == NULL ? 0 : key->length;
+    dst->mode          = STODIUM_BUFFER_DIRECT;
+    dst->backing_array = NULL;
+}
+
+/**
+ * stodium_enter_critical pins the backing arrays of all buffers that were
+ * prepared using stodium_get_buffer_critical. If the VM fails to pin one of
+ * them, the arrays pinned so far are released again and -1 is returned, in
+ * which case none of the buffers may be used or released by the caller.
+ */
+int stodium_enter_critical(JNIEnv *jenv, stodium_buffer **buffers, size_t count) {
+    size_t i;
+    for (i = 0; i < count; i++) {
+        if (buffers[i]->mode != STODIUM_BUFFER_CRITICAL) {
+            continue;
+        }
+        buffers[i]->content = (unsigned char *) (*jenv)->GetPrimitiveArrayCritical(jenv, buffers[i]->backing_array, NULL);
+        if (buffers[i]->content == NULL) {
+            while (i-- > 0) {
+                if (buffers[i]->mode == STODIUM_BUFFER_CRITICAL) {
+                    (*jenv)->ReleasePrimitiveArrayCritical(jenv, buffers[i]->backing_array, buffers[i]->content, JNI_ABORT);
+                    buffers[i]->content = 0;
+                }
+            }
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * STODIUM_ENTER_CRITICAL is a utility macro around stodium_enter_critical,
+ * taking the addresses of the buffers to pin as its varargs. It evaluates to
+ * the result of stodium_enter_critical.
+ */
+#define STODIUM_ENTER_CRITICAL(jenv, ...) \
+    stodium_enter_critical(jenv, (stodium_buffer *[]) { __VA_ARGS__ }, \
+            sizeof((stodium_buffer *[]) { __VA_ARGS__ }) / sizeof(stodium_buffer *))
+
+/**
+ * stodium_release_buffer hands the content of an indirect buffer back to the
+ * VM, using the given JNI release mode (0 or JNI_ABORT).
+ */
+static void stodium_release_buffer(JNIEnv *jenv, stodium_buffer *buffer, jint release_mode) {
+    if (buffer->content == 0) {
+        return;
+    }
+
+    switch (buffer->mode) {
+    case STODIUM_BUFFER_ELEMENTS:
+        (*jenv)->ReleaseByteArrayElements(jenv, buffer->backing_array, (jbyte *) (buffer->content), release_mode);
+        break;
+    case STODIUM_BUFFER_REGION:
+        // Only write back the bytes produced, which is the (possibly updated)
+        // capacity of the buffer
+        if (release_mode == 0) {
+            (*jenv)->SetByteArrayRegion(jenv, buffer->backing_array, (jsize) buffer->region_offset,
+                    (jsize) (buffer->capacity < buffer->region_length ? buffer->capacity : buffer->region_length),
+                    (const jbyte *) buffer->content);
+        }
+        if (buffer->region_scratch) {
+            stodium_scratch_release();
+        } else {
+            sodium_memzero(buffer->content, buffer->region_length);
+            free(buffer->content);
+        }
+        break;
+    case STODIUM_BUFFER_CRITICAL:
+        (*jenv)->ReleasePrimitiveArrayCritical(jenv, buffer->backing_array, buffer->content, release_mode);
+        break;
+    default:
+        break; // No need for copying or releasing
+    }
 }
 
 /**
  *
  */
 void stodium_release_output(JNIEnv *jenv, jobject output, stodium_buffer *buffer) {
-    if (buffer->is_direct) {
-        return; // No need for copying
-    }
-    
     // Release with copying of the native buffer
-    (*jenv)->ReleaseByteArrayElements(jenv, buffer->backing_array, (jbyte *) (buffer->content), 0);
+    stodium_release_buffer(jenv, buffer, 0);
 }
 
 /**
  *
  */
 void stodium_release_input(JNIEnv *jenv, jobject output, stodium_buffer *buffer) {
-    if (buffer->is_direct || buffer->content == 0) {
-        return; // No need for copying or releasing
-    }
-
     // Release without copying the native buffer
-    (*jenv)->ReleaseByteArrayElements(jenv, buffer->backing_array, (jbyte *) (buffer->content), JNI_ABORT);
+    stodium_release_buffer(jenv, buffer, JNI_ABORT);
 }
 
 /**
@@ -233,523 +634,896 @@ STODIUM_JNI(jint, randombytes_1close) (JNIEnv *jenv, jclass jcls) {
 
 /** ****************************************************************************
  *
- * AEAD - AES-256-GCM
+ * KEY HANDLES
  *
  **************************************************************************** */
 
-STODIUM_CONSTANT(aead, aes256gcm, keybytes)
-STODIUM_CONSTANT(aead, aes256gcm, nsecbytes)
-STODIUM_CONSTANT(aead, aes256gcm, npubbytes)
-STODIUM_CONSTANT(aead, aes256gcm, abytes)
+/**
+ * stodium_key_handle_alloc allocates a writable stodium_key_handle for a key of
+ * the given length, or returns NULL if the allocation failed.
+ */
+static stodium_key_handle *stodium_key_handle_alloc(size_t length) {
+    stodium_key_handle *handle;
 
-STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1is_1available) (JNIEnv *jenv, jclass jcls) {
-       return (jint) crypto_aead_aes256gcm_is_available();
+    handle = (stodium_key_handle *) sodium_malloc(sizeof(stodium_key_handle) + length);
+    if (handle != NULL) {
+        handle->length = length;
+    }
+    return handle;
 }
 
-STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1encrypt_1detached) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject mac,
-        jobject src,
-        jobject ad,
-        jobject nonce,
+/**
+ * stodium_key_handle_new copies key into guarded native memory, and returns
+ * the address of the new handle (or 0 on failure). The handle must be released
+ * through stodium_key_handle_free.
+ */
+STODIUM_JNI(jlong, stodium_1key_1handle_1new) (JNIEnv *jenv, jclass jcls,
         jobject key) {
-    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &mac_buffer,   mac);
-    stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &ad_buffer,    ad);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer,   key);
- 
-    jint result = (jint) crypto_aead_aes256gcm_encrypt_detached(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_OUTPUT(unsigned char, mac_buffer),
-            //AS_OUTPUT_LEN(unsigned long long, mac_buffer),
-            NULL,
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, ad_buffer),
-            AS_INPUT_LEN(unsigned long long, ad_buffer),
-            NULL, // nsec
-            AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, key_buffer));
+    stodium_key_handle *handle;
+    stodium_buffer key_buffer;
+    stodium_get_buffer(jenv, &key_buffer, key);
 
-    stodium_release_output(jenv, dst,   &dst_buffer);
-    stodium_release_output(jenv, mac,   &mac_buffer);
-    stodium_release_input(jenv,  src,   &src_buffer);
-    stodium_release_input(jenv,  ad,    &ad_buffer);
-    stodium_release_input(jenv,  nonce, &nonce_buffer);
-    stodium_release_input(jenv,  key,   &key_buffer);
+    handle = stodium_key_handle_alloc(AS_INPUT_LEN(size_t, key_buffer));
+    if (handle != NULL) {
+        memcpy(handle->key, AS_INPUT(unsigned char, key_buffer), handle->length);
+        sodium_mprotect_readonly(handle);
+    }
 
-    return result;
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return (jlong) (intptr_t) handle;
 }
 
-STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1encrypt) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jobject ad,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &ad_buffer,    ad);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer,   key);
- 
-    jint result = (jint) crypto_aead_aes256gcm_encrypt(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            NULL,
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, ad_buffer),
-            AS_INPUT_LEN(unsigned long long, ad_buffer),
-            NULL, // nsec
-            AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, key_buffer));
+/**
+ * stodium_key_handle_random generates a random key of the given length
+ * directly in guarded native memory, so the key never enters the Java heap.
+ */
+STODIUM_JNI(jlong, stodium_1key_1handle_1random) (JNIEnv *jenv, jclass jcls,
+        jint length) {
+    stodium_key_handle *handle;
+
+    handle = stodium_key_handle_alloc((size_t) length);
+    if (handle != NULL) {
+        randombytes_buf(handle->key, handle->length);
+        sodium_mprotect_readonly(handle);
+    }
 
-    stodium_release_output(jenv, dst,   &dst_buffer);
-    stodium_release_input(jenv,  src,   &src_buffer);
-    stodium_release_input(jenv,  ad,    &ad_buffer);
-    stodium_release_input(jenv,  nonce, &nonce_buffer);
-    stodium_release_input(jenv,  key,   &key_buffer);
+    return (jlong) (intptr_t) handle;
+}
 
-    return result;
+STODIUM_JNI(jint, stodium_1key_1handle_1length) (JNIEnv *jenv, jclass jcls,
+        jlong handle) {
+    return (jint) ((stodium_key_handle *) (intptr_t) handle)->length;
 }
 
-STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1decrypt_1detached) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jobject mac,
-        jobject ad,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &mac_buffer,   mac);
-    stodium_get_buffer(jenv, &ad_buffer,    ad);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer,   key);
- 
-    jint result = (jint) crypto_aead_aes256gcm_decrypt_detached(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            NULL, // nsec
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_OUTPUT(unsigned char, mac_buffer),
-            AS_INPUT(unsigned char, ad_buffer),
-            AS_INPUT_LEN(unsigned long long, ad_buffer),
-            AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, key_buffer));
+STODIUM_JNI(void, stodium_1key_1handle_1free) (JNIEnv *jenv, jclass jcls,
+        jlong handle) {
+    sodium_free((void *) (intptr_t) handle);
+}
 
-    stodium_release_output(jenv, dst,   &dst_buffer);
-    stodium_release_input(jenv,  mac,   &mac_buffer);
-    stodium_release_input(jenv,  src,   &src_buffer);
-    stodium_release_input(jenv,  ad,    &ad_buffer);
-    stodium_release_input(jenv,  nonce, &nonce_buffer);
-    stodium_release_input(jenv,  key,   &key_buffer);
+/** ****************************************************************************
+ *
+ * FILES
+ *
+ **************************************************************************** */
 
-    return result;
-}
+/**
+ * STODIUM_FILE_WINDOW is the size of the window of a file that is mapped into
+ * memory at a time. It is a multiple of every supported page size, so only the
+ * first window of a range has to be aligned down to a page boundary.
+ */
+#define STODIUM_FILE_WINDOW ((size_t) 64 * 1024 * 1024)
 
-STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1decrypt) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jobject ad,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &ad_buffer,    ad);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer,   key);
- 
-    jint result = (jint) crypto_aead_aes256gcm_decrypt(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
-            NULL, // nsec
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, ad_buffer),
-            AS_INPUT_LEN(unsigned long long, ad_buffer),
-            AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, key_buffer));
-
-    stodium_release_output(jenv, dst,   &dst_buffer);
-    stodium_release_input(jenv,  src,   &src_buffer);
-    stodium_release_input(jenv,  ad,    &ad_buffer);
-    stodium_release_input(jenv,  nonce, &nonce_buffer);
-    stodium_release_input(jenv,  key,   &key_buffer);
+/**
+ * stodium_update_fn absorbs inlen bytes into a multipart state, and
+ * returns 0 on success.
+ */
+typedef int (*stodium_update_fn)(void *state, const unsigned char *in, size_t inlen);
 
-    return result;
-}
+/**
+ * stodium_file_digest_fn computes the (optionally keyed) digest of a range of
+ * the file behind fd, writing outlen bytes to out. The return value follows
+ * stodium_file_update.
+ */
+typedef int (*stodium_file_digest_fn)(int fd, jlong offset, jlong length,
+        unsigned char *out, size_t outlen,
+        const unsigned char *key, size_t keylen);
 
-/** ****************************************************************************
- *
- * AEAD - Chacha20Poly1305
+/**
+ * stodium_file_update maps length bytes of the file behind fd, starting at
+ * offset, into memory one window at a time, and passes each window to update.
+ * A negative length covers the rest of the file.
  *
- **************************************************************************** */
+ * Returns 0 on success, -1 if update failed, or the errno value of a failed
+ * I/O call. A range that extends past the end of the file fails with EINVAL.
+ * The file must not be truncated while it is being read, as accessing a page
+ * beyond the end of the file raises SIGBUS.
+ */
+static int stodium_file_update(int fd, jlong offset, jlong length,
+        stodium_update_fn update, void *state) {
+    struct stat info;
+    jlong       page;
 
-STODIUM_CONSTANT(aead, chacha20poly1305, keybytes)
-STODIUM_CONSTANT(aead, chacha20poly1305, nsecbytes)
-STODIUM_CONSTANT(aead, chacha20poly1305, npubbytes)
-STODIUM_CONSTANT(aead, chacha20poly1305, abytes)
+    if (offset < 0) {
+        return EINVAL;
+    }
+    if (fstat(fd, &info) != 0) {
+        return errno;
+    }
+    if (offset > (jlong) info.st_size) {
+        return EINVAL;
+    }
+    if (length < 0) {
+        length = (jlong) info.st_size - offset;
+    } else if (length > (jlong) info.st_size - offset) {
+        return EINVAL;
+    }
 
-STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1encrypt_1detached) (JNIEnv *jenv, jclass jcls,
+    page = (jlong) sysconf(_SC_PAGESIZE);
+    while (length > 0) {
+        jlong  base  = offset - offset % page;
+        size_t skip  = (size_t) (offset - base);
+        size_t chunk = STODIUM_FILE_WINDOW - skip;
+        void  *map;
+        int    result;
+
+        if ((jlong) chunk > length) {
+            chunk = (size_t) length;
+        }
+        if ((jlong) (off_t) base != base) {
+            return EOVERFLOW;
+        }
+
+        map = mmap(NULL, skip + chunk, PROT_READ, MAP_PRIVATE, fd, (off_t) base);
+        if (map == MAP_FAILED) {
+            return errno;
+        }
+        madvise(map, skip + chunk, MADV_SEQUENTIAL);
+
+        result = update(state, (const unsigned char *) map + skip, chunk);
+        munmap(map, skip + chunk);
+        if (result != 0) {
+            return -1;
+        }
+
+        offset += (jlong) chunk;
+        length -= (jlong) chunk;
+    }
+    return 0;
+}
+
+/**
+ * stodium_file_digest resolves the dst and key buffers, and runs digest over
+ * the given range of fd. The buffers are not pinned, as reading the file may
+ * take arbitrarily long.
+ */
+static jint stodium_file_digest(JNIEnv *jenv,
         jobject dst,
-        jobject mac,
-        jobject src,
-        jobject ad,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &mac_buffer,   mac);
-    stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &ad_buffer,    ad);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer,   key);
- 
-    jint result = (jint) crypto_aead_chacha20poly1305_encrypt_detached(
+        jobject key,
+        jint    fd,
+        jlong   offset,
+        jlong   length,
+        stodium_file_digest_fn digest) {
+    stodium_buffer dst_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) digest((int) fd, offset, length,
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_OUTPUT(unsigned char, mac_buffer),
-            AS_OUTPUT_LEN(unsigned long long, mac_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, ad_buffer),
-            AS_INPUT_LEN(unsigned long long, ad_buffer),
-            NULL, // nsec
-            AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, key_buffer));
+            AS_INPUT_LEN(size_t, dst_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT_LEN(size_t, key_buffer));
 
-    stodium_release_output(jenv, dst,   &dst_buffer);
-    stodium_release_output(jenv, mac,   &mac_buffer);
-    stodium_release_input(jenv,  src,   &src_buffer);
-    stodium_release_input(jenv,  ad,    &ad_buffer);
-    stodium_release_input(jenv,  nonce, &nonce_buffer);
-    stodium_release_input(jenv,  key,   &key_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1encrypt) (JNIEnv *jenv, jclass jcls,
+/**
+ * stodium_path_digest is the same as stodium_file_digest, for the file at the
+ * given path. The file is opened read-only for the duration of the call.
+ */
+static jint stodium_path_digest(JNIEnv *jenv,
         jobject dst,
-        jobject src,
-        jobject ad,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &ad_buffer,    ad);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer,   key);
- 
-    jint result = (jint) crypto_aead_chacha20poly1305_encrypt(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, ad_buffer),
-            AS_INPUT_LEN(unsigned long long, ad_buffer),
-            NULL, // nsec
-            AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, key_buffer));
+        jobject key,
+        jstring path,
+        jlong   offset,
+        jlong   length,
+        stodium_file_digest_fn digest) {
+    const char *name;
+    int         fd, error;
+    jint        result;
+
+    name = (*jenv)->GetStringUTFChars(jenv, path, NULL);
+    if (name == NULL) {
+        return ENOMEM; // OutOfMemoryError is pending
+    }
+    fd    = open(name, O_RDONLY | O_CLOEXEC);
+    error = errno;
+    (*jenv)->ReleaseStringUTFChars(jenv, path, name);
+    if (fd < 0) {
+        return (jint) error;
+    }
 
-    stodium_release_output(jenv, dst,   &dst_buffer);
-    stodium_release_input(jenv,  src,   &src_buffer);
-    stodium_release_input(jenv,  ad,    &ad_buffer);
-    stodium_release_input(jenv,  nonce, &nonce_buffer);
-    stodium_release_input(jenv,  key,   &key_buffer);
+    result = stodium_file_digest(jenv, dst, key, (jint) fd, offset, length, digest);
+    close(fd);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1decrypt_1detached) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jobject mac,
-        jobject ad,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &mac_buffer,   mac);
-    stodium_get_buffer(jenv, &ad_buffer,    ad);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer,   key);
- 
-    jint result = (jint) crypto_aead_chacha20poly1305_decrypt_detached(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            NULL, // nsec
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_OUTPUT(unsigned char, mac_buffer),
-            AS_INPUT(unsigned char, ad_buffer),
-            AS_INPUT_LEN(unsigned long long, ad_buffer),
-            AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, key_buffer));
+/** ****************************************************************************
+ *
+ * VECTORED UPDATES
+ *
+ **************************************************************************** */
 
-    stodium_release_output(jenv, dst,   &dst_buffer);
-    stodium_release_input(jenv,  mac,   &mac_buffer);
-    stodium_release_input(jenv,  src,   &src_buffer);
-    stodium_release_input(jenv,  ad,    &ad_buffer);
-    stodium_release_input(jenv,  nonce, &nonce_buffer);
-    stodium_release_input(jenv,  key,   &key_buffer);
+/**
+ * stodium_updatev passes length buffers of the srcs array, starting at index
+ * offset, to update in a single JNI call. Every buffer is resolved and
+ * released on its own, so heap buffers are only copied one at a time.
+ *
+ * Returns 0 on success, or -1 if update failed for any of the buffers.
+ */
+static jint stodium_updatev(JNIEnv *jenv,
+        jobject      state,
+        jobjectArray srcs,
+        jint         offset,
+        jint         length,
+        stodium_update_fn update) {
+    stodium_buffer state_buffer, src_buffer;
+    jint result = 0;
+    jint i;
 
-    return result;
-}
+    stodium_get_buffer(jenv, &state_buffer, state);
 
-STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1decrypt) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jobject ad,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &ad_buffer,    ad);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer,   key);
- 
-    jint result = (jint) crypto_aead_chacha20poly1305_decrypt(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
-            NULL, // nsec
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, ad_buffer),
-            AS_INPUT_LEN(unsigned long long, ad_buffer),
-            AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, key_buffer));
+    for (i = offset; i < offset + length && result == 0; i++) {
+        jobject src = (*jenv)->GetObjectArrayElement(jenv, srcs, (jsize) i);
+        stodium_get_buffer(jenv, &src_buffer, src);
 
-    stodium_release_output(jenv, dst,   &dst_buffer);
-    stodium_release_input(jenv,  src,   &src_buffer);
-    stodium_release_input(jenv,  ad,    &ad_buffer);
-    stodium_release_input(jenv,  nonce, &nonce_buffer);
-    stodium_release_input(jenv,  key,   &key_buffer);
+        if (update(AS_OUTPUT(void, state_buffer),
+                AS_INPUT(unsigned char, src_buffer),
+                AS_INPUT_LEN(size_t, src_buffer)) != 0) {
+            result = -1;
+        }
+
+        stodium_release_input(jenv, src, &src_buffer);
+        (*jenv)->DeleteLocalRef(jenv, src);
+    }
+
+    stodium_release_output(jenv, state, &state_buffer);
 
     return result;
 }
 
 /** ****************************************************************************
  *
- * AEAD - Chacha20Poly1305 (ietf)
+ * THREAD POOL
  *
  **************************************************************************** */
 
-STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1keybytes) (JNIEnv *jenv, jclass jcls) {
-       return (jint) crypto_aead_chacha20poly1305_ietf_keybytes();
-}
-STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1nsecbytes) (JNIEnv *jenv, jclass jcls) {
-       return (jint) crypto_aead_chacha20poly1305_ietf_nsecbytes();
-}
-STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1npubbytes) (JNIEnv *jenv, jclass jcls) {
-       return (jint) crypto_aead_chacha20poly1305_ietf_npubbytes();
+/**
+ * stodium_pool_task_fn runs task index of a job. The tasks of a job may run
+ * concurrently on the pool's worker threads, so they must only touch native
+ * memory and never call back into the JVM.
+ */
+typedef void (*stodium_pool_task_fn)(void *ctx, size_t index);
+
+typedef struct stodium_pool_jobs {
+    stodium_pool_task_fn      task;
+    void                     *ctx;
+    size_t                    count;    // number of tasks
+    size_t                    next;     // next task to be claimed
+    size_t                    finished; // number of completed tasks
+    struct stodium_pool_jobs *link;     // next job in the queue
+} stodium_pool_job;
+
+static pthread_mutex_t   stodium_g_pool_lock    = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t    stodium_g_pool_work    = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t    stodium_g_pool_done    = PTHREAD_COND_INITIALIZER;
+static stodium_pool_job *stodium_g_pool_queue   = NULL;
+static size_t            stodium_g_pool_threads = 0; // running workers
+static size_t            stodium_g_pool_target  = 0; // requested workers
+
+/**
+ * stodium_pool_take claims the next task of job, and removes the job from the
+ * queue once all of its tasks have been claimed. The pool lock must be held.
+ */
+static size_t stodium_pool_take(stodium_pool_job *job) {
+    stodium_pool_job **link;
+    size_t             index = job->next++;
+
+    if (job->next == job->count) {
+        for (link = &stodium_g_pool_queue; *link != NULL; link = &(*link)->link) {
+            if (*link == job) {
+                *link = job->link;
+                break;
+            }
+        }
+    }
+    return index;
 }
-STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1abytes) (JNIEnv *jenv, jclass jcls) {
-       return (jint) crypto_aead_chacha20poly1305_ietf_abytes();
+
+/**
+ * stodium_pool_complete marks a task of job as finished, and wakes up the
+ * thread waiting for the job once it is done. The pool lock must be held.
+ */
+static void stodium_pool_complete(stodium_pool_job *job) {
+    if (++job->finished == job->count) {
+        pthread_cond_broadcast(&stodium_g_pool_done);
+    }
 }
 
-STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1encrypt_1detached) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject mac,
-        jobject src,
-        jobject ad,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &mac_buffer,   mac);
-    stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &ad_buffer,    ad);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer,   key);
- 
-    jint result = (jint) crypto_aead_chacha20poly1305_ietf_encrypt_detached(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_OUTPUT(unsigned char, mac_buffer),
-            AS_OUTPUT_LEN(unsigned long long, mac_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, ad_buffer),
-            AS_INPUT_LEN(unsigned long long, ad_buffer),
-            NULL, // nsec
-            AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, key_buffer));
+static void *stodium_pool_worker(void *arg) {
+    stodium_pool_job *job;
+    size_t            index;
 
-    stodium_release_output(jenv, dst,   &dst_buffer);
-    stodium_release_output(jenv, mac,   &mac_buffer);
-    stodium_release_input(jenv,  src,   &src_buffer);
-    stodium_release_input(jenv,  ad,    &ad_buffer);
-    stodium_release_input(jenv,  nonce, &nonce_buffer);
-    stodium_release_input(jenv,  key,   &key_buffer);
+    pthread_mutex_lock(&stodium_g_pool_lock);
+    for (;;) {
+        while (stodium_g_pool_queue == NULL && stodium_g_pool_threads <= stodium_g_pool_target) {
+            pthread_cond_wait(&stodium_g_pool_work, &stodium_g_pool_lock);
+        }
+        if (stodium_g_pool_threads > stodium_g_pool_target) {
+            break; // the pool has been shrunk
+        }
 
-    return result;
+        job   = stodium_g_pool_queue;
+        index = stodium_pool_take(job);
+
+        pthread_mutex_unlock(&stodium_g_pool_lock);
+        job->task(job->ctx, index);
+        pthread_mutex_lock(&stodium_g_pool_lock);
+
+        stodium_pool_complete(job);
+    }
+    stodium_g_pool_threads--;
+    pthread_mutex_unlock(&stodium_g_pool_lock);
+
+    return NULL;
 }
 
-STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1encrypt) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-	jint dst_offset,
-        jobject src,
-	jint src_offset,
-	jint src_limit,
-        jobject ad,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &ad_buffer,    ad);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer,   key);
- 
-    jint result = (jint) crypto_aead_chacha20poly1305_ietf_encrypt(
-            AS_OUTPUT(unsigned char, dst_buffer)+dst_offset,
-            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
-            AS_INPUT(unsigned char, src_buffer)+src_offset,
-            (unsigned long long)src_limit,//AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, ad_buffer),
-            AS_INPUT_LEN(unsigned long long, ad_buffer),
-            NULL, // nsec
-            AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, key_buffer));
+/**
+ * stodium_pool_run runs count tasks, and returns once all of them finished.
+ * The calling thread works on its own job alongside the pool's workers, so a
+ * job always completes, even when the pool has no threads at all. Jobs from
+ * different threads are served in the order they were queued.
+ */
+static void stodium_pool_run(stodium_pool_task_fn task, void *ctx, size_t count) {
+    stodium_pool_job   job = { task, ctx, count, 0, 0, NULL };
+    stodium_pool_job **tail;
+    size_t             index;
 
-    stodium_release_output(jenv, dst,   &dst_buffer);
-    stodium_release_input(jenv,  src,   &src_buffer);
-    stodium_release_input(jenv,  ad,    &ad_buffer);
-    stodium_release_input(jenv,  nonce, &nonce_buffer);
-    stodium_release_input(jenv,  key,   &key_buffer);
+    if (count == 0) {
+        return;
+    }
 
-    return result;
+    pthread_mutex_lock(&stodium_g_pool_lock);
+    if (count > 1 && stodium_g_pool_threads > 0) {
+        for (tail = &stodium_g_pool_queue; *tail != NULL; tail = &(*tail)->link);
+        *tail = &job;
+        pthread_cond_broadcast(&stodium_g_pool_work);
+    }
+
+    while (job.next < job.count) {
+        index = stodium_pool_take(&job);
+
+        pthread_mutex_unlock(&stodium_g_pool_lock);
+        task(ctx, index);
+        pthread_mutex_lock(&stodium_g_pool_lock);
+
+        stodium_pool_complete(&job);
+    }
+    while (job.finished < job.count) {
+        pthread_cond_wait(&stodium_g_pool_done, &stodium_g_pool_lock);
+    }
+    pthread_mutex_unlock(&stodium_g_pool_lock);
 }
 
-STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1decrypt_1detached) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jobject mac,
-        jobject ad,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &mac_buffer,   mac);
-    stodium_get_buffer(jenv, &ad_buffer,    ad);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer,   key);
- 
-    jint result = (jint) crypto_aead_chacha20poly1305_ietf_decrypt_detached(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            NULL, // nsec
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_OUTPUT(unsigned char, mac_buffer),
-            AS_INPUT(unsigned char, ad_buffer),
-            AS_INPUT_LEN(unsigned long long, ad_buffer),
-            AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, key_buffer));
+/**
+ * stodium_pool_set_threads resizes the pool to the given number of worker
+ * threads, and returns the resulting size, which is smaller than requested if
+ * not all threads could be started. Surplus workers exit once they are idle.
+ */
+STODIUM_JNI(jint, stodium_1pool_1set_1threads) (JNIEnv *jenv, jclass jcls,
+        jint threads) {
+    pthread_attr_t attr;
+    pthread_t      thread;
+    jint           result;
+
+    pthread_mutex_lock(&stodium_g_pool_lock);
+    stodium_g_pool_target = (size_t) threads;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    while (stodium_g_pool_threads < stodium_g_pool_target) {
+        if (pthread_create(&thread, &attr, stodium_pool_worker, NULL) != 0) {
+            stodium_g_pool_target = stodium_g_pool_threads;
+            break;
+        }
+        stodium_g_pool_threads++;
+    }
+    pthread_attr_destroy(&attr);
 
-    stodium_release_output(jenv, dst,   &dst_buffer);
-    stodium_release_input(jenv,  mac,   &mac_buffer);
-    stodium_release_input(jenv,  src,   &src_buffer);
-    stodium_release_input(jenv,  ad,    &ad_buffer);
-    stodium_release_input(jenv,  nonce, &nonce_buffer);
-    stodium_release_input(jenv,  key,   &key_buffer);
+    pthread_cond_broadcast(&stodium_g_pool_work);
+    result = (jint) stodium_g_pool_target;
+    pthread_mutex_unlock(&stodium_g_pool_lock);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1decrypt) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-	jint dst_offset,
-        jobject src,
-	jint src_offset,
-	jint src_length,
-        jobject ad,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &ad_buffer,    ad);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer,   key);
- 
-    jint result = (jint) crypto_aead_chacha20poly1305_ietf_decrypt(
-            AS_OUTPUT(unsigned char, dst_buffer) + dst_offset,
-            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
-            NULL, // nsec
-            AS_INPUT(unsigned char, src_buffer) + src_offset,
-            (unsigned long long)src_length, //AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, ad_buffer),
-            AS_INPUT_LEN(unsigned long long, ad_buffer),
-            AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, key_buffer));
+STODIUM_JNI(jint, stodium_1pool_1threads) (JNIEnv *jenv, jclass jcls) {
+    jint result;
 
-    stodium_release_output(jenv, dst,   &dst_buffer);
-    stodium_release_input(jenv,  src,   &src_buffer);
-    stodium_release_input(jenv,  ad,    &ad_buffer);
-    stodium_release_input(jenv,  nonce, &nonce_buffer);
-    stodium_release_input(jenv,  key,   &key_buffer);
+    pthread_mutex_lock(&stodium_g_pool_lock);
+    result = (jint) stodium_g_pool_target;
+    pthread_mutex_unlock(&stodium_g_pool_lock);
 
     return result;
 }
 
+/** ****************************************************************************
+ *
+ * KEY AGREEMENT BATCHES
+ *
+ **************************************************************************** */
+
+/**
+ * stodium_dh_fn computes the result of a key agreement between the local key
+ * pair (pk, sk) and a single peer public key. Functions that only produce a
+ * single output ignore tx, and functions that do not need the local public
+ * key ignore pk.
+ */
+typedef int (*stodium_dh_fn)(unsigned char *rx, unsigned char *tx,
+        const unsigned char *pk, const unsigned char *sk, const unsigned char *peer);
+
+/**
+ * stodium_dh_job runs a key agreement function for a batch of peers, as one
+ * task per peer. Output i is written at offset i * outbytes of rx (and tx),
+ * and the status of every peer is stored in status.
+ */
+typedef struct stodium_dh_jobs {
+    stodium_dh_fn        fn;
+    unsigned char       *rx;
+    unsigned char       *tx;
+    size_t               outbytes;
+    const unsigned char *pk;
+    const unsigned char *sk;
+    const unsigned char *peers;
+    size_t               peerbytes;
+    jint                *status;
+    int                  failed;
+} stodium_dh_job;
+
+static void stodium_dh_task(void *ctx, size_t index) {
+    stodium_dh_job *job = (stodium_dh_job *) ctx;
+
+    int result = job->fn(
+            job->rx + index * job->outbytes,
+            job->tx == NULL ? NULL : job->tx + index * job->outbytes,
+            job->pk,
+            job->sk,
+            job->peers + index * job->peerbytes);
+
+    job->status[index] = (jint) result;
+    if (result != 0) {
+        __sync_fetch_and_add(&job->failed, 1);
+    }
+}
+
+/**
+ * stodium_dh_batch runs fn against every public key in peers (back to back,
+ * peerbytes each) in a single JNI call, and returns the number of peers for
+ * which it failed. The length of status determines the number of peers. When
+ * parallel is set the batch is spread over the thread pool, otherwise it runs
+ * on the calling thread only. tx and pk may be NULL for functions that do not
+ * use them. The Java layer validates the buffer sizes up front. If the VM
+ * cannot pin status, -1 is returned with an OutOfMemoryError pending.
+ */
+static jint stodium_dh_batch(JNIEnv *jenv,
+        stodium_dh_fn fn,
+        size_t    outbytes,
+        size_t    peerbytes,
+        jobject   rx,
+        jobject   tx,
+        jobject   pk,
+        jobject   sk,
+        jobject   peers,
+        jintArray status,
+        jboolean  parallel) {
+    stodium_buffer rx_buffer, tx_buffer, pk_buffer, sk_buffer, peers_buffer;
+    stodium_dh_job job;
+    size_t         count, i;
+
+    count = (size_t) (*jenv)->GetArrayLength(jenv, status);
+
+    stodium_get_buffer(jenv, &rx_buffer,    rx);
+    stodium_get_buffer(jenv, &tx_buffer,    tx);
+    stodium_get_buffer(jenv, &pk_buffer,    pk);
+    stodium_get_buffer(jenv, &sk_buffer,    sk);
+    stodium_get_buffer(jenv, &peers_buffer, peers);
+
+    job.fn        = fn;
+    job.rx        = AS_OUTPUT(unsigned char, rx_buffer);
+    job.tx        = tx == NULL ? NULL : AS_OUTPUT(unsigned char, tx_buffer);
+    job.outbytes  = outbytes;
+    job.pk        = pk == NULL ? NULL : AS_INPUT(unsigned char, pk_buffer);
+    job.sk        = AS_INPUT(unsigned char, sk_buffer);
+    job.peers     = AS_INPUT(unsigned char, peers_buffer);
+    job.peerbytes = peerbytes;
+    job.status    = (*jenv)->GetIntArrayElements(jenv, status, NULL);
+    job.failed    = 0;
+
+    if (job.status == NULL) {
+        stodium_release_input(jenv, rx, &rx_buffer);
+        stodium_release_input(jenv, tx, &tx_buffer);
+        stodium_release_input(jenv, pk, &pk_buffer);
+        stodium_release_input(jenv, sk, &sk_buffer);
+        stodium_release_input(jenv, peers, &peers_buffer);
+        return -1;
+    }
+
+    if (parallel) {
+        stodium_pool_run(stodium_dh_task, &job, count);
+    } else {
+        for (i = 0; i < count; i++) {
+            stodium_dh_task(&job, i);
+        }
+    }
+
+    (*jenv)->ReleaseIntArrayElements(jenv, status, job.status, 0);
+
+    stodium_release_output(jenv, rx, &rx_buffer);
+    stodium_release_output(jenv, tx, &tx_buffer);
+    stodium_release_input(jenv, pk, &pk_buffer);
+    stodium_release_input(jenv, sk, &sk_buffer);
+    stodium_release_input(jenv, peers, &peers_buffer);
+
+    return (jint) job.failed;
+}
 
 /** ****************************************************************************
  *
- * AEAD - XChacha20Poly1305 (ietf)
+ * SCATTER/GATHER
  *
  **************************************************************************** */
 
-STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1keybytes) (JNIEnv *jenv, jclass jcls) {
-       return (jint) crypto_aead_xchacha20poly1305_ietf_keybytes();
+/**
+ * STODIUM_STREAM_BLOCKBYTES is the block size of the Salsa20 and ChaCha20
+ * based stream ciphers, which the block counter passed to xor_ic counts in.
+ */
+#define STODIUM_STREAM_BLOCKBYTES 64U
+
+/**
+ * stodium_stream_xor_ic_fn matches the xor_ic functions of the stream ciphers,
+ * with the block counter widened to 64 bits.
+ */
+typedef int (*stodium_stream_xor_ic_fn)(unsigned char *c, const unsigned char *m,
+        unsigned long long mlen, const unsigned char *n, uint64_t ic, const unsigned char *k);
+
+/**
+ * stodium_stream_chacha20_ietf_xor_ic adapts the 32 bit block counter of the
+ * ietf variant to stodium_stream_xor_ic_fn. The counter is range checked by
+ * the Java code.
+ */
+static int stodium_stream_chacha20_ietf_xor_ic(unsigned char *c, const unsigned char *m,
+        unsigned long long mlen, const unsigned char *n, uint64_t ic, const unsigned char *k) {
+    return crypto_stream_chacha20_ietf_xor_ic(c, m, mlen, n, (uint32_t) ic, k);
 }
-STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1nsecbytes) (JNIEnv *jenv, jclass jcls) {
-       return (jint) crypto_aead_xchacha20poly1305_ietf_nsecbytes();
+
+/**
+ * stodium_segments walks the buffers of a ByteBuffer[] as if they were a
+ * single run of bytes. Only the current buffer is resolved at any time, so
+ * heap buffers are copied in (and written back) one at a time.
+ */
+typedef struct stodium_segment_lists {
+    JNIEnv        *jenv;
+    jobjectArray   array;
+    jsize          count;
+    jsize          index;   // index of the current buffer
+    jobject        current; // NULL if no buffer is resolved
+    stodium_buffer buffer;
+    size_t         used;    // bytes of the current buffer consumed
+    bool           output;
+} stodium_segments;
+
+static void stodium_segments_open(stodium_segments *segs, JNIEnv *jenv,
+        jobjectArray array, bool output) {
+    segs->jenv    = jenv;
+    segs->array   = array;
+    segs->count   = (*jenv)->GetArrayLength(jenv, array);
+    segs->index   = -1;
+    segs->current = NULL;
+    segs->used    = 0;
+    segs->output  = output;
+}
+
+static void stodium_segments_close(stodium_segments *segs) {
+    if (segs->current == NULL) {
+        return;
+    }
+    if (segs->output) {
+        stodium_release_output(segs->jenv, segs->current, &segs->buffer);
+    } else {
+        stodium_release_input(segs->jenv, segs->current, &segs->buffer);
+    }
+    (*segs->jenv)->DeleteLocalRef(segs->jenv, segs->current);
+    segs->current = NULL;
 }
-STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1npubbytes) (JNIEnv *jenv, jclass jcls) {
-       return (jint) crypto_aead_xchacha20poly1305_ietf_npubbytes();
+
+/**
+ * stodium_segments_peek stores the address of the next unconsumed byte in ptr,
+ * moving on to the next non-empty buffer when the current one is used up, and
+ * returns the number of bytes left in that buffer. Returns 0 once all buffers
+ * have been consumed.
+ */
+static size_t stodium_segments_peek(stodium_segments *segs, unsigned char **ptr) {
+    while (segs->current == NULL || segs->used == segs->buffer.capacity) {
+        stodium_segments_close(segs);
+        if (segs->index + 1 >= segs->count) {
+            return 0;
+        }
+        segs->index++;
+        segs->current = (*segs->jenv)->GetObjectArrayElement(segs->jenv, segs->array, segs->index);
+        stodium_get_buffer(segs->jenv, &segs->buffer, segs->current);
+        segs->used = 0;
+    }
+
+    *ptr = AS_OUTPUT(unsigned char, segs->buffer) + segs->used;
+    return segs->buffer.capacity - segs->used;
 }
-STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1abytes) (JNIEnv *jenv, jclass jcls) {
-       return (jint) crypto_aead_xchacha20poly1305_ietf_abytes();
+
+/**
+ * stodium_keystream is a cursor into the keystream of a stream cipher, which
+ * allows a message to be encrypted in pieces of any length. Whole blocks are
+ * passed straight to xor_ic; the keystream of a block that is only partially
+ * used is kept in block.
+ */
+typedef struct stodium_keystreams {
+    stodium_stream_xor_ic_fn xor_ic;
+    const unsigned char     *n;
+    const unsigned char     *k;
+    uint64_t                 ic;   // counter of the next block
+    unsigned char            block[STODIUM_STREAM_BLOCKBYTES];
+    size_t                   used; // bytes of block already used
+} stodium_keystream;
+
+static int stodium_keystream_xor(stodium_keystream *ks,
+        unsigned char *c, const unsigned char *m, size_t mlen) {
+    size_t take, i;
+    int    result;
+
+    while (mlen > 0) {
+        if (ks->used < STODIUM_STREAM_BLOCKBYTES) {
+            take = STODIUM_STREAM_BLOCKBYTES - ks->used;
+            if (take > mlen) {
+                take = mlen;
+            }
+            for (i = 0; i < take; i++) {
+                c[i] = m[i] ^ ks->block[ks->used + i];
+            }
+            ks->used += take;
+        } else if (mlen >= STODIUM_STREAM_BLOCKBYTES) {
+            take   = mlen - mlen % STODIUM_STREAM_BLOCKBYTES;
+            result = ks->xor_ic(c, m, (unsigned long long) take, ks->n, ks->ic, ks->k);
+            if (result != 0) {
+                return result;
+            }
+            ks->ic += take / STODIUM_STREAM_BLOCKBYTES;
+        } else {
+            memset(ks->block, 0, sizeof ks->block);
+            result = ks->xor_ic(ks->block, ks->block, sizeof ks->block, ks->n, ks->ic, ks->k);
+            if (result != 0) {
+                return result;
+            }
+            ks->ic++;
+            ks->used = 0;
+            continue;
+        }
+
+        c    += take;
+        m    += take;
+        mlen -= take;
+    }
+
+    return 0;
 }
 
-STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt_1detached) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject mac,
-        jobject src,
-        jobject ad,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
+/**
+ * stodium_sg_mode selects how a construction feeds the Poly1305 MAC:
+ * - STODIUM_SG_AEAD_IETF: ad, padding, c, padding, both lengths (RFC 7539)
+ * - STODIUM_SG_AEAD: ad, its length, c, its length (original chacha20poly1305)
+ * - STODIUM_SG_SECRETBOX: c only, with the message keystream starting right
+ *   after the Poly1305 key rather than at the next block
+ */
+typedef enum stodium_sg_modes {
+    STODIUM_SG_AEAD_IETF,
+    STODIUM_SG_AEAD,
+    STODIUM_SG_SECRETBOX
+} stodium_sg_mode;
+
+/**
+ * stodium_sg_construction describes one of the stream cipher + Poly1305
+ * constructions. Extended nonce variants first derive a subkey from the key
+ * and the first 16 bytes of the nonce; the stream nonce is then the rest of
+ * the nonce, prefixed with nonce_pad zero bytes.
+ */
+typedef struct stodium_sg_constructions {
+    stodium_sg_mode          mode;
+    stodium_stream_xor_ic_fn xor_ic;
+    size_t                   npubbytes;
+    int                    (*subkey)(unsigned char *out, const unsigned char *in,
+                                     const unsigned char *k, const unsigned char *c);
+    size_t                   nonce_pad;
+} stodium_sg_construction;
+
+/**
+ * STODIUM_SG_NONCEBYTES_MAX is the largest stream nonce used by any of the
+ * constructions.
+ */
+#define STODIUM_SG_NONCEBYTES_MAX 24U
+
+/**
+ * stodium_sg_context holds the state of a single scatter/gather seal or open.
+ */
+typedef struct stodium_sg_contexts {
+    crypto_onetimeauth_poly1305_state mac;
+    stodium_keystream                 ks;
+    unsigned char                     subkey[32];
+    unsigned char                     nonce[STODIUM_SG_NONCEBYTES_MAX];
+} stodium_sg_context;
+
+static void stodium_sg_pad16(crypto_onetimeauth_poly1305_state *mac, unsigned long long len) {
+    static const unsigned char zero[16];
+
+    if ((len & 15) != 0) {
+        crypto_onetimeauth_poly1305_update(mac, zero, 16 - (len & 15));
+    }
+}
+
+static void stodium_sg_length(crypto_onetimeauth_poly1305_state *mac, unsigned long long len) {
+    unsigned char le[8];
+    size_t        i;
+
+    for (i = 0; i < sizeof le; i++) {
+        le[i] = (unsigned char) (len >> (8 * i));
+    }
+    crypto_onetimeauth_poly1305_update(mac, le, sizeof le);
+}
+
+/**
+ * stodium_sg_begin sets up the keystream, takes the Poly1305 key from the
+ * first block, and absorbs the additional data.
+ */
+static int stodium_sg_begin(stodium_sg_context *ctx, const stodium_sg_construction *con,
+        const unsigned char *ad, unsigned long long adlen,
+        const unsigned char *npub, const unsigned char *k) {
+    stodium_keystream *ks = &ctx->ks;
+    int result;
+
+    ks->xor_ic = con->xor_ic;
+    ks->n      = npub;
+    ks->k      = k;
+    if (con->subkey != NULL) {
+        memset(ctx->nonce, 0, sizeof ctx->nonce);
+        memcpy(ctx->nonce + con->nonce_pad, npub + 16, con->npubbytes - 16);
+        if (con->subkey(ctx->subkey, npub, k, NULL) != 0) {
+            return -1;
+        }
+        ks->n = ctx->nonce;
+        ks->k = ctx->subkey;
+    }
+
+    memset(ks->block, 0, sizeof ks->block);
+    result = ks->xor_ic(ks->block, ks->block, sizeof ks->block, ks->n, 0, ks->k);
+    if (result != 0) {
+        return result;
+    }
+    ks->ic   = 1;
+    ks->used = con->mode == STODIUM_SG_SECRETBOX ? 32 : STODIUM_STREAM_BLOCKBYTES;
+
+    crypto_onetimeauth_poly1305_init(&ctx->mac, ks->block);
+    if (con->mode != STODIUM_SG_SECRETBOX) {
+        crypto_onetimeauth_poly1305_update(&ctx->mac, ad, adlen);
+    }
+    if (con->mode == STODIUM_SG_AEAD_IETF) {
+        stodium_sg_pad16(&ctx->mac, adlen);
+    } else if (con->mode == STODIUM_SG_AEAD) {
+        stodium_sg_length(&ctx->mac, adlen);
+    }
+
+    return 0;
+}
+
+/**
+ * stodium_sg_end absorbs the trailer of the MAC input and writes the tag.
+ */
+static void stodium_sg_end(stodium_sg_context *ctx, const stodium_sg_construction *con,
+        unsigned long long adlen, unsigned long long clen, unsigned char *tag) {
+    if (con->mode == STODIUM_SG_AEAD_IETF) {
+        stodium_sg_pad16(&ctx->mac, clen);
+        stodium_sg_length(&ctx->mac, adlen);
+        stodium_sg_length(&ctx->mac, clen);
+    } else if (con->mode == STODIUM_SG_AEAD) {
+        stodium_sg_length(&ctx->mac, clen);
+    }
+    crypto_onetimeauth_poly1305_final(&ctx->mac, tag);
+}
+
+/**
+ * stodium_sg_xor xors the bytes of src with the keystream into dst, where the
+ * buffer boundaries of src and dst need not line up. If mac is not NULL, the
+ * output is absorbed into it. The number of bytes processed is added to
+ * total. Fails if dst runs out before src does.
+ */
+static int stodium_sg_xor(stodium_segments *dst, stodium_segments *src,
+        stodium_keystream *ks, crypto_onetimeauth_poly1305_state *mac,
+        unsigned long long *total) {
+    unsigned char *in, *out;
+    size_t         len, avail;
+
+    while ((len = stodium_segments_peek(src, &in)) > 0) {
+        avail = stodium_segments_peek(dst, &out);
+        if (avail == 0) {
+            return -1;
+        }
+        if (len > avail) {
+            len = avail;
+        }
+        if (stodium_keystream_xor(ks, out, in, len) != 0) {
+            return -1;
+        }
+        if (mac != NULL) {
+            crypto_onetimeauth_poly1305_update(mac, out, len);
+        }
+        src->used += len;
+        dst->used += len;
+        *total    += len;
+    }
+
+    return 0;
+}
+
+/**
+ * stodium_sg_seal encrypts the buffers of srcs into the buffers of dsts,
+ * writing the detached tag to mac.
+ */
+static jint stodium_sg_seal(JNIEnv *jenv, const stodium_sg_construction *con,
+        jobjectArray dsts,
+        jobject      mac,
+        jobjectArray srcs,
+        jobject      ad,
+        jobject      nonce,
+        jobject      key) {
+    stodium_sg_context ctx;
+    stodium_segments   dst_segs, src_segs;
+    stodium_buffer     mac_buffer, ad_buffer, nonce_buffer, key_buffer;
+    unsigned long long clen = 0;
+    jint               result;
+
     stodium_get_buffer(jenv, &mac_buffer,   mac);
-    stodium_get_buffer(jenv, &src_buffer,   src);
     stodium_get_buffer(jenv, &ad_buffer,    ad);
     stodium_get_buffer(jenv, &nonce_buffer, nonce);
     stodium_get_buffer(jenv, &key_buffer,   key);
- 
-    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_encrypt_detached(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_OUTPUT(unsigned char, mac_buffer),
-            AS_OUTPUT_LEN(unsigned long long, mac_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
+
+    result = (jint) stodium_sg_begin(&ctx, con,
             AS_INPUT(unsigned char, ad_buffer),
             AS_INPUT_LEN(unsigned long long, ad_buffer),
-            NULL, // nsec
             AS_INPUT(unsigned char, nonce_buffer),
             AS_INPUT(unsigned char, key_buffer));
+    if (result == 0) {
+        stodium_segments_open(&dst_segs, jenv, dsts, true);
+        stodium_segments_open(&src_segs, jenv, srcs, false);
+        result = (jint) stodium_sg_xor(&dst_segs, &src_segs, &ctx.ks, &ctx.mac, &clen);
+        stodium_segments_close(&dst_segs);
+        stodium_segments_close(&src_segs);
+    }
+    if (result == 0) {
+        stodium_sg_end(&ctx, con, AS_INPUT_LEN(unsigned long long, ad_buffer), clen,
+                AS_OUTPUT(unsigned char, mac_buffer));
+    }
+    sodium_memzero(&ctx, sizeof ctx);
 
-    stodium_release_output(jenv, dst,   &dst_buffer);
     stodium_release_output(jenv, mac,   &mac_buffer);
-    stodium_release_input(jenv,  src,   &src_buffer);
     stodium_release_input(jenv,  ad,    &ad_buffer);
     stodium_release_input(jenv,  nonce, &nonce_buffer);
     stodium_release_input(jenv,  key,   &key_buffer);
@@ -757,67 +1531,464 @@ STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt_1detached) (JNI
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jobject ad,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &src_buffer,   src);
+/**
+ * stodium_sg_open verifies the tag over the buffers of srcs, and only then
+ * decrypts them into the buffers of dsts, so nothing is written on failure.
+ */
+static jint stodium_sg_open(JNIEnv *jenv, const stodium_sg_construction *con,
+        jobjectArray dsts,
+        jobjectArray srcs,
+        jobject      mac,
+        jobject      ad,
+        jobject      nonce,
+        jobject      key) {
+    stodium_sg_context ctx;
+    stodium_segments   dst_segs, src_segs;
+    stodium_buffer     mac_buffer, ad_buffer, nonce_buffer, key_buffer;
+    unsigned char      tag[crypto_onetimeauth_poly1305_BYTES];
+    unsigned char     *in;
+    unsigned long long clen = 0;
+    size_t             len;
+    jint               result;
+
+    stodium_get_buffer(jenv, &mac_buffer,   mac);
     stodium_get_buffer(jenv, &ad_buffer,    ad);
     stodium_get_buffer(jenv, &nonce_buffer, nonce);
     stodium_get_buffer(jenv, &key_buffer,   key);
- 
-    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_encrypt(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
+
+    result = (jint) stodium_sg_begin(&ctx, con,
             AS_INPUT(unsigned char, ad_buffer),
             AS_INPUT_LEN(unsigned long long, ad_buffer),
-            NULL, // nsec
             AS_INPUT(unsigned char, nonce_buffer),
             AS_INPUT(unsigned char, key_buffer));
+    if (result == 0) {
+        stodium_segments_open(&src_segs, jenv, srcs, false);
+        while ((len = stodium_segments_peek(&src_segs, &in)) > 0) {
+            crypto_onetimeauth_poly1305_update(&ctx.mac, in, len);
+            src_segs.used += len;
+            clen          += len;
+        }
+        stodium_segments_close(&src_segs);
+
+        stodium_sg_end(&ctx, con, AS_INPUT_LEN(unsigned long long, ad_buffer), clen, tag);
+        result = (jint) crypto_verify_16(tag, AS_INPUT(unsigned char, mac_buffer));
+    }
+    if (result == 0) {
+        clen = 0;
+        stodium_segments_open(&dst_segs, jenv, dsts, true);
+        stodium_segments_open(&src_segs, jenv, srcs, false);
+        result = (jint) stodium_sg_xor(&dst_segs, &src_segs, &ctx.ks, NULL, &clen);
+        stodium_segments_close(&dst_segs);
+        stodium_segments_close(&src_segs);
+    }
+    sodium_memzero(&ctx, sizeof ctx);
 
-    stodium_release_output(jenv, dst,   &dst_buffer);
-    stodium_release_input(jenv,  src,   &src_buffer);
-    stodium_release_input(jenv,  ad,    &ad_buffer);
-    stodium_release_input(jenv,  nonce, &nonce_buffer);
-    stodium_release_input(jenv,  key,   &key_buffer);
+    stodium_release_input(jenv, mac,   &mac_buffer);
+    stodium_release_input(jenv, ad,    &ad_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key,   &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt_1detached) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jobject mac,
-        jobject ad,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+/** ****************************************************************************
+ *
+ * AEAD
+ *
+ **************************************************************************** */
+
+/**
+ * stodium_aead_encrypt_fn and stodium_aead_decrypt_fn match the combined mode
+ * encrypt and decrypt functions shared by all AEAD constructions in libsodium.
+ */
+typedef int (*stodium_aead_encrypt_fn)(unsigned char *c, unsigned long long *clen_p,
+        const unsigned char *m, unsigned long long mlen,
+        const unsigned char *ad, unsigned long long adlen,
+        const unsigned char *nsec, const unsigned char *npub, const unsigned char *k);
+typedef int (*stodium_aead_decrypt_fn)(unsigned char *m, unsigned long long *mlen_p,
+        unsigned char *nsec,
+        const unsigned char *c, unsigned long long clen,
+        const unsigned char *ad, unsigned long long adlen,
+        const unsigned char *npub, const unsigned char *k);
+
+/**
+ * stodium_aead_batch runs either the encrypt or the decrypt function of an AEAD
+ * construction over a batch of messages in a single JNI call. The messages are
+ * laid out in the dst, src and ad buffers at the given offsets (relative to the
+ * position of each buffer), the nonces are stored back to back in the nonces
+ * buffer, and all messages share the same key. The ad buffer and its offset
+ * and length arrays may be NULL.
+ *
+ * The buffers are accessed through the copying path rather than a critical
+ * section, as a batch can take long enough to stall the garbage collector.
+ *
+ * The libsodium status of every message is written to status, and the number
+ * of failed messages is returned. The Java layer validates all descriptors
+ * before calling into the batch. If the VM cannot pin one of the int arrays,
+ * -1 is returned with an OutOfMemoryError pending.
+ */
+static jint stodium_aead_batch(JNIEnv *jenv,
+        stodium_aead_encrypt_fn encrypt,
+        stodium_aead_decrypt_fn decrypt,
+        size_t    npubbytes,
+        jobject   dst,
+        jintArray dst_offsets,
+        jobject   src,
+        jintArray src_offsets,
+        jintArray src_lengths,
+        jobject   ad,
+        jintArray ad_offsets,
+        jintArray ad_lengths,
+        jobject   nonces,
+        jobject   key,
+        jintArray status) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    jint  *dst_off, *src_off, *src_len, *ad_off, *ad_len, *result;
+    jsize  count, i;
+    jint   failed = 0;
+
+    count = (*jenv)->GetArrayLength(jenv, status);
+
     stodium_get_buffer(jenv, &dst_buffer,   dst);
     stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &mac_buffer,   mac);
     stodium_get_buffer(jenv, &ad_buffer,    ad);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &nonce_buffer, nonces);
     stodium_get_buffer(jenv, &key_buffer,   key);
+
+    dst_off = (*jenv)->GetIntArrayElements(jenv, dst_offsets, NULL);
+    src_off = (*jenv)->GetIntArrayElements(jenv, src_offsets, NULL);
+    src_len = (*jenv)->GetIntArrayElements(jenv, src_lengths, NULL);
+    ad_off  = ad_offsets == NULL ? NULL : (*jenv)->GetIntArrayElements(jenv, ad_offsets, NULL);
+    ad_len  = ad_lengths == NULL ? NULL : (*jenv)->GetIntArrayElements(jenv, ad_lengths, NULL);
+    result  = (*jenv)->GetIntArrayElements(jenv, status, NULL);
+
+    if (dst_off == NULL || src_off == NULL || src_len == NULL || result == NULL
+            || (ad_offsets != NULL && ad_off == NULL) || (ad_lengths != NULL && ad_len == NULL)) {
+        failed = -1;
+        goto release;
+    }
+
+    for (i = 0; i < count; i++) {
+        const unsigned char *ad_ptr = NULL;
+        unsigned long long   ad_size = 0;
+
+        if (ad_off != NULL && ad_len != NULL) {
+            ad_ptr  = AS_INPUT(unsigned char, ad_buffer) + ad_off[i];
+            ad_size = (unsigned long long) ad_len[i];
+        }
+
+        if (encrypt != NULL) {
+            result[i] = (jint) encrypt(
+                    AS_OUTPUT(unsigned char, dst_buffer) + dst_off[i],
+                    NULL,
+                    AS_INPUT(unsigned char, src_buffer) + src_off[i],
+                    (unsigned long long) src_len[i],
+                    ad_ptr,
+                    ad_size,
+                    NULL, // nsec
+                    AS_INPUT(unsigned char, nonce_buffer) + (size_t) i * npubbytes,
+                    AS_INPUT(unsigned char, key_buffer));
+        } else {
+            result[i] = (jint) decrypt(
+                    AS_OUTPUT(unsigned char, dst_buffer) + dst_off[i],
+                    NULL,
+                    NULL, // nsec
+                    AS_INPUT(unsigned char, src_buffer) + src_off[i],
+                    (unsigned long long) src_len[i],
+                    ad_ptr,
+                    ad_size,
+                    AS_INPUT(unsigned char, nonce_buffer) + (size_t) i * npubbytes,
+                    AS_INPUT(unsigned char, key_buffer));
+        }
+
+        if (result[i] != 0) {
+            failed++;
+        }
+    }
+
+release:
+    if (result != NULL) {
+        (*jenv)->ReleaseIntArrayElements(jenv, status, result, 0);
+    }
+    if (ad_len != NULL) {
+        (*jenv)->ReleaseIntArrayElements(jenv, ad_lengths, ad_len, JNI_ABORT);
+    }
+    if (ad_off != NULL) {
+        (*jenv)->ReleaseIntArrayElements(jenv, ad_offsets, ad_off, JNI_ABORT);
+    }
+    if (src_len != NULL) {
+        (*jenv)->ReleaseIntArrayElements(jenv, src_lengths, src_len, JNI_ABORT);
+    }
+    if (src_off != NULL) {
+        (*jenv)->ReleaseIntArrayElements(jenv, src_offsets, src_off, JNI_ABORT);
+    }
+    if (dst_off != NULL) {
+        (*jenv)->ReleaseIntArrayElements(jenv, dst_offsets, dst_off, JNI_ABORT);
+    }
+
+    stodium_release_output(jenv, dst,    &dst_buffer);
+    stodium_release_input(jenv,  src,    &src_buffer);
+    stodium_release_input(jenv,  ad,     &ad_buffer);
+    stodium_release_input(jenv,  nonces, &nonce_buffer);
+    stodium_release_input(jenv,  key,    &key_buffer);
+
+    return failed;
+}
+
+/**
+ * STODIUM_AEAD_NPUBBYTES_MAX is the largest nonce used by the AEAD
+ * constructions that support chunking.
+ */
+#define STODIUM_AEAD_NPUBBYTES_MAX 24U
+
+/**
+ * stodium_aead_chunk_job describes a chunked seal or open operation, run as
+ * one pool task per chunk. Chunk i holds chunk plaintext bytes (the last chunk
+ * may be shorter) and is sealed with the header as additional data, under the
+ * nonce found at the start of the header with first + i xored into its last 8
+ * bytes (little endian).
+ */
+typedef struct stodium_aead_chunk_jobs {
+    stodium_aead_encrypt_fn encrypt;
+    stodium_aead_decrypt_fn decrypt;
+    size_t                  npubbytes;
+    size_t                  in_size;  // src bytes per chunk
+    size_t                  out_size; // dst bytes per chunk
+    uint64_t                first;
+    unsigned char          *dst;
+    const unsigned char    *src;
+    size_t                  srclen;
+    const unsigned char    *header;
+    size_t                  headerlen;
+    const unsigned char    *key;
+    int                     failed;
+} stodium_aead_chunk_job;
+
+static void stodium_aead_chunk_task(void *ctx, size_t index) {
+    stodium_aead_chunk_job *job = (stodium_aead_chunk_job *) ctx;
+    unsigned char           nonce[STODIUM_AEAD_NPUBBYTES_MAX];
+    uint64_t                counter = job->first + (uint64_t) index;
+    size_t                  offset  = index * job->in_size;
+    size_t                  length  = job->srclen - offset;
+    size_t                  i;
+    int                     result;
+
+    if (length > job->in_size) {
+        length = job->in_size;
+    }
+
+    memcpy(nonce, job->header, job->npubbytes);
+    for (i = 0; i < 8; i++) {
+        nonce[job->npubbytes - 8 + i] ^= (unsigned char) (counter >> (8 * i));
+    }
+
+    if (job->encrypt != NULL) {
+        result = job->encrypt(
+                job->dst + index * job->out_size,
+                NULL,
+                job->src + offset,
+                (unsigned long long) length,
+                job->header,
+                (unsigned long long) job->headerlen,
+                NULL, // nsec
+                nonce,
+                job->key);
+    } else {
+        result = job->decrypt(
+                job->dst + index * job->out_size,
+                NULL,
+                NULL, // nsec
+                job->src + offset,
+                (unsigned long long) length,
+                job->header,
+                (unsigned long long) job->headerlen,
+                nonce,
+                job->key);
+    }
+
+    if (result != 0) {
+        __sync_fetch_and_add(&job->failed, 1);
+    }
+}
+
+/**
+ * stodium_aead_chunks seals (or opens) the chunks in src, starting at chunk
+ * index first, spreading the chunks over the thread pool. An empty src is
+ * treated as a single empty chunk. If any chunk fails to open, the whole of
+ * dst is wiped.
+ *
+ * Returns the number of chunks that failed. The Java layer validates the
+ * layout of src and dst against the header before calling into native code.
+ */
+static jint stodium_aead_chunks(JNIEnv *jenv,
+        stodium_aead_encrypt_fn encrypt,
+        stodium_aead_decrypt_fn decrypt,
+        size_t  npubbytes,
+        size_t  abytes,
+        jobject dst,
+        jobject src,
+        jobject header,
+        jint    chunk_size,
+        jlong   first_chunk,
+        jobject key) {
+    stodium_buffer         dst_buffer, src_buffer, header_buffer, key_buffer;
+    stodium_aead_chunk_job job;
+    size_t                 count;
+
+    stodium_get_buffer(jenv, &dst_buffer,    dst);
+    stodium_get_buffer(jenv, &src_buffer,    src);
+    stodium_get_buffer(jenv, &header_buffer, header);
+    stodium_get_buffer(jenv, &key_buffer,    key);
+
+    job.encrypt   = encrypt;
+    job.decrypt   = decrypt;
+    job.npubbytes = npubbytes;
+    job.in_size   = encrypt != NULL ? (size_t) chunk_size : (size_t) chunk_size + abytes;
+    job.out_size  = encrypt != NULL ? (size_t) chunk_size + abytes : (size_t) chunk_size;
+    job.first     = (uint64_t) first_chunk;
+    job.dst       = AS_OUTPUT(unsigned char, dst_buffer);
+    job.src       = AS_INPUT(unsigned char, src_buffer);
+    job.srclen    = AS_INPUT_LEN(size_t, src_buffer);
+    job.header    = AS_INPUT(unsigned char, header_buffer);
+    job.headerlen = AS_INPUT_LEN(size_t, header_buffer);
+    job.key       = AS_INPUT(unsigned char, key_buffer);
+    job.failed    = 0;
+
+    count = job.srclen == 0 ? 1 : (job.srclen + job.in_size - 1) / job.in_size;
+    stodium_pool_run(stodium_aead_chunk_task, &job, count);
+
+    if (decrypt != NULL && job.failed != 0) {
+        sodium_memzero(AS_OUTPUT(unsigned char, dst_buffer), AS_INPUT_LEN(size_t, dst_buffer));
+    }
+
+    stodium_release_output(jenv, dst,    &dst_buffer);
+    stodium_release_input(jenv,  src,    &src_buffer);
+    stodium_release_input(jenv,  header, &header_buffer);
+    stodium_release_input(jenv,  key,    &key_buffer);
+
+    return (jint) job.failed;
+}
+
+/** ****************************************************************************
+ *
+ * AEAD - AES-256-GCM
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT(aead, aes256gcm, keybytes)
+STODIUM_CONSTANT(aead, aes256gcm, nsecbytes)
+STODIUM_CONSTANT(aead, aes256gcm, npubbytes)
+STODIUM_CONSTANT(aead, aes256gcm, abytes)
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1is_1available) (JNIEnv *jenv, jclass jcls) {
+       return (jint) crypto_aead_aes256gcm_is_available();
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1encrypt_1detached) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject mac,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
  
-    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_decrypt_detached(
+    jint result = (jint) crypto_aead_aes256gcm_encrypt_detached(
             AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            //AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            NULL,
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
             NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_output(jenv, mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1encrypt_1detached_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong mac, jint mac_length,
+        jlong src, jint src_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&mac_buffer,   mac, mac_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_aes256gcm_encrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            //AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            NULL,
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1encrypt_1detached_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &mac_buffer,   mac, mac_offset, mac_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_aes256gcm_encrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
             AS_OUTPUT(unsigned char, mac_buffer),
+            //AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            NULL,
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
             AS_INPUT(unsigned char, ad_buffer),
             AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
             AS_INPUT(unsigned char, nonce_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst,   &dst_buffer);
-    stodium_release_input(jenv,  mac,   &mac_buffer);
+    stodium_release_output(jenv, mac,   &mac_buffer);
     stodium_release_input(jenv,  src,   &src_buffer);
     stodium_release_input(jenv,  ad,    &ad_buffer);
     stodium_release_input(jenv,  nonce, &nonce_buffer);
@@ -826,58 +1997,7583 @@ STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt_1detached) (JNI
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1encrypt_1detached_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject mac,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_aes256gcm_encrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            //AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            NULL,
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_output(jenv, mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1encrypt) (JNIEnv *jenv, jclass jcls,
         jobject dst,
         jobject src,
         jobject ad,
         jobject nonce,
         jobject key) {
     stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &ad_buffer,    ad);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer,   key);
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
  
-    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_decrypt(
+    jint result = (jint) crypto_aead_aes256gcm_encrypt(
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL,
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1encrypt_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_aes256gcm_encrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL,
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1encrypt_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_aes256gcm_encrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL,
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
             NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1encrypt_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_aes256gcm_encrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL,
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1decrypt_1detached) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject mac,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_aes256gcm_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1decrypt_1detached_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong mac, jint mac_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&mac_buffer,   mac, mac_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_aes256gcm_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1decrypt_1detached_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &mac_buffer,   mac, mac_offset, mac_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_aes256gcm_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1decrypt_1detached_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject mac,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &mac_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_aes256gcm_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1decrypt) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_aes256gcm_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1decrypt_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_aes256gcm_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1decrypt_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_aes256gcm_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1decrypt_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_aes256gcm_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+/**
+ * crypto_aead_aes256gcm_beforenm expands key into a crypto_aead_aes256gcm_state
+ * held in guarded native memory, and returns its address (or 0 on failure).
+ * The expanded state is made read-only, as the _afternm functions only read
+ * it. The state must be released through crypto_aead_aes256gcm_state_free.
+ */
+STODIUM_JNI(jlong, crypto_1aead_1aes256gcm_1beforenm) (JNIEnv *jenv, jclass jcls,
+        jobject key) {
+    crypto_aead_aes256gcm_state *state;
+    stodium_buffer key_buffer;
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    state = (crypto_aead_aes256gcm_state *) sodium_malloc(sizeof(crypto_aead_aes256gcm_state));
+    if (state != NULL) {
+        if (crypto_aead_aes256gcm_beforenm(state, AS_INPUT(unsigned char, key_buffer)) == 0) {
+            sodium_mprotect_readonly(state);
+        } else {
+            sodium_free(state);
+            state = NULL;
+        }
+    }
+
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return (jlong) (intptr_t) state;
+}
+
+STODIUM_JNI(void, crypto_1aead_1aes256gcm_1state_1free) (JNIEnv *jenv, jclass jcls,
+        jlong state) {
+    sodium_free((void *) (intptr_t) state);
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1encrypt_1detached_1afternm) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject mac,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jlong   state) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_aes256gcm_encrypt_detached_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            //AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            NULL,
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            (const crypto_aead_aes256gcm_state *) (intptr_t) state);
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_output(jenv, mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1encrypt_1afternm) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jlong   state) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_aes256gcm_encrypt_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL,
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            (const crypto_aead_aes256gcm_state *) (intptr_t) state);
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1decrypt_1detached_1afternm) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject mac,
+        jobject ad,
+        jobject nonce,
+        jlong   state) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &mac_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_aes256gcm_decrypt_detached_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            (const crypto_aead_aes256gcm_state *) (intptr_t) state);
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1decrypt_1afternm) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jlong   state) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_aes256gcm_decrypt_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            (const crypto_aead_aes256gcm_state *) (intptr_t) state);
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1encrypt_1batch) (JNIEnv *jenv, jclass jcls,
+        jobject   dst,
+        jintArray dst_offsets,
+        jobject   src,
+        jintArray src_offsets,
+        jintArray src_lengths,
+        jobject   ad,
+        jintArray ad_offsets,
+        jintArray ad_lengths,
+        jobject   nonces,
+        jobject   key,
+        jintArray status) {
+    return stodium_aead_batch(jenv, crypto_aead_aes256gcm_encrypt, NULL,
+            crypto_aead_aes256gcm_npubbytes(),
+            dst, dst_offsets,
+            src, src_offsets, src_lengths,
+            ad, ad_offsets, ad_lengths,
+            nonces, key, status);
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1decrypt_1batch) (JNIEnv *jenv, jclass jcls,
+        jobject   dst,
+        jintArray dst_offsets,
+        jobject   src,
+        jintArray src_offsets,
+        jintArray src_lengths,
+        jobject   ad,
+        jintArray ad_offsets,
+        jintArray ad_lengths,
+        jobject   nonces,
+        jobject   key,
+        jintArray status) {
+    return stodium_aead_batch(jenv, NULL, crypto_aead_aes256gcm_decrypt,
+            crypto_aead_aes256gcm_npubbytes(),
+            dst, dst_offsets,
+            src, src_offsets, src_lengths,
+            ad, ad_offsets, ad_lengths,
+            nonces, key, status);
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1encrypt_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jint    plain_length,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    // The plain text at the start of buf is replaced by the cipher text,
+    // followed by the MAC
+    jint result = (jint) crypto_aead_aes256gcm_encrypt(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            NULL,
+            AS_INPUT(unsigned char, buf_buffer),
+            (unsigned long long) plain_length,
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,   &buf_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1encrypt_1detached_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject dst_mac,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, mac_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   dst_mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_aead_aes256gcm_encrypt_detached(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            NULL,
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,     &buf_buffer);
+    stodium_release_output(jenv, dst_mac, &mac_buffer);
+    stodium_release_input(jenv,  ad,      &ad_buffer);
+    stodium_release_input(jenv,  nonce,   &nonce_buffer);
+    stodium_release_input(jenv,  key,     &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1decrypt_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    // As m == c, libsodium wipes the cipher text in buf if verification fails
+    jint result = (jint) crypto_aead_aes256gcm_decrypt(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            NULL,
+            NULL, // nsec
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,   &buf_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1aes256gcm_1decrypt_1detached_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject src_mac,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, mac_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   src_mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_aead_aes256gcm_decrypt_detached(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,     &buf_buffer);
+    stodium_release_input(jenv,  src_mac, &mac_buffer);
+    stodium_release_input(jenv,  ad,      &ad_buffer);
+    stodium_release_input(jenv,  nonce,   &nonce_buffer);
+    stodium_release_input(jenv,  key,     &key_buffer);
+
+    return result;
+}
+
+/** ****************************************************************************
+ *
+ * AEAD - Chacha20Poly1305
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT(aead, chacha20poly1305, keybytes)
+STODIUM_CONSTANT(aead, chacha20poly1305, nsecbytes)
+STODIUM_CONSTANT(aead, chacha20poly1305, npubbytes)
+STODIUM_CONSTANT(aead, chacha20poly1305, abytes)
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1encrypt_1detached) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject mac,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_encrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_output(jenv, mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1encrypt_1detached_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong mac, jint mac_length,
+        jlong src, jint src_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&mac_buffer,   mac, mac_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_chacha20poly1305_encrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1encrypt_1detached_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &mac_buffer,   mac, mac_offset, mac_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_encrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_output(jenv, mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1encrypt_1detached_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject mac,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_encrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_output(jenv, mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1encrypt) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_encrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1encrypt_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_chacha20poly1305_encrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1encrypt_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_encrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1encrypt_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_encrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1decrypt_1detached) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject mac,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1decrypt_1detached_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong mac, jint mac_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&mac_buffer,   mac, mac_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_chacha20poly1305_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1decrypt_1detached_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &mac_buffer,   mac, mac_offset, mac_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1decrypt_1detached_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject mac,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &mac_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1decrypt) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1decrypt_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_chacha20poly1305_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1decrypt_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1decrypt_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1encrypt_1batch) (JNIEnv *jenv, jclass jcls,
+        jobject   dst,
+        jintArray dst_offsets,
+        jobject   src,
+        jintArray src_offsets,
+        jintArray src_lengths,
+        jobject   ad,
+        jintArray ad_offsets,
+        jintArray ad_lengths,
+        jobject   nonces,
+        jobject   key,
+        jintArray status) {
+    return stodium_aead_batch(jenv, crypto_aead_chacha20poly1305_encrypt, NULL,
+            crypto_aead_chacha20poly1305_npubbytes(),
+            dst, dst_offsets,
+            src, src_offsets, src_lengths,
+            ad, ad_offsets, ad_lengths,
+            nonces, key, status);
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1decrypt_1batch) (JNIEnv *jenv, jclass jcls,
+        jobject   dst,
+        jintArray dst_offsets,
+        jobject   src,
+        jintArray src_offsets,
+        jintArray src_lengths,
+        jobject   ad,
+        jintArray ad_offsets,
+        jintArray ad_lengths,
+        jobject   nonces,
+        jobject   key,
+        jintArray status) {
+    return stodium_aead_batch(jenv, NULL, crypto_aead_chacha20poly1305_decrypt,
+            crypto_aead_chacha20poly1305_npubbytes(),
+            dst, dst_offsets,
+            src, src_offsets, src_lengths,
+            ad, ad_offsets, ad_lengths,
+            nonces, key, status);
+}
+
+/**
+ * stodium_sg_chacha20poly1305 describes chacha20poly1305 for the scatter/gather natives.
+ */
+static const stodium_sg_construction stodium_sg_chacha20poly1305 = {
+    STODIUM_SG_AEAD, crypto_stream_chacha20_xor_ic, 8U, NULL, 0U
+};
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1encrypt_1detachedv) (JNIEnv *jenv, jclass jcls,
+        jobjectArray dst,
+        jobject      mac,
+        jobjectArray src,
+        jobject      ad,
+        jobject      nonce,
+        jobject      key) {
+    return stodium_sg_seal(jenv, &stodium_sg_chacha20poly1305, dst, mac, src, ad, nonce, key);
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1decrypt_1detachedv) (JNIEnv *jenv, jclass jcls,
+        jobjectArray dst,
+        jobjectArray src,
+        jobject      mac,
+        jobject      ad,
+        jobject      nonce,
+        jobject      key) {
+    return stodium_sg_open(jenv, &stodium_sg_chacha20poly1305, dst, src, mac, ad, nonce, key);
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1encrypt_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jint    plain_length,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    // The plain text at the start of buf is replaced by the cipher text,
+    // followed by the MAC
+    jint result = (jint) crypto_aead_chacha20poly1305_encrypt(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            NULL,
+            AS_INPUT(unsigned char, buf_buffer),
+            (unsigned long long) plain_length,
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,   &buf_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1encrypt_1detached_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject dst_mac,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, mac_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   dst_mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_aead_chacha20poly1305_encrypt_detached(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            NULL,
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,     &buf_buffer);
+    stodium_release_output(jenv, dst_mac, &mac_buffer);
+    stodium_release_input(jenv,  ad,      &ad_buffer);
+    stodium_release_input(jenv,  nonce,   &nonce_buffer);
+    stodium_release_input(jenv,  key,     &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1decrypt_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    // As m == c, libsodium wipes the cipher text in buf if verification fails
+    jint result = (jint) crypto_aead_chacha20poly1305_decrypt(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            NULL,
+            NULL, // nsec
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,   &buf_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1decrypt_1detached_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject src_mac,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, mac_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   src_mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_aead_chacha20poly1305_decrypt_detached(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,     &buf_buffer);
+    stodium_release_input(jenv,  src_mac, &mac_buffer);
+    stodium_release_input(jenv,  ad,      &ad_buffer);
+    stodium_release_input(jenv,  nonce,   &nonce_buffer);
+    stodium_release_input(jenv,  key,     &key_buffer);
+
+    return result;
+}
+
+/** ****************************************************************************
+ *
+ * AEAD - Chacha20Poly1305 (ietf)
+ *
+ **************************************************************************** */
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1keybytes) (JNIEnv *jenv, jclass jcls) {
+       return (jint) crypto_aead_chacha20poly1305_ietf_keybytes();
+}
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1nsecbytes) (JNIEnv *jenv, jclass jcls) {
+       return (jint) crypto_aead_chacha20poly1305_ietf_nsecbytes();
+}
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1npubbytes) (JNIEnv *jenv, jclass jcls) {
+       return (jint) crypto_aead_chacha20poly1305_ietf_npubbytes();
+}
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1abytes) (JNIEnv *jenv, jclass jcls) {
+       return (jint) crypto_aead_chacha20poly1305_ietf_abytes();
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1encrypt_1detached) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject mac,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_encrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_output(jenv, mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1encrypt_1detached_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong mac, jint mac_length,
+        jlong src, jint src_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&mac_buffer,   mac, mac_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_encrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1encrypt_1detached_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &mac_buffer,   mac, mac_offset, mac_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_encrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_output(jenv, mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1encrypt_1detached_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject mac,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_encrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_output(jenv, mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1encrypt) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_encrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1encrypt_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_encrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1encrypt_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_encrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1encrypt_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_encrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1decrypt_1detached) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject mac,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1decrypt_1detached_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong mac, jint mac_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&mac_buffer,   mac, mac_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1decrypt_1detached_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &mac_buffer,   mac, mac_offset, mac_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1decrypt_1detached_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject mac,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &mac_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1decrypt) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1decrypt_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1decrypt_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1decrypt_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1encrypt_1batch) (JNIEnv *jenv, jclass jcls,
+        jobject   dst,
+        jintArray dst_offsets,
+        jobject   src,
+        jintArray src_offsets,
+        jintArray src_lengths,
+        jobject   ad,
+        jintArray ad_offsets,
+        jintArray ad_lengths,
+        jobject   nonces,
+        jobject   key,
+        jintArray status) {
+    return stodium_aead_batch(jenv, crypto_aead_chacha20poly1305_ietf_encrypt, NULL,
+            crypto_aead_chacha20poly1305_ietf_npubbytes(),
+            dst, dst_offsets,
+            src, src_offsets, src_lengths,
+            ad, ad_offsets, ad_lengths,
+            nonces, key, status);
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1decrypt_1batch) (JNIEnv *jenv, jclass jcls,
+        jobject   dst,
+        jintArray dst_offsets,
+        jobject   src,
+        jintArray src_offsets,
+        jintArray src_lengths,
+        jobject   ad,
+        jintArray ad_offsets,
+        jintArray ad_lengths,
+        jobject   nonces,
+        jobject   key,
+        jintArray status) {
+    return stodium_aead_batch(jenv, NULL, crypto_aead_chacha20poly1305_ietf_decrypt,
+            crypto_aead_chacha20poly1305_ietf_npubbytes(),
+            dst, dst_offsets,
+            src, src_offsets, src_lengths,
+            ad, ad_offsets, ad_lengths,
+            nonces, key, status);
+}
+
+/**
+ * stodium_sg_chacha20poly1305_ietf describes chacha20poly1305_ietf for the scatter/gather natives.
+ */
+static const stodium_sg_construction stodium_sg_chacha20poly1305_ietf = {
+    STODIUM_SG_AEAD_IETF, stodium_stream_chacha20_ietf_xor_ic, 12U, NULL, 0U
+};
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1encrypt_1detachedv) (JNIEnv *jenv, jclass jcls,
+        jobjectArray dst,
+        jobject      mac,
+        jobjectArray src,
+        jobject      ad,
+        jobject      nonce,
+        jobject      key) {
+    return stodium_sg_seal(jenv, &stodium_sg_chacha20poly1305_ietf, dst, mac, src, ad, nonce, key);
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1decrypt_1detachedv) (JNIEnv *jenv, jclass jcls,
+        jobjectArray dst,
+        jobjectArray src,
+        jobject      mac,
+        jobject      ad,
+        jobject      nonce,
+        jobject      key) {
+    return stodium_sg_open(jenv, &stodium_sg_chacha20poly1305_ietf, dst, src, mac, ad, nonce, key);
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1encrypt_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jint    plain_length,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    // The plain text at the start of buf is replaced by the cipher text,
+    // followed by the MAC
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_encrypt(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            NULL,
+            AS_INPUT(unsigned char, buf_buffer),
+            (unsigned long long) plain_length,
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,   &buf_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1encrypt_1detached_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject dst_mac,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, mac_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   dst_mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_encrypt_detached(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            NULL,
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,     &buf_buffer);
+    stodium_release_output(jenv, dst_mac, &mac_buffer);
+    stodium_release_input(jenv,  ad,      &ad_buffer);
+    stodium_release_input(jenv,  nonce,   &nonce_buffer);
+    stodium_release_input(jenv,  key,     &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1decrypt_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    // As m == c, libsodium wipes the cipher text in buf if verification fails
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_decrypt(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            NULL,
+            NULL, // nsec
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,   &buf_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1decrypt_1detached_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject src_mac,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, mac_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   src_mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_aead_chacha20poly1305_ietf_decrypt_detached(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,     &buf_buffer);
+    stodium_release_input(jenv,  src_mac, &mac_buffer);
+    stodium_release_input(jenv,  ad,      &ad_buffer);
+    stodium_release_input(jenv,  nonce,   &nonce_buffer);
+    stodium_release_input(jenv,  key,     &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1encrypt_1chunks) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject header,
+        jint    chunk_size,
+        jlong   first_chunk,
+        jobject key) {
+    return stodium_aead_chunks(jenv, crypto_aead_chacha20poly1305_ietf_encrypt, NULL,
+            crypto_aead_chacha20poly1305_ietf_npubbytes(),
+            crypto_aead_chacha20poly1305_ietf_abytes(),
+            dst, src, header, chunk_size, first_chunk, key);
+}
+
+STODIUM_JNI(jint, crypto_1aead_1chacha20poly1305_1ietf_1decrypt_1chunks) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject header,
+        jint    chunk_size,
+        jlong   first_chunk,
+        jobject key) {
+    return stodium_aead_chunks(jenv, NULL, crypto_aead_chacha20poly1305_ietf_decrypt,
+            crypto_aead_chacha20poly1305_ietf_npubbytes(),
+            crypto_aead_chacha20poly1305_ietf_abytes(),
+            dst, src, header, chunk_size, first_chunk, key);
+}
+
+/** ****************************************************************************
+ *
+ * AEAD - XChacha20Poly1305 (ietf)
+ *
+ **************************************************************************** */
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1keybytes) (JNIEnv *jenv, jclass jcls) {
+       return (jint) crypto_aead_xchacha20poly1305_ietf_keybytes();
+}
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1nsecbytes) (JNIEnv *jenv, jclass jcls) {
+       return (jint) crypto_aead_xchacha20poly1305_ietf_nsecbytes();
+}
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1npubbytes) (JNIEnv *jenv, jclass jcls) {
+       return (jint) crypto_aead_xchacha20poly1305_ietf_npubbytes();
+}
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1abytes) (JNIEnv *jenv, jclass jcls) {
+       return (jint) crypto_aead_xchacha20poly1305_ietf_abytes();
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt_1detached) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject mac,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_encrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_output(jenv, mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt_1detached_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong mac, jint mac_length,
+        jlong src, jint src_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&mac_buffer,   mac, mac_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_encrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt_1detached_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &mac_buffer,   mac, mac_offset, mac_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_encrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_output(jenv, mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt_1detached_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject mac,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_encrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_OUTPUT_LEN(unsigned long long, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_output(jenv, mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_encrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_encrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_encrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_encrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt_1detached) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject mac,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt_1detached_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong mac, jint mac_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&mac_buffer,   mac, mac_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt_1detached_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &mac_buffer,   mac, mac_offset, mac_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt_1detached_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject mac,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &mac_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_decrypt_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  mac,   &mac_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong ad, jint ad_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer,   dst, dst_length);
+    stodium_get_address(&src_buffer,   src, src_length);
+    stodium_get_address(&ad_buffer,    ad, ad_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer,   key, key_length);
+
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray ad, jint ad_offset, jint ad_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer,   dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer,   src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &ad_buffer,    ad, ad_offset, ad_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer,   key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &ad_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+ 
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_decrypt(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt_1batch) (JNIEnv *jenv, jclass jcls,
+        jobject   dst,
+        jintArray dst_offsets,
+        jobject   src,
+        jintArray src_offsets,
+        jintArray src_lengths,
+        jobject   ad,
+        jintArray ad_offsets,
+        jintArray ad_lengths,
+        jobject   nonces,
+        jobject   key,
+        jintArray status) {
+    return stodium_aead_batch(jenv, crypto_aead_xchacha20poly1305_ietf_encrypt, NULL,
+            crypto_aead_xchacha20poly1305_ietf_npubbytes(),
+            dst, dst_offsets,
+            src, src_offsets, src_lengths,
+            ad, ad_offsets, ad_lengths,
+            nonces, key, status);
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt_1batch) (JNIEnv *jenv, jclass jcls,
+        jobject   dst,
+        jintArray dst_offsets,
+        jobject   src,
+        jintArray src_offsets,
+        jintArray src_lengths,
+        jobject   ad,
+        jintArray ad_offsets,
+        jintArray ad_lengths,
+        jobject   nonces,
+        jobject   key,
+        jintArray status) {
+    return stodium_aead_batch(jenv, NULL, crypto_aead_xchacha20poly1305_ietf_decrypt,
+            crypto_aead_xchacha20poly1305_ietf_npubbytes(),
+            dst, dst_offsets,
+            src, src_offsets, src_lengths,
+            ad, ad_offsets, ad_lengths,
+            nonces, key, status);
+}
+
+/**
+ * stodium_sg_xchacha20poly1305_ietf describes xchacha20poly1305_ietf for the scatter/gather natives.
+ */
+static const stodium_sg_construction stodium_sg_xchacha20poly1305_ietf = {
+    STODIUM_SG_AEAD_IETF, stodium_stream_chacha20_ietf_xor_ic, 24U, crypto_core_hchacha20, 4U
+};
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt_1detachedv) (JNIEnv *jenv, jclass jcls,
+        jobjectArray dst,
+        jobject      mac,
+        jobjectArray src,
+        jobject      ad,
+        jobject      nonce,
+        jobject      key) {
+    return stodium_sg_seal(jenv, &stodium_sg_xchacha20poly1305_ietf, dst, mac, src, ad, nonce, key);
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt_1detachedv) (JNIEnv *jenv, jclass jcls,
+        jobjectArray dst,
+        jobjectArray src,
+        jobject      mac,
+        jobject      ad,
+        jobject      nonce,
+        jobject      key) {
+    return stodium_sg_open(jenv, &stodium_sg_xchacha20poly1305_ietf, dst, src, mac, ad, nonce, key);
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jint    plain_length,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    // The plain text at the start of buf is replaced by the cipher text,
+    // followed by the MAC
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_encrypt(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            NULL,
+            AS_INPUT(unsigned char, buf_buffer),
+            (unsigned long long) plain_length,
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,   &buf_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt_1detached_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject dst_mac,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, mac_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   dst_mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_encrypt_detached(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            NULL,
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,     &buf_buffer);
+    stodium_release_output(jenv, dst_mac, &mac_buffer);
+    stodium_release_input(jenv,  ad,      &ad_buffer);
+    stodium_release_input(jenv,  nonce,   &nonce_buffer);
+    stodium_release_input(jenv,  key,     &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    // As m == c, libsodium wipes the cipher text in buf if verification fails
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_decrypt(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            NULL,
+            NULL, // nsec
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,   &buf_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt_1detached_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject src_mac,
+        jobject ad,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, mac_buffer, ad_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer,   buf);
+    stodium_get_buffer_critical(jenv, &mac_buffer,   src_mac);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &mac_buffer, &ad_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_aead_xchacha20poly1305_ietf_decrypt_detached(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            NULL, // nsec
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf,     &buf_buffer);
+    stodium_release_input(jenv,  src_mac, &mac_buffer);
+    stodium_release_input(jenv,  ad,      &ad_buffer);
+    stodium_release_input(jenv,  nonce,   &nonce_buffer);
+    stodium_release_input(jenv,  key,     &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1encrypt_1chunks) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject header,
+        jint    chunk_size,
+        jlong   first_chunk,
+        jobject key) {
+    return stodium_aead_chunks(jenv, crypto_aead_xchacha20poly1305_ietf_encrypt, NULL,
+            crypto_aead_xchacha20poly1305_ietf_npubbytes(),
+            crypto_aead_xchacha20poly1305_ietf_abytes(),
+            dst, src, header, chunk_size, first_chunk, key);
+}
+
+STODIUM_JNI(jint, crypto_1aead_1xchacha20poly1305_1ietf_1decrypt_1chunks) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject header,
+        jint    chunk_size,
+        jlong   first_chunk,
+        jobject key) {
+    return stodium_aead_chunks(jenv, NULL, crypto_aead_xchacha20poly1305_ietf_decrypt,
+            crypto_aead_xchacha20poly1305_ietf_npubbytes(),
+            crypto_aead_xchacha20poly1305_ietf_abytes(),
+            dst, src, header, chunk_size, first_chunk, key);
+}
+
+/** ****************************************************************************
+ *
+ * AUTH
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT_STR(auth)
+
+/** ****************************************************************************
+ *
+ * AUTH - HMAC-256
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT(auth, hmacsha256, bytes)
+STODIUM_CONSTANT(auth, hmacsha256, keybytes)
+STODIUM_CONSTANT(auth, hmacsha256, statebytes)
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jobject key) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha256(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1address) (JNIEnv *jenv, jclass jcls,
+        jlong mac, jint mac_length,
+        jlong src, jint src_length,
+        jlong key, jint key_length) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_address(&mac_buffer, mac, mac_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&key_buffer, key, key_length);
+
+    jint result = (jint) crypto_auth_hmacsha256(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &mac_buffer, mac, mac_offset, mac_length);
+    stodium_get_array_critical(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &key_buffer, key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha256(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jlong   key) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha256(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1verify) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jobject key) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha256_verify(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_input(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1verify_1address) (JNIEnv *jenv, jclass jcls,
+        jlong mac, jint mac_length,
+        jlong src, jint src_length,
+        jlong key, jint key_length) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_address(&mac_buffer, mac, mac_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&key_buffer, key, key_length);
+
+    jint result = (jint) crypto_auth_hmacsha256_verify(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1verify_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &mac_buffer, mac, mac_offset, mac_length);
+    stodium_get_array_critical(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &key_buffer, key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha256_verify(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_input(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1verify_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jlong   key) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha256_verify(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_input(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1init) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject key) {
+    stodium_buffer dst_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) crypto_auth_hmacsha256_init(
+            AS_OUTPUT(crypto_auth_hmacsha256_state, dst_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT_LEN(size_t, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1init_1array) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
+
+    jint result = (jint) crypto_auth_hmacsha256_init(
+            AS_OUTPUT(crypto_auth_hmacsha256_state, dst_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT_LEN(size_t, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1update) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+
+    jint result = (jint) crypto_auth_hmacsha256_update(
+            AS_OUTPUT(crypto_auth_hmacsha256_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1update_1array) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jbyteArray src, jint src_offset, jint src_length) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+
+    jint result = (jint) crypto_auth_hmacsha256_update(
+            AS_OUTPUT(crypto_auth_hmacsha256_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1final) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jobject dst) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+
+    jint result = (jint) crypto_auth_hmacsha256_final(
+            AS_OUTPUT(crypto_auth_hmacsha256_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer));
+
+    stodium_release_output(jenv, state, &state_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1final_1array) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jbyteArray dst, jint dst_offset, jint dst_length) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+
+    jint result = (jint) crypto_auth_hmacsha256_final(
+            AS_OUTPUT(crypto_auth_hmacsha256_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer));
+
+    stodium_release_output(jenv, state, &state_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+
+    return result;
+}
+
+/**
+ * stodium_auth_hmacsha256_update adapts crypto_auth_hmacsha256_update to stodium_update_fn.
+ */
+static int stodium_auth_hmacsha256_update(void *state, const unsigned char *in, size_t inlen) {
+    return crypto_auth_hmacsha256_update((crypto_auth_hmacsha256_state *) state, in, (unsigned long long) inlen);
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1updatev) (JNIEnv *jenv, jclass jcls,
+        jobject      state,
+        jobjectArray srcs,
+        jint         offset,
+        jint         length) {
+    return stodium_updatev(jenv, state, srcs, offset, length, stodium_auth_hmacsha256_update);
+}
+
+/**
+ * stodium_auth_hmacsha256_file computes the MAC of a range of a file, see
+ * stodium_file_update.
+ */
+static int stodium_auth_hmacsha256_file(int fd, jlong offset, jlong length,
+        unsigned char *out, size_t outlen,
+        const unsigned char *key, size_t keylen) {
+    crypto_auth_hmacsha256_state state;
+    int result;
+
+    if (crypto_auth_hmacsha256_init(&state, key, keylen) != 0) {
+        return -1;
+    }
+    result = stodium_file_update(fd, offset, length, stodium_auth_hmacsha256_update, &state);
+    if (result == 0 && crypto_auth_hmacsha256_final(&state, out) != 0) {
+        result = -1;
+    }
+    sodium_memzero(&state, sizeof state);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1fd) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject key,
+        jint    fd,
+        jlong   offset,
+        jlong   length) {
+    return stodium_file_digest(jenv, dst, key, fd, offset, length, stodium_auth_hmacsha256_file);
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1file) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject key,
+        jstring path,
+        jlong   offset,
+        jlong   length) {
+    return stodium_path_digest(jenv, dst, key, path, offset, length, stodium_auth_hmacsha256_file);
+}
+
+/**
+ * crypto_auth_hmacsha256_beforenm runs the key setup of HMAC once, and keeps the
+ * resulting state (the inner and outer hash states after absorbing the padded
+ * key) in guarded native memory. The state must be released through
+ * crypto_auth_hmacsha256_state_free.
+ */
+STODIUM_JNI(jlong, crypto_1auth_1hmacsha256_1beforenm) (JNIEnv *jenv, jclass jcls,
+        jobject key) {
+    crypto_auth_hmacsha256_state *state;
+    stodium_buffer key_buffer;
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    state = (crypto_auth_hmacsha256_state *) sodium_malloc(sizeof(crypto_auth_hmacsha256_state));
+    if (state != NULL) {
+        if (crypto_auth_hmacsha256_init(state,
+                AS_INPUT(unsigned char, key_buffer),
+                AS_INPUT_LEN(size_t, key_buffer)) == 0) {
+            sodium_mprotect_readonly(state);
+        } else {
+            sodium_free(state);
+            state = NULL;
+        }
+    }
+
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return (jlong) (intptr_t) state;
+}
+
+STODIUM_JNI(void, crypto_1auth_1hmacsha256_1state_1free) (JNIEnv *jenv, jclass jcls,
+        jlong state) {
+    sodium_free((void *) (intptr_t) state);
+}
+
+/**
+ * stodium_auth_hmacsha256_afternm computes the MAC of inlen bytes of in from a copy
+ * of a precomputed key state.
+ */
+static int stodium_auth_hmacsha256_afternm(unsigned char *out,
+        const unsigned char *in, unsigned long long inlen,
+        const crypto_auth_hmacsha256_state *key) {
+    crypto_auth_hmacsha256_state state;
+    int result;
+
+    memcpy(&state, key, sizeof state);
+    result = crypto_auth_hmacsha256_update(&state, in, inlen);
+    if (result == 0) {
+        result = crypto_auth_hmacsha256_final(&state, out);
+    }
+    sodium_memzero(&state, sizeof state);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1afternm) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jlong   state) {
+    stodium_buffer mac_buffer, src_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) stodium_auth_hmacsha256_afternm(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            (const crypto_auth_hmacsha256_state *) (intptr_t) state);
+
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1verify_1afternm) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jlong   state) {
+    unsigned char expected[crypto_auth_hmacsha256_BYTES];
+    stodium_buffer mac_buffer, src_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) stodium_auth_hmacsha256_afternm(
+            expected,
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            (const crypto_auth_hmacsha256_state *) (intptr_t) state);
+    if (result == 0) {
+        result = (jint) crypto_verify_32(AS_INPUT(unsigned char, mac_buffer), expected);
+    }
+
+    stodium_release_input(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    sodium_memzero(expected, sizeof expected);
+
+    return result;
+}
+
+/** ****************************************************************************
+ *
+ * AUTH - HMAC-512
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT(auth, hmacsha512, bytes)
+STODIUM_CONSTANT(auth, hmacsha512, keybytes)
+STODIUM_CONSTANT(auth, hmacsha512, statebytes)
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jobject key) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha512(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1address) (JNIEnv *jenv, jclass jcls,
+        jlong mac, jint mac_length,
+        jlong src, jint src_length,
+        jlong key, jint key_length) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_address(&mac_buffer, mac, mac_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&key_buffer, key, key_length);
+
+    jint result = (jint) crypto_auth_hmacsha512(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &mac_buffer, mac, mac_offset, mac_length);
+    stodium_get_array_critical(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &key_buffer, key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha512(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jlong   key) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha512(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1verify) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jobject key) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha512_verify(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_input(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1verify_1address) (JNIEnv *jenv, jclass jcls,
+        jlong mac, jint mac_length,
+        jlong src, jint src_length,
+        jlong key, jint key_length) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_address(&mac_buffer, mac, mac_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&key_buffer, key, key_length);
+
+    jint result = (jint) crypto_auth_hmacsha512_verify(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1verify_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &mac_buffer, mac, mac_offset, mac_length);
+    stodium_get_array_critical(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &key_buffer, key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha512_verify(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_input(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1verify_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jlong   key) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha512_verify(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_input(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1init) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject key) {
+    stodium_buffer dst_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) crypto_auth_hmacsha512_init(
+            AS_OUTPUT(crypto_auth_hmacsha512_state, dst_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT_LEN(size_t, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1init_1array) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
+
+    jint result = (jint) crypto_auth_hmacsha512_init(
+            AS_OUTPUT(crypto_auth_hmacsha512_state, dst_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT_LEN(size_t, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1update) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+
+    jint result = (jint) crypto_auth_hmacsha512_update(
+            AS_OUTPUT(crypto_auth_hmacsha512_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1update_1array) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jbyteArray src, jint src_offset, jint src_length) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+
+    jint result = (jint) crypto_auth_hmacsha512_update(
+            AS_OUTPUT(crypto_auth_hmacsha512_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1final) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jobject dst) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+
+    jint result = (jint) crypto_auth_hmacsha512_final(
+            AS_OUTPUT(crypto_auth_hmacsha512_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer));
+
+    stodium_release_output(jenv, state, &state_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1final_1array) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jbyteArray dst, jint dst_offset, jint dst_length) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+
+    jint result = (jint) crypto_auth_hmacsha512_final(
+            AS_OUTPUT(crypto_auth_hmacsha512_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer));
+
+    stodium_release_output(jenv, state, &state_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+
+    return result;
+}
+
+/**
+ * stodium_auth_hmacsha512_update adapts crypto_auth_hmacsha512_update to stodium_update_fn.
+ */
+static int stodium_auth_hmacsha512_update(void *state, const unsigned char *in, size_t inlen) {
+    return crypto_auth_hmacsha512_update((crypto_auth_hmacsha512_state *) state, in, (unsigned long long) inlen);
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1updatev) (JNIEnv *jenv, jclass jcls,
+        jobject      state,
+        jobjectArray srcs,
+        jint         offset,
+        jint         length) {
+    return stodium_updatev(jenv, state, srcs, offset, length, stodium_auth_hmacsha512_update);
+}
+
+/**
+ * stodium_auth_hmacsha512_file computes the MAC of a range of a file, see
+ * stodium_file_update.
+ */
+static int stodium_auth_hmacsha512_file(int fd, jlong offset, jlong length,
+        unsigned char *out, size_t outlen,
+        const unsigned char *key, size_t keylen) {
+    crypto_auth_hmacsha512_state state;
+    int result;
+
+    if (crypto_auth_hmacsha512_init(&state, key, keylen) != 0) {
+        return -1;
+    }
+    result = stodium_file_update(fd, offset, length, stodium_auth_hmacsha512_update, &state);
+    if (result == 0 && crypto_auth_hmacsha512_final(&state, out) != 0) {
+        result = -1;
+    }
+    sodium_memzero(&state, sizeof state);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1fd) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject key,
+        jint    fd,
+        jlong   offset,
+        jlong   length) {
+    return stodium_file_digest(jenv, dst, key, fd, offset, length, stodium_auth_hmacsha512_file);
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1file) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject key,
+        jstring path,
+        jlong   offset,
+        jlong   length) {
+    return stodium_path_digest(jenv, dst, key, path, offset, length, stodium_auth_hmacsha512_file);
+}
+
+/**
+ * crypto_auth_hmacsha512_beforenm runs the key setup of HMAC once, and keeps the
+ * resulting state (the inner and outer hash states after absorbing the padded
+ * key) in guarded native memory. The state must be released through
+ * crypto_auth_hmacsha512_state_free.
+ */
+STODIUM_JNI(jlong, crypto_1auth_1hmacsha512_1beforenm) (JNIEnv *jenv, jclass jcls,
+        jobject key) {
+    crypto_auth_hmacsha512_state *state;
+    stodium_buffer key_buffer;
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    state = (crypto_auth_hmacsha512_state *) sodium_malloc(sizeof(crypto_auth_hmacsha512_state));
+    if (state != NULL) {
+        if (crypto_auth_hmacsha512_init(state,
+                AS_INPUT(unsigned char, key_buffer),
+                AS_INPUT_LEN(size_t, key_buffer)) == 0) {
+            sodium_mprotect_readonly(state);
+        } else {
+            sodium_free(state);
+            state = NULL;
+        }
+    }
+
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return (jlong) (intptr_t) state;
+}
+
+STODIUM_JNI(void, crypto_1auth_1hmacsha512_1state_1free) (JNIEnv *jenv, jclass jcls,
+        jlong state) {
+    sodium_free((void *) (intptr_t) state);
+}
+
+/**
+ * stodium_auth_hmacsha512_afternm computes the MAC of inlen bytes of in from a copy
+ * of a precomputed key state.
+ */
+static int stodium_auth_hmacsha512_afternm(unsigned char *out,
+        const unsigned char *in, unsigned long long inlen,
+        const crypto_auth_hmacsha512_state *key) {
+    crypto_auth_hmacsha512_state state;
+    int result;
+
+    memcpy(&state, key, sizeof state);
+    result = crypto_auth_hmacsha512_update(&state, in, inlen);
+    if (result == 0) {
+        result = crypto_auth_hmacsha512_final(&state, out);
+    }
+    sodium_memzero(&state, sizeof state);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1afternm) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jlong   state) {
+    stodium_buffer mac_buffer, src_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) stodium_auth_hmacsha512_afternm(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            (const crypto_auth_hmacsha512_state *) (intptr_t) state);
+
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1verify_1afternm) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jlong   state) {
+    unsigned char expected[crypto_auth_hmacsha512_BYTES];
+    stodium_buffer mac_buffer, src_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) stodium_auth_hmacsha512_afternm(
+            expected,
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            (const crypto_auth_hmacsha512_state *) (intptr_t) state);
+    if (result == 0) {
+        result = (jint) crypto_verify_64(AS_INPUT(unsigned char, mac_buffer), expected);
+    }
+
+    stodium_release_input(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    sodium_memzero(expected, sizeof expected);
+
+    return result;
+}
+
+/** ****************************************************************************
+ *
+ * AUTH - HMAC-512/256
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT(auth, hmacsha512256, bytes)
+STODIUM_CONSTANT(auth, hmacsha512256, keybytes)
+STODIUM_CONSTANT(auth, hmacsha512256, statebytes)
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jobject key) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha512256(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1address) (JNIEnv *jenv, jclass jcls,
+        jlong mac, jint mac_length,
+        jlong src, jint src_length,
+        jlong key, jint key_length) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_address(&mac_buffer, mac, mac_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&key_buffer, key, key_length);
+
+    jint result = (jint) crypto_auth_hmacsha512256(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &mac_buffer, mac, mac_offset, mac_length);
+    stodium_get_array_critical(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &key_buffer, key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha512256(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jlong   key) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha512256(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1verify) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jobject key) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha512256_verify(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_input(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1verify_1address) (JNIEnv *jenv, jclass jcls,
+        jlong mac, jint mac_length,
+        jlong src, jint src_length,
+        jlong key, jint key_length) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_address(&mac_buffer, mac, mac_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&key_buffer, key, key_length);
+
+    jint result = (jint) crypto_auth_hmacsha512256_verify(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1verify_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &mac_buffer, mac, mac_offset, mac_length);
+    stodium_get_array_critical(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &key_buffer, key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha512256_verify(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_input(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1verify_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jlong   key) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_auth_hmacsha512256_verify(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_input(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1init) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject key) {
+    stodium_buffer dst_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) crypto_auth_hmacsha512256_init(
+            AS_OUTPUT(crypto_auth_hmacsha512256_state, dst_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT_LEN(size_t, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1init_1array) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
+
+    jint result = (jint) crypto_auth_hmacsha512256_init(
+            AS_OUTPUT(crypto_auth_hmacsha512256_state, dst_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT_LEN(size_t, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1update) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+
+    jint result = (jint) crypto_auth_hmacsha512256_update(
+            AS_OUTPUT(crypto_auth_hmacsha512256_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1update_1array) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jbyteArray src, jint src_offset, jint src_length) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+
+    jint result = (jint) crypto_auth_hmacsha512256_update(
+            AS_OUTPUT(crypto_auth_hmacsha512256_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1final) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jobject dst) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+
+    jint result = (jint) crypto_auth_hmacsha512256_final(
+            AS_OUTPUT(crypto_auth_hmacsha512256_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer));
+
+    stodium_release_output(jenv, state, &state_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1final_1array) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jbyteArray dst, jint dst_offset, jint dst_length) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+
+    jint result = (jint) crypto_auth_hmacsha512256_final(
+            AS_OUTPUT(crypto_auth_hmacsha512256_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer));
+
+    stodium_release_output(jenv, state, &state_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+
+    return result;
+}
+
+/**
+ * stodium_auth_hmacsha512256_update adapts crypto_auth_hmacsha512256_update to stodium_update_fn.
+ */
+static int stodium_auth_hmacsha512256_update(void *state, const unsigned char *in, size_t inlen) {
+    return crypto_auth_hmacsha512256_update((crypto_auth_hmacsha512256_state *) state, in, (unsigned long long) inlen);
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1updatev) (JNIEnv *jenv, jclass jcls,
+        jobject      state,
+        jobjectArray srcs,
+        jint         offset,
+        jint         length) {
+    return stodium_updatev(jenv, state, srcs, offset, length, stodium_auth_hmacsha512256_update);
+}
+
+/**
+ * stodium_auth_hmacsha512256_file computes the MAC of a range of a file, see
+ * stodium_file_update.
+ */
+static int stodium_auth_hmacsha512256_file(int fd, jlong offset, jlong length,
+        unsigned char *out, size_t outlen,
+        const unsigned char *key, size_t keylen) {
+    crypto_auth_hmacsha512256_state state;
+    int result;
+
+    if (crypto_auth_hmacsha512256_init(&state, key, keylen) != 0) {
+        return -1;
+    }
+    result = stodium_file_update(fd, offset, length, stodium_auth_hmacsha512256_update, &state);
+    if (result == 0 && crypto_auth_hmacsha512256_final(&state, out) != 0) {
+        result = -1;
+    }
+    sodium_memzero(&state, sizeof state);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1fd) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject key,
+        jint    fd,
+        jlong   offset,
+        jlong   length) {
+    return stodium_file_digest(jenv, dst, key, fd, offset, length, stodium_auth_hmacsha512256_file);
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1file) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject key,
+        jstring path,
+        jlong   offset,
+        jlong   length) {
+    return stodium_path_digest(jenv, dst, key, path, offset, length, stodium_auth_hmacsha512256_file);
+}
+
+/**
+ * crypto_auth_hmacsha512256_beforenm runs the key setup of HMAC once, and keeps the
+ * resulting state (the inner and outer hash states after absorbing the padded
+ * key) in guarded native memory. The state must be released through
+ * crypto_auth_hmacsha512256_state_free.
+ */
+STODIUM_JNI(jlong, crypto_1auth_1hmacsha512256_1beforenm) (JNIEnv *jenv, jclass jcls,
+        jobject key) {
+    crypto_auth_hmacsha512256_state *state;
+    stodium_buffer key_buffer;
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    state = (crypto_auth_hmacsha512256_state *) sodium_malloc(sizeof(crypto_auth_hmacsha512256_state));
+    if (state != NULL) {
+        if (crypto_auth_hmacsha512256_init(state,
+                AS_INPUT(unsigned char, key_buffer),
+                AS_INPUT_LEN(size_t, key_buffer)) == 0) {
+            sodium_mprotect_readonly(state);
+        } else {
+            sodium_free(state);
+            state = NULL;
+        }
+    }
+
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return (jlong) (intptr_t) state;
+}
+
+STODIUM_JNI(void, crypto_1auth_1hmacsha512256_1state_1free) (JNIEnv *jenv, jclass jcls,
+        jlong state) {
+    sodium_free((void *) (intptr_t) state);
+}
+
+/**
+ * stodium_auth_hmacsha512256_afternm computes the MAC of inlen bytes of in from a copy
+ * of a precomputed key state.
+ */
+static int stodium_auth_hmacsha512256_afternm(unsigned char *out,
+        const unsigned char *in, unsigned long long inlen,
+        const crypto_auth_hmacsha512256_state *key) {
+    crypto_auth_hmacsha512256_state state;
+    int result;
+
+    memcpy(&state, key, sizeof state);
+    result = crypto_auth_hmacsha512256_update(&state, in, inlen);
+    if (result == 0) {
+        result = crypto_auth_hmacsha512256_final(&state, out);
+    }
+    sodium_memzero(&state, sizeof state);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1afternm) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jlong   state) {
+    stodium_buffer mac_buffer, src_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) stodium_auth_hmacsha512256_afternm(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            (const crypto_auth_hmacsha512256_state *) (intptr_t) state);
+
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1verify_1afternm) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jlong   state) {
+    unsigned char expected[crypto_auth_hmacsha512256_BYTES];
+    stodium_buffer mac_buffer, src_buffer;
+    stodium_get_buffer_critical(jenv, &mac_buffer, mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    if (STODIUM_ENTER_CRITICAL(jenv, &mac_buffer, &src_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) stodium_auth_hmacsha512256_afternm(
+            expected,
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            (const crypto_auth_hmacsha512256_state *) (intptr_t) state);
+    if (result == 0) {
+        result = (jint) crypto_verify_32(AS_INPUT(unsigned char, mac_buffer), expected);
+    }
+
+    stodium_release_input(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    sodium_memzero(expected, sizeof expected);
+
+    return result;
+}
+
+/** ****************************************************************************
+ *
+ * BOX
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT_STR(box)
+STODIUM_CONSTANT_HL(box, sealbytes)
+
+STODIUM_JNI(jint, crypto_1box_1seal) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject pub) {
+    stodium_buffer dst_buffer, src_buffer, pub_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+
+    jint result = (jint) crypto_box_seal(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, pub_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1seal_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray pub, jint pub_offset, jint pub_length) {
+    stodium_buffer dst_buffer, src_buffer, pub_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &pub_buffer, pub, pub_offset, pub_length);
+
+    jint result = (jint) crypto_box_seal(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, pub_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1seal_1open) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject pub,
+        jobject priv) {
+    stodium_buffer dst_buffer, src_buffer, pub_buffer, priv_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+
+    jint result = (jint) crypto_box_seal_open(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1seal_1open_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray pub, jint pub_offset, jint pub_length,
+        jbyteArray priv, jint priv_offset, jint priv_length) {
+    stodium_buffer dst_buffer, src_buffer, pub_buffer, priv_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &pub_buffer, pub, pub_offset, pub_length);
+    stodium_get_array(jenv, &priv_buffer, priv, priv_offset, priv_length);
+
+    jint result = (jint) crypto_box_seal_open(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+/**
+ * crypto_box_seal_ephemeral is crypto_box_seal with an ephemeral key pair that
+ * was generated ahead of time, passed in as the public key followed by the
+ * secret key. The output can be opened by crypto_box_seal_open. The ephemeral
+ * secret key is wiped, so a key pair can never be used twice.
+ */
+STODIUM_JNI(jint, crypto_1box_1seal_1ephemeral) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject pub,
+        jobject ephemeral) {
+    crypto_generichash_state st;
+    unsigned char            nonce[crypto_box_NONCEBYTES];
+    unsigned char           *epk, *esk;
+    stodium_buffer dst_buffer, src_buffer, pub_buffer, ephemeral_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &ephemeral_buffer, ephemeral);
+
+    epk = AS_OUTPUT(unsigned char, ephemeral_buffer);
+    esk = epk + crypto_box_PUBLICKEYBYTES;
+
+    // nonce = BLAKE2b(epk || pk), as computed by crypto_box_seal
+    crypto_generichash_init(&st, NULL, 0U, sizeof nonce);
+    crypto_generichash_update(&st, epk, crypto_box_PUBLICKEYBYTES);
+    crypto_generichash_update(&st, AS_INPUT(unsigned char, pub_buffer), crypto_box_PUBLICKEYBYTES);
+    crypto_generichash_final(&st, nonce, sizeof nonce);
+
+    jint result = (jint) crypto_box_easy(
+            AS_OUTPUT(unsigned char, dst_buffer) + crypto_box_PUBLICKEYBYTES,
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            nonce,
+            AS_INPUT(unsigned char, pub_buffer),
+            esk);
+    memcpy(AS_OUTPUT(unsigned char, dst_buffer), epk, crypto_box_PUBLICKEYBYTES);
+
+    sodium_memzero(esk, crypto_box_SECRETKEYBYTES);
+    sodium_memzero(nonce, sizeof nonce);
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_output(jenv, ephemeral, &ephemeral_buffer);
+
+    return result;
+}
+
+/**
+ * STODIUM_BOX_KEYIDBYTES is the length of the key id that precedes every
+ * sealed key produced by crypto_box_seal_batch: the first bytes of the
+ * BLAKE2b digest of the recipient's public key.
+ */
+#define STODIUM_BOX_KEYIDBYTES 8U
+
+/**
+ * stodium_box_seal_job seals the same short message (typically a key) for a
+ * list of recipients, run as one pool task per recipient. Entry i of dst is
+ * the key id of public key i, followed by the message sealed for it.
+ */
+typedef struct stodium_box_seal_jobs {
+    unsigned char       *dst;
+    const unsigned char *pubs;
+    const unsigned char *src;
+    size_t               srclen;
+    int                  failed;
+} stodium_box_seal_job;
+
+static void stodium_box_seal_task(void *ctx, size_t index) {
+    stodium_box_seal_job *job   = (stodium_box_seal_job *) ctx;
+    const unsigned char  *pk    = job->pubs + index * crypto_box_PUBLICKEYBYTES;
+    unsigned char        *entry = job->dst + index * (STODIUM_BOX_KEYIDBYTES + crypto_box_SEALBYTES + job->srclen);
+    unsigned char         id[crypto_generichash_BYTES_MIN];
+
+    crypto_generichash(id, sizeof id, pk, crypto_box_PUBLICKEYBYTES, NULL, 0U);
+    memcpy(entry, id, STODIUM_BOX_KEYIDBYTES);
+
+    if (crypto_box_seal(entry + STODIUM_BOX_KEYIDBYTES, job->src, (unsigned long long) job->srclen, pk) != 0) {
+        __sync_fetch_and_add(&job->failed, 1);
+    }
+}
+
+/**
+ * crypto_box_seal_batch seals src for every public key in pubs (concatenated),
+ * spreading the recipients over the thread pool. Returns the number of
+ * recipients for which sealing failed. The Java layer validates the size of
+ * dst before calling into native code.
+ */
+STODIUM_JNI(jint, crypto_1box_1seal_1batch) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject pubs) {
+    stodium_buffer       dst_buffer, src_buffer, pubs_buffer;
+    stodium_box_seal_job job;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &pubs_buffer, pubs);
+
+    job.dst    = AS_OUTPUT(unsigned char, dst_buffer);
+    job.pubs   = AS_INPUT(unsigned char, pubs_buffer);
+    job.src    = AS_INPUT(unsigned char, src_buffer);
+    job.srclen = AS_INPUT_LEN(size_t, src_buffer);
+    job.failed = 0;
+
+    stodium_pool_run(stodium_box_seal_task, &job, AS_INPUT_LEN(size_t, pubs_buffer) / crypto_box_PUBLICKEYBYTES);
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, pubs, &pubs_buffer);
+
+    return (jint) job.failed;
+}
+
+/** ****************************************************************************
+ *
+ * BOX - X25519XSalsa20Poly1305
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, seedbytes)
+STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, publickeybytes)
+STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, secretkeybytes)
+STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, beforenmbytes)
+STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, noncebytes)
+STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, zerobytes)
+STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, boxzerobytes)
+STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, macbytes)
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1seed_1keypair) (JNIEnv *jenv, jclass jcls,
+        jobject pk,
+        jobject sk,
+        jobject seed) {
+    stodium_buffer pk_buffer, sk_buffer, seed_buffer;
+    stodium_get_buffer(jenv, &pk_buffer, pk);
+    stodium_get_buffer(jenv, &sk_buffer, sk);
+    stodium_get_buffer(jenv, &seed_buffer, seed);
+
+    jint result = (jint) crypto_box_curve25519xsalsa20poly1305_seed_keypair(
+            AS_OUTPUT(unsigned char, pk_buffer),
+            AS_OUTPUT(unsigned char, sk_buffer),
+            AS_INPUT(unsigned char, seed_buffer));
+
+    stodium_release_output(jenv, pk, &pk_buffer);
+    stodium_release_output(jenv, sk, &sk_buffer);
+    stodium_release_input(jenv, seed, &seed_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1keypair) (JNIEnv *jenv, jclass jcls,
+        jobject pk,
+        jobject sk) {
+    stodium_buffer pk_buffer, sk_buffer;
+    stodium_get_buffer(jenv, &pk_buffer, pk);
+    stodium_get_buffer(jenv, &sk_buffer, sk);
+
+    jint result = (jint) crypto_box_curve25519xsalsa20poly1305_keypair(
+            AS_OUTPUT(unsigned char, pk_buffer),
+            AS_OUTPUT(unsigned char, sk_buffer));
+
+    stodium_release_output(jenv, pk, &pk_buffer);
+    stodium_release_output(jenv, sk, &sk_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1beforenm) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject pub,
+        jobject priv) {
+    stodium_buffer dst_buffer, pub_buffer, priv_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+
+    jint result = (jint) crypto_box_curve25519xsalsa20poly1305_beforenm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+static int stodium_box_curve25519xsalsa20poly1305_beforenm_dh(unsigned char *rx, unsigned char *tx,
+        const unsigned char *pk, const unsigned char *sk, const unsigned char *peer) {
+    return crypto_box_curve25519xsalsa20poly1305_beforenm(rx, peer, sk);
+}
+
+/**
+ * crypto_box_curve25519xsalsa20poly1305_beforenm_batch precomputes the shared keys
+ * between priv and every public key in pubs, see stodium_dh_batch.
+ */
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1beforenm_1batch) (JNIEnv *jenv, jclass jcls,
+        jobject   dst,
+        jobject   pubs,
+        jobject   priv,
+        jintArray status,
+        jboolean  parallel) {
+    return stodium_dh_batch(jenv, stodium_box_curve25519xsalsa20poly1305_beforenm_dh,
+            crypto_box_curve25519xsalsa20poly1305_BEFORENMBYTES,
+            crypto_box_curve25519xsalsa20poly1305_PUBLICKEYBYTES,
+            dst, NULL, NULL, priv, pubs, status, parallel);
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1beforenm_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray pub, jint pub_offset, jint pub_length,
+        jbyteArray priv, jint priv_offset, jint priv_length) {
+    stodium_buffer dst_buffer, pub_buffer, priv_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &pub_buffer, pub, pub_offset, pub_length);
+    stodium_get_array(jenv, &priv_buffer, priv, priv_offset, priv_length);
+
+    jint result = (jint) crypto_box_curve25519xsalsa20poly1305_beforenm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+/**
+ * crypto_box_curve25519xsalsa20poly1305_beforenm_handle computes the shared key of a key pair
+ * directly into a stodium_key_handle, so it never enters the Java heap. Returns
+ * 0 if the allocation failed or the public key was rejected.
+ */
+STODIUM_JNI(jlong, crypto_1box_1curve25519xsalsa20poly1305_1beforenm_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject pub,
+        jobject priv) {
+    stodium_key_handle *handle;
+    stodium_buffer pub_buffer, priv_buffer;
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+
+    handle = stodium_key_handle_alloc(crypto_box_curve25519xsalsa20poly1305_BEFORENMBYTES);
+    if (handle != NULL && crypto_box_curve25519xsalsa20poly1305_beforenm(handle->key,
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer)) != 0) {
+        sodium_free(handle);
+        handle = NULL;
+    }
+    if (handle != NULL) {
+        sodium_mprotect_readonly(handle);
+    }
+
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return (jlong) (intptr_t) handle;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1afternm) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) crypto_box_curve25519xsalsa20poly1305_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1easy_1afternm_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
+
+    jint result = (jint) crypto_box_easy_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1easy_1afternm_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer, key, key_length);
+
+    jint result = (jint) crypto_box_easy_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1easy_1afternm_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+
+    jint result = (jint) crypto_box_easy_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1open_1afternm) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) crypto_box_curve25519xsalsa20poly1305_open_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1open_1easy_1afternm_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
+
+    jint result = (jint) crypto_box_open_easy_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1open_1easy_1afternm_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer, key, key_length);
+
+    jint result = (jint) crypto_box_open_easy_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1open_1easy_1afternm_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+
+    jint result = (jint) crypto_box_open_easy_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject nonce,
+        jobject pub,
+        jobject priv) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, pub_buffer, priv_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+
+    jint result = (jint) crypto_box_curve25519xsalsa20poly1305(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1easy_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray pub, jint pub_offset, jint pub_length,
+        jbyteArray priv, jint priv_offset, jint priv_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, pub_buffer, priv_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array(jenv, &pub_buffer, pub, pub_offset, pub_length);
+    stodium_get_array(jenv, &priv_buffer, priv, priv_offset, priv_length);
+
+    jint result = (jint) crypto_box_easy(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1open) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject nonce,
+        jobject pub,
+        jobject priv) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, pub_buffer, priv_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+
+    jint result = (jint) crypto_box_curve25519xsalsa20poly1305_open(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1open_1easy_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray pub, jint pub_offset, jint pub_length,
+        jbyteArray priv, jint priv_offset, jint priv_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, pub_buffer, priv_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array(jenv, &pub_buffer, pub, pub_offset, pub_length);
+    stodium_get_array(jenv, &priv_buffer, priv, priv_offset, priv_length);
+
+    jint result = (jint) crypto_box_open_easy(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1easy_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jint    plain_length,
+        jobject nonce,
+        jobject pub,
+        jobject priv) {
+    stodium_buffer buf_buffer, nonce_buffer, pub_buffer, priv_buffer;
+    stodium_get_buffer(jenv, &buf_buffer, buf);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+
+    // The MAC is prepended, so the plain text overlaps the cipher text at an
+    // offset of MACBYTES; libsodium moves the message into place first
+    jint result = (jint) crypto_box_easy(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            (unsigned long long) plain_length,
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, buf, &buf_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1open_1easy_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject nonce,
+        jobject pub,
+        jobject priv) {
+    stodium_buffer buf_buffer, nonce_buffer, pub_buffer, priv_buffer;
+    stodium_get_buffer(jenv, &buf_buffer, buf);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+
+    jint result = (jint) crypto_box_open_easy(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, buf, &buf_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1easy_1afternm_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jint    plain_length,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer(jenv, &buf_buffer, buf);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) crypto_box_easy_afternm(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            (unsigned long long) plain_length,
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf, &buf_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1open_1easy_1afternm_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer(jenv, &buf_buffer, buf);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) crypto_box_open_easy_afternm(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf, &buf_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+/** ****************************************************************************
+ *
+ * BOX - X25519XChacha20Poly1305
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT(box, curve25519xchacha20poly1305, seedbytes)
+STODIUM_CONSTANT(box, curve25519xchacha20poly1305, publickeybytes)
+STODIUM_CONSTANT(box, curve25519xchacha20poly1305, secretkeybytes)
+STODIUM_CONSTANT(box, curve25519xchacha20poly1305, beforenmbytes)
+STODIUM_CONSTANT(box, curve25519xchacha20poly1305, noncebytes)
+STODIUM_CONSTANT(box, curve25519xchacha20poly1305, macbytes)
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1seed_1keypair) (JNIEnv *jenv, jclass jcls,
+        jobject pk,
+        jobject sk,
+        jobject seed) {
+    stodium_buffer pk_buffer, sk_buffer, seed_buffer;
+    stodium_get_buffer(jenv, &pk_buffer, pk);
+    stodium_get_buffer(jenv, &sk_buffer, sk);
+    stodium_get_buffer(jenv, &seed_buffer, seed);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_seed_keypair(
+            AS_OUTPUT(unsigned char, pk_buffer),
+            AS_OUTPUT(unsigned char, sk_buffer),
+            AS_INPUT(unsigned char, seed_buffer));
+
+    stodium_release_output(jenv, pk, &pk_buffer);
+    stodium_release_output(jenv, sk, &sk_buffer);
+    stodium_release_input(jenv, seed, &seed_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1keypair) (JNIEnv *jenv, jclass jcls,
+        jobject pk,
+        jobject sk) {
+    stodium_buffer pk_buffer, sk_buffer;
+    stodium_get_buffer(jenv, &pk_buffer, pk);
+    stodium_get_buffer(jenv, &sk_buffer, sk);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_keypair(
+            AS_OUTPUT(unsigned char, pk_buffer),
+            AS_OUTPUT(unsigned char, sk_buffer));
+
+    stodium_release_output(jenv, pk, &pk_buffer);
+    stodium_release_output(jenv, sk, &sk_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1beforenm) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject pub,
+        jobject priv) {
+    stodium_buffer dst_buffer, pub_buffer, priv_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_beforenm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+static int stodium_box_curve25519xchacha20poly1305_beforenm_dh(unsigned char *rx, unsigned char *tx,
+        const unsigned char *pk, const unsigned char *sk, const unsigned char *peer) {
+    return crypto_box_curve25519xchacha20poly1305_beforenm(rx, peer, sk);
+}
+
+/**
+ * crypto_box_curve25519xchacha20poly1305_beforenm_batch precomputes the shared keys
+ * between priv and every public key in pubs, see stodium_dh_batch.
+ */
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1beforenm_1batch) (JNIEnv *jenv, jclass jcls,
+        jobject   dst,
+        jobject   pubs,
+        jobject   priv,
+        jintArray status,
+        jboolean  parallel) {
+    return stodium_dh_batch(jenv, stodium_box_curve25519xchacha20poly1305_beforenm_dh,
+            crypto_box_curve25519xchacha20poly1305_BEFORENMBYTES,
+            crypto_box_curve25519xchacha20poly1305_PUBLICKEYBYTES,
+            dst, NULL, NULL, priv, pubs, status, parallel);
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1beforenm_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray pub, jint pub_offset, jint pub_length,
+        jbyteArray priv, jint priv_offset, jint priv_length) {
+    stodium_buffer dst_buffer, pub_buffer, priv_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &pub_buffer, pub, pub_offset, pub_length);
+    stodium_get_array(jenv, &priv_buffer, priv, priv_offset, priv_length);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_beforenm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+/**
+ * crypto_box_curve25519xchacha20poly1305_beforenm_handle computes the shared key of a key pair
+ * directly into a stodium_key_handle, so it never enters the Java heap. Returns
+ * 0 if the allocation failed or the public key was rejected.
+ */
+STODIUM_JNI(jlong, crypto_1box_1curve25519xchacha20poly1305_1beforenm_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject pub,
+        jobject priv) {
+    stodium_key_handle *handle;
+    stodium_buffer pub_buffer, priv_buffer;
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+
+    handle = stodium_key_handle_alloc(crypto_box_curve25519xchacha20poly1305_BEFORENMBYTES);
+    if (handle != NULL && crypto_box_curve25519xchacha20poly1305_beforenm(handle->key,
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer)) != 0) {
+        sodium_free(handle);
+        handle = NULL;
+    }
+    if (handle != NULL) {
+        sodium_mprotect_readonly(handle);
+    }
+
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return (jlong) (intptr_t) handle;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1easy_1afternm) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_easy_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1easy_1afternm_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer, key, key_length);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_easy_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1easy_1afternm_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_easy_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1easy_1afternm_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_easy_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1open_1easy_1afternm) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_open_easy_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1open_1easy_1afternm_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer, key, key_length);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_open_easy_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1open_1easy_1afternm_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_open_easy_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1open_1easy_1afternm_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_open_easy_afternm(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1easy) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject nonce,
+        jobject pub,
+        jobject priv) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, pub_buffer, priv_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_easy(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1easy_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray pub, jint pub_offset, jint pub_length,
+        jbyteArray priv, jint priv_offset, jint priv_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, pub_buffer, priv_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array(jenv, &pub_buffer, pub, pub_offset, pub_length);
+    stodium_get_array(jenv, &priv_buffer, priv, priv_offset, priv_length);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_easy(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1open_1easy) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject nonce,
+        jobject pub,
+        jobject priv) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, pub_buffer, priv_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_open_easy(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1open_1easy_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray pub, jint pub_offset, jint pub_length,
+        jbyteArray priv, jint priv_offset, jint priv_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, pub_buffer, priv_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array(jenv, &pub_buffer, pub, pub_offset, pub_length);
+    stodium_get_array(jenv, &priv_buffer, priv, priv_offset, priv_length);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_open_easy(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1easy_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jint    plain_length,
+        jobject nonce,
+        jobject pub,
+        jobject priv) {
+    stodium_buffer buf_buffer, nonce_buffer, pub_buffer, priv_buffer;
+    stodium_get_buffer(jenv, &buf_buffer, buf);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+
+    // The MAC is prepended, so the plain text overlaps the cipher text at an
+    // offset of MACBYTES; libsodium moves the message into place first
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_easy(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            (unsigned long long) plain_length,
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, buf, &buf_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1open_1easy_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject nonce,
+        jobject pub,
+        jobject priv) {
+    stodium_buffer buf_buffer, nonce_buffer, pub_buffer, priv_buffer;
+    stodium_get_buffer(jenv, &buf_buffer, buf);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_open_easy(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, pub_buffer),
+            AS_INPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, buf, &buf_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1easy_1afternm_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jint    plain_length,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer(jenv, &buf_buffer, buf);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_easy_afternm(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            (unsigned long long) plain_length,
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf, &buf_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1open_1easy_1afternm_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer(jenv, &buf_buffer, buf);
+    stodium_get_buffer(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) crypto_box_curve25519xchacha20poly1305_open_easy_afternm(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, buf, &buf_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+/** ****************************************************************************
+ *
+ * CODECS
+ *
+ **************************************************************************** */
+
+/** ****************************************************************************
+ *
+ * CODECS - HEX
+ *
+ **************************************************************************** */
+
+STODIUM_JNI(jint, sodium_1bin2hex) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+
+    sodium_bin2hex(
+            AS_OUTPUT(char, dst_buffer),
+            AS_INPUT_LEN(size_t, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(size_t, src_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    
+    return (jint) 0;
+}
+
+STODIUM_JNI(jint, sodium_1hex2bin) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+
+    jint result = (jint) sodium_hex2bin(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT_LEN(size_t, dst_buffer),
+            AS_INPUT(char, src_buffer),
+            AS_INPUT_LEN(size_t, src_buffer),
+            NULL,
+            NULL,
+            NULL);
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    
+    return result;
+}
+
+/** ****************************************************************************
+ *
+ * CODECS - BASE64
+ *
+ **************************************************************************** */
+
+STODIUM_JNI(jint, stodium_1base64_1variant_1original) (JNIEnv *jenv, jclass jcls) {
+        return (jint) sodium_base64_VARIANT_ORIGINAL;
+}
+STODIUM_JNI(jint, stodium_1base64_1variant_1original_1no_1padding) (JNIEnv *jenv, jclass jcls) {
+        return (jint) sodium_base64_VARIANT_ORIGINAL_NO_PADDING;
+}
+STODIUM_JNI(jint, stodium_1base64_1variant_1urlsafe) (JNIEnv *jenv, jclass jcls) {
+        return (jint) sodium_base64_VARIANT_URLSAFE;
+}
+STODIUM_JNI(jint, stodium_1base64_1variant_1urlsafe_1no_1padding) (JNIEnv *jenv, jclass jcls) {
+        return (jint) sodium_base64_VARIANT_URLSAFE_NO_PADDING;
+}
+
+STODIUM_JNI(jint, sodium_1base64_1encoded_1len) (JNIEnv *jenv, jclass jcls,
+        jint bin_len,
+        jint variant) {
+    return (jint) sodium_base64_encoded_len(
+            (const size_t) bin_len,
+            (const int) variant);
+}
+
+STODIUM_JNI(jint, sodium_1bin2base64) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jint variant) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+
+    sodium_bin2base64(
+            AS_OUTPUT(char, dst_buffer),
+            AS_INPUT_LEN(size_t, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(size_t, src_buffer),
+            (const int) variant);
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    
+    return 0;
+}
+
+STODIUM_JNI(jint, sodium_1base642bin) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jint variant) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+
+    jint result = (jint) sodium_base642bin(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT_LEN(size_t, dst_buffer),
+            AS_INPUT(char, src_buffer),
+            AS_INPUT_LEN(size_t, src_buffer),
+            NULL,
+            AS_OUTPUT_LEN(size_t, dst_buffer),
+            NULL,
+            (const int) variant);
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    
+    return result;
+}
+
+/** ****************************************************************************
+ *
+ * CORE - HCHACHA
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT(core, hchacha20, outputbytes)
+STODIUM_CONSTANT(core, hchacha20, inputbytes)
+STODIUM_CONSTANT(core, hchacha20, keybytes)
+STODIUM_CONSTANT(core, hchacha20, constbytes)
+
+STODIUM_JNI(jint, crypto_1core_1hchacha20) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject key,
+        jobject constant) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer, const_buffer;
+    stodium_get_buffer(jenv, &dst_buffer,   dst);
+    stodium_get_buffer(jenv, &src_buffer,   src);
+    stodium_get_buffer(jenv, &key_buffer,   key);
+    stodium_get_buffer(jenv, &const_buffer, constant);
+
+    jint result = (jint) crypto_core_hchacha20(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT(unsigned char, const_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_input(jenv, constant, &const_buffer);
+    
+    return result;
+}
+
+/** ****************************************************************************
+ *
+ * CORE - HSALSA20
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT(core, hsalsa20, outputbytes)
+STODIUM_CONSTANT(core, hsalsa20, inputbytes)
+STODIUM_CONSTANT(core, hsalsa20, keybytes)
+STODIUM_CONSTANT(core, hsalsa20, constbytes)
+
+STODIUM_JNI(jint, crypto_1core_1hsalsa20) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject key,
+        jobject constant) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer, const_buffer;
+    stodium_get_buffer(jenv, &dst_buffer,   dst);
+    stodium_get_buffer(jenv, &src_buffer,   src);
+    stodium_get_buffer(jenv, &key_buffer,   key);
+    stodium_get_buffer(jenv, &const_buffer, constant);
+
+    jint result = (jint) crypto_core_hsalsa20(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT(unsigned char, const_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_input(jenv, constant, &const_buffer);
+    
+    return result;
+}
+
+/** ****************************************************************************
+ *
+ * GENERICHASH
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT_STR(generichash)
+
+/** ****************************************************************************
+ *
+ * GENERICHASH - Blake2b
+ *
+ **************************************************************************** */
+STODIUM_CONSTANT(generichash, blake2b, bytes)
+STODIUM_CONSTANT(generichash, blake2b, keybytes)
+STODIUM_CONSTANT(generichash, blake2b, saltbytes)
+STODIUM_CONSTANT(generichash, blake2b, personalbytes)
+STODIUM_CONSTANT(generichash, blake2b, statebytes)
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1bytes_1min) (JNIEnv *jenv, jclass jcls) {
+    return (jint) crypto_generichash_blake2b_bytes_min();
+}
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1bytes_1max) (JNIEnv *jenv, jclass jcls) {
+    return (jint) crypto_generichash_blake2b_bytes_max();
+}
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1keybytes_1min) (JNIEnv *jenv, jclass jcls) {
+    return (jint) crypto_generichash_blake2b_keybytes_min();
+}
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1keybytes_1max) (JNIEnv *jenv, jclass jcls) {
+    return (jint) crypto_generichash_blake2b_keybytes_max();
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) crypto_generichash_blake2b(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT_LEN(size_t, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT_LEN(size_t, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&key_buffer, key, key_length);
+
+    jint result = (jint) crypto_generichash_blake2b(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT_LEN(size_t, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT_LEN(size_t, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
+
+    jint result = (jint) crypto_generichash_blake2b(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT_LEN(size_t, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT_LEN(size_t, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1salt_1personal) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject key,
+        jobject salt,
+        jobject personal) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer, salt_buffer, pers_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_get_buffer(jenv, &salt_buffer, salt);
+    stodium_get_buffer(jenv, &pers_buffer, personal);
+
+    jint result = (jint) crypto_generichash_blake2b_salt_personal(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT_LEN(size_t, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT_LEN(size_t, key_buffer),
+            AS_INPUT(unsigned char, salt_buffer),
+            AS_INPUT(unsigned char, pers_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_input(jenv, salt, &salt_buffer);
+    stodium_release_input(jenv, personal, &pers_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1init) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jobject key,
+        jint    outlen) {
+    stodium_buffer dst_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, state);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) crypto_generichash_blake2b_init(
+            AS_OUTPUT(crypto_generichash_blake2b_state, dst_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT_LEN(size_t, key_buffer),
+            (size_t) outlen);
+
+    stodium_release_output(jenv, state, &dst_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1init_1address) (JNIEnv *jenv, jclass jcls,
+        jlong state, jint state_length,
+        jlong key, jint key_length,
+        jint    outlen) {
+    stodium_buffer dst_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, state, state_length);
+    stodium_get_address(&key_buffer, key, key_length);
+
+    jint result = (jint) crypto_generichash_blake2b_init(
+            AS_OUTPUT(crypto_generichash_blake2b_state, dst_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT_LEN(size_t, key_buffer),
+            (size_t) outlen);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1init_1array) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jbyteArray key, jint key_offset, jint key_length,
+        jint outlen) {
+    stodium_buffer dst_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, state);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
+
+    jint result = (jint) crypto_generichash_blake2b_init(
+            AS_OUTPUT(crypto_generichash_blake2b_state, dst_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT_LEN(size_t, key_buffer),
+            (size_t) outlen);
+
+    stodium_release_output(jenv, state, &dst_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1update) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jobject src) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, state);
+    stodium_get_buffer(jenv, &src_buffer, src);
+
+    jint result = (jint) crypto_generichash_blake2b_update(
+            AS_OUTPUT(crypto_generichash_blake2b_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, state, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1update_1address) (JNIEnv *jenv, jclass jcls,
+        jlong state, jint state_length,
+        jlong src, jint src_length) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_address(&dst_buffer, state, state_length);
+    stodium_get_address(&src_buffer, src, src_length);
+
+    jint result = (jint) crypto_generichash_blake2b_update(
+            AS_OUTPUT(crypto_generichash_blake2b_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1update_1array) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jbyteArray src, jint src_offset, jint src_length) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, state);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+
+    jint result = (jint) crypto_generichash_blake2b_update(
+            AS_OUTPUT(crypto_generichash_blake2b_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, state, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1final) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jobject dst) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &state_buffer, state);
+
+    jint result = (jint) crypto_generichash_blake2b_final(
+            AS_OUTPUT(crypto_generichash_blake2b_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT_LEN(size_t, dst_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_output(jenv, state, &state_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1final_1address) (JNIEnv *jenv, jclass jcls,
+        jlong state, jint state_length,
+        jlong dst, jint dst_length) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&state_buffer, state, state_length);
+
+    jint result = (jint) crypto_generichash_blake2b_final(
+            AS_OUTPUT(crypto_generichash_blake2b_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT_LEN(size_t, dst_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1final_1array) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jbyteArray dst, jint dst_offset, jint dst_length) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_buffer(jenv, &state_buffer, state);
+
+    jint result = (jint) crypto_generichash_blake2b_final(
+            AS_OUTPUT(crypto_generichash_blake2b_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT_LEN(size_t, dst_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_output(jenv, state, &state_buffer);
+
+    return result;
+}
+
+/**
+ * stodium_generichash_blake2b_update adapts crypto_generichash_blake2b_update to stodium_update_fn.
+ */
+static int stodium_generichash_blake2b_update(void *state, const unsigned char *in, size_t inlen) {
+    return crypto_generichash_blake2b_update((crypto_generichash_blake2b_state *) state, in, (unsigned long long) inlen);
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1updatev) (JNIEnv *jenv, jclass jcls,
+        jobject      state,
+        jobjectArray srcs,
+        jint         offset,
+        jint         length) {
+    return stodium_updatev(jenv, state, srcs, offset, length, stodium_generichash_blake2b_update);
+}
+
+/**
+ * stodium_generichash_blake2b_file computes the hash of a range of a file, see
+ * stodium_file_update.
+ */
+static int stodium_generichash_blake2b_file(int fd, jlong offset, jlong length,
+        unsigned char *out, size_t outlen,
+        const unsigned char *key, size_t keylen) {
+    crypto_generichash_blake2b_state state;
+    int result;
+
+    if (crypto_generichash_blake2b_init(&state, key, keylen, outlen) != 0) {
+        return -1;
+    }
+    result = stodium_file_update(fd, offset, length, stodium_generichash_blake2b_update, &state);
+    if (result == 0 && crypto_generichash_blake2b_final(&state, out, outlen) != 0) {
+        result = -1;
+    }
+    sodium_memzero(&state, sizeof state);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1fd) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject key,
+        jint    fd,
+        jlong   offset,
+        jlong   length) {
+    return stodium_file_digest(jenv, dst, key, fd, offset, length, stodium_generichash_blake2b_file);
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1file) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject key,
+        jstring path,
+        jlong   offset,
+        jlong   length) {
+    return stodium_path_digest(jenv, dst, key, path, offset, length, stodium_generichash_blake2b_file);
+}
+
+/**
+ * STODIUM_TREE_LEAFBYTES is the size of the digest of a single leaf of a
+ * BLAKE2b tree hash.
+ */
+#define STODIUM_TREE_LEAFBYTES 32U
+
+/**
+ * stodium_tree_personal marks every node of a BLAKE2b tree hash, so a tree
+ * hash never collides with a plain BLAKE2b hash of the same data.
+ */
+static const unsigned char stodium_tree_personal[16] = {
+    's', 't', 'o', 'd', 'i', 'u', 'm', '.', 'b', '2', 't', 'r', 'e', 'e', 0, 0
+};
+
+/**
+ * stodium_tree_salt encodes the position of a node in the tree into a BLAKE2b
+ * salt: the node offset (8 bytes, little endian), followed by the leaf size
+ * (4 bytes, little endian) and the node depth (1 byte, 0 for the leaves and 1
+ * for the root). libsodium does not expose the node parameters of the BLAKE2b
+ * parameter block, so the salt takes their place.
+ */
+static void stodium_tree_salt(unsigned char salt[16], uint64_t offset, uint32_t leaf_size, unsigned char depth) {
+    size_t i;
+
+    memset(salt, 0, 16);
+    for (i = 0; i < 8; i++) {
+        salt[i] = (unsigned char) (offset >> (8 * i));
+    }
+    for (i = 0; i < 4; i++) {
+        salt[8 + i] = (unsigned char) (leaf_size >> (8 * i));
+    }
+    salt[12] = depth;
+}
+
+/**
+ * stodium_tree_job describes the hashing of a run of consecutive leaves, either
+ * from memory (src) or from a file (fd), as one pool task per leaf.
+ */
+typedef struct stodium_tree_jobs {
+    unsigned char       *dst;
+    const unsigned char *src;    // read when fd is -1
+    jlong                length; // bytes of src, or the size of the file
+    int                  fd;
+    size_t               leaf_size;
+    uint64_t             first;
+    const unsigned char *key;
+    size_t               keylen;
+    int                  error;  // first failure, see stodium_file_update
+} stodium_tree_job;
+
+static int stodium_tree_update(void *state, const unsigned char *in, size_t inlen) {
+    return crypto_generichash_blake2b_update((crypto_generichash_blake2b_state *) state,
+            in, (unsigned long long) inlen);
+}
+
+static void stodium_tree_leaf_task(void *ctx, size_t index) {
+    stodium_tree_job                  *job  = (stodium_tree_job *) ctx;
+    uint64_t                           leaf = job->first + (uint64_t) index;
+    crypto_generichash_blake2b_state   state;
+    unsigned char                      salt[16];
+    jlong                              offset, length;
+    int                                result;
+
+    stodium_tree_salt(salt, leaf, (uint32_t) job->leaf_size, 0);
+
+    if (job->fd < 0) {
+        offset = (jlong) (index * job->leaf_size);
+        length = job->length - offset;
+        if (length > (jlong) job->leaf_size) {
+            length = (jlong) job->leaf_size;
+        }
+        result = crypto_generichash_blake2b_salt_personal(
+                job->dst + index * STODIUM_TREE_LEAFBYTES, STODIUM_TREE_LEAFBYTES,
+                job->src + offset, (unsigned long long) length,
+                job->key, job->keylen,
+                salt, stodium_tree_personal);
+    } else {
+        offset = (jlong) leaf * (jlong) job->leaf_size;
+        length = job->length - offset;
+        if (length > (jlong) job->leaf_size) {
+            length = (jlong) job->leaf_size;
+        }
+        if (length < 0 || (length == 0 && leaf != 0)) {
+            result = EINVAL; // the leaf lies past the end of the file
+        } else if (crypto_generichash_blake2b_init_salt_personal(&state,
+                job->key, job->keylen, STODIUM_TREE_LEAFBYTES,
+                salt, stodium_tree_personal) != 0) {
+            result = -1;
+        } else {
+            result = stodium_file_update(job->fd, offset, length, stodium_tree_update, &state);
+            if (result == 0 && crypto_generichash_blake2b_final(&state,
+                    job->dst + index * STODIUM_TREE_LEAFBYTES, STODIUM_TREE_LEAFBYTES) != 0) {
+                result = -1;
+            }
+        }
+        sodium_memzero(&state, sizeof state);
+    }
+
+    if (result != 0) {
+        __sync_bool_compare_and_swap(&job->error, 0, result);
+    }
+}
+
+/**
+ * stodium_tree_leaves hashes the leaves described by job, one per digest slot
+ * in dst, spreading them over the thread pool.
+ */
+static jint stodium_tree_leaves(JNIEnv *jenv,
+        stodium_tree_job *job,
+        jobject dst,
+        jobject key) {
+    stodium_buffer dst_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    job->dst    = AS_OUTPUT(unsigned char, dst_buffer);
+    job->key    = AS_INPUT(unsigned char, key_buffer);
+    job->keylen = AS_INPUT_LEN(size_t, key_buffer);
+    job->error  = 0;
+
+    stodium_pool_run(stodium_tree_leaf_task, job,
+            AS_INPUT_LEN(size_t, dst_buffer) / STODIUM_TREE_LEAFBYTES);
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return (jint) job->error;
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1tree_1leafbytes) (JNIEnv *jenv, jclass jcls) {
+    return (jint) STODIUM_TREE_LEAFBYTES;
+}
+
+/**
+ * crypto_generichash_blake2b_tree_leaves hashes src as consecutive leaves of a
+ * tree, starting at leaf first_leaf, and writes one leaf digest per leaf to
+ * dst. Every leaf holds leaf_size bytes, except for the last one.
+ */
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1tree_1leaves) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject key,
+        jint    leaf_size,
+        jlong   first_leaf) {
+    stodium_tree_job job;
+    stodium_buffer   src_buffer;
+    jint             result;
+    stodium_get_buffer(jenv, &src_buffer, src);
+
+    job.src       = AS_INPUT(unsigned char, src_buffer);
+    job.length    = (jlong) AS_INPUT_LEN(size_t, src_buffer);
+    job.fd        = -1;
+    job.leaf_size = (size_t) leaf_size;
+    job.first     = (uint64_t) first_leaf;
+
+    result = stodium_tree_leaves(jenv, &job, dst, key);
+
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+/**
+ * stodium_tree_leaves_fd hashes the leaves of the file behind fd, starting at
+ * leaf first_leaf, mapping the file into memory one leaf at a time. The file
+ * must be exactly length bytes long. Returns 0, -1 or an errno value, like
+ * stodium_file_update.
+ */
+static jint stodium_tree_leaves_fd(JNIEnv *jenv,
+        jobject dst,
+        jobject key,
+        int     fd,
+        jlong   length,
+        jint    leaf_size,
+        jlong   first_leaf) {
+    stodium_tree_job job;
+    struct stat      info;
+
+    if (fstat(fd, &info) != 0) {
+        return (jint) errno;
+    }
+    if ((jlong) info.st_size != length) {
+        return EINVAL; // the file does not hold the data the leaves describe
+    }
+
+    job.src       = NULL;
+    job.length    = length;
+    job.fd        = fd;
+    job.leaf_size = (size_t) leaf_size;
+    job.first     = (uint64_t) first_leaf;
+
+    return stodium_tree_leaves(jenv, &job, dst, key);
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1tree_1leaves_1fd) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject key,
+        jint    fd,
+        jlong   length,
+        jint    leaf_size,
+        jlong   first_leaf) {
+    return stodium_tree_leaves_fd(jenv, dst, key, (int) fd, length, leaf_size, first_leaf);
+}
+
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1tree_1leaves_1file) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject key,
+        jstring path,
+        jlong   length,
+        jint    leaf_size,
+        jlong   first_leaf) {
+    const char *name;
+    int         fd, error;
+    jint        result;
+
+    name = (*jenv)->GetStringUTFChars(jenv, path, NULL);
+    if (name == NULL) {
+        return ENOMEM; // OutOfMemoryError is pending
+    }
+    fd    = open(name, O_RDONLY | O_CLOEXEC);
+    error = errno;
+    (*jenv)->ReleaseStringUTFChars(jenv, path, name);
+    if (fd < 0) {
+        return (jint) error;
+    }
+
+    result = stodium_tree_leaves_fd(jenv, dst, key, fd, length, leaf_size, first_leaf);
+    close(fd);
+
+    return result;
+}
+
+/**
+ * stodium_tree_parent_job describes the hashing of a run of consecutive
+ * interior nodes at one level of a binary tree, as one pool task per node.
+ * Node i is the hash of children 2i and 2i + 1, or of child 2i alone if it is
+ * the last child of its level.
+ */
+typedef struct stodium_tree_parent_jobs {
+    unsigned char       *dst;
+    const unsigned char *children;
+    size_t               count;  // number of children
+    size_t               leaf_size;
+    uint64_t             first;
+    unsigned char        depth;
+    const unsigned char *key;
+    size_t               keylen;
+    int                  error;
+} stodium_tree_parent_job;
+
+static void stodium_tree_parent_task(void *ctx, size_t index) {
+    stodium_tree_parent_job *job = (stodium_tree_parent_job *) ctx;
+    unsigned char            salt[16];
+    size_t                   children = job->count - 2 * index;
+
+    if (children > 2) {
+        children = 2;
+    }
+    stodium_tree_salt(salt, job->first + (uint64_t) index, (uint32_t) job->leaf_size, job->depth);
+
+    if (crypto_generichash_blake2b_salt_personal(
+            job->dst + index * STODIUM_TREE_LEAFBYTES, STODIUM_TREE_LEAFBYTES,
+            job->children + 2 * index * STODIUM_TREE_LEAFBYTES,
+            (unsigned long long) (children * STODIUM_TREE_LEAFBYTES),
+            job->key, job->keylen,
+            salt, stodium_tree_personal) != 0) {
+        __sync_bool_compare_and_swap(&job->error, 0, -1);
+    }
+}
+
+/**
+ * crypto_generichash_blake2b_tree_parents hashes the child digests in
+ * children into the interior nodes at the given depth of a binary tree,
+ * starting at node first_node, and writes one digest per node to dst.
+ */
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1tree_1parents) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject children,
+        jobject key,
+        jint    leaf_size,
+        jint    depth,
+        jlong   first_node) {
+    stodium_tree_parent_job job;
+    stodium_buffer          dst_buffer, children_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &children_buffer, children);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    job.dst       = AS_OUTPUT(unsigned char, dst_buffer);
+    job.children  = AS_INPUT(unsigned char, children_buffer);
+    job.count     = AS_INPUT_LEN(size_t, children_buffer) / STODIUM_TREE_LEAFBYTES;
+    job.leaf_size = (size_t) leaf_size;
+    job.first     = (uint64_t) first_node;
+    job.depth     = (unsigned char) depth;
+    job.key       = AS_INPUT(unsigned char, key_buffer);
+    job.keylen    = AS_INPUT_LEN(size_t, key_buffer);
+    job.error     = 0;
+
+    stodium_pool_run(stodium_tree_parent_task, &job,
+            AS_INPUT_LEN(size_t, dst_buffer) / STODIUM_TREE_LEAFBYTES);
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, children, &children_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return (jint) job.error;
+}
+
+/**
+ * crypto_generichash_blake2b_tree_root combines the leaf digests of a tree
+ * into the root digest, which is written to dst.
+ */
+STODIUM_JNI(jint, crypto_1generichash_1blake2b_1tree_1root) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject leaves,
+        jobject key,
+        jint    leaf_size) {
+    unsigned char  salt[16];
+    stodium_buffer dst_buffer, leaves_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &leaves_buffer, leaves);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    stodium_tree_salt(salt, 0, (uint32_t) leaf_size, 1);
+
+    jint result = (jint) crypto_generichash_blake2b_salt_personal(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT_LEN(size_t, dst_buffer),
+            AS_INPUT(unsigned char, leaves_buffer),
+            AS_INPUT_LEN(unsigned long long, leaves_buffer),
+            AS_INPUT(unsigned char, key_buffer),
+            AS_INPUT_LEN(size_t, key_buffer),
+            salt,
+            stodium_tree_personal);
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, leaves, &leaves_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+/** ****************************************************************************
+ *
+ * HASH
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT_STR(hash)
+
+/** ****************************************************************************
+ *
+ * HASH - SHA-256
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT(hash, sha256, bytes)
+STODIUM_CONSTANT(hash, sha256, statebytes)
+
+STODIUM_JNI(jint, crypto_1hash_1sha256) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src) {
+    stodium_buffer mac_buffer, src_buffer;
+    stodium_get_buffer(jenv, &mac_buffer, mac);
+    stodium_get_buffer(jenv, &src_buffer, src);
+
+    jint result = (jint) crypto_hash_sha256(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha256_1address) (JNIEnv *jenv, jclass jcls,
+        jlong mac, jint mac_length,
+        jlong src, jint src_length) {
+    stodium_buffer mac_buffer, src_buffer;
+    stodium_get_address(&mac_buffer, mac, mac_length);
+    stodium_get_address(&src_buffer, src, src_length);
+
+    jint result = (jint) crypto_hash_sha256(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha256_1init) (JNIEnv *jenv, jclass jcls,
+        jobject dst) {
+    stodium_buffer dst_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+
+    jint result = (jint) crypto_hash_sha256_init(
+            AS_OUTPUT(crypto_hash_sha256_state, dst_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha256_1init_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length) {
+    stodium_buffer dst_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+
+    jint result = (jint) crypto_hash_sha256_init(
+            AS_OUTPUT(crypto_hash_sha256_state, dst_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha256_1update) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+
+    jint result = (jint) crypto_hash_sha256_update(
+            AS_OUTPUT(crypto_hash_sha256_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha256_1update_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&src_buffer, src, src_length);
+
+    jint result = (jint) crypto_hash_sha256_update(
+            AS_OUTPUT(crypto_hash_sha256_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha256_1update_1array) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jbyteArray src, jint src_offset, jint src_length) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+
+    jint result = (jint) crypto_hash_sha256_update(
+            AS_OUTPUT(crypto_hash_sha256_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha256_1final) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jobject dst) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+
+    jint result = (jint) crypto_hash_sha256_final(
+            AS_OUTPUT(crypto_hash_sha256_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer));
+
+    stodium_release_output(jenv, state, &state_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha256_1final_1address) (JNIEnv *jenv, jclass jcls,
+        jlong state, jint state_length,
+        jlong dst, jint dst_length) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_address(&state_buffer, state, state_length);
+    stodium_get_address(&dst_buffer, dst, dst_length);
+
+    jint result = (jint) crypto_hash_sha256_final(
+            AS_OUTPUT(crypto_hash_sha256_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha256_1final_1array) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jbyteArray dst, jint dst_offset, jint dst_length) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+
+    jint result = (jint) crypto_hash_sha256_final(
+            AS_OUTPUT(crypto_hash_sha256_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer));
+
+    stodium_release_output(jenv, state, &state_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+
+    return result;
+}
+
+/**
+ * stodium_hash_sha256_update adapts crypto_hash_sha256_update to stodium_update_fn.
+ */
+static int stodium_hash_sha256_update(void *state, const unsigned char *in, size_t inlen) {
+    return crypto_hash_sha256_update((crypto_hash_sha256_state *) state, in, (unsigned long long) inlen);
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha256_1updatev) (JNIEnv *jenv, jclass jcls,
+        jobject      state,
+        jobjectArray srcs,
+        jint         offset,
+        jint         length) {
+    return stodium_updatev(jenv, state, srcs, offset, length, stodium_hash_sha256_update);
+}
+
+/**
+ * stodium_hash_sha256_file computes the hash of a range of a file, see
+ * stodium_file_update.
+ */
+static int stodium_hash_sha256_file(int fd, jlong offset, jlong length,
+        unsigned char *out, size_t outlen,
+        const unsigned char *key, size_t keylen) {
+    crypto_hash_sha256_state state;
+    int result;
+
+    if (crypto_hash_sha256_init(&state) != 0) {
+        return -1;
+    }
+    result = stodium_file_update(fd, offset, length, stodium_hash_sha256_update, &state);
+    if (result == 0 && crypto_hash_sha256_final(&state, out) != 0) {
+        result = -1;
+    }
+    sodium_memzero(&state, sizeof state);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha256_1fd) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jint    fd,
+        jlong   offset,
+        jlong   length) {
+    return stodium_file_digest(jenv, dst, NULL, fd, offset, length, stodium_hash_sha256_file);
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha256_1file) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jstring path,
+        jlong   offset,
+        jlong   length) {
+    return stodium_path_digest(jenv, dst, NULL, path, offset, length, stodium_hash_sha256_file);
+}
+
+/** ****************************************************************************
+ *
+ * HASH - SHA-512
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT(hash, sha512, bytes)
+STODIUM_CONSTANT(hash, sha512, statebytes)
+
+STODIUM_JNI(jint, crypto_1hash_1sha512) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src) {
+    stodium_buffer mac_buffer, src_buffer;
+    stodium_get_buffer(jenv, &mac_buffer, mac);
+    stodium_get_buffer(jenv, &src_buffer, src);
+
+    jint result = (jint) crypto_hash_sha512(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha512_1address) (JNIEnv *jenv, jclass jcls,
+        jlong mac, jint mac_length,
+        jlong src, jint src_length) {
+    stodium_buffer mac_buffer, src_buffer;
+    stodium_get_address(&mac_buffer, mac, mac_length);
+    stodium_get_address(&src_buffer, src, src_length);
+
+    jint result = (jint) crypto_hash_sha512(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha512_1init) (JNIEnv *jenv, jclass jcls,
+        jobject dst) {
+    stodium_buffer dst_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+
+    jint result = (jint) crypto_hash_sha512_init(
+            AS_OUTPUT(crypto_hash_sha512_state, dst_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha512_1init_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length) {
+    stodium_buffer dst_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+
+    jint result = (jint) crypto_hash_sha512_init(
+            AS_OUTPUT(crypto_hash_sha512_state, dst_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha512_1update) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+
+    jint result = (jint) crypto_hash_sha512_update(
+            AS_OUTPUT(crypto_hash_sha512_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha512_1update_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&src_buffer, src, src_length);
+
+    jint result = (jint) crypto_hash_sha512_update(
+            AS_OUTPUT(crypto_hash_sha512_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha512_1update_1array) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jbyteArray src, jint src_offset, jint src_length) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+
+    jint result = (jint) crypto_hash_sha512_update(
+            AS_OUTPUT(crypto_hash_sha512_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha512_1final) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jobject dst) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+
+    jint result = (jint) crypto_hash_sha512_final(
+            AS_OUTPUT(crypto_hash_sha512_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer));
+
+    stodium_release_output(jenv, state, &state_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha512_1final_1address) (JNIEnv *jenv, jclass jcls,
+        jlong state, jint state_length,
+        jlong dst, jint dst_length) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_address(&state_buffer, state, state_length);
+    stodium_get_address(&dst_buffer, dst, dst_length);
+
+    jint result = (jint) crypto_hash_sha512_final(
+            AS_OUTPUT(crypto_hash_sha512_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha512_1final_1array) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jbyteArray dst, jint dst_offset, jint dst_length) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+
+    jint result = (jint) crypto_hash_sha512_final(
+            AS_OUTPUT(crypto_hash_sha512_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer));
+
+    stodium_release_output(jenv, state, &state_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+
+    return result;
+}
+
+/**
+ * stodium_hash_sha512_update adapts crypto_hash_sha512_update to stodium_update_fn.
+ */
+static int stodium_hash_sha512_update(void *state, const unsigned char *in, size_t inlen) {
+    return crypto_hash_sha512_update((crypto_hash_sha512_state *) state, in, (unsigned long long) inlen);
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha512_1updatev) (JNIEnv *jenv, jclass jcls,
+        jobject      state,
+        jobjectArray srcs,
+        jint         offset,
+        jint         length) {
+    return stodium_updatev(jenv, state, srcs, offset, length, stodium_hash_sha512_update);
+}
+
+/**
+ * stodium_hash_sha512_file computes the hash of a range of a file, see
+ * stodium_file_update.
+ */
+static int stodium_hash_sha512_file(int fd, jlong offset, jlong length,
+        unsigned char *out, size_t outlen,
+        const unsigned char *key, size_t keylen) {
+    crypto_hash_sha512_state state;
+    int result;
+
+    if (crypto_hash_sha512_init(&state) != 0) {
+        return -1;
+    }
+    result = stodium_file_update(fd, offset, length, stodium_hash_sha512_update, &state);
+    if (result == 0 && crypto_hash_sha512_final(&state, out) != 0) {
+        result = -1;
+    }
+    sodium_memzero(&state, sizeof state);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha512_1fd) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jint    fd,
+        jlong   offset,
+        jlong   length) {
+    return stodium_file_digest(jenv, dst, NULL, fd, offset, length, stodium_hash_sha512_file);
+}
+
+STODIUM_JNI(jint, crypto_1hash_1sha512_1file) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jstring path,
+        jlong   offset,
+        jlong   length) {
+    return stodium_path_digest(jenv, dst, NULL, path, offset, length, stodium_hash_sha512_file);
+}
+
+/** ****************************************************************************
+ *
+ * KDF
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT_STR(kdf)
+
+/** ****************************************************************************
+ *
+ * KDF - Blake2b
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT(kdf, blake2b, contextbytes)
+STODIUM_CONSTANT(kdf, blake2b, keybytes)
+STODIUM_JNI(jint, crypto_1kdf_1blake2b_1bytes_1min) (JNIEnv *jenv, jclass jcls) {
+    return (jint) crypto_kdf_blake2b_bytes_min();
+}
+STODIUM_JNI(jint, crypto_1kdf_1blake2b_1bytes_1max) (JNIEnv *jenv, jclass jcls) {
+    return (jint) crypto_kdf_blake2b_bytes_max();
+}
+
+STODIUM_JNI(jint, crypto_1kdf_1blake2b_1derive_1from_1key) (JNIEnv *jenv, jclass jcls,
+        jobject sub,
+        jlong   subid,
+        jobject ctx,
+        jobject key) {
+    stodium_buffer sub_buffer, ctx_buffer, key_buffer;
+    stodium_get_buffer(jenv, &sub_buffer, sub);
+    stodium_get_buffer(jenv, &ctx_buffer, ctx);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) crypto_kdf_blake2b_derive_from_key(
+            AS_OUTPUT(unsigned char, sub_buffer),
+            AS_INPUT_LEN(size_t, sub_buffer),
+            (uint64_t) subid,
+            AS_INPUT(char, ctx_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, sub, &sub_buffer);
+    stodium_release_input(jenv, ctx, &ctx_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1kdf_1blake2b_1derive_1from_1key_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject sub,
+        jlong   subid,
+        jobject ctx,
+        jlong   key) {
+    stodium_buffer sub_buffer, ctx_buffer, key_buffer;
+    stodium_get_buffer(jenv, &sub_buffer, sub);
+    stodium_get_buffer(jenv, &ctx_buffer, ctx);
+    stodium_get_handle(&key_buffer, key);
+
+    jint result = (jint) crypto_kdf_blake2b_derive_from_key(
+            AS_OUTPUT(unsigned char, sub_buffer),
+            AS_INPUT_LEN(size_t, sub_buffer),
+            (uint64_t) subid,
+            AS_INPUT(char, ctx_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, sub, &sub_buffer);
+    stodium_release_input(jenv, ctx, &ctx_buffer);
+
+    return result;
+}
+
+/** ****************************************************************************
+ *
+ * KX (x25519blake2b)
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT_STR(kx)
+STODIUM_CONSTANT_HL(kx, publickeybytes)
+STODIUM_CONSTANT_HL(kx, secretkeybytes)
+STODIUM_CONSTANT_HL(kx, seedbytes)
+STODIUM_CONSTANT_HL(kx, sessionkeybytes)
+
+STODIUM_JNI(jint, crypto_1kx_1keypair) (JNIEnv *jenv, jclass jcls,
+        jobject pub,
+        jobject priv) {
+    stodium_buffer pub_buffer, priv_buffer;
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+
+    jint result = (jint) crypto_kx_keypair(
+            AS_OUTPUT(unsigned char, pub_buffer),
+            AS_OUTPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, pub, &pub_buffer);
+    stodium_release_output(jenv, priv, &priv_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1kx_1seed_1keypair) (JNIEnv *jenv, jclass jcls,
+        jobject pub,
+        jobject priv,
+        jobject seed) {
+    stodium_buffer pub_buffer, priv_buffer, seed_buffer;
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+    stodium_get_buffer(jenv, &seed_buffer, seed);
+
+    jint result = (jint) crypto_kx_seed_keypair(
+            AS_OUTPUT(unsigned char, pub_buffer),
+            AS_OUTPUT(unsigned char, priv_buffer),
+            AS_INPUT(unsigned char, seed_buffer));
+
+    stodium_release_output(jenv, pub, &pub_buffer);
+    stodium_release_output(jenv, priv, &priv_buffer);
+    stodium_release_input(jenv, seed, &seed_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1kx_1server_1session_1keys) (JNIEnv *jenv, jclass jcls,
+            jobject rx,
+            jobject tx,
+            jobject spk,
+            jobject ssk,
+            jobject cpk) {
+    stodium_buffer rx_buffer, tx_buffer, spk_buffer, ssk_buffer, cpk_buffer;
+    stodium_get_buffer(jenv, &rx_buffer, rx);
+    stodium_get_buffer(jenv, &tx_buffer, tx);
+    stodium_get_buffer(jenv, &spk_buffer, spk);
+    stodium_get_buffer(jenv, &ssk_buffer, ssk);
+    stodium_get_buffer(jenv, &cpk_buffer, cpk);
+
+    jint result = (jint) crypto_kx_server_session_keys(
+            AS_OUTPUT(unsigned char, rx_buffer),
+            AS_OUTPUT(unsigned char, tx_buffer),
+            AS_INPUT(unsigned char, spk_buffer),
+            AS_INPUT(unsigned char, ssk_buffer),
+            AS_INPUT(unsigned char, cpk_buffer));
+
+    stodium_release_output(jenv, rx, &rx_buffer);
+    stodium_release_output(jenv, tx, &tx_buffer);
+    stodium_release_input(jenv, spk, &spk_buffer);
+    stodium_release_input(jenv, ssk, &ssk_buffer);
+    stodium_release_input(jenv, cpk, &cpk_buffer);
+
+    return result;
+}
+
+static int stodium_kx_server_session_keys_dh(unsigned char *rx, unsigned char *tx,
+        const unsigned char *pk, const unsigned char *sk, const unsigned char *peer) {
+    return crypto_kx_server_session_keys(rx, tx, pk, sk, peer);
+}
+
+/**
+ * crypto_kx_server_session_keys_batch computes the session keys of a server
+ * for every client public key in cpks, see stodium_dh_batch.
+ */
+STODIUM_JNI(jint, crypto_1kx_1server_1session_1keys_1batch) (JNIEnv *jenv, jclass jcls,
+        jobject   rx,
+        jobject   tx,
+        jobject   spk,
+        jobject   ssk,
+        jobject   cpks,
+        jintArray status,
+        jboolean  parallel) {
+    return stodium_dh_batch(jenv, stodium_kx_server_session_keys_dh,
+            crypto_kx_SESSIONKEYBYTES,
+            crypto_kx_PUBLICKEYBYTES,
+            rx, tx, spk, ssk, cpks, status, parallel);
+}
+
+STODIUM_JNI(jint, crypto_1kx_1client_1session_1keys) (JNIEnv *jenv, jclass jcls,
+            jobject rx,
+            jobject tx,
+            jobject cpk,
+            jobject csk,
+            jobject spk) {
+    stodium_buffer rx_buffer, tx_buffer, cpk_buffer, csk_buffer, spk_buffer;
+    stodium_get_buffer(jenv, &rx_buffer, rx);
+    stodium_get_buffer(jenv, &tx_buffer, tx);
+    stodium_get_buffer(jenv, &cpk_buffer, cpk);
+    stodium_get_buffer(jenv, &csk_buffer, csk);
+    stodium_get_buffer(jenv, &spk_buffer, spk);
+
+    jint result = (jint) crypto_kx_client_session_keys(
+            AS_OUTPUT(unsigned char, rx_buffer),
+            AS_OUTPUT(unsigned char, tx_buffer),
+            AS_INPUT(unsigned char, cpk_buffer),
+            AS_INPUT(unsigned char, csk_buffer),
+            AS_INPUT(unsigned char, spk_buffer));
+
+    stodium_release_output(jenv, rx, &rx_buffer);
+    stodium_release_output(jenv, tx, &tx_buffer);
+    stodium_release_input(jenv, cpk, &cpk_buffer);
+    stodium_release_input(jenv, csk, &csk_buffer);
+    stodium_release_input(jenv, spk, &spk_buffer);
+
+    return result;
+}
+
+/** ****************************************************************************
+ *
+ * ONETIMEAUTH
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT_STR(onetimeauth)
+
+/** ****************************************************************************
+ *
+ * ONETIMEAUTH - Poly1305
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT(onetimeauth, poly1305, bytes)
+STODIUM_CONSTANT(onetimeauth, poly1305, keybytes)
+STODIUM_CONSTANT(onetimeauth, poly1305, statebytes)
+
+STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jobject key) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_buffer(jenv, &mac_buffer, mac);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &key_buffer, key);
+
+    jint result = (jint) crypto_onetimeauth_poly1305(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_array(jenv, &mac_buffer, mac, mac_offset, mac_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
+
+    jint result = (jint) crypto_onetimeauth_poly1305(
+            AS_OUTPUT(unsigned char, mac_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, ad_buffer),
-            AS_INPUT_LEN(unsigned long long, ad_buffer),
-            AS_INPUT(unsigned char, nonce_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst,   &dst_buffer);
-    stodium_release_input(jenv,  src,   &src_buffer);
-    stodium_release_input(jenv,  ad,    &ad_buffer);
-    stodium_release_input(jenv,  nonce, &nonce_buffer);
-    stodium_release_input(jenv,  key,   &key_buffer);
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-/** ****************************************************************************
- *
- * AUTH
- *
- **************************************************************************** */
+STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject mac,
+        jobject src,
+        jlong   key) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_buffer(jenv, &mac_buffer, mac);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_handle(&key_buffer, key);
 
-STODIUM_CONSTANT_STR(auth)
+    jint result = (jint) crypto_onetimeauth_poly1305(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-/** ****************************************************************************
- *
- * AUTH - HMAC-256
- *
- **************************************************************************** */
+    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
 
-STODIUM_CONSTANT(auth, hmacsha256, bytes)
-STODIUM_CONSTANT(auth, hmacsha256, keybytes)
-STODIUM_CONSTANT(auth, hmacsha256, statebytes)
+    return result;
+}
 
-STODIUM_JNI(jint, crypto_1auth_1hmacsha256) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1verify) (JNIEnv *jenv, jclass jcls,
         jobject mac,
         jobject src,
         jobject key) {
@@ -886,29 +9582,51 @@ STODIUM_JNI(jint, crypto_1auth_1hmacsha256) (JNIEnv *jenv, jclass jcls,
     stodium_get_buffer(jenv, &src_buffer, src);
     stodium_get_buffer(jenv, &key_buffer, key);
 
-    jint result = (jint) crypto_auth_hmacsha256(
+    jint result = (jint) crypto_onetimeauth_poly1305_verify(
             AS_OUTPUT(unsigned char, mac_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, mac, &mac_buffer);
     stodium_release_input(jenv, src, &src_buffer);
     stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1verify) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1verify_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray mac, jint mac_offset, jint mac_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer mac_buffer, src_buffer, key_buffer;
+    stodium_get_array(jenv, &mac_buffer, mac, mac_offset, mac_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
+
+    jint result = (jint) crypto_onetimeauth_poly1305_verify(
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_input(jenv, mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1verify_1handle) (JNIEnv *jenv, jclass jcls,
         jobject mac,
         jobject src,
-        jobject key) {
+        jlong   key) {
     stodium_buffer mac_buffer, src_buffer, key_buffer;
     stodium_get_buffer(jenv, &mac_buffer, mac);
     stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_get_handle(&key_buffer, key);
 
-    jint result = (jint) crypto_auth_hmacsha256_verify(
+    jint result = (jint) crypto_onetimeauth_poly1305_verify(
             AS_OUTPUT(unsigned char, mac_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
@@ -916,428 +9634,735 @@ STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1verify) (JNIEnv *jenv, jclass jcls,
 
     stodium_release_input(jenv, mac, &mac_buffer);
     stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1init) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1init) (JNIEnv *jenv, jclass jcls,
         jobject dst,
         jobject key) {
     stodium_buffer dst_buffer, key_buffer;
     stodium_get_buffer(jenv, &dst_buffer, dst);
     stodium_get_buffer(jenv, &key_buffer, key);
 
-    jint result = (jint) crypto_auth_hmacsha256_init(
-            AS_OUTPUT(crypto_auth_hmacsha256_state, dst_buffer),
-            AS_INPUT(unsigned char, key_buffer),
-            AS_INPUT_LEN(size_t, key_buffer));
+    jint result = (jint) crypto_onetimeauth_poly1305_init(
+            AS_OUTPUT(crypto_onetimeauth_poly1305_state, dst_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1init_1array) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, key_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
+
+    jint result = (jint) crypto_onetimeauth_poly1305_init(
+            AS_OUTPUT(crypto_onetimeauth_poly1305_state, dst_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1update) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+
+    jint result = (jint) crypto_onetimeauth_poly1305_update(
+            AS_OUTPUT(crypto_onetimeauth_poly1305_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1update_1array) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jbyteArray src, jint src_offset, jint src_length) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+
+    jint result = (jint) crypto_onetimeauth_poly1305_update(
+            AS_OUTPUT(crypto_onetimeauth_poly1305_state, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1final) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jobject dst) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+
+    jint result = (jint) crypto_onetimeauth_poly1305_final(
+            AS_OUTPUT(crypto_onetimeauth_poly1305_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer));
+
+    stodium_release_output(jenv, state, &state_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1final_1array) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jbyteArray dst, jint dst_offset, jint dst_length) {
+    stodium_buffer state_buffer, dst_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+
+    jint result = (jint) crypto_onetimeauth_poly1305_final(
+            AS_OUTPUT(crypto_onetimeauth_poly1305_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer));
+
+    stodium_release_output(jenv, state, &state_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+
+    return result;
+}
+
+/**
+ * stodium_onetimeauth_poly1305_update adapts crypto_onetimeauth_poly1305_update to stodium_update_fn.
+ */
+static int stodium_onetimeauth_poly1305_update(void *state, const unsigned char *in, size_t inlen) {
+    return crypto_onetimeauth_poly1305_update((crypto_onetimeauth_poly1305_state *) state, in, (unsigned long long) inlen);
+}
+
+STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1updatev) (JNIEnv *jenv, jclass jcls,
+        jobject      state,
+        jobjectArray srcs,
+        jint         offset,
+        jint         length) {
+    return stodium_updatev(jenv, state, srcs, offset, length, stodium_onetimeauth_poly1305_update);
+}
+
+/**
+ * stodium_onetimeauth_poly1305_file computes the MAC of a range of a file, see
+ * stodium_file_update.
+ */
+static int stodium_onetimeauth_poly1305_file(int fd, jlong offset, jlong length,
+        unsigned char *out, size_t outlen,
+        const unsigned char *key, size_t keylen) {
+    crypto_onetimeauth_poly1305_state state;
+    int result;
+
+    if (crypto_onetimeauth_poly1305_init(&state, key) != 0) {
+        return -1;
+    }
+    result = stodium_file_update(fd, offset, length, stodium_onetimeauth_poly1305_update, &state);
+    if (result == 0 && crypto_onetimeauth_poly1305_final(&state, out) != 0) {
+        result = -1;
+    }
+    sodium_memzero(&state, sizeof state);
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1fd) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject key,
+        jint    fd,
+        jlong   offset,
+        jlong   length) {
+    return stodium_file_digest(jenv, dst, key, fd, offset, length, stodium_onetimeauth_poly1305_file);
+}
+
+STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1file) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject key,
+        jstring path,
+        jlong   offset,
+        jlong   length) {
+    return stodium_path_digest(jenv, dst, key, path, offset, length, stodium_onetimeauth_poly1305_file);
+}
+
+/** ****************************************************************************
+ *
+ * PWHASH
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT_STR(pwhash)
+
+/** ****************************************************************************
+ *
+ * PWHASH - Argon2i
+ *
+ **************************************************************************** */
+
+STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1bytes_1min) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_argon2i_bytes_min();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1bytes_1max) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_argon2i_bytes_max();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1passwd_1min) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_argon2i_passwd_min();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1passwd_1max) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_argon2i_passwd_max();
+}
+STODIUM_CONSTANT(pwhash, argon2i, saltbytes)
+STODIUM_CONSTANT(pwhash, argon2i, strbytes)
+STODIUM_JNI(jstring, crypto_1pwhash_1argon2i_1strprefix) (JNIEnv *jenv, jclass jcls) {
+        return (*jenv)->NewStringUTF(jenv, crypto_pwhash_argon2i_strprefix());
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1opslimit_1min) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_argon2i_opslimit_min();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1opslimit_1max) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_argon2i_opslimit_max();
+}
+STODIUM_JNI(jint, crypto_1pwhash_1argon2i_1memlimit_1min) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_argon2i_memlimit_min();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1memlimit_1max) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_argon2i_memlimit_max();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1opslimit_1interactive) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_argon2i_opslimit_interactive();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1memlimit_1interactive) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_argon2i_memlimit_interactive();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1opslimit_1sensitive) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_argon2i_opslimit_sensitive();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1memlimit_1sensitive) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_argon2i_memlimit_sensitive();
+}
+
+STODIUM_JNI(jint, crypto_1pwhash_1argon2i) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject password,
+        jobject salt,
+        jlong opslimit,
+        jlong memlimit) {
+    stodium_buffer dst_buffer, pw_buffer, salt_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &pw_buffer, password);
+    stodium_get_buffer(jenv, &salt_buffer, salt);
+
+    jint result = (jint) crypto_pwhash_argon2i(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(char, pw_buffer),
+            AS_INPUT_LEN(unsigned long long, pw_buffer),
+            AS_INPUT(unsigned char, salt_buffer),
+            (unsigned long long) opslimit,
+            (size_t) memlimit,
+            crypto_pwhash_ALG_DEFAULT);
 
     stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_input(jenv, password, &pw_buffer);
+    stodium_release_input(jenv, salt, &salt_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1update) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1pwhash_1argon2i_1str) (JNIEnv *jenv, jclass jcls,
         jobject dst,
-        jobject src) {
-    stodium_buffer dst_buffer, src_buffer;
+        jobject password,
+        jlong opslimit,
+        jlong memlimit) {
+    stodium_buffer dst_buffer, pw_buffer;
     stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &pw_buffer, password);
 
-    jint result = (jint) crypto_auth_hmacsha256_update(
-            AS_OUTPUT(crypto_auth_hmacsha256_state, dst_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer));
+    jint result = (jint) crypto_pwhash_argon2i_str(
+            AS_OUTPUT(char, dst_buffer),
+            AS_INPUT(char, pw_buffer),
+            AS_INPUT_LEN(unsigned long long, pw_buffer),
+            (unsigned long long) opslimit,
+            (size_t) memlimit);
 
     stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, password, &pw_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1auth_1hmacsha256_1final) (JNIEnv *jenv, jclass jcls,
-        jobject state,
-        jobject dst) {
-    stodium_buffer state_buffer, dst_buffer;
-    stodium_get_buffer(jenv, &state_buffer, state);
+STODIUM_JNI(jint, crypto_1pwhash_1argon2i_1str_1verify) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject password) {
+    stodium_buffer dst_buffer, pw_buffer;
     stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &pw_buffer, password);
 
-    jint result = (jint) crypto_auth_hmacsha256_final(
-            AS_OUTPUT(crypto_auth_hmacsha256_state, state_buffer),
-            AS_OUTPUT(unsigned char, dst_buffer));
+    jint result = (jint) crypto_pwhash_argon2i_str_verify(
+            AS_OUTPUT(char, dst_buffer),
+            AS_INPUT(char, pw_buffer),
+            AS_INPUT_LEN(unsigned long long, pw_buffer));
 
-    stodium_release_output(jenv, state, &state_buffer);
-    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, password, &pw_buffer);
 
     return result;
 }
 
 /** ****************************************************************************
  *
- * AUTH - HMAC-512
+ * PWHASH - Scrypt
  *
  **************************************************************************** */
 
-STODIUM_CONSTANT(auth, hmacsha512, bytes)
-STODIUM_CONSTANT(auth, hmacsha512, keybytes)
-STODIUM_CONSTANT(auth, hmacsha512, statebytes)
+STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1bytes_1min) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_scryptsalsa208sha256_bytes_min();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1bytes_1max) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_scryptsalsa208sha256_bytes_max();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1passwd_1min) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_scryptsalsa208sha256_passwd_min();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1passwd_1max) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_scryptsalsa208sha256_passwd_max();
+}
+STODIUM_CONSTANT(pwhash, scryptsalsa208sha256, saltbytes)
+STODIUM_CONSTANT(pwhash, scryptsalsa208sha256, strbytes)
+STODIUM_JNI(jstring, crypto_1pwhash_1scryptsalsa208sha256_1strprefix) (JNIEnv *jenv, jclass jcls) {
+        return (*jenv)->NewStringUTF(jenv, crypto_pwhash_scryptsalsa208sha256_strprefix());
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1opslimit_1min) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_scryptsalsa208sha256_opslimit_min();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1opslimit_1max) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_scryptsalsa208sha256_opslimit_max();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1memlimit_1min) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_scryptsalsa208sha256_memlimit_min();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1memlimit_1max) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_scryptsalsa208sha256_memlimit_max();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1opslimit_1interactive) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_scryptsalsa208sha256_opslimit_interactive();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1memlimit_1interactive) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_scryptsalsa208sha256_memlimit_interactive();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1opslimit_1sensitive) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_scryptsalsa208sha256_opslimit_sensitive();
+}
+STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1memlimit_1sensitive) (JNIEnv *jenv, jclass jcls) {
+       return (jlong) crypto_pwhash_scryptsalsa208sha256_memlimit_sensitive();
+}
 
-STODIUM_JNI(jint, crypto_1auth_1hmacsha512) (JNIEnv *jenv, jclass jcls,
-        jobject mac,
-        jobject src,
-        jobject key) {
-    stodium_buffer mac_buffer, src_buffer, key_buffer;
-    stodium_get_buffer(jenv, &mac_buffer, mac);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
+STODIUM_JNI(jint, crypto_1pwhash_1scryptsalsa208sha256) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject password,
+        jobject salt,
+        jlong opslimit,
+        jlong memlimit) {
+    stodium_buffer dst_buffer, pw_buffer, salt_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &pw_buffer, password);
+    stodium_get_buffer(jenv, &salt_buffer, salt);
 
-    jint result = (jint) crypto_auth_hmacsha512(
-            AS_OUTPUT(unsigned char, mac_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, key_buffer));
+    jint result = (jint) crypto_pwhash_scryptsalsa208sha256(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(char, pw_buffer),
+            AS_INPUT_LEN(unsigned long long, pw_buffer),
+            AS_INPUT(unsigned char, salt_buffer),
+            (unsigned long long) opslimit,
+            (size_t) memlimit);
 
-    stodium_release_output(jenv, mac, &mac_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, password, &pw_buffer);
+    stodium_release_input(jenv, salt, &salt_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1verify) (JNIEnv *jenv, jclass jcls,
-        jobject mac,
-        jobject src,
-        jobject key) {
-    stodium_buffer mac_buffer, src_buffer, key_buffer;
-    stodium_get_buffer(jenv, &mac_buffer, mac);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
+STODIUM_JNI(jint, crypto_1pwhash_1scryptsalsa208sha256_1str) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject password,
+        jlong opslimit,
+        jlong memlimit) {
+    stodium_buffer dst_buffer, pw_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &pw_buffer, password);
 
-    jint result = (jint) crypto_auth_hmacsha512_verify(
-            AS_OUTPUT(unsigned char, mac_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, key_buffer));
+    jint result = (jint) crypto_pwhash_scryptsalsa208sha256_str(
+            AS_OUTPUT(char, dst_buffer),
+            AS_INPUT(char, pw_buffer),
+            AS_INPUT_LEN(unsigned long long, pw_buffer),
+            (unsigned long long) opslimit,
+            (size_t) memlimit);
 
-    stodium_release_input(jenv, mac, &mac_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, password, &pw_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1init) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1pwhash_1scryptsalsa208sha256_1str_1verify) (JNIEnv *jenv, jclass jcls,
         jobject dst,
-        jobject key) {
-    stodium_buffer dst_buffer, key_buffer;
+        jobject password) {
+    stodium_buffer dst_buffer, pw_buffer;
     stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_get_buffer(jenv, &pw_buffer, password);
 
-    jint result = (jint) crypto_auth_hmacsha512_init(
-            AS_OUTPUT(crypto_auth_hmacsha512_state, dst_buffer),
-            AS_INPUT(unsigned char, key_buffer),
-            AS_INPUT_LEN(size_t, key_buffer));
+    jint result = (jint) crypto_pwhash_scryptsalsa208sha256_str_verify(
+            AS_OUTPUT(char, dst_buffer),
+            AS_INPUT(char, pw_buffer),
+            AS_INPUT_LEN(unsigned long long, pw_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_input(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, password, &pw_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1update) (JNIEnv *jenv, jclass jcls,
+/** ****************************************************************************
+ *
+ * SCALARMULT - Curve25519
+ *
+ **************************************************************************** */
+STODIUM_CONSTANT_STR(scalarmult)
+
+STODIUM_CONSTANT(scalarmult, curve25519, bytes)
+STODIUM_CONSTANT(scalarmult, curve25519, scalarbytes)
+
+STODIUM_JNI(jint, crypto_1scalarmult_1curve25519) (JNIEnv *jenv, jclass jcls,
         jobject dst,
-        jobject src) {
-    stodium_buffer dst_buffer, src_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
+        jobject priv,
+        jobject pub) {
+    stodium_buffer dst_buffer, priv_buffer, pub_buffer;
+    stodium_get_buffer(jenv, &dst_buffer,  dst);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+    stodium_get_buffer(jenv, &pub_buffer,  pub);
 
-    jint result = (jint) crypto_auth_hmacsha512_update(
-            AS_OUTPUT(crypto_auth_hmacsha512_state, dst_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer));
+    jint result = (jint) crypto_scalarmult_curve25519(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char,  priv_buffer),
+            AS_INPUT(unsigned char,  pub_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-
+    stodium_release_input(jenv, priv, &priv_buffer);
+    stodium_release_input(jenv, pub, &pub_buffer);
+    
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1auth_1hmacsha512_1final) (JNIEnv *jenv, jclass jcls,
-        jobject state,
-        jobject dst) {
-    stodium_buffer state_buffer, dst_buffer;
-    stodium_get_buffer(jenv, &state_buffer, state);
-    stodium_get_buffer(jenv, &dst_buffer, dst);
+static int stodium_scalarmult_curve25519_dh(unsigned char *rx, unsigned char *tx,
+        const unsigned char *pk, const unsigned char *sk, const unsigned char *peer) {
+    return crypto_scalarmult_curve25519(rx, sk, peer);
+}
 
-    jint result = (jint) crypto_auth_hmacsha512_final(
-            AS_OUTPUT(crypto_auth_hmacsha512_state, state_buffer),
-            AS_OUTPUT(unsigned char, dst_buffer));
+/**
+ * crypto_scalarmult_curve25519_batch multiplies every group element in pubs by
+ * the scalar priv, see stodium_dh_batch.
+ */
+STODIUM_JNI(jint, crypto_1scalarmult_1curve25519_1batch) (JNIEnv *jenv, jclass jcls,
+        jobject   dst,
+        jobject   priv,
+        jobject   pubs,
+        jintArray status,
+        jboolean  parallel) {
+    return stodium_dh_batch(jenv, stodium_scalarmult_curve25519_dh,
+            crypto_scalarmult_curve25519_BYTES,
+            crypto_scalarmult_curve25519_BYTES,
+            dst, NULL, NULL, priv, pubs, status, parallel);
+}
 
-    stodium_release_output(jenv, state, &state_buffer);
-    stodium_release_output(jenv, dst, &dst_buffer);
+STODIUM_JNI(jint, crypto_1scalarmult_1curve25519_1base) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src) {
+    stodium_buffer dst_buffer, src_buffer;
+    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    
+    jint result = (jint) crypto_scalarmult_curve25519_base(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer));
 
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    
     return result;
 }
 
 /** ****************************************************************************
  *
- * AUTH - HMAC-512/256
+ * SECRETBOX
  *
  **************************************************************************** */
 
-STODIUM_CONSTANT(auth, hmacsha512256, bytes)
-STODIUM_CONSTANT(auth, hmacsha512256, keybytes)
-STODIUM_CONSTANT(auth, hmacsha512256, statebytes)
+STODIUM_CONSTANT_STR(secretbox)
 
-STODIUM_JNI(jint, crypto_1auth_1hmacsha512256) (JNIEnv *jenv, jclass jcls,
-        jobject mac,
+/** ****************************************************************************
+ *
+ * SECRETBOX - XSalsa20Poly1305
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT(secretbox, xsalsa20poly1305, keybytes)
+STODIUM_CONSTANT(secretbox, xsalsa20poly1305, macbytes)
+STODIUM_CONSTANT(secretbox, xsalsa20poly1305, noncebytes)
+
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1easy) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
         jobject src,
+        jobject nonce,
         jobject key) {
-    stodium_buffer mac_buffer, src_buffer, key_buffer;
-    stodium_get_buffer(jenv, &mac_buffer, mac);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_auth_hmacsha512256(
-            AS_OUTPUT(unsigned char, mac_buffer),
+    jint result = (jint) crypto_secretbox_easy(
+            AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
     stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
     stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1verify) (JNIEnv *jenv, jclass jcls,
-        jobject mac,
-        jobject src,
-        jobject key) {
-    stodium_buffer mac_buffer, src_buffer, key_buffer;
-    stodium_get_buffer(jenv, &mac_buffer, mac);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1easy_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer, key, key_length);
 
-    jint result = (jint) crypto_auth_hmacsha512256_verify(
-            AS_OUTPUT(unsigned char, mac_buffer),
+    jint result = (jint) crypto_secretbox_easy(
+            AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_input(jenv, mac, &mac_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
-
-    return result;
-}
-
-STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1init) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject key) {
-    stodium_buffer dst_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &key_buffer, key);
-
-    jint result = (jint) crypto_auth_hmacsha512256_init(
-            AS_OUTPUT(crypto_auth_hmacsha512256_state, dst_buffer),
-            AS_INPUT(unsigned char, key_buffer),
-            AS_INPUT_LEN(size_t, key_buffer));
-
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
-
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1update) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src) {
-    stodium_buffer dst_buffer, src_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1easy_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer, key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_auth_hmacsha512256_update(
-            AS_OUTPUT(crypto_auth_hmacsha512256_state, dst_buffer),
+    jint result = (jint) crypto_secretbox_easy(
+            AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer));
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
     stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1auth_1hmacsha512256_1final) (JNIEnv *jenv, jclass jcls,
-        jobject state,
-        jobject dst) {
-    stodium_buffer state_buffer, dst_buffer;
-    stodium_get_buffer(jenv, &state_buffer, state);
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-
-    jint result = (jint) crypto_auth_hmacsha512256_final(
-            AS_OUTPUT(crypto_auth_hmacsha512256_state, state_buffer),
-            AS_OUTPUT(unsigned char, dst_buffer));
-
-    stodium_release_output(jenv, state, &state_buffer);
-    stodium_release_output(jenv, dst, &dst_buffer);
-
-    return result;
-}
-
-/** ****************************************************************************
- *
- * BOX
- *
- **************************************************************************** */
-
-STODIUM_CONSTANT_STR(box)
-STODIUM_CONSTANT_HL(box, sealbytes)
-
-STODIUM_JNI(jint, crypto_1box_1seal) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1easy_1handle) (JNIEnv *jenv, jclass jcls,
         jobject dst,
         jobject src,
-        jobject pub) {
-    stodium_buffer dst_buffer, src_buffer, pub_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &pub_buffer, pub);
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_box_seal(
+    jint result = (jint) crypto_secretbox_easy(
             AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, pub_buffer));
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
     stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, pub, &pub_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1box_1seal_1open) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1open_1easy) (JNIEnv *jenv, jclass jcls,
         jobject dst,
         jobject src,
-        jobject pub,
-        jobject priv) {
-    stodium_buffer dst_buffer, src_buffer, pub_buffer, priv_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &pub_buffer, pub);
-    stodium_get_buffer(jenv, &priv_buffer, priv);
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_box_seal_open(
+    jint result = (jint) crypto_secretbox_open_easy(
             AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, pub_buffer),
-            AS_INPUT(unsigned char, priv_buffer));
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
     stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, pub, &pub_buffer);
-    stodium_release_input(jenv, priv, &priv_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-/** ****************************************************************************
- *
- * BOX - X25519XSalsa20Poly1305
- *
- **************************************************************************** */
-
-STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, seedbytes)
-STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, publickeybytes)
-STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, secretkeybytes)
-STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, beforenmbytes)
-STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, noncebytes)
-STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, zerobytes)
-STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, boxzerobytes)
-STODIUM_CONSTANT(box, curve25519xsalsa20poly1305, macbytes)
-
-STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1seed_1keypair) (JNIEnv *jenv, jclass jcls,
-        jobject pk,
-        jobject sk,
-        jobject seed) {
-    stodium_buffer pk_buffer, sk_buffer, seed_buffer;
-    stodium_get_buffer(jenv, &pk_buffer, pk);
-    stodium_get_buffer(jenv, &sk_buffer, sk);
-    stodium_get_buffer(jenv, &seed_buffer, seed);
-
-    jint result = (jint) crypto_box_curve25519xsalsa20poly1305_seed_keypair(
-            AS_OUTPUT(unsigned char, pk_buffer),
-            AS_OUTPUT(unsigned char, sk_buffer),
-            AS_INPUT(unsigned char, seed_buffer));
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1open_1easy_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer, key, key_length);
 
-    stodium_release_output(jenv, pk, &pk_buffer);
-    stodium_release_output(jenv, sk, &sk_buffer);
-    stodium_release_input(jenv, seed, &seed_buffer);
+    jint result = (jint) crypto_secretbox_open_easy(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1keypair) (JNIEnv *jenv, jclass jcls,
-        jobject pk,
-        jobject sk) {
-    stodium_buffer pk_buffer, sk_buffer;
-    stodium_get_buffer(jenv, &pk_buffer, pk);
-    stodium_get_buffer(jenv, &sk_buffer, sk);
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1open_1easy_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer, key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_box_curve25519xsalsa20poly1305_keypair(
-            AS_OUTPUT(unsigned char, pk_buffer),
-            AS_OUTPUT(unsigned char, sk_buffer));
+    jint result = (jint) crypto_secretbox_open_easy(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, pk, &pk_buffer);
-    stodium_release_output(jenv, sk, &sk_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1beforenm) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1open_1easy_1handle) (JNIEnv *jenv, jclass jcls,
         jobject dst,
-        jobject pub,
-        jobject priv) {
-    stodium_buffer dst_buffer, pub_buffer, priv_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &pub_buffer, pub);
-    stodium_get_buffer(jenv, &priv_buffer, priv);
+        jobject src,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_box_curve25519xsalsa20poly1305_beforenm(
+    jint result = (jint) crypto_secretbox_open_easy(
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT(unsigned char, pub_buffer),
-            AS_INPUT(unsigned char, priv_buffer));
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, pub, &pub_buffer);
-    stodium_release_input(jenv, priv, &priv_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1afternm) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1detached) (JNIEnv *jenv, jclass jcls,
         jobject dst,
-        jobject src,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer, key);
+        jobject dst_mac,
+        jobject src,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer, dst_mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_box_curve25519xsalsa20poly1305_afternm(
+    jint result = (jint) crypto_secretbox_detached(
             AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
             AS_INPUT(unsigned char, nonce_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_output(jenv, dst_mac, &mac_buffer);
     stodium_release_input(jenv, src, &src_buffer);
     stodium_release_input(jenv, nonce, &nonce_buffer);
     stodium_release_input(jenv, key, &key_buffer);
@@ -1345,25 +10370,56 @@ STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1afternm) (JNIEnv *jen
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1open_1afternm) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer, key);
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1detached_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong dst_mac, jint dst_mac_length,
+        jlong src, jint src_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&mac_buffer, dst_mac, dst_mac_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer, key, key_length);
 
-    jint result = (jint) crypto_box_curve25519xsalsa20poly1305_open_afternm(
+    jint result = (jint) crypto_secretbox_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1detached_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray dst_mac, jint dst_mac_offset, jint dst_mac_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &mac_buffer, dst_mac, dst_mac_offset, dst_mac_length);
+    stodium_get_array_critical(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer, key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_secretbox_detached(
             AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
             AS_INPUT(unsigned char, nonce_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_output(jenv, dst_mac, &mac_buffer);
     stodium_release_input(jenv, src, &src_buffer);
     stodium_release_input(jenv, nonce, &nonce_buffer);
     stodium_release_input(jenv, key, &key_buffer);
@@ -1371,1844 +10427,2119 @@ STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1open_1afternm) (JNIEn
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1detached_1handle) (JNIEnv *jenv, jclass jcls,
         jobject dst,
+        jobject dst_mac,
         jobject src,
         jobject nonce,
-        jobject pub,
-        jobject priv) {
-    stodium_buffer dst_buffer, src_buffer, nonce_buffer, pub_buffer, priv_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &pub_buffer, pub);
-    stodium_get_buffer(jenv, &priv_buffer, priv);
+        jlong   key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer, dst_mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_box_curve25519xsalsa20poly1305(
+    jint result = (jint) crypto_secretbox_detached(
             AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
             AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, pub_buffer),
-            AS_INPUT(unsigned char, priv_buffer));
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_output(jenv, dst_mac, &mac_buffer);
     stodium_release_input(jenv, src, &src_buffer);
     stodium_release_input(jenv, nonce, &nonce_buffer);
-    stodium_release_input(jenv, pub, &pub_buffer);
-    stodium_release_input(jenv, priv, &priv_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1box_1curve25519xsalsa20poly1305_1open) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1open_1detached) (JNIEnv *jenv, jclass jcls,
         jobject dst,
         jobject src,
+        jobject src_mac,
         jobject nonce,
-        jobject pub,
-        jobject priv) {
-    stodium_buffer dst_buffer, src_buffer, nonce_buffer, pub_buffer, priv_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &pub_buffer, pub);
-    stodium_get_buffer(jenv, &priv_buffer, priv);
+        jobject key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer, src_mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_box_curve25519xsalsa20poly1305_open(
+    jint result = (jint) crypto_secretbox_open_detached(
             AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT(unsigned char, mac_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
             AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, pub_buffer),
-            AS_INPUT(unsigned char, priv_buffer));
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
     stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, src_mac, &mac_buffer);
     stodium_release_input(jenv, nonce, &nonce_buffer);
-    stodium_release_input(jenv, pub, &pub_buffer);
-    stodium_release_input(jenv, priv, &priv_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-/** ****************************************************************************
- *
- * BOX - X25519XChacha20Poly1305
- *
- **************************************************************************** */
-
-STODIUM_CONSTANT(box, curve25519xchacha20poly1305, seedbytes)
-STODIUM_CONSTANT(box, curve25519xchacha20poly1305, publickeybytes)
-STODIUM_CONSTANT(box, curve25519xchacha20poly1305, secretkeybytes)
-STODIUM_CONSTANT(box, curve25519xchacha20poly1305, beforenmbytes)
-STODIUM_CONSTANT(box, curve25519xchacha20poly1305, noncebytes)
-STODIUM_CONSTANT(box, curve25519xchacha20poly1305, macbytes)
-
-STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1seed_1keypair) (JNIEnv *jenv, jclass jcls,
-        jobject pk,
-        jobject sk,
-        jobject seed) {
-    stodium_buffer pk_buffer, sk_buffer, seed_buffer;
-    stodium_get_buffer(jenv, &pk_buffer, pk);
-    stodium_get_buffer(jenv, &sk_buffer, sk);
-    stodium_get_buffer(jenv, &seed_buffer, seed);
-
-    jint result = (jint) crypto_box_curve25519xchacha20poly1305_seed_keypair(
-            AS_OUTPUT(unsigned char, pk_buffer),
-            AS_OUTPUT(unsigned char, sk_buffer),
-            AS_INPUT(unsigned char, seed_buffer));
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1open_1detached_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong src_mac, jint src_mac_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&mac_buffer, src_mac, src_mac_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer, key, key_length);
 
-    stodium_release_output(jenv, pk, &pk_buffer);
-    stodium_release_output(jenv, sk, &sk_buffer);
-    stodium_release_input(jenv, seed, &seed_buffer);
+    jint result = (jint) crypto_secretbox_open_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT(unsigned char, mac_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1keypair) (JNIEnv *jenv, jclass jcls,
-        jobject pk,
-        jobject sk) {
-    stodium_buffer pk_buffer, sk_buffer;
-    stodium_get_buffer(jenv, &pk_buffer, pk);
-    stodium_get_buffer(jenv, &sk_buffer, sk);
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1open_1detached_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray src_mac, jint src_mac_offset, jint src_mac_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &mac_buffer, src_mac, src_mac_offset, src_mac_length);
+    stodium_get_array_critical(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer, key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_box_curve25519xchacha20poly1305_keypair(
-            AS_OUTPUT(unsigned char, pk_buffer),
-            AS_OUTPUT(unsigned char, sk_buffer));
+    jint result = (jint) crypto_secretbox_open_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT(unsigned char, mac_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, pk, &pk_buffer);
-    stodium_release_output(jenv, sk, &sk_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, src_mac, &mac_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1beforenm) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1open_1detached_1handle) (JNIEnv *jenv, jclass jcls,
         jobject dst,
-        jobject pub,
-        jobject priv) {
-    stodium_buffer dst_buffer, pub_buffer, priv_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &pub_buffer, pub);
-    stodium_get_buffer(jenv, &priv_buffer, priv);
+        jobject src,
+        jobject src_mac,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer, src_mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_box_curve25519xchacha20poly1305_beforenm(
+    jint result = (jint) crypto_secretbox_open_detached(
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT(unsigned char, pub_buffer),
-            AS_INPUT(unsigned char, priv_buffer));
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT(unsigned char, mac_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, pub, &pub_buffer);
-    stodium_release_input(jenv, priv, &priv_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, src_mac, &mac_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1easy_1afternm) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
+/**
+ * stodium_sg_secretbox_xsalsa20poly1305 describes secretbox_xsalsa20poly1305 for the scatter/gather
+ * natives.
+ */
+static const stodium_sg_construction stodium_sg_secretbox_xsalsa20poly1305 = {
+    STODIUM_SG_SECRETBOX, crypto_stream_salsa20_xor_ic, 24U, crypto_core_hsalsa20, 0U
+};
+
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1detachedv) (JNIEnv *jenv, jclass jcls,
+        jobjectArray dst,
+        jobject      mac,
+        jobjectArray src,
+        jobject      nonce,
+        jobject      key) {
+    return stodium_sg_seal(jenv, &stodium_sg_secretbox_xsalsa20poly1305, dst, mac, src, NULL, nonce, key);
+}
+
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1open_1detachedv) (JNIEnv *jenv, jclass jcls,
+        jobjectArray dst,
+        jobjectArray src,
+        jobject      mac,
+        jobject      nonce,
+        jobject      key) {
+    return stodium_sg_open(jenv, &stodium_sg_secretbox_xsalsa20poly1305, dst, src, mac, NULL, nonce, key);
+}
+
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1easy_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jint    plain_length,
         jobject nonce,
         jobject key) {
-    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer buf_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer, buf);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_box_curve25519xchacha20poly1305_easy_afternm(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
+    // The MAC is prepended, so the plain text overlaps the cipher text at an
+    // offset of MACBYTES; libsodium moves the message into place first
+    jint result = (jint) crypto_secretbox_easy(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            (unsigned long long) plain_length,
             AS_INPUT(unsigned char, nonce_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_output(jenv, buf, &buf_buffer);
     stodium_release_input(jenv, nonce, &nonce_buffer);
     stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1open_1easy_1afternm) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1open_1easy_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
         jobject nonce,
         jobject key) {
-    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer buf_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer, buf);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_box_curve25519xchacha20poly1305_open_easy_afternm(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
+    jint result = (jint) crypto_secretbox_open_easy(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
             AS_INPUT(unsigned char, nonce_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_output(jenv, buf, &buf_buffer);
     stodium_release_input(jenv, nonce, &nonce_buffer);
     stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1easy) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1detached_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject dst_mac,
         jobject nonce,
-        jobject pub,
-        jobject priv) {
-    stodium_buffer dst_buffer, src_buffer, nonce_buffer, pub_buffer, priv_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &pub_buffer, pub);
-    stodium_get_buffer(jenv, &priv_buffer, priv);
+        jobject key) {
+    stodium_buffer buf_buffer, mac_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer, buf);
+    stodium_get_buffer_critical(jenv, &mac_buffer, dst_mac);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &mac_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_box_curve25519xchacha20poly1305_easy(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
+    jint result = (jint) crypto_secretbox_detached(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
             AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, pub_buffer),
-            AS_INPUT(unsigned char, priv_buffer));
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_output(jenv, buf, &buf_buffer);
+    stodium_release_output(jenv, dst_mac, &mac_buffer);
     stodium_release_input(jenv, nonce, &nonce_buffer);
-    stodium_release_input(jenv, pub, &pub_buffer);
-    stodium_release_input(jenv, priv, &priv_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1box_1curve25519xchacha20poly1305_1open_1easy) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jobject nonce,
-        jobject pub,
-        jobject priv) {
-    stodium_buffer dst_buffer, src_buffer, nonce_buffer, pub_buffer, priv_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &pub_buffer, pub);
-    stodium_get_buffer(jenv, &priv_buffer, priv);
+STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1open_1detached_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject src_mac,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, mac_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer, buf);
+    stodium_get_buffer_critical(jenv, &mac_buffer, src_mac);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &mac_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_box_curve25519xchacha20poly1305_open_easy(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
+    jint result = (jint) crypto_secretbox_open_detached(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, mac_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
             AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, pub_buffer),
-            AS_INPUT(unsigned char, priv_buffer));
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_output(jenv, buf, &buf_buffer);
+    stodium_release_input(jenv, src_mac, &mac_buffer);
     stodium_release_input(jenv, nonce, &nonce_buffer);
-    stodium_release_input(jenv, pub, &pub_buffer);
-    stodium_release_input(jenv, priv, &priv_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
 /** ****************************************************************************
  *
- * CODECS
+ * SECRETBOX - XSalsa20Poly1305
  *
  **************************************************************************** */
 
-/** ****************************************************************************
- *
- * CODECS - HEX
- *
- **************************************************************************** */
+STODIUM_CONSTANT(secretbox, xchacha20poly1305, keybytes)
+STODIUM_CONSTANT(secretbox, xchacha20poly1305, macbytes)
+STODIUM_CONSTANT(secretbox, xchacha20poly1305, noncebytes)
 
-STODIUM_JNI(jint, sodium_1bin2hex) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1easy) (JNIEnv *jenv, jclass jcls,
         jobject dst,
-        jobject src) {
-    stodium_buffer dst_buffer, src_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
+        jobject src,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    sodium_bin2hex(
-            AS_OUTPUT(char, dst_buffer),
-            AS_INPUT_LEN(size_t, dst_buffer),
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_easy(
+            AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(size_t, src_buffer));
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
     stodium_release_input(jenv, src, &src_buffer);
-    
-    return (jint) 0;
-}
-
-STODIUM_JNI(jint, sodium_1hex2bin) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src) {
-    stodium_buffer dst_buffer, src_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-
-    jint result = (jint) sodium_hex2bin(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT_LEN(size_t, dst_buffer),
-            AS_INPUT(char, src_buffer),
-            AS_INPUT_LEN(size_t, src_buffer),
-            NULL,
-            NULL,
-            NULL);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    
     return result;
 }
 
-/** ****************************************************************************
- *
- * CODECS - BASE64
- *
- **************************************************************************** */
-
-STODIUM_JNI(jint, stodium_1base64_1variant_1original) (JNIEnv *jenv, jclass jcls) {
-        return (jint) sodium_base64_VARIANT_ORIGINAL;
-}
-STODIUM_JNI(jint, stodium_1base64_1variant_1original_1no_1padding) (JNIEnv *jenv, jclass jcls) {
-        return (jint) sodium_base64_VARIANT_ORIGINAL_NO_PADDING;
-}
-STODIUM_JNI(jint, stodium_1base64_1variant_1urlsafe) (JNIEnv *jenv, jclass jcls) {
-        return (jint) sodium_base64_VARIANT_URLSAFE;
-}
-STODIUM_JNI(jint, stodium_1base64_1variant_1urlsafe_1no_1padding) (JNIEnv *jenv, jclass jcls) {
-        return (jint) sodium_base64_VARIANT_URLSAFE_NO_PADDING;
-}
-
-STODIUM_JNI(jint, sodium_1base64_1encoded_1len) (JNIEnv *jenv, jclass jcls,
-        jint bin_len,
-        jint variant) {
-    return (jint) sodium_base64_encoded_len(
-            (const size_t) bin_len,
-            (const int) variant);
-}
-
-STODIUM_JNI(jint, sodium_1bin2base64) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jint variant) {
-    stodium_buffer dst_buffer, src_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1easy_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer, key, key_length);
 
-    sodium_bin2base64(
-            AS_OUTPUT(char, dst_buffer),
-            AS_INPUT_LEN(size_t, dst_buffer),
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_easy(
+            AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(size_t, src_buffer),
-            (const int) variant);
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    
-    return 0;
+    return result;
 }
 
-STODIUM_JNI(jint, sodium_1base642bin) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jint variant) {
-    stodium_buffer dst_buffer, src_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1easy_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer, key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) sodium_base642bin(
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_easy(
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT_LEN(size_t, dst_buffer),
-            AS_INPUT(char, src_buffer),
-            AS_INPUT_LEN(size_t, src_buffer),
-            NULL,
-            AS_OUTPUT_LEN(size_t, dst_buffer),
-            NULL,
-            (const int) variant);
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
     stodium_release_input(jenv, src, &src_buffer);
-    
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
     return result;
 }
 
-/** ****************************************************************************
- *
- * CORE - HCHACHA
- *
- **************************************************************************** */
-
-STODIUM_CONSTANT(core, hchacha20, outputbytes)
-STODIUM_CONSTANT(core, hchacha20, inputbytes)
-STODIUM_CONSTANT(core, hchacha20, keybytes)
-STODIUM_CONSTANT(core, hchacha20, constbytes)
-
-STODIUM_JNI(jint, crypto_1core_1hchacha20) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1easy_1handle) (JNIEnv *jenv, jclass jcls,
         jobject dst,
         jobject src,
-        jobject key,
-        jobject constant) {
-    stodium_buffer dst_buffer, src_buffer, key_buffer, const_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &key_buffer,   key);
-    stodium_get_buffer(jenv, &const_buffer, constant);
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_core_hchacha20(
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_easy(
             AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT(unsigned char, key_buffer),
-            AS_INPUT(unsigned char, const_buffer));
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
     stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
-    stodium_release_input(jenv, constant, &const_buffer);
-    
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+
     return result;
 }
 
-/** ****************************************************************************
- *
- * CORE - HSALSA20
- *
- **************************************************************************** */
-
-STODIUM_CONSTANT(core, hsalsa20, outputbytes)
-STODIUM_CONSTANT(core, hsalsa20, inputbytes)
-STODIUM_CONSTANT(core, hsalsa20, keybytes)
-STODIUM_CONSTANT(core, hsalsa20, constbytes)
-
-STODIUM_JNI(jint, crypto_1core_1hsalsa20) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1open_1easy) (JNIEnv *jenv, jclass jcls,
         jobject dst,
         jobject src,
-        jobject key,
-        jobject constant) {
-    stodium_buffer dst_buffer, src_buffer, key_buffer, const_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,   dst);
-    stodium_get_buffer(jenv, &src_buffer,   src);
-    stodium_get_buffer(jenv, &key_buffer,   key);
-    stodium_get_buffer(jenv, &const_buffer, constant);
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_core_hsalsa20(
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_open_easy(
             AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT(unsigned char, key_buffer),
-            AS_INPUT(unsigned char, const_buffer));
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
     stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
     stodium_release_input(jenv, key, &key_buffer);
-    stodium_release_input(jenv, constant, &const_buffer);
-    
+
     return result;
 }
 
-/** ****************************************************************************
- *
- * GENERICHASH
- *
- **************************************************************************** */
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1open_1easy_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer, key, key_length);
 
-STODIUM_CONSTANT_STR(generichash)
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_open_easy(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-/** ****************************************************************************
- *
- * GENERICHASH - Blake2b
- *
- **************************************************************************** */
-STODIUM_CONSTANT(generichash, blake2b, bytes)
-STODIUM_CONSTANT(generichash, blake2b, keybytes)
-STODIUM_CONSTANT(generichash, blake2b, saltbytes)
-STODIUM_CONSTANT(generichash, blake2b, personalbytes)
-STODIUM_CONSTANT(generichash, blake2b, statebytes)
-STODIUM_JNI(jint, crypto_1generichash_1blake2b_1bytes_1min) (JNIEnv *jenv, jclass jcls) {
-    return (jint) crypto_generichash_blake2b_bytes_min();
-}
-STODIUM_JNI(jint, crypto_1generichash_1blake2b_1bytes_1max) (JNIEnv *jenv, jclass jcls) {
-    return (jint) crypto_generichash_blake2b_bytes_max();
-}
-STODIUM_JNI(jint, crypto_1generichash_1blake2b_1keybytes_1min) (JNIEnv *jenv, jclass jcls) {
-    return (jint) crypto_generichash_blake2b_keybytes_min();
-}
-STODIUM_JNI(jint, crypto_1generichash_1blake2b_1keybytes_1max) (JNIEnv *jenv, jclass jcls) {
-    return (jint) crypto_generichash_blake2b_keybytes_max();
+    return result;
 }
 
-STODIUM_JNI(jint, crypto_1generichash_1blake2b) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jobject key) {
-    stodium_buffer dst_buffer, src_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1open_1easy_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer, key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_generichash_blake2b(
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_open_easy(
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT_LEN(size_t, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, key_buffer),
-            AS_INPUT_LEN(size_t, key_buffer));
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
     stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
     stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1generichash_1blake2b_1salt_1personal) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1open_1easy_1handle) (JNIEnv *jenv, jclass jcls,
         jobject dst,
         jobject src,
-        jobject key,
-        jobject salt,
-        jobject personal) {
-    stodium_buffer dst_buffer, src_buffer, key_buffer, salt_buffer, pers_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
-    stodium_get_buffer(jenv, &salt_buffer, salt);
-    stodium_get_buffer(jenv, &pers_buffer, personal);
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_generichash_blake2b_salt_personal(
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_open_easy(
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT_LEN(size_t, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, key_buffer),
-            AS_INPUT_LEN(size_t, key_buffer),
-            AS_INPUT(unsigned char, salt_buffer),
-            AS_INPUT(unsigned char, pers_buffer));
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
     stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
-    stodium_release_input(jenv, salt, &salt_buffer);
-    stodium_release_input(jenv, personal, &pers_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
 
     return result;
 }
 
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1detached) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject dst_mac,
+        jobject src,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer, dst_mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-STODIUM_JNI(jint, crypto_1generichash_1blake2b_1init) (JNIEnv *jenv, jclass jcls,
-        jobject state,
-        jobject key,
-        jint    outlen) {
-    stodium_buffer dst_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, state);
-    stodium_get_buffer(jenv, &key_buffer, key);
-
-    jint result = (jint) crypto_generichash_blake2b_init(
-            AS_OUTPUT(crypto_generichash_blake2b_state, dst_buffer),
-            AS_INPUT(unsigned char, key_buffer),
-            AS_INPUT_LEN(size_t, key_buffer),
-            (size_t) outlen);
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, state, &dst_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_output(jenv, dst_mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
     stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1generichash_1blake2b_1update) (JNIEnv *jenv, jclass jcls,
-        jobject state,
-        jobject src) {
-    stodium_buffer dst_buffer, src_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, state);
-    stodium_get_buffer(jenv, &src_buffer, src);
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1detached_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong dst_mac, jint dst_mac_length,
+        jlong src, jint src_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&mac_buffer, dst_mac, dst_mac_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer, key, key_length);
 
-    jint result = (jint) crypto_generichash_blake2b_update(
-            AS_OUTPUT(crypto_generichash_blake2b_state, dst_buffer),
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
             AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer));
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, state, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1generichash_1blake2b_1final) (JNIEnv *jenv, jclass jcls,
-        jobject state,
-        jobject dst) {
-    stodium_buffer state_buffer, dst_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &state_buffer, state);
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1detached_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray dst_mac, jint dst_mac_offset, jint dst_mac_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &mac_buffer, dst_mac, dst_mac_offset, dst_mac_length);
+    stodium_get_array_critical(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer, key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_generichash_blake2b_final(
-            AS_OUTPUT(crypto_generichash_blake2b_state, state_buffer),
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_detached(
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT_LEN(size_t, dst_buffer));
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_output(jenv, state, &state_buffer);
+    stodium_release_output(jenv, dst_mac, &mac_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-/** ****************************************************************************
- *
- * HASH
- *
- **************************************************************************** */
-
-STODIUM_CONSTANT_STR(hash)
-
-/** ****************************************************************************
- *
- * HASH - SHA-256
- *
- **************************************************************************** */
-
-STODIUM_CONSTANT(hash, sha256, bytes)
-STODIUM_CONSTANT(hash, sha256, statebytes)
-
-STODIUM_JNI(jint, crypto_1hash_1sha256) (JNIEnv *jenv, jclass jcls,
-        jobject mac,
-        jobject src) {
-    stodium_buffer mac_buffer, src_buffer;
-    stodium_get_buffer(jenv, &mac_buffer, mac);
-    stodium_get_buffer(jenv, &src_buffer, src);
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1detached_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject dst_mac,
+        jobject src,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer, dst_mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_hash_sha256(
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
             AS_OUTPUT(unsigned char, mac_buffer),
             AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer));
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_output(jenv, dst_mac, &mac_buffer);
     stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1hash_1sha256_1init) (JNIEnv *jenv, jclass jcls,
-        jobject dst) {
-    stodium_buffer dst_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1open_1detached) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject src_mac,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer, src_mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_hash_sha256_init(
-            AS_OUTPUT(crypto_hash_sha256_state, dst_buffer));
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_open_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT(unsigned char, mac_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, src_mac, &mac_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1hash_1sha256_1update) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src) {
-    stodium_buffer dst_buffer, src_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1open_1detached_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong src_mac, jint src_mac_length,
+        jlong nonce, jint nonce_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&mac_buffer, src_mac, src_mac_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&nonce_buffer, nonce, nonce_length);
+    stodium_get_address(&key_buffer, key, key_length);
 
-    jint result = (jint) crypto_hash_sha256_update(
-            AS_OUTPUT(crypto_hash_sha256_state, dst_buffer),
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_open_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer));
-
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
+            AS_INPUT(unsigned char, mac_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1hash_1sha256_1final) (JNIEnv *jenv, jclass jcls,
-        jobject state,
-        jobject dst) {
-    stodium_buffer state_buffer, dst_buffer;
-    stodium_get_buffer(jenv, &state_buffer, state);
-    stodium_get_buffer(jenv, &dst_buffer, dst);
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1open_1detached_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray src_mac, jint src_mac_offset, jint src_mac_length,
+        jbyteArray nonce, jint nonce_offset, jint nonce_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_array_critical(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array_critical(jenv, &mac_buffer, src_mac, src_mac_offset, src_mac_length);
+    stodium_get_array_critical(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array_critical(jenv, &nonce_buffer, nonce, nonce_offset, nonce_length);
+    stodium_get_array_critical(jenv, &key_buffer, key, key_offset, key_length);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_hash_sha256_final(
-            AS_OUTPUT(crypto_hash_sha256_state, state_buffer),
-            AS_OUTPUT(unsigned char, dst_buffer));
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_open_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT(unsigned char, mac_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, state, &state_buffer);
     stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, src_mac, &mac_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-/** ****************************************************************************
- *
- * HASH - SHA-512
- *
- **************************************************************************** */
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1open_1detached_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject src_mac,
+        jobject nonce,
+        jlong   key) {
+    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &mac_buffer, src_mac);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &mac_buffer, &src_buffer, &nonce_buffer) != 0) {
+        return -1;
+    }
+
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_open_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT(unsigned char, mac_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, src_mac, &mac_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
 
-STODIUM_CONSTANT(hash, sha512, bytes)
-STODIUM_CONSTANT(hash, sha512, statebytes)
+    return result;
+}
 
-STODIUM_JNI(jint, crypto_1hash_1sha512) (JNIEnv *jenv, jclass jcls,
-        jobject mac,
-        jobject src) {
-    stodium_buffer mac_buffer, src_buffer;
-    stodium_get_buffer(jenv, &mac_buffer, mac);
-    stodium_get_buffer(jenv, &src_buffer, src);
+/**
+ * stodium_sg_secretbox_xchacha20poly1305 describes secretbox_xchacha20poly1305 for the scatter/gather
+ * natives.
+ */
+static const stodium_sg_construction stodium_sg_secretbox_xchacha20poly1305 = {
+    STODIUM_SG_SECRETBOX, crypto_stream_chacha20_xor_ic, 24U, crypto_core_hchacha20, 0U
+};
+
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1detachedv) (JNIEnv *jenv, jclass jcls,
+        jobjectArray dst,
+        jobject      mac,
+        jobjectArray src,
+        jobject      nonce,
+        jobject      key) {
+    return stodium_sg_seal(jenv, &stodium_sg_secretbox_xchacha20poly1305, dst, mac, src, NULL, nonce, key);
+}
+
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1open_1detachedv) (JNIEnv *jenv, jclass jcls,
+        jobjectArray dst,
+        jobjectArray src,
+        jobject      mac,
+        jobject      nonce,
+        jobject      key) {
+    return stodium_sg_open(jenv, &stodium_sg_secretbox_xchacha20poly1305, dst, src, mac, NULL, nonce, key);
+}
+
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1easy_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jint    plain_length,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer, buf);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_hash_sha512(
-            AS_OUTPUT(unsigned char, mac_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer));
+    // The MAC is prepended, so the plain text overlaps the cipher text at an
+    // offset of MACBYTES; libsodium moves the message into place first
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_easy(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            (unsigned long long) plain_length,
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, mac, &mac_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_output(jenv, buf, &buf_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1hash_1sha512_1init) (JNIEnv *jenv, jclass jcls,
-        jobject dst) {
-    stodium_buffer dst_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1open_1easy_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer, buf);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_hash_sha512_init(
-            AS_OUTPUT(crypto_hash_sha512_state, dst_buffer));
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_open_easy(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_output(jenv, buf, &buf_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1hash_1sha512_1update) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src) {
-    stodium_buffer dst_buffer, src_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1detached_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject dst_mac,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, mac_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer, buf);
+    stodium_get_buffer_critical(jenv, &mac_buffer, dst_mac);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &mac_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_hash_sha512_update(
-            AS_OUTPUT(crypto_hash_sha512_state, dst_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer));
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_detached(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_OUTPUT(unsigned char, mac_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_output(jenv, buf, &buf_buffer);
+    stodium_release_output(jenv, dst_mac, &mac_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1hash_1sha512_1final) (JNIEnv *jenv, jclass jcls,
-        jobject state,
-        jobject dst) {
-    stodium_buffer state_buffer, dst_buffer;
-    stodium_get_buffer(jenv, &state_buffer, state);
-    stodium_get_buffer(jenv, &dst_buffer, dst);
+STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1open_1detached_1inplace) (JNIEnv *jenv, jclass jcls,
+        jobject buf,
+        jobject src_mac,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer buf_buffer, mac_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &buf_buffer, buf);
+    stodium_get_buffer_critical(jenv, &mac_buffer, src_mac);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &buf_buffer, &mac_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_hash_sha512_final(
-            AS_OUTPUT(crypto_hash_sha512_state, state_buffer),
-            AS_OUTPUT(unsigned char, dst_buffer));
+    jint result = (jint) crypto_secretbox_xchacha20poly1305_open_detached(
+            AS_OUTPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, buf_buffer),
+            AS_INPUT(unsigned char, mac_buffer),
+            AS_INPUT_LEN(unsigned long long, buf_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, state, &state_buffer);
-    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_output(jenv, buf, &buf_buffer);
+    stodium_release_input(jenv, src_mac, &mac_buffer);
+    stodium_release_input(jenv, nonce, &nonce_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
 /** ****************************************************************************
  *
- * KDF
+ * SECRETSTREAM
  *
  **************************************************************************** */
 
-STODIUM_CONSTANT_STR(kdf)
-
 /** ****************************************************************************
  *
- * KDF - Blake2b
+ * SECRETSTREAM - XChacha20Poly1305
  *
  **************************************************************************** */
-
-STODIUM_CONSTANT(kdf, blake2b, contextbytes)
-STODIUM_CONSTANT(kdf, blake2b, keybytes)
-STODIUM_JNI(jint, crypto_1kdf_1blake2b_1bytes_1min) (JNIEnv *jenv, jclass jcls) {
-    return (jint) crypto_kdf_blake2b_bytes_min();
+STODIUM_CONSTANT(secretstream, xchacha20poly1305, abytes)
+STODIUM_CONSTANT(secretstream, xchacha20poly1305, headerbytes)
+STODIUM_CONSTANT(secretstream, xchacha20poly1305, keybytes)
+STODIUM_CONSTANT(secretstream, xchacha20poly1305, statebytes)
+STODIUM_JNI(jint, crypto_1secretstream_1xchacha20poly1305_1tag_1message) (JNIEnv *jenv, jclass jcls) {
+       return (jint) crypto_secretstream_xchacha20poly1305_tag_message();
 }
-STODIUM_JNI(jint, crypto_1kdf_1blake2b_1bytes_1max) (JNIEnv *jenv, jclass jcls) {
-    return (jint) crypto_kdf_blake2b_bytes_max();
+STODIUM_JNI(jint, crypto_1secretstream_1xchacha20poly1305_1tag_1push) (JNIEnv *jenv, jclass jcls) {
+       return (jint) crypto_secretstream_xchacha20poly1305_tag_push();
+}
+STODIUM_JNI(jint, crypto_1secretstream_1xchacha20poly1305_1tag_1rekey) (JNIEnv *jenv, jclass jcls) {
+       return (jint) crypto_secretstream_xchacha20poly1305_tag_rekey();
+}
+STODIUM_JNI(jint, crypto_1secretstream_1xchacha20poly1305_1tag_1final) (JNIEnv *jenv, jclass jcls) {
+       return (jint) crypto_secretstream_xchacha20poly1305_tag_final();
 }
 
-STODIUM_JNI(jint, crypto_1kdf_1blake2b_1derive_1from_1key) (JNIEnv *jenv, jclass jcls,
-        jobject sub,
-        jlong   subid,
-        jobject ctx,
+STODIUM_JNI(jint, crypto_1secretstream_1xchacha20poly1305_1init_1push) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jobject header,
         jobject key) {
-    stodium_buffer sub_buffer, ctx_buffer, key_buffer;
-    stodium_get_buffer(jenv, &sub_buffer, sub);
-    stodium_get_buffer(jenv, &ctx_buffer, ctx);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer state_buffer, header_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &state_buffer,  state);
+    stodium_get_buffer_critical(jenv, &header_buffer, header);
+    stodium_get_buffer_critical(jenv, &key_buffer,    key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &state_buffer, &header_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_kdf_blake2b_derive_from_key(
-            AS_OUTPUT(unsigned char, sub_buffer),
-            AS_INPUT_LEN(size_t, sub_buffer),
-            (uint64_t) subid,
-            AS_INPUT(char, ctx_buffer),
+    jint result = (jint) crypto_secretstream_xchacha20poly1305_init_push(
+            AS_OUTPUT(crypto_secretstream_xchacha20poly1305_state, state_buffer),
+            AS_OUTPUT(unsigned char, header_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, sub, &sub_buffer);
-    stodium_release_input(jenv, ctx, &ctx_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_output(jenv, state,  &state_buffer);
+    stodium_release_output(jenv, header, &header_buffer);
+    stodium_release_input(jenv,  key,    &key_buffer);
 
     return result;
 }
 
-/** ****************************************************************************
- *
- * KX (x25519blake2b)
- *
- **************************************************************************** */
-
-STODIUM_CONSTANT_STR(kx)
-STODIUM_CONSTANT_HL(kx, publickeybytes)
-STODIUM_CONSTANT_HL(kx, secretkeybytes)
-STODIUM_CONSTANT_HL(kx, seedbytes)
-STODIUM_CONSTANT_HL(kx, sessionkeybytes)
-
-STODIUM_JNI(jint, crypto_1kx_1keypair) (JNIEnv *jenv, jclass jcls,
-        jobject pub,
-        jobject priv) {
-    stodium_buffer pub_buffer, priv_buffer;
-    stodium_get_buffer(jenv, &pub_buffer, pub);
-    stodium_get_buffer(jenv, &priv_buffer, priv);
+STODIUM_JNI(jint, crypto_1secretstream_1xchacha20poly1305_1init_1pull) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jobject header,
+        jobject key) {
+    stodium_buffer state_buffer, header_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &state_buffer,  state);
+    stodium_get_buffer_critical(jenv, &header_buffer, header);
+    stodium_get_buffer_critical(jenv, &key_buffer,    key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &state_buffer, &header_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_kx_keypair(
-            AS_OUTPUT(unsigned char, pub_buffer),
-            AS_OUTPUT(unsigned char, priv_buffer));
+    jint result = (jint) crypto_secretstream_xchacha20poly1305_init_pull(
+            AS_OUTPUT(crypto_secretstream_xchacha20poly1305_state, state_buffer),
+            AS_INPUT(unsigned char, header_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, pub, &pub_buffer);
-    stodium_release_output(jenv, priv, &priv_buffer);
+    stodium_release_output(jenv, state,  &state_buffer);
+    stodium_release_input(jenv,  header, &header_buffer);
+    stodium_release_input(jenv,  key,    &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1kx_1seed_1keypair) (JNIEnv *jenv, jclass jcls,
-        jobject pub,
-        jobject priv,
-        jobject seed) {
-    stodium_buffer pub_buffer, priv_buffer, seed_buffer;
-    stodium_get_buffer(jenv, &pub_buffer, pub);
-    stodium_get_buffer(jenv, &priv_buffer, priv);
-    stodium_get_buffer(jenv, &seed_buffer, seed);
+/**
+ * crypto_secretstream_xchacha20poly1305_push encrypts src as the next chunk of
+ * the stream, writing src length + abytes bytes straight into dst.
+ */
+STODIUM_JNI(jint, crypto_1secretstream_1xchacha20poly1305_1push) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jobject dst,
+        jobject src,
+        jobject ad,
+        jint    tag) {
+    stodium_buffer state_buffer, dst_buffer, src_buffer, ad_buffer;
+    stodium_get_buffer_critical(jenv, &state_buffer, state);
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    if (STODIUM_ENTER_CRITICAL(jenv, &state_buffer, &dst_buffer, &src_buffer, &ad_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_kx_seed_keypair(
-            AS_OUTPUT(unsigned char, pub_buffer),
-            AS_OUTPUT(unsigned char, priv_buffer),
-            AS_INPUT(unsigned char, seed_buffer));
+    jint result = (jint) crypto_secretstream_xchacha20poly1305_push(
+            AS_OUTPUT(crypto_secretstream_xchacha20poly1305_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL,
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer),
+            (unsigned char) tag);
 
-    stodium_release_output(jenv, pub, &pub_buffer);
-    stodium_release_output(jenv, priv, &priv_buffer);
-    stodium_release_input(jenv, seed, &seed_buffer);
+    stodium_release_output(jenv, state, &state_buffer);
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1kx_1server_1session_1keys) (JNIEnv *jenv, jclass jcls,
-            jobject rx,
-            jobject tx,
-            jobject spk,
-            jobject ssk,
-            jobject cpk) {
-    stodium_buffer rx_buffer, tx_buffer, spk_buffer, ssk_buffer, cpk_buffer;
-    stodium_get_buffer(jenv, &rx_buffer, rx);
-    stodium_get_buffer(jenv, &tx_buffer, tx);
-    stodium_get_buffer(jenv, &spk_buffer, spk);
-    stodium_get_buffer(jenv, &ssk_buffer, ssk);
-    stodium_get_buffer(jenv, &cpk_buffer, cpk);
+/**
+ * crypto_secretstream_xchacha20poly1305_pull verifies and decrypts the next
+ * chunk of the stream into dst. It returns the tag attached to the chunk, or
+ * -1 if the chunk could not be verified. The state is left untouched on
+ * failure.
+ */
+STODIUM_JNI(jint, crypto_1secretstream_1xchacha20poly1305_1pull) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jobject dst,
+        jobject src,
+        jobject ad) {
+    unsigned char tag;
+    stodium_buffer state_buffer, dst_buffer, src_buffer, ad_buffer;
+    stodium_get_buffer_critical(jenv, &state_buffer, state);
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &ad_buffer,    ad);
+    if (STODIUM_ENTER_CRITICAL(jenv, &state_buffer, &dst_buffer, &src_buffer, &ad_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_kx_server_session_keys(
-            AS_OUTPUT(unsigned char, rx_buffer),
-            AS_OUTPUT(unsigned char, tx_buffer),
-            AS_INPUT(unsigned char, spk_buffer),
-            AS_INPUT(unsigned char, ssk_buffer),
-            AS_INPUT(unsigned char, cpk_buffer));
+    jint result = (jint) crypto_secretstream_xchacha20poly1305_pull(
+            AS_OUTPUT(crypto_secretstream_xchacha20poly1305_state, state_buffer),
+            AS_OUTPUT(unsigned char, dst_buffer),
+            NULL,
+            &tag,
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, ad_buffer),
+            AS_INPUT_LEN(unsigned long long, ad_buffer));
 
-    stodium_release_output(jenv, rx, &rx_buffer);
-    stodium_release_output(jenv, tx, &tx_buffer);
-    stodium_release_input(jenv, spk, &spk_buffer);
-    stodium_release_input(jenv, ssk, &ssk_buffer);
-    stodium_release_input(jenv, cpk, &cpk_buffer);
+    stodium_release_output(jenv, state, &state_buffer);
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  ad,    &ad_buffer);
 
-    return result;
+    return result == 0 ? (jint) tag : -1;
 }
 
-STODIUM_JNI(jint, crypto_1kx_1client_1session_1keys) (JNIEnv *jenv, jclass jcls,
-            jobject rx,
-            jobject tx,
-            jobject cpk,
-            jobject csk,
-            jobject spk) {
-    stodium_buffer rx_buffer, tx_buffer, cpk_buffer, csk_buffer, spk_buffer;
-    stodium_get_buffer(jenv, &rx_buffer, rx);
-    stodium_get_buffer(jenv, &tx_buffer, tx);
-    stodium_get_buffer(jenv, &cpk_buffer, cpk);
-    stodium_get_buffer(jenv, &csk_buffer, csk);
-    stodium_get_buffer(jenv, &spk_buffer, spk);
-
-    jint result = (jint) crypto_kx_client_session_keys(
-            AS_OUTPUT(unsigned char, rx_buffer),
-            AS_OUTPUT(unsigned char, tx_buffer),
-            AS_INPUT(unsigned char, cpk_buffer),
-            AS_INPUT(unsigned char, csk_buffer),
-            AS_INPUT(unsigned char, spk_buffer));
+STODIUM_JNI(void, crypto_1secretstream_1xchacha20poly1305_1rekey) (JNIEnv *jenv, jclass jcls,
+        jobject state) {
+    stodium_buffer state_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
 
-    stodium_release_output(jenv, rx, &rx_buffer);
-    stodium_release_output(jenv, tx, &tx_buffer);
-    stodium_release_input(jenv, cpk, &cpk_buffer);
-    stodium_release_input(jenv, csk, &csk_buffer);
-    stodium_release_input(jenv, spk, &spk_buffer);
+    crypto_secretstream_xchacha20poly1305_rekey(
+            AS_OUTPUT(crypto_secretstream_xchacha20poly1305_state, state_buffer));
 
-    return result;
+    stodium_release_output(jenv, state, &state_buffer);
 }
 
 /** ****************************************************************************
  *
- * ONETIMEAUTH
+ * SHORTHASH
  *
  **************************************************************************** */
 
-STODIUM_CONSTANT_STR(onetimeauth)
+STODIUM_CONSTANT_STR(shorthash)
 
 /** ****************************************************************************
  *
- * ONETIMEAUTH - Poly1305
+ * SHORTHASH - SipHash-2-4
  *
  **************************************************************************** */
+STODIUM_CONSTANT(shorthash, siphash24, bytes)
+STODIUM_CONSTANT(shorthash, siphash24, keybytes)
 
-STODIUM_CONSTANT(onetimeauth, poly1305, bytes)
-STODIUM_CONSTANT(onetimeauth, poly1305, keybytes)
-STODIUM_CONSTANT(onetimeauth, poly1305, statebytes)
-
-STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305) (JNIEnv *jenv, jclass jcls,
-        jobject mac,
+STODIUM_JNI(jint, crypto_1shorthash_1siphash24) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
         jobject src,
         jobject key) {
-    stodium_buffer mac_buffer, src_buffer, key_buffer;
-    stodium_get_buffer(jenv, &mac_buffer, mac);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer dst_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_onetimeauth_poly1305(
-            AS_OUTPUT(unsigned char, mac_buffer),
+    jint result = (jint) crypto_shorthash_siphash24(
+            AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, mac, &mac_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
     stodium_release_input(jenv, src, &src_buffer);
     stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1verify) (JNIEnv *jenv, jclass jcls,
-        jobject mac,
+STODIUM_JNI(jint, crypto_1shorthash_1siphash24_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&key_buffer, key, key_length);
+
+    jint result = (jint) crypto_shorthash_siphash24(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    return result;
+}
+
+STODIUM_JNI(jint, crypto_1shorthash_1siphash24_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
         jobject src,
-        jobject key) {
-    stodium_buffer mac_buffer, src_buffer, key_buffer;
-    stodium_get_buffer(jenv, &mac_buffer, mac);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_onetimeauth_poly1305_verify(
-            AS_OUTPUT(unsigned char, mac_buffer),
+    jint result = (jint) crypto_shorthash_siphash24(
+            AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_input(jenv, mac, &mac_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
     stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1init) (JNIEnv *jenv, jclass jcls,
+/** ****************************************************************************
+ *
+ * SHORTHASH - SipHashx-2-4
+ *
+ **************************************************************************** */
+STODIUM_CONSTANT(shorthash, siphashx24, bytes)
+STODIUM_CONSTANT(shorthash, siphashx24, keybytes)
+
+STODIUM_JNI(jint, crypto_1shorthash_1siphashx24) (JNIEnv *jenv, jclass jcls,
         jobject dst,
+        jobject src,
         jobject key) {
-    stodium_buffer dst_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer dst_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_buffer_critical(jenv, &key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_onetimeauth_poly1305_init(
-            AS_OUTPUT(crypto_onetimeauth_poly1305_state, dst_buffer),
+    jint result = (jint) crypto_shorthash_siphashx24(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
     stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1update) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src) {
-    stodium_buffer dst_buffer, src_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
+STODIUM_JNI(jint, crypto_1shorthash_1siphashx24_1address) (JNIEnv *jenv, jclass jcls,
+        jlong dst, jint dst_length,
+        jlong src, jint src_length,
+        jlong key, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer;
+    stodium_get_address(&dst_buffer, dst, dst_length);
+    stodium_get_address(&src_buffer, src, src_length);
+    stodium_get_address(&key_buffer, key, key_length);
 
-    jint result = (jint) crypto_onetimeauth_poly1305_update(
-            AS_OUTPUT(crypto_onetimeauth_poly1305_state, dst_buffer),
+    jint result = (jint) crypto_shorthash_siphashx24(
+            AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer));
-
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1onetimeauth_1poly1305_1final) (JNIEnv *jenv, jclass jcls,
-        jobject state,
-        jobject dst) {
-    stodium_buffer state_buffer, dst_buffer;
-    stodium_get_buffer(jenv, &state_buffer, state);
-    stodium_get_buffer(jenv, &dst_buffer, dst);
+STODIUM_JNI(jint, crypto_1shorthash_1siphashx24_1handle) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jlong   key) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer, dst);
+    stodium_get_buffer_critical(jenv, &src_buffer, src);
+    stodium_get_handle(&key_buffer, key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_onetimeauth_poly1305_final(
-            AS_OUTPUT(crypto_onetimeauth_poly1305_state, state_buffer),
-            AS_OUTPUT(unsigned char, dst_buffer));
+    jint result = (jint) crypto_shorthash_siphashx24(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, state, &state_buffer);
     stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
 
     return result;
 }
 
 /** ****************************************************************************
  *
- * PWHASH
+ * SIGN
  *
  **************************************************************************** */
 
-STODIUM_CONSTANT_STR(pwhash)
+STODIUM_CONSTANT_STR(sign)
 
 /** ****************************************************************************
  *
- * PWHASH - Argon2i
+ * SIGN - Ed25519/Ed25519ph
  *
  **************************************************************************** */
+STODIUM_CONSTANT(sign, ed25519, publickeybytes)
+STODIUM_CONSTANT(sign, ed25519, secretkeybytes)
+STODIUM_CONSTANT(sign, ed25519, bytes)
+STODIUM_CONSTANT(sign, ed25519, seedbytes)
+STODIUM_CONSTANT(sign, ed25519ph, statebytes)
 
-STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1bytes_1min) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_argon2i_bytes_min();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1bytes_1max) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_argon2i_bytes_max();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1passwd_1min) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_argon2i_passwd_min();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1passwd_1max) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_argon2i_passwd_max();
-}
-STODIUM_CONSTANT(pwhash, argon2i, saltbytes)
-STODIUM_CONSTANT(pwhash, argon2i, strbytes)
-STODIUM_JNI(jstring, crypto_1pwhash_1argon2i_1strprefix) (JNIEnv *jenv, jclass jcls) {
-        return (*jenv)->NewStringUTF(jenv, crypto_pwhash_argon2i_strprefix());
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1opslimit_1min) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_argon2i_opslimit_min();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1opslimit_1max) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_argon2i_opslimit_max();
-}
-STODIUM_JNI(jint, crypto_1pwhash_1argon2i_1memlimit_1min) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_argon2i_memlimit_min();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1memlimit_1max) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_argon2i_memlimit_max();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1opslimit_1interactive) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_argon2i_opslimit_interactive();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1memlimit_1interactive) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_argon2i_memlimit_interactive();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1opslimit_1sensitive) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_argon2i_opslimit_sensitive();
+STODIUM_JNI(jint, crypto_1sign_1ed25519_1keypair) (JNIEnv *jenv, jclass jcls,
+        jobject pub,
+        jobject priv) {
+    stodium_buffer pub_buffer, priv_buffer;
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+
+    jint result = (jint) crypto_sign_ed25519_keypair(
+            AS_OUTPUT(unsigned char, pub_buffer),
+            AS_OUTPUT(unsigned char, priv_buffer));
+
+    stodium_release_output(jenv, pub, &pub_buffer);
+    stodium_release_output(jenv, priv, &priv_buffer);
+
+    return result;
 }
-STODIUM_JNI(jlong, crypto_1pwhash_1argon2i_1memlimit_1sensitive) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_argon2i_memlimit_sensitive();
+
+STODIUM_JNI(jint, crypto_1sign_1ed25519_1seed_1keypair) (JNIEnv *jenv, jclass jcls,
+        jobject pub,
+        jobject priv,
+        jobject seed) {
+    stodium_buffer pub_buffer, priv_buffer, seed_buffer;
+    stodium_get_buffer(jenv, &pub_buffer, pub);
+    stodium_get_buffer(jenv, &priv_buffer, priv);
+    stodium_get_buffer(jenv, &seed_buffer, seed);
+
+    jint result = (jint) crypto_sign_ed25519_seed_keypair(
+            AS_OUTPUT(unsigned char, pub_buffer),
+            AS_OUTPUT(unsigned char, priv_buffer),
+            AS_INPUT(unsigned char, seed_buffer));
+
+    stodium_release_output(jenv, pub, &pub_buffer);
+    stodium_release_output(jenv, priv, &priv_buffer);
+    stodium_release_input(jenv, seed, &seed_buffer);
+
+    return result;
 }
 
-STODIUM_JNI(jint, crypto_1pwhash_1argon2i) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1sign_1ed25519) (JNIEnv *jenv, jclass jcls,
         jobject dst,
-        jobject password,
-        jobject salt,
-        jlong opslimit,
-        jlong memlimit) {
-    stodium_buffer dst_buffer, pw_buffer, salt_buffer;
+        jobject src,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer;
     stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &pw_buffer, password);
-    stodium_get_buffer(jenv, &salt_buffer, salt);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &key_buffer, key);
 
-    jint result = (jint) crypto_pwhash_argon2i(
+    jint result = (jint) crypto_sign_ed25519(
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT_LEN(unsigned long long, dst_buffer),
-            AS_INPUT(char, pw_buffer),
-            AS_INPUT_LEN(unsigned long long, pw_buffer),
-            AS_INPUT(unsigned char, salt_buffer),
-            (unsigned long long) opslimit,
-            (size_t) memlimit,
-            crypto_pwhash_ALG_DEFAULT);
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_OUTPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, password, &pw_buffer);
-    stodium_release_input(jenv, salt, &salt_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1pwhash_1argon2i_1str) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject password,
-        jlong opslimit,
-        jlong memlimit) {
-    stodium_buffer dst_buffer, pw_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &pw_buffer, password);
+STODIUM_JNI(jint, crypto_1sign_1ed25519_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
 
-    jint result = (jint) crypto_pwhash_argon2i_str(
-            AS_OUTPUT(char, dst_buffer),
-            AS_INPUT(char, pw_buffer),
-            AS_INPUT_LEN(unsigned long long, pw_buffer),
-            (unsigned long long) opslimit,
-            (size_t) memlimit);
+    jint result = (jint) crypto_sign_ed25519(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_OUTPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, password, &pw_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1pwhash_1argon2i_1str_1verify) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1sign_1ed25519_1open) (JNIEnv *jenv, jclass jcls,
         jobject dst,
-        jobject password) {
-    stodium_buffer dst_buffer, pw_buffer;
+        jobject src,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer;
     stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &pw_buffer, password);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &key_buffer, key);
 
-    jint result = (jint) crypto_pwhash_argon2i_str_verify(
-            AS_OUTPUT(char, dst_buffer),
-            AS_INPUT(char, pw_buffer),
-            AS_INPUT_LEN(unsigned long long, pw_buffer));
+    jint result = (jint) crypto_sign_ed25519_open(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_OUTPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_input(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, password, &pw_buffer);
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
+STODIUM_JNI(jint, crypto_1sign_1ed25519_1open_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
 
-/** ****************************************************************************
- *
- * PWHASH - Scrypt
- *
- **************************************************************************** */
+    jint result = (jint) crypto_sign_ed25519_open(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_OUTPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1bytes_1min) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_scryptsalsa208sha256_bytes_min();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1bytes_1max) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_scryptsalsa208sha256_bytes_max();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1passwd_1min) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_scryptsalsa208sha256_passwd_min();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1passwd_1max) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_scryptsalsa208sha256_passwd_max();
-}
-STODIUM_CONSTANT(pwhash, scryptsalsa208sha256, saltbytes)
-STODIUM_CONSTANT(pwhash, scryptsalsa208sha256, strbytes)
-STODIUM_JNI(jstring, crypto_1pwhash_1scryptsalsa208sha256_1strprefix) (JNIEnv *jenv, jclass jcls) {
-        return (*jenv)->NewStringUTF(jenv, crypto_pwhash_scryptsalsa208sha256_strprefix());
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1opslimit_1min) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_scryptsalsa208sha256_opslimit_min();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1opslimit_1max) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_scryptsalsa208sha256_opslimit_max();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1memlimit_1min) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_scryptsalsa208sha256_memlimit_min();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1memlimit_1max) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_scryptsalsa208sha256_memlimit_max();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1opslimit_1interactive) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_scryptsalsa208sha256_opslimit_interactive();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1memlimit_1interactive) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_scryptsalsa208sha256_memlimit_interactive();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1opslimit_1sensitive) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_scryptsalsa208sha256_opslimit_sensitive();
-}
-STODIUM_JNI(jlong, crypto_1pwhash_1scryptsalsa208sha256_1memlimit_1sensitive) (JNIEnv *jenv, jclass jcls) {
-       return (jlong) crypto_pwhash_scryptsalsa208sha256_memlimit_sensitive();
+    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
+
+    return result;
 }
 
-STODIUM_JNI(jint, crypto_1pwhash_1scryptsalsa208sha256) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1sign_1ed25519_1detached) (JNIEnv *jenv, jclass jcls,
         jobject dst,
-        jobject password,
-        jobject salt,
-        jlong opslimit,
-        jlong memlimit) {
-    stodium_buffer dst_buffer, pw_buffer, salt_buffer;
+        jobject src,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer;
     stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &pw_buffer, password);
-    stodium_get_buffer(jenv, &salt_buffer, salt);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &key_buffer, key);
 
-    jint result = (jint) crypto_pwhash_scryptsalsa208sha256(
+    jint result = (jint) crypto_sign_ed25519_detached(
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT_LEN(unsigned long long, dst_buffer),
-            AS_INPUT(char, pw_buffer),
-            AS_INPUT_LEN(unsigned long long, pw_buffer),
-            AS_INPUT(unsigned char, salt_buffer),
-            (unsigned long long) opslimit,
-            (size_t) memlimit);
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_OUTPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, password, &pw_buffer);
-    stodium_release_input(jenv, salt, &salt_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1pwhash_1scryptsalsa208sha256_1str) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject password,
-        jlong opslimit,
-        jlong memlimit) {
-    stodium_buffer dst_buffer, pw_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &pw_buffer, password);
+STODIUM_JNI(jint, crypto_1sign_1ed25519_1detached_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer dst_buffer, src_buffer, key_buffer;
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
 
-    jint result = (jint) crypto_pwhash_scryptsalsa208sha256_str(
-            AS_OUTPUT(char, dst_buffer),
-            AS_INPUT(char, pw_buffer),
-            AS_INPUT_LEN(unsigned long long, pw_buffer),
-            (unsigned long long) opslimit,
-            (size_t) memlimit);
+    jint result = (jint) crypto_sign_ed25519_detached(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_OUTPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
     stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, password, &pw_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1pwhash_1scryptsalsa208sha256_1str_1verify) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject password) {
-    stodium_buffer dst_buffer, pw_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &pw_buffer, password);
+STODIUM_JNI(jint, crypto_1sign_1ed25519_1verify_1detached) (JNIEnv *jenv, jclass jcls,
+        jobject sig,
+        jobject src,
+        jobject key) {
+    stodium_buffer sig_buffer, src_buffer, key_buffer;
+    stodium_get_buffer(jenv, &sig_buffer, sig);
+    stodium_get_buffer(jenv, &src_buffer, src);
+    stodium_get_buffer(jenv, &key_buffer, key);
 
-    jint result = (jint) crypto_pwhash_scryptsalsa208sha256_str_verify(
-            AS_OUTPUT(char, dst_buffer),
-            AS_INPUT(char, pw_buffer),
-            AS_INPUT_LEN(unsigned long long, pw_buffer));
+    jint result = (jint) crypto_sign_ed25519_verify_detached(
+            AS_OUTPUT(unsigned char, sig_buffer),
+            AS_OUTPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_input(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, password, &pw_buffer);
+    stodium_release_input(jenv, sig, &sig_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-/** ****************************************************************************
- *
- * SCALARMULT - Curve25519
- *
- **************************************************************************** */
-STODIUM_CONSTANT_STR(scalarmult)
-
-STODIUM_CONSTANT(scalarmult, curve25519, bytes)
-STODIUM_CONSTANT(scalarmult, curve25519, scalarbytes)
+STODIUM_JNI(jint, crypto_1sign_1ed25519_1verify_1detached_1array) (JNIEnv *jenv, jclass jcls,
+        jbyteArray sig, jint sig_offset, jint sig_length,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer sig_buffer, src_buffer, key_buffer;
+    stodium_get_array(jenv, &sig_buffer, sig, sig_offset, sig_length);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
 
-STODIUM_JNI(jint, crypto_1scalarmult_1curve25519) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject priv,
-        jobject pub) {
-    stodium_buffer dst_buffer, priv_buffer, pub_buffer;
-    stodium_get_buffer(jenv, &dst_buffer,  dst);
-    stodium_get_buffer(jenv, &priv_buffer, priv);
-    stodium_get_buffer(jenv, &pub_buffer,  pub);
+    jint result = (jint) crypto_sign_ed25519_verify_detached(
+            AS_OUTPUT(unsigned char, sig_buffer),
+            AS_OUTPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    jint result = (jint) crypto_scalarmult_curve25519(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT(unsigned char,  priv_buffer),
-            AS_INPUT(unsigned char,  pub_buffer));
+    stodium_release_input(jenv, sig, &sig_buffer);
+    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_input(jenv, key, &key_buffer);
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, priv, &priv_buffer);
-    stodium_release_input(jenv, pub, &pub_buffer);
-    
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1scalarmult_1curve25519_1base) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src) {
-    stodium_buffer dst_buffer, src_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    
-    jint result = (jint) crypto_scalarmult_curve25519_base(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT(unsigned char, src_buffer));
+/**
+ * crypto_sign_ed25519_verify_detached_batch verifies a batch of detached
+ * signatures in a single JNI call. The signatures and public keys are stored
+ * back to back in sigs and pubs, while message i is read from msgs at
+ * msg_offsets[i] (relative to the buffer's position) for msg_lengths[i] bytes.
+ * The outcome of every verification is written to valid, and the number of
+ * invalid signatures is returned, or -1 if the VM cannot pin one of the
+ * arrays.
+ *
+ * libsodium does not expose a multi-scalar multiplication, so the signatures
+ * are still checked one by one; the batch saves the JNI transition and the
+ * buffer marshalling of every item. The copying buffer path is used, as a
+ * large batch could otherwise stall the garbage collector.
+ */
+STODIUM_JNI(jint, crypto_1sign_1ed25519_1verify_1detached_1batch) (JNIEnv *jenv, jclass jcls,
+        jobject       sigs,
+        jobject       msgs,
+        jintArray     msg_offsets,
+        jintArray     msg_lengths,
+        jobject       pubs,
+        jbooleanArray valid) {
+    stodium_buffer sig_buffer, msg_buffer, pub_buffer;
+    jint     *msg_off, *msg_len;
+    jboolean *result;
+    jsize     count, i;
+    jint      failed = 0;
+
+    count = (*jenv)->GetArrayLength(jenv, valid);
+
+    stodium_get_buffer(jenv, &sig_buffer, sigs);
+    stodium_get_buffer(jenv, &msg_buffer, msgs);
+    stodium_get_buffer(jenv, &pub_buffer, pubs);
+
+    msg_off = (*jenv)->GetIntArrayElements(jenv, msg_offsets, NULL);
+    msg_len = (*jenv)->GetIntArrayElements(jenv, msg_lengths, NULL);
+    result  = (*jenv)->GetBooleanArrayElements(jenv, valid, NULL);
+
+    if (msg_off == NULL || msg_len == NULL || result == NULL) {
+        failed = -1;
+        goto release;
+    }
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    
-    return result;
+    for (i = 0; i < count; i++) {
+        result[i] = crypto_sign_ed25519_verify_detached(
+                AS_INPUT(unsigned char, sig_buffer) + (size_t) i * crypto_sign_ed25519_BYTES,
+                AS_INPUT(unsigned char, msg_buffer) + msg_off[i],
+                (unsigned long long) msg_len[i],
+                AS_INPUT(unsigned char, pub_buffer) + (size_t) i * crypto_sign_ed25519_PUBLICKEYBYTES) == 0
+                ? JNI_TRUE : JNI_FALSE;
+
+        if (result[i] == JNI_FALSE) {
+            failed++;
+        }
+    }
+
+release:
+    if (result != NULL) {
+        (*jenv)->ReleaseBooleanArrayElements(jenv, valid, result, 0);
+    }
+    if (msg_len != NULL) {
+        (*jenv)->ReleaseIntArrayElements(jenv, msg_lengths, msg_len, JNI_ABORT);
+    }
+    if (msg_off != NULL) {
+        (*jenv)->ReleaseIntArrayElements(jenv, msg_offsets, msg_off, JNI_ABORT);
+    }
+
+    stodium_release_input(jenv, sigs, &sig_buffer);
+    stodium_release_input(jenv, msgs, &msg_buffer);
+    stodium_release_input(jenv, pubs, &pub_buffer);
+
+    return failed;
 }
 
-/** ****************************************************************************
- *
- * SECRETBOX
- *
- **************************************************************************** */
+STODIUM_JNI(jint, crypto_1sign_1ed25519ph_1init) (JNIEnv *jenv, jclass jcls,
+        jobject state) {
+    stodium_buffer state_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
 
-STODIUM_CONSTANT_STR(secretbox)
+    jint result = (jint) crypto_sign_ed25519ph_init(
+            AS_OUTPUT(crypto_sign_ed25519ph_state, state_buffer));
 
-/** ****************************************************************************
- *
- * SECRETBOX - XSalsa20Poly1305
- *
- **************************************************************************** */
+    stodium_release_output(jenv, state, &state_buffer);
 
-STODIUM_CONSTANT(secretbox, xsalsa20poly1305, keybytes)
-STODIUM_CONSTANT(secretbox, xsalsa20poly1305, macbytes)
-STODIUM_CONSTANT(secretbox, xsalsa20poly1305, noncebytes)
+    return result;
+}
 
-STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1easy) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
+STODIUM_JNI(jint, crypto_1sign_1ed25519ph_1update) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jobject src) {
+    stodium_buffer state_buffer, src_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
     stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer, key);
 
-    jint result = (jint) crypto_secretbox_easy(
-            AS_OUTPUT(unsigned char, dst_buffer),
+    jint result = (jint) crypto_sign_ed25519ph_update(
+            AS_OUTPUT(crypto_sign_ed25519ph_state, state_buffer),
             AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, key_buffer));
+            AS_INPUT_LEN(unsigned long long, src_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_output(jenv, state, &state_buffer);
     stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, nonce, &nonce_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1open_1easy) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer, key);
+STODIUM_JNI(jint, crypto_1sign_1ed25519ph_1update_1array) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jbyteArray src, jint src_offset, jint src_length) {
+    stodium_buffer state_buffer, src_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
 
-    jint result = (jint) crypto_secretbox_open_easy(
-            AS_OUTPUT(unsigned char, dst_buffer),
+    jint result = (jint) crypto_sign_ed25519ph_update(
+            AS_OUTPUT(crypto_sign_ed25519ph_state, state_buffer),
             AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, nonce_buffer),
-            AS_INPUT(unsigned char, key_buffer));
+            AS_INPUT_LEN(unsigned long long, src_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_output(jenv, state, &state_buffer);
     stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, nonce, &nonce_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1secretbox_xsalsa20poly1305_1detached) (JNIEnv *jenv, jclass jcls,
+/**
+ * stodium_sign_ed25519ph_update adapts crypto_sign_ed25519ph_update to stodium_update_fn.
+ */
+static int stodium_sign_ed25519ph_update(void *state, const unsigned char *in, size_t inlen) {
+    return crypto_sign_ed25519ph_update((crypto_sign_ed25519ph_state *) state, in, (unsigned long long) inlen);
+}
+
+STODIUM_JNI(jint, crypto_1sign_1ed25519ph_1updatev) (JNIEnv *jenv, jclass jcls,
+        jobject      state,
+        jobjectArray srcs,
+        jint         offset,
+        jint         length) {
+    return stodium_updatev(jenv, state, srcs, offset, length, stodium_sign_ed25519ph_update);
+}
+
+STODIUM_JNI(jint, crypto_1sign_1ed25519ph_1final_1create) (JNIEnv *jenv, jclass jcls,
+        jobject state,
         jobject dst,
-        jobject dst_mac,
-        jobject src,
-        jobject nonce,
         jobject key) {
-    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_buffer state_buffer, dst_buffer, key_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
     stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &mac_buffer, dst_mac);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
     stodium_get_buffer(jenv, &key_buffer, key);
 
-    jint result = (jint) crypto_secretbox_detached(
+    jint result = (jint) crypto_sign_ed25519ph_final_create(
+            AS_OUTPUT(crypto_sign_ed25519ph_state, state_buffer),
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_OUTPUT(unsigned char, mac_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, nonce_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
+    stodium_release_output(jenv, state, &state_buffer);
     stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_output(jenv, dst_mac, &mac_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, nonce, &nonce_buffer);
     stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1secretbox_1xsalsa20poly1305_1open_1detached) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jobject src_mac,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &mac_buffer, src_mac);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer, key);
+STODIUM_JNI(jint, crypto_1sign_1ed25519ph_1final_1create_1array) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jbyteArray dst, jint dst_offset, jint dst_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer state_buffer, dst_buffer, key_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
+    stodium_get_array(jenv, &dst_buffer, dst, dst_offset, dst_length);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
 
-    jint result = (jint) crypto_secretbox_open_detached(
+    jint result = (jint) crypto_sign_ed25519ph_final_create(
+            AS_OUTPUT(crypto_sign_ed25519ph_state, state_buffer),
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT(unsigned char, mac_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, nonce_buffer),
+            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
+    stodium_release_output(jenv, state, &state_buffer);
     stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, src_mac, &mac_buffer);
-    stodium_release_input(jenv, nonce, &nonce_buffer);
     stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-/** ****************************************************************************
- *
- * SECRETBOX - XSalsa20Poly1305
- *
- **************************************************************************** */
-
-STODIUM_CONSTANT(secretbox, xchacha20poly1305, keybytes)
-STODIUM_CONSTANT(secretbox, xchacha20poly1305, macbytes)
-STODIUM_CONSTANT(secretbox, xchacha20poly1305, noncebytes)
-
-STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1easy) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
+STODIUM_JNI(jint, crypto_1sign_1ed25519ph_1final_1verify) (JNIEnv *jenv, jclass jcls,
+        jobject state,
         jobject src,
-        jobject nonce,
         jobject key) {
-    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
+    stodium_buffer state_buffer, src_buffer, key_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
     stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
     stodium_get_buffer(jenv, &key_buffer, key);
 
-    jint result = (jint) crypto_secretbox_xchacha20poly1305_easy(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, nonce_buffer),
+    jint result = (jint) crypto_sign_ed25519ph_final_verify(
+            AS_OUTPUT(crypto_sign_ed25519ph_state, state_buffer),
+            // FIXME this is supposed to be input, but the libsodium method expects a non-const. This is probably not intended.
+            AS_OUTPUT(unsigned char, src_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_output(jenv, state, &state_buffer);
     stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, nonce, &nonce_buffer);
     stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1open_1easy) (JNIEnv *jenv, jclass jcls,
-        jobject dst,
-        jobject src,
-        jobject nonce,
-        jobject key) {
-    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer, key);
+STODIUM_JNI(jint, crypto_1sign_1ed25519ph_1final_1verify_1array) (JNIEnv *jenv, jclass jcls,
+        jobject state,
+        jbyteArray src, jint src_offset, jint src_length,
+        jbyteArray key, jint key_offset, jint key_length) {
+    stodium_buffer state_buffer, src_buffer, key_buffer;
+    stodium_get_buffer(jenv, &state_buffer, state);
+    stodium_get_array(jenv, &src_buffer, src, src_offset, src_length);
+    stodium_get_array(jenv, &key_buffer, key, key_offset, key_length);
 
-    jint result = (jint) crypto_secretbox_xchacha20poly1305_open_easy(
-            AS_OUTPUT(unsigned char, dst_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
-            AS_INPUT(unsigned char, nonce_buffer),
+    jint result = (jint) crypto_sign_ed25519ph_final_verify(
+            AS_OUTPUT(crypto_sign_ed25519ph_state, state_buffer),
+            // FIXME this is supposed to be input, but the libsodium method expects a non-const. This is probably not intended.
+            AS_OUTPUT(unsigned char, src_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
+    stodium_release_output(jenv, state, &state_buffer);
     stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, nonce, &nonce_buffer);
     stodium_release_input(jenv, key, &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1secretbox_xchacha20poly1305_1detached) (JNIEnv *jenv, jclass jcls,
+/** ****************************************************************************
+ *
+ * STREAM
+ *
+ **************************************************************************** */
+
+STODIUM_CONSTANT_STR(stream)
+
+/**
+ * stodium_stream_xor_at xors m with the keystream starting at the given byte
+ * offset into the stream, rather than at a block boundary. A leading partial
+ * block is handled through a zero padded block on the stack, after which the
+ * remaining bytes are passed to xor_ic with the next block counter. This
+ * allows any byte range of a stream to be decrypted without processing the
+ * bytes in front of it.
+ */
+static int stodium_stream_xor_at(stodium_stream_xor_ic_fn xor_ic,
+        unsigned char *c, const unsigned char *m, unsigned long long mlen,
+        const unsigned char *n, uint64_t offset, const unsigned char *k) {
+    unsigned char block[STODIUM_STREAM_BLOCKBYTES];
+    uint64_t      ic   = offset / STODIUM_STREAM_BLOCKBYTES;
+    size_t        skip = (size_t) (offset % STODIUM_STREAM_BLOCKBYTES);
+    size_t        take;
+    int           result;
+
+    if (skip != 0 && mlen > 0) {
+        take = STODIUM_STREAM_BLOCKBYTES - skip;
+        if (take > mlen) {
+            take = (size_t) mlen;
+        }
+
+        memset(block, 0, sizeof block);
+        memcpy(block + skip, m, take);
+        result = xor_ic(block, block, sizeof block, n, ic, k);
+        memcpy(c, block + skip, take);
+        sodium_memzero(block, sizeof block);
+        if (result != 0) {
+            return result;
+        }
+
+        c    += take;
+        m    += take;
+        mlen -= take;
+        ic++;
+    }
+
+    if (mlen == 0) {
+        return 0;
+    }
+    return xor_ic(c, m, mlen, n, ic, k);
+}
+
+/** ****************************************************************************
+ *
+ * STREAM - XChacha20
+ *
+ **************************************************************************** */
+STODIUM_CONSTANT(stream, xchacha20, keybytes)
+STODIUM_CONSTANT(stream, xchacha20, noncebytes)
+
+STODIUM_JNI(jint, crypto_1stream_1xchacha20) (JNIEnv *jenv, jclass jcls,
         jobject dst,
-        jobject dst_mac,
-        jobject src,
         jobject nonce,
         jobject key) {
-    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &mac_buffer, dst_mac);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer dst_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_secretbox_xchacha20poly1305_detached(
+    jint result = (jint) crypto_stream_xchacha20(
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_OUTPUT(unsigned char, mac_buffer),
-            AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT_LEN(unsigned long long, dst_buffer),
             AS_INPUT(unsigned char, nonce_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_output(jenv, dst_mac, &mac_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, nonce, &nonce_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1secretbox_1xchacha20poly1305_1open_1detached) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1stream_1xchacha20_1xor) (JNIEnv *jenv, jclass jcls,
         jobject dst,
         jobject src,
-        jobject src_mac,
         jobject nonce,
         jobject key) {
-    stodium_buffer dst_buffer, mac_buffer, src_buffer, nonce_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &mac_buffer, src_mac);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &nonce_buffer, nonce);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_secretbox_xchacha20poly1305_open_detached(
+    jint result = (jint) crypto_stream_xchacha20_xor(
             AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT(unsigned char, mac_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
             AS_INPUT(unsigned char, nonce_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, src_mac, &mac_buffer);
-    stodium_release_input(jenv, nonce, &nonce_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
 
     return result;
 }
 
-/** ****************************************************************************
- *
- * SHORTHASH
- *
- **************************************************************************** */
-
-STODIUM_CONSTANT_STR(shorthash)
-
-/** ****************************************************************************
- *
- * SHORTHASH - SipHash-2-4
- *
- **************************************************************************** */
-STODIUM_CONSTANT(shorthash, siphash24, bytes)
-STODIUM_CONSTANT(shorthash, siphash24, keybytes)
-
-STODIUM_JNI(jint, crypto_1shorthash_1siphash24) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1stream_1xchacha20_1xor_1ic) (JNIEnv *jenv, jclass jcls,
         jobject dst,
         jobject src,
+        jobject nonce,
+        jlong   ic,
         jobject key) {
-    stodium_buffer dst_buffer, src_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_shorthash_siphash24(
+    jint result = (jint) crypto_stream_xchacha20_xor_ic(
             AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            (uint64_t) ic,
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
 
     return result;
-}
-
-/** ****************************************************************************
- *
- * SHORTHASH - SipHashx-2-4
- *
- **************************************************************************** */
-STODIUM_CONSTANT(shorthash, siphashx24, bytes)
-STODIUM_CONSTANT(shorthash, siphashx24, keybytes)
+}
 
-STODIUM_JNI(jint, crypto_1shorthash_1siphashx24) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1stream_1xchacha20_1xor_1at) (JNIEnv *jenv, jclass jcls,
         jobject dst,
         jobject src,
+        jobject nonce,
+        jlong   offset,
         jobject key) {
-    stodium_buffer dst_buffer, src_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_shorthash_siphashx24(
+    jint result = (jint) stodium_stream_xor_at(crypto_stream_xchacha20_xor_ic,
             AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            (uint64_t) offset,
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
 
     return result;
 }
 
 /** ****************************************************************************
  *
- * SIGN
- *
- **************************************************************************** */
-
-STODIUM_CONSTANT_STR(sign)
-
-/** ****************************************************************************
- *
- * SIGN - Ed25519/Ed25519ph
+ * STREAM - Chacha20 (ietf)
  *
  **************************************************************************** */
-STODIUM_CONSTANT(sign, ed25519, publickeybytes)
-STODIUM_CONSTANT(sign, ed25519, secretkeybytes)
-STODIUM_CONSTANT(sign, ed25519, bytes)
-STODIUM_CONSTANT(sign, ed25519, seedbytes)
-STODIUM_CONSTANT(sign, ed25519ph, statebytes)
-
-STODIUM_JNI(jint, crypto_1sign_1ed25519_1keypair) (JNIEnv *jenv, jclass jcls,
-        jobject pub,
-        jobject priv) {
-    stodium_buffer pub_buffer, priv_buffer;
-    stodium_get_buffer(jenv, &pub_buffer, pub);
-    stodium_get_buffer(jenv, &priv_buffer, priv);
-
-    jint result = (jint) crypto_sign_ed25519_keypair(
-            AS_OUTPUT(unsigned char, pub_buffer),
-            AS_OUTPUT(unsigned char, priv_buffer));
-
-    stodium_release_output(jenv, pub, &pub_buffer);
-    stodium_release_output(jenv, priv, &priv_buffer);
-
-    return result;
+STODIUM_JNI(jint, crypto_1stream_1chacha20_1ietf_1keybytes) (JNIEnv *jenv, jclass jcls) {
+       return (jint) crypto_stream_chacha20_ietf_keybytes();
 }
-
-STODIUM_JNI(jint, crypto_1sign_1ed25519_1seed_1keypair) (JNIEnv *jenv, jclass jcls,
-        jobject pub,
-        jobject priv,
-        jobject seed) {
-    stodium_buffer pub_buffer, priv_buffer, seed_buffer;
-    stodium_get_buffer(jenv, &pub_buffer, pub);
-    stodium_get_buffer(jenv, &priv_buffer, priv);
-    stodium_get_buffer(jenv, &seed_buffer, seed);
-
-    jint result = (jint) crypto_sign_ed25519_seed_keypair(
-            AS_OUTPUT(unsigned char, pub_buffer),
-            AS_OUTPUT(unsigned char, priv_buffer),
-            AS_INPUT(unsigned char, seed_buffer));
-
-    stodium_release_output(jenv, pub, &pub_buffer);
-    stodium_release_output(jenv, priv, &priv_buffer);
-    stodium_release_input(jenv, seed, &seed_buffer);
-
-    return result;
+STODIUM_JNI(jint, crypto_1stream_1chacha20_1ietf_1noncebytes) (JNIEnv *jenv, jclass jcls) {
+       return (jint) crypto_stream_chacha20_ietf_noncebytes();
 }
 
-STODIUM_JNI(jint, crypto_1sign_1ed25519) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1stream_1chacha20_1ietf) (JNIEnv *jenv, jclass jcls,
         jobject dst,
-        jobject src,
+        jobject nonce,
         jobject key) {
-    stodium_buffer dst_buffer, src_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer dst_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_sign_ed25519(
+    jint result = (jint) crypto_stream_chacha20_ietf(
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
-            AS_OUTPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1sign_1ed25519_1open) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1stream_1chacha20_1ietf_1xor) (JNIEnv *jenv, jclass jcls,
         jobject dst,
         jobject src,
+        jobject nonce,
         jobject key) {
-    stodium_buffer dst_buffer, src_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_sign_ed25519_open(
+    jint result = (jint) crypto_stream_chacha20_ietf_xor(
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
-            AS_OUTPUT(unsigned char, src_buffer),
+            AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1sign_1ed25519_1detached) (JNIEnv *jenv, jclass jcls,
+STODIUM_JNI(jint, crypto_1stream_1chacha20_1ietf_1xor_1ic) (JNIEnv *jenv, jclass jcls,
         jobject dst,
         jobject src,
+        jobject nonce,
+        jlong   ic,
         jobject key) {
-    stodium_buffer dst_buffer, src_buffer, key_buffer;
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_sign_ed25519_detached(
+    jint result = (jint) crypto_stream_chacha20_ietf_xor_ic(
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
-            AS_OUTPUT(unsigned char, src_buffer),
+            AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            (uint32_t) ic,
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1sign_1ed25519_1verify_1detached) (JNIEnv *jenv, jclass jcls,
-        jobject sig,
+STODIUM_JNI(jint, crypto_1stream_1chacha20_1ietf_1xor_1at) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
         jobject src,
+        jobject nonce,
+        jlong   offset,
         jobject key) {
-    stodium_buffer sig_buffer, src_buffer, key_buffer;
-    stodium_get_buffer(jenv, &sig_buffer, sig);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_sign_ed25519_verify_detached(
-            AS_OUTPUT(unsigned char, sig_buffer),
-            AS_OUTPUT(unsigned char, src_buffer),
+    jint result = (jint) stodium_stream_xor_at(stodium_stream_chacha20_ietf_xor_ic,
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
             AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            (uint64_t) offset,
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_input(jenv, sig, &sig_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1sign_1ed25519ph_1init) (JNIEnv *jenv, jclass jcls,
-        jobject state) {
-    stodium_buffer state_buffer;
-    stodium_get_buffer(jenv, &state_buffer, state);
+/** ****************************************************************************
+ *
+ * STREAM - XSalsa20
+ *
+ **************************************************************************** */
+STODIUM_CONSTANT(stream, xsalsa20, keybytes)
+STODIUM_CONSTANT(stream, xsalsa20, noncebytes)
 
-    jint result = (jint) crypto_sign_ed25519ph_init(
-            AS_OUTPUT(crypto_sign_ed25519ph_state, state_buffer));
+STODIUM_JNI(jint, crypto_1stream_1xsalsa20) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    stodium_release_output(jenv, state, &state_buffer);
+    jint result = (jint) crypto_stream_xsalsa20(
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
+
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1sign_1ed25519ph_1update) (JNIEnv *jenv, jclass jcls,
-        jobject state,
-        jobject src) {
-    stodium_buffer state_buffer, src_buffer;
-    stodium_get_buffer(jenv, &state_buffer, state);
-    stodium_get_buffer(jenv, &src_buffer, src);
+STODIUM_JNI(jint, crypto_1stream_1xsalsa20_1xor) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
+        jobject src,
+        jobject nonce,
+        jobject key) {
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_sign_ed25519ph_update(
-            AS_OUTPUT(crypto_sign_ed25519ph_state, state_buffer),
+    jint result = (jint) crypto_stream_xsalsa20_xor(
+            AS_OUTPUT(unsigned char, dst_buffer),
             AS_INPUT(unsigned char, src_buffer),
-            AS_INPUT_LEN(unsigned long long, src_buffer));
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, state, &state_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1sign_1ed25519ph_1final_1create) (JNIEnv *jenv, jclass jcls,
-        jobject state,
+STODIUM_JNI(jint, crypto_1stream_1xsalsa20_1xor_1ic) (JNIEnv *jenv, jclass jcls,
         jobject dst,
+        jobject src,
+        jobject nonce,
+        jlong   ic,
         jobject key) {
-    stodium_buffer state_buffer, dst_buffer, key_buffer;
-    stodium_get_buffer(jenv, &state_buffer, state);
-    stodium_get_buffer(jenv, &dst_buffer, dst);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_sign_ed25519ph_final_create(
-            AS_OUTPUT(crypto_sign_ed25519ph_state, state_buffer),
+    jint result = (jint) crypto_stream_xsalsa20_xor_ic(
             AS_OUTPUT(unsigned char, dst_buffer),
-            AS_OUTPUT_LEN(unsigned long long, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            (uint64_t) ic,
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, state, &state_buffer);
-    stodium_release_output(jenv, dst, &dst_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
 
     return result;
 }
 
-STODIUM_JNI(jint, crypto_1sign_1ed25519ph_1final_1verify) (JNIEnv *jenv, jclass jcls,
-        jobject state,
+STODIUM_JNI(jint, crypto_1stream_1xsalsa20_1xor_1at) (JNIEnv *jenv, jclass jcls,
+        jobject dst,
         jobject src,
+        jobject nonce,
+        jlong   offset,
         jobject key) {
-    stodium_buffer state_buffer, src_buffer, key_buffer;
-    stodium_get_buffer(jenv, &state_buffer, state);
-    stodium_get_buffer(jenv, &src_buffer, src);
-    stodium_get_buffer(jenv, &key_buffer, key);
+    stodium_buffer dst_buffer, src_buffer, nonce_buffer, key_buffer;
+    stodium_get_buffer_critical(jenv, &dst_buffer,   dst);
+    stodium_get_buffer_critical(jenv, &src_buffer,   src);
+    stodium_get_buffer_critical(jenv, &nonce_buffer, nonce);
+    stodium_get_buffer_critical(jenv, &key_buffer,   key);
+    if (STODIUM_ENTER_CRITICAL(jenv, &dst_buffer, &src_buffer, &nonce_buffer, &key_buffer) != 0) {
+        return -1;
+    }
 
-    jint result = (jint) crypto_sign_ed25519ph_final_verify(
-            AS_OUTPUT(crypto_sign_ed25519ph_state, state_buffer),
-            // FIXME this is supposed to be input, but the libsodium method expects a non-const. This is probably not intended.
-            AS_OUTPUT(unsigned char, src_buffer),
+    jint result = (jint) stodium_stream_xor_at(crypto_stream_xsalsa20_xor_ic,
+            AS_OUTPUT(unsigned char, dst_buffer),
+            AS_INPUT(unsigned char, src_buffer),
+            AS_INPUT_LEN(unsigned long long, src_buffer),
+            AS_INPUT(unsigned char, nonce_buffer),
+            (uint64_t) offset,
             AS_INPUT(unsigned char, key_buffer));
 
-    stodium_release_output(jenv, state, &state_buffer);
-    stodium_release_input(jenv, src, &src_buffer);
-    stodium_release_input(jenv, key, &key_buffer);
+    stodium_release_output(jenv, dst,   &dst_buffer);
+    stodium_release_input(jenv,  src,   &src_buffer);
+    stodium_release_input(jenv,  nonce, &nonce_buffer);
+    stodium_release_input(jenv,  key,   &key_buffer);
 
     return result;
 }
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium;
+
+import org.jetbrains.annotations.NotNull;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.exceptions.OperationFailedException;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * KeyHandle is an opaque reference to a secret key held in guarded native
+ * memory (allocated through sodium_malloc, surrounded by guard pages and kept
+ * read-only). The AEAD, SecretBox, Auth, Kdf and ShortHash APIs accept a
+ * KeyHandle in place of a key buffer, which avoids keeping long-lived keys on
+ * the Java heap, where they may be copied around by the garbage collector.
+ * <p>
+ * The key is wiped and released once the handle is closed. The _handle variants
+ * of the {@link StodiumJNI} methods take the address of the key handle, which
+ * is passed to them through {@link #call(Call)}.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public final class KeyHandle
+        extends NativeResource {
+
+    private final int length;
+
+    private KeyHandle(final long handle,
+                      final int  length) {
+        super(handle);
+        this.length = length;
+    }
+
+    /**
+     * of copies the remaining bytes of key into a new KeyHandle. The position
+     * of key is left unchanged, so the caller remains responsible for wiping
+     * its own copy of the key.
+     *
+     * @param key
+     * @return a handle to a copy of the key
+     * @throws StodiumException if the guarded memory could not be allocated
+     */
+    public static @NotNull KeyHandle of(final @NotNull ByteBuffer key)
+            throws StodiumException {
+        final int  length = key.remaining();
+        final long handle = StodiumJNI.stodium_key_handle_new(
+                Stodium.ensureUsableByteBuffer(key));
+        if (handle == 0L) {
+            throw new OperationFailedException("Stodium: could not allocate key handle");
+        }
+        return new KeyHandle(handle, length);
+    }
+
+    /**
+     * random generates a new random key of the given length directly in
+     * guarded native memory, so the key never enters the Java heap.
+     *
+     * @param length
+     * @return a handle to the new key
+     * @throws StodiumException if the guarded memory could not be allocated
+     */
+    public static @NotNull KeyHandle random(final int length)
+            throws StodiumException {
+        Stodium.checkPositive(length);
+
+        final long handle = StodiumJNI.stodium_key_handle_random(length);
+        if (handle == 0L) {
+            throw new OperationFailedException("Stodium: could not allocate key handle");
+        }
+        return new KeyHandle(handle, length);
+    }
+
+    /**
+     *
+     * @return the length of the key, in bytes
+     */
+    public int length() {
+        return length;
+    }
+
+    @Override
+    protected void free(final long pointer) {
+        StodiumJNI.stodium_key_handle_free(pointer);
+    }
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium;
+
+import org.jetbrains.annotations.NotNull;
+
+import java.io.Closeable;
+
+/**
+ * NativeResource is the base class of objects that own a block of memory
+ * allocated by the native code, such as precomputed key state. The memory is
+ * released (and wiped) when the resource is closed. Finalization only acts as
+ * a safety net, as it may run arbitrarily late; callers are expected to close
+ * resources explicitly once they are done with them.
+ * <p>
+ * The address of the memory is only handed to native code through
+ * {@link #call(Call)}, which keeps the resource reachable for the duration of
+ * the call. Otherwise the resource could be finalized, and its memory freed,
+ * while the native code is still reading it. Closing a resource that is in
+ * use by another thread defers the release until the last call returns.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public abstract class NativeResource
+        implements Closeable {
+
+    /**
+     * Call is a native call that uses the memory owned by a resource, see
+     * {@link #call(Call)}.
+     */
+    public interface Call {
+        int run(final long pointer);
+    }
+
+    private long    pointer;
+    private int     calls;
+    private boolean closed;
+
+    /**
+     *
+     * @param pointer the address of the native memory owned by this resource
+     */
+    protected NativeResource(final long pointer) {
+        this.pointer = pointer;
+    }
+
+    /**
+     * call runs call with the address of the native memory owned by this
+     * resource, and returns its result. The memory stays allocated until call
+     * returns, even if the resource is closed by another thread in the
+     * meantime.
+     *
+     * @param call
+     * @return the result of call
+     * @throws IllegalStateException if the resource has already been closed
+     */
+    public final int call(final @NotNull Call call) {
+        final long address;
+
+        synchronized (this) {
+            if (closed) {
+                throw new IllegalStateException("Stodium: native resource has been closed");
+            }
+            calls++;
+            address = pointer;
+        }
+
+        try {
+            return call.run(address);
+        } finally {
+            // touching this after the call keeps the resource reachable
+            synchronized (this) {
+                if (--calls == 0 && closed) {
+                    release();
+                }
+            }
+        }
+    }
+
+    /**
+     *
+     * @return true iff the resource has been closed
+     */
+    public final synchronized boolean isClosed() {
+        return closed;
+    }
+
+    /**
+     * close releases the native memory owned by this resource, as soon as no
+     * calls are using it anymore. Closing a resource more than once has no
+     * effect.
+     */
+    @Override
+    public final synchronized void close() {
+        if (closed) {
+            return;
+        }
+        closed = true;
+        if (calls == 0) {
+            release();
+        }
+    }
+
+    private void release() {
+        free(pointer);
+        pointer = 0L;
+    }
+
+    /**
+     * free releases the native memory at the given address.
+     *
+     * @param pointer
+     */
+    protected abstract void free(final long pointer);
+
+    @Override
+    protected void finalize()
+            throws Throwable {
+        try {
+            close();
+        } finally {
+            super.finalize();
+        }
+    }
+}
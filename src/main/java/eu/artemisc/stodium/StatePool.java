@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium;
+
+import org.jetbrains.annotations.NotNull;
+
+import java.nio.ByteBuffer;
+import java.util.ArrayDeque;
+import java.util.HashMap;
+import java.util.Map;
+
+/**
+ * StatePool keeps the direct buffers that hold the state of multipart
+ * operations, so that forking a {@link Multipart} or
+ * {@link eu.artemisc.stodium.sign.MultipartSign} for every message does not
+ * cost a call to ByteBuffer.allocateDirect. Buffers are pooled by size, as
+ * every primitive has a fixed state size.
+ * <p>
+ * Released buffers are wiped before they are returned to the pool. At most
+ * MAX_POOLED buffers of each size are kept; any others are left to the
+ * garbage collector.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public final class StatePool {
+    private static final int MAX_POOLED = 64;
+
+    private static final @NotNull Map<Integer, ArrayDeque<ByteBuffer>> POOL =
+            new HashMap<>();
+
+    // block the constructor
+    private StatePool() {}
+
+    /**
+     * acquire returns a direct buffer of exactly size bytes, with its position
+     * at 0 and its limit at size. The contents of the buffer are all zero.
+     *
+     * @param size
+     * @return
+     */
+    @NotNull
+    public static ByteBuffer acquire(final int size) {
+        final ByteBuffer buff;
+
+        synchronized (POOL) {
+            final ArrayDeque<ByteBuffer> free = POOL.get(size);
+            buff = free == null ? null : free.pollFirst();
+        }
+
+        return buff != null ? buff : ByteBuffer.allocateDirect(size);
+    }
+
+    /**
+     * release wipes the buffer and returns it to the pool. The buffer must
+     * have been obtained through {@link #acquire(int)}, as the pool can not
+     * tell it apart from a buffer that is still in use elsewhere, and may not
+     * be used by the caller afterwards. Buffers whose position or limit has
+     * moved, such as slices of a larger buffer, are only wiped between their
+     * position and limit, and are not pooled.
+     *
+     * @param buff
+     */
+    public static void release(final @NotNull ByteBuffer buff) {
+        final boolean poolable = buff.isDirect() && !buff.isReadOnly()
+                && buff.position() == 0 && buff.limit() == buff.capacity();
+
+        Stodium.wipeBytes(buff.duplicate());
+        if (!poolable) {
+            return;
+        }
+        buff.clear();
+
+        synchronized (POOL) {
+            ArrayDeque<ByteBuffer> free = POOL.get(buff.capacity());
+            if (free == null) {
+                free = new ArrayDeque<>();
+                POOL.put(buff.capacity(), free);
+            }
+            if (free.size() < MAX_POOLED) {
+                free.addFirst(buff);
+            }
+        }
+    }
+}
@@ -51,6 +51,23 @@ public final class Stodium {
         throw new OperationFailedException("operation returned non-zero status " + status);
     }
 
+    /**
+     * checkFileStatus is the variant of checkStatus for the native functions
+     * that read a file, which return the (positive) errno value of a failed
+     * I/O call.
+     *
+     * @param status
+     * @throws StodiumException
+     */
+    public static void checkFileStatus(final int status)
+            throws StodiumException {
+        if (status <= StodiumJNI.NOERR) {
+            checkStatus(status);
+            return;
+        }
+        throw new OperationFailedException("file could not be read [errno: " + status + "]");
+    }
+
     /**
      *
      * @param src
@@ -149,6 +166,47 @@ public final class Stodium {
         Stodium.checkPositive(len);
     }
 
+    /**
+     * checkAddress is the raw address counterpart of checkOffsetParams. It
+     * verifies that address is not NULL and that the len bytes starting at it
+     * do not wrap around the end of the address space. As the memory is owned
+     * by the caller, this is the most that can be verified.
+     *
+     * @param address
+     * @param len
+     * @throws ConstraintViolationException
+     */
+    public static void checkAddress(final long address,
+                                    final int  len)
+            throws ConstraintViolationException {
+        Stodium.checkPositive(len);
+        // unsigned comparison, as Long.compareUnsigned is not available on
+        // older Android releases
+        if (address != 0L && ((address + len) ^ Long.MIN_VALUE) >= (address ^ Long.MIN_VALUE)) {
+            return;
+        }
+        throw new ConstraintViolationException(
+                String.format(Locale.ENGLISH, "checkAddress failed [address: 0x%x, len: %d]", address, len));
+    }
+
+    /**
+     * checkOptionalAddress is the variant of checkAddress for arguments that
+     * may be omitted, in which case both address and len must be 0.
+     *
+     * @param address
+     * @param len
+     * @throws ConstraintViolationException
+     */
+    public static void checkOptionalAddress(final long address,
+                                            final int  len)
+            throws ConstraintViolationException {
+        if (address == 0L) {
+            Stodium.checkSize(len, 0, 0);
+            return;
+        }
+        Stodium.checkAddress(address, len);
+    }
+
     /**
      * checkPow2 checks whether the given integer src is a power of 2, and
      * throws an exception otherwise.
@@ -276,10 +334,11 @@ public final class Stodium {
      * native code.
      * <p>
      * If the passed buff argument represents a JNI usable ByteBuffer, it is
-     * directly returned. Otherwise, the method allocates a direct buffer with
-     * the size of {@code buff.remaining()}, and copies the contents of buff.
-     * This copy is guaranteed to work with the native code (as it is a direct
-     * buffer) and therefore is returned.
+     * directly returned. Otherwise, the contents of buff are copied into a
+     * direct buffer taken from a small per-thread pool, which is returned. This
+     * copy is guaranteed to work with the native code (as it is a direct
+     * buffer). The returned buffer must therefore only be passed straight to a
+     * native call, and not be kept around after it.
      *
      * @param buff the original buffer
      * @return a ByteBuffer that is guaranteed to function correctly in the
@@ -291,13 +350,113 @@ public final class Stodium {
             return buff;
         }
 
-        final ByteBuffer direct = ByteBuffer.allocateDirect(buff.remaining());
+        final ByteBuffer direct = SCRATCH.get().acquire(buff.remaining());
         direct.mark();
         direct.put(buff.slice());
         direct.reset();
         return direct;
     }
 
+    /**
+     * ensureUsableByteBuffers is the array counterpart of
+     * {@link #ensureUsableByteBuffer(ByteBuffer)}, for the length buffers of
+     * buffs starting at offset. If all of them are usable, buffs itself is
+     * returned. Otherwise a copy of the array is returned, in which the
+     * unusable buffers are replaced by direct copies at the same index. These
+     * copies are not taken from the per-thread pool, as an array may hold
+     * more buffers than the pool has slots.
+     *
+     * @param buffs
+     * @param offset
+     * @param length
+     * @return
+     */
+    @NotNull
+    public static ByteBuffer[] ensureUsableByteBuffers(final @NotNull ByteBuffer[] buffs,
+                                                       final          int          offset,
+                                                       final          int          length) {
+        ByteBuffer[] usable = buffs;
+
+        for (int i = offset; i < offset + length; i++) {
+            if (buffs[i].isDirect() || !buffs[i].isReadOnly()) {
+                continue;
+            }
+            if (usable == buffs) {
+                usable = buffs.clone();
+            }
+            usable[i] = ByteBuffer.allocateDirect(buffs[i].remaining());
+            usable[i].put(buffs[i].slice()).clear();
+        }
+
+        return usable;
+    }
+
+    /**
+     * SCRATCH holds the per-thread pool of direct buffers used by
+     * ensureUsableByteBuffer.
+     */
+    private static final @NotNull ThreadLocal<ScratchBuffers> SCRATCH = new ThreadLocal<ScratchBuffers>() {
+        @Override
+        protected ScratchBuffers initialValue() {
+            return new ScratchBuffers();
+        }
+    };
+
+    /**
+     * ScratchBuffers is a ring of grow-only direct buffers. ByteBuffer
+     * allocateDirect is slow, and counts against the VM's direct memory limit
+     * until the buffer is collected, so the buffers are reused round robin
+     * instead. No single native call takes more than SLOTS buffers, so a slot
+     * is never handed out twice for the arguments of one call.
+     * <p>
+     * Copies larger than MAX_POOLED are not pooled, to keep the pool from
+     * pinning the size of the largest message seen by the thread. Copies of at
+     * most MAX_UNPOOLED bytes are not pooled either: every key, seed and nonce
+     * fits in that size, and a slot would keep such a copy alive until the
+     * slot is reused. The part of a slot that is not overwritten by the next
+     * copy is wiped on reuse.
+     */
+    private static final class ScratchBuffers {
+        private static final int SLOTS        = 8;
+        private static final int MAX_UNPOOLED = 64;
+        private static final int MIN_POOLED   = 256;
+        private static final int MAX_POOLED   = 64 * 1024;
+
+        private final @NotNull ByteBuffer[] slots = new ByteBuffer[SLOTS];
+        private final @NotNull int[]        used  = new int[SLOTS];
+        private int next;
+
+        @NotNull
+        ByteBuffer acquire(final int len) {
+            if (len <= MAX_UNPOOLED || len > MAX_POOLED) {
+                return ByteBuffer.allocateDirect(len);
+            }
+
+            final int slot = next;
+            next = (next + 1) % SLOTS;
+
+            ByteBuffer buff = slots[slot];
+            if (buff == null || buff.capacity() < len) {
+                int size = MIN_POOLED;
+                while (size < len) {
+                    size <<= 1;
+                }
+                buff = ByteBuffer.allocateDirect(size);
+                slots[slot] = buff;
+                used[slot]  = 0;
+            }
+
+            if (used[slot] > len) {
+                buff.limit(used[slot]).position(len);
+                wipeBytes(buff);
+            }
+            used[slot] = len;
+
+            buff.clear().limit(len);
+            return buff;
+        }
+    }
+
     /**
      * checkDestinationWritable throws an exception if the ByteBuffer passed to
      * it is backed by an array and is read-only. If this is the case, the
@@ -315,6 +474,53 @@ public final class Stodium {
         throw new ReadOnlyBufferException("Stodium: output buffer is readonly");
     }
 
+    /**
+     * checkDestinationWritable calls
+     * {@link #checkDestinationWritable(ByteBuffer)} for every buffer of buffs.
+     *
+     * @param buffs
+     * @throws ReadOnlyBufferException
+     */
+    public static void checkDestinationWritable(final @NotNull ByteBuffer[] buffs) {
+        for (final ByteBuffer buff : buffs) {
+            checkDestinationWritable(buff);
+        }
+    }
+
+    /**
+     * remaining returns the total number of bytes remaining in buffs.
+     *
+     * @param buffs
+     * @return
+     */
+    public static long remaining(final @NotNull ByteBuffer[] buffs) {
+        long total = 0L;
+        for (final ByteBuffer buff : buffs) {
+            total += buff.remaining();
+        }
+        return total;
+    }
+
+    /**
+     * window returns a view of length bytes of buff, starting at offset bytes
+     * from its position. The view shares the content of buff, but has its own
+     * position, limit and (big endian) byte order.
+     *
+     * @param buff
+     * @param offset
+     * @param length
+     * @return
+     */
+    @NotNull
+    public static ByteBuffer window(final @NotNull ByteBuffer buff,
+                                    final          int        offset,
+                                    final          int        length) {
+        final ByteBuffer dup = buff.duplicate();
+        dup.position(buff.position() + offset);
+        dup.limit(buff.position() + offset + length);
+        return dup;
+    }
+
     /**
      * version returns the value of sodium_version_string().
      *
@@ -42,6 +42,20 @@ public class StodiumJNI {
     public static native int randombytes_uniform(int upper_bound);
     public static native void randombytes_buf(@NotNull ByteBuffer dst);
 
+    //
+    // Key handles
+    //
+    public static native long stodium_key_handle_new(@NotNull ByteBuffer key);
+    public static native long stodium_key_handle_random(int length);
+    public static native int stodium_key_handle_length(long handle);
+    public static native void stodium_key_handle_free(long handle);
+
+    //
+    // Thread pool
+    //
+    public static native int stodium_pool_set_threads(int threads);
+    public static native int stodium_pool_threads();
+
     //
     // Core
     //
@@ -88,12 +102,51 @@ public class StodiumJNI {
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_aes256gcm_encrypt_detached_address(
+            long dstCipher, int dstCipherLength,
+            long dstMac, int dstMacLength,
+            long srcPlain, int srcPlainLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_aes256gcm_encrypt_detached_array(
+            @NotNull byte[] dstCipher, int dstCipherOffset, int dstCipherLength,
+            @NotNull byte[] dstMac, int dstMacOffset, int dstMacLength,
+            @NotNull byte[] srcPlain, int srcPlainOffset, int srcPlainLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_aes256gcm_encrypt_detached_handle(
+            @NotNull ByteBuffer dstCipher,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_aead_aes256gcm_encrypt(
             @NotNull ByteBuffer dstCipher,
             @NotNull ByteBuffer srcPlain,
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_aes256gcm_encrypt_address(
+            long dstCipher, int dstCipherLength,
+            long srcPlain, int srcPlainLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_aes256gcm_encrypt_array(
+            @NotNull byte[] dstCipher, int dstCipherOffset, int dstCipherLength,
+            @NotNull byte[] srcPlain, int srcPlainOffset, int srcPlainLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_aes256gcm_encrypt_handle(
+            @NotNull ByteBuffer dstCipher,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_aead_aes256gcm_decrypt_detached(
             @NotNull ByteBuffer dstPlain,
             @NotNull ByteBuffer srcCipher,
@@ -101,12 +154,118 @@ public class StodiumJNI {
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_aes256gcm_decrypt_detached_address(
+            long dstPlain, int dstPlainLength,
+            long srcCipher, int srcCipherLength,
+            long srcMac, int srcMacLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_aes256gcm_decrypt_detached_array(
+            @NotNull byte[] dstPlain, int dstPlainOffset, int dstPlainLength,
+            @NotNull byte[] srcCipher, int srcCipherOffset, int srcCipherLength,
+            @NotNull byte[] srcMac, int srcMacOffset, int srcMacLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_aes256gcm_decrypt_detached_handle(
+            @NotNull ByteBuffer dstPlain,
+            @NotNull ByteBuffer srcCipher,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_aead_aes256gcm_decrypt(
             @NotNull ByteBuffer dstPlain,
             @NotNull ByteBuffer srcCipher,
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_aes256gcm_decrypt_address(
+            long dstPlain, int dstPlainLength,
+            long srcCipher, int srcCipherLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_aes256gcm_decrypt_array(
+            @NotNull byte[] dstPlain, int dstPlainOffset, int dstPlainLength,
+            @NotNull byte[] srcCipher, int srcCipherOffset, int srcCipherLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_aes256gcm_decrypt_handle(
+            @NotNull ByteBuffer dstPlain,
+            @NotNull ByteBuffer srcCipher,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
+    public static native long crypto_aead_aes256gcm_beforenm(
+            @NotNull ByteBuffer key);
+    public static native void crypto_aead_aes256gcm_state_free(
+            long state);
+    public static native int crypto_aead_aes256gcm_encrypt_detached_afternm(
+            @NotNull ByteBuffer dstCipher,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long state);
+    public static native int crypto_aead_aes256gcm_encrypt_afternm(
+            @NotNull ByteBuffer dstCipher,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long state);
+    public static native int crypto_aead_aes256gcm_decrypt_detached_afternm(
+            @NotNull ByteBuffer dstPlain,
+            @NotNull ByteBuffer srcCipher,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long state);
+    public static native int crypto_aead_aes256gcm_decrypt_afternm(
+            @NotNull ByteBuffer dstPlain,
+            @NotNull ByteBuffer srcCipher,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long state);
+    public static native int crypto_aead_aes256gcm_encrypt_batch(
+            @NotNull ByteBuffer dstCipher, @NotNull int[] dstOffsets,
+            @NotNull ByteBuffer srcPlain, @NotNull int[] srcOffsets, @NotNull int[] srcLengths,
+            @Nullable ByteBuffer ad, @Nullable int[] adOffsets, @Nullable int[] adLengths,
+            @NotNull ByteBuffer nonces,
+            @NotNull ByteBuffer key,
+            @NotNull int[] status);
+    public static native int crypto_aead_aes256gcm_decrypt_batch(
+            @NotNull ByteBuffer dstPlain, @NotNull int[] dstOffsets,
+            @NotNull ByteBuffer srcCipher, @NotNull int[] srcOffsets, @NotNull int[] srcLengths,
+            @Nullable ByteBuffer ad, @Nullable int[] adOffsets, @Nullable int[] adLengths,
+            @NotNull ByteBuffer nonces,
+            @NotNull ByteBuffer key,
+            @NotNull int[] status);
+    public static native int crypto_aead_aes256gcm_encrypt_inplace(
+            @NotNull ByteBuffer buf,
+            int plainLength,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_aes256gcm_encrypt_detached_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_aes256gcm_decrypt_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_aes256gcm_decrypt_detached_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
 
     //
     // AEAD - Chacha20Poly1305
@@ -123,12 +282,51 @@ public class StodiumJNI {
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_encrypt_detached_address(
+            long dstCipher, int dstCipherLength,
+            long dstMac, int dstMacLength,
+            long srcPlain, int srcPlainLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_encrypt_detached_array(
+            @NotNull byte[] dstCipher, int dstCipherOffset, int dstCipherLength,
+            @NotNull byte[] dstMac, int dstMacOffset, int dstMacLength,
+            @NotNull byte[] srcPlain, int srcPlainOffset, int srcPlainLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_encrypt_detached_handle(
+            @NotNull ByteBuffer dstCipher,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_aead_chacha20poly1305_encrypt(
             @NotNull ByteBuffer dstCipher,
             @NotNull ByteBuffer srcPlain,
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_encrypt_address(
+            long dstCipher, int dstCipherLength,
+            long srcPlain, int srcPlainLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_encrypt_array(
+            @NotNull byte[] dstCipher, int dstCipherOffset, int dstCipherLength,
+            @NotNull byte[] srcPlain, int srcPlainOffset, int srcPlainLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_encrypt_handle(
+            @NotNull ByteBuffer dstCipher,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_aead_chacha20poly1305_decrypt_detached(
             @NotNull ByteBuffer dstPlain,
             @NotNull ByteBuffer srcCipher,
@@ -136,12 +334,102 @@ public class StodiumJNI {
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_decrypt_detached_address(
+            long dstPlain, int dstPlainLength,
+            long srcCipher, int srcCipherLength,
+            long srcMac, int srcMacLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_decrypt_detached_array(
+            @NotNull byte[] dstPlain, int dstPlainOffset, int dstPlainLength,
+            @NotNull byte[] srcCipher, int srcCipherOffset, int srcCipherLength,
+            @NotNull byte[] srcMac, int srcMacOffset, int srcMacLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_decrypt_detached_handle(
+            @NotNull ByteBuffer dstPlain,
+            @NotNull ByteBuffer srcCipher,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_aead_chacha20poly1305_decrypt(
             @NotNull ByteBuffer dstPlain,
             @NotNull ByteBuffer srcCipher,
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_decrypt_address(
+            long dstPlain, int dstPlainLength,
+            long srcCipher, int srcCipherLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_decrypt_array(
+            @NotNull byte[] dstPlain, int dstPlainOffset, int dstPlainLength,
+            @NotNull byte[] srcCipher, int srcCipherOffset, int srcCipherLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_decrypt_handle(
+            @NotNull ByteBuffer dstPlain,
+            @NotNull ByteBuffer srcCipher,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
+    public static native int crypto_aead_chacha20poly1305_encrypt_batch(
+            @NotNull ByteBuffer dstCipher, @NotNull int[] dstOffsets,
+            @NotNull ByteBuffer srcPlain, @NotNull int[] srcOffsets, @NotNull int[] srcLengths,
+            @Nullable ByteBuffer ad, @Nullable int[] adOffsets, @Nullable int[] adLengths,
+            @NotNull ByteBuffer nonces,
+            @NotNull ByteBuffer key,
+            @NotNull int[] status);
+    public static native int crypto_aead_chacha20poly1305_decrypt_batch(
+            @NotNull ByteBuffer dstPlain, @NotNull int[] dstOffsets,
+            @NotNull ByteBuffer srcCipher, @NotNull int[] srcOffsets, @NotNull int[] srcLengths,
+            @Nullable ByteBuffer ad, @Nullable int[] adOffsets, @Nullable int[] adLengths,
+            @NotNull ByteBuffer nonces,
+            @NotNull ByteBuffer key,
+            @NotNull int[] status);
+    public static native int crypto_aead_chacha20poly1305_encrypt_detachedv(
+            @NotNull ByteBuffer[] dstCipher,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer[] srcPlain,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_decrypt_detachedv(
+            @NotNull ByteBuffer[] dstPlain,
+            @NotNull ByteBuffer[] srcCipher,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_encrypt_inplace(
+            @NotNull ByteBuffer buf,
+            int plainLength,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_encrypt_detached_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_decrypt_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_decrypt_detached_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
 
     //
     // AEAD - Chacha20Poly1305 (ietf)
@@ -158,15 +446,51 @@ public class StodiumJNI {
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_ietf_encrypt_detached_address(
+            long dstCipher, int dstCipherLength,
+            long dstMac, int dstMacLength,
+            long srcPlain, int srcPlainLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_ietf_encrypt_detached_array(
+            @NotNull byte[] dstCipher, int dstCipherOffset, int dstCipherLength,
+            @NotNull byte[] dstMac, int dstMacOffset, int dstMacLength,
+            @NotNull byte[] srcPlain, int srcPlainOffset, int srcPlainLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_ietf_encrypt_detached_handle(
+            @NotNull ByteBuffer dstCipher,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_aead_chacha20poly1305_ietf_encrypt(
             @NotNull ByteBuffer dstCipher,
-            int dstOffset,
             @NotNull ByteBuffer srcPlain,
-            int srcOffset,
-            int srcLimit,
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_ietf_encrypt_address(
+            long dstCipher, int dstCipherLength,
+            long srcPlain, int srcPlainLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_ietf_encrypt_array(
+            @NotNull byte[] dstCipher, int dstCipherOffset, int dstCipherLength,
+            @NotNull byte[] srcPlain, int srcPlainOffset, int srcPlainLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_ietf_encrypt_handle(
+            @NotNull ByteBuffer dstCipher,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_aead_chacha20poly1305_ietf_decrypt_detached(
             @NotNull ByteBuffer dstPlain,
             @NotNull ByteBuffer srcCipher,
@@ -174,15 +498,114 @@ public class StodiumJNI {
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_ietf_decrypt_detached_address(
+            long dstPlain, int dstPlainLength,
+            long srcCipher, int srcCipherLength,
+            long srcMac, int srcMacLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_ietf_decrypt_detached_array(
+            @NotNull byte[] dstPlain, int dstPlainOffset, int dstPlainLength,
+            @NotNull byte[] srcCipher, int srcCipherOffset, int srcCipherLength,
+            @NotNull byte[] srcMac, int srcMacOffset, int srcMacLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_ietf_decrypt_detached_handle(
+            @NotNull ByteBuffer dstPlain,
+            @NotNull ByteBuffer srcCipher,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_aead_chacha20poly1305_ietf_decrypt(
             @NotNull ByteBuffer dstPlain,
-            int dstOffset,
             @NotNull ByteBuffer srcCipher,
-            int srcOffset,
-            int srcLength,
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_ietf_decrypt_address(
+            long dstPlain, int dstPlainLength,
+            long srcCipher, int srcCipherLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_ietf_decrypt_array(
+            @NotNull byte[] dstPlain, int dstPlainOffset, int dstPlainLength,
+            @NotNull byte[] srcCipher, int srcCipherOffset, int srcCipherLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_chacha20poly1305_ietf_decrypt_handle(
+            @NotNull ByteBuffer dstPlain,
+            @NotNull ByteBuffer srcCipher,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
+    public static native int crypto_aead_chacha20poly1305_ietf_encrypt_batch(
+            @NotNull ByteBuffer dstCipher, @NotNull int[] dstOffsets,
+            @NotNull ByteBuffer srcPlain, @NotNull int[] srcOffsets, @NotNull int[] srcLengths,
+            @Nullable ByteBuffer ad, @Nullable int[] adOffsets, @Nullable int[] adLengths,
+            @NotNull ByteBuffer nonces,
+            @NotNull ByteBuffer key,
+            @NotNull int[] status);
+    public static native int crypto_aead_chacha20poly1305_ietf_decrypt_batch(
+            @NotNull ByteBuffer dstPlain, @NotNull int[] dstOffsets,
+            @NotNull ByteBuffer srcCipher, @NotNull int[] srcOffsets, @NotNull int[] srcLengths,
+            @Nullable ByteBuffer ad, @Nullable int[] adOffsets, @Nullable int[] adLengths,
+            @NotNull ByteBuffer nonces,
+            @NotNull ByteBuffer key,
+            @NotNull int[] status);
+    public static native int crypto_aead_chacha20poly1305_ietf_encrypt_detachedv(
+            @NotNull ByteBuffer[] dstCipher,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer[] srcPlain,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_ietf_decrypt_detachedv(
+            @NotNull ByteBuffer[] dstPlain,
+            @NotNull ByteBuffer[] srcCipher,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_ietf_encrypt_inplace(
+            @NotNull ByteBuffer buf,
+            int plainLength,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_ietf_encrypt_detached_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_ietf_decrypt_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_ietf_decrypt_detached_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_ietf_encrypt_chunks(
+            @NotNull ByteBuffer dstCipher,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer header,
+            int chunkSize, long firstChunk,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_chacha20poly1305_ietf_decrypt_chunks(
+            @NotNull ByteBuffer dstPlain,
+            @NotNull ByteBuffer srcCipher,
+            @NotNull ByteBuffer header,
+            int chunkSize, long firstChunk,
+            @NotNull ByteBuffer key);
 
     //
     // AEAD - XChacha20Poly1305 (ietf)
@@ -199,12 +622,51 @@ public class StodiumJNI {
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_xchacha20poly1305_ietf_encrypt_detached_address(
+            long dstCipher, int dstCipherLength,
+            long dstMac, int dstMacLength,
+            long srcPlain, int srcPlainLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_xchacha20poly1305_ietf_encrypt_detached_array(
+            @NotNull byte[] dstCipher, int dstCipherOffset, int dstCipherLength,
+            @NotNull byte[] dstMac, int dstMacOffset, int dstMacLength,
+            @NotNull byte[] srcPlain, int srcPlainOffset, int srcPlainLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_xchacha20poly1305_ietf_encrypt_detached_handle(
+            @NotNull ByteBuffer dstCipher,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_aead_xchacha20poly1305_ietf_encrypt(
             @NotNull ByteBuffer dstCipher,
             @NotNull ByteBuffer srcPlain,
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_xchacha20poly1305_ietf_encrypt_address(
+            long dstCipher, int dstCipherLength,
+            long srcPlain, int srcPlainLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_xchacha20poly1305_ietf_encrypt_array(
+            @NotNull byte[] dstCipher, int dstCipherOffset, int dstCipherLength,
+            @NotNull byte[] srcPlain, int srcPlainOffset, int srcPlainLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_xchacha20poly1305_ietf_encrypt_handle(
+            @NotNull ByteBuffer dstCipher,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_aead_xchacha20poly1305_ietf_decrypt_detached(
             @NotNull ByteBuffer dstPlain,
             @NotNull ByteBuffer srcCipher,
@@ -212,12 +674,114 @@ public class StodiumJNI {
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_xchacha20poly1305_ietf_decrypt_detached_address(
+            long dstPlain, int dstPlainLength,
+            long srcCipher, int srcCipherLength,
+            long srcMac, int srcMacLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_xchacha20poly1305_ietf_decrypt_detached_array(
+            @NotNull byte[] dstPlain, int dstPlainOffset, int dstPlainLength,
+            @NotNull byte[] srcCipher, int srcCipherOffset, int srcCipherLength,
+            @NotNull byte[] srcMac, int srcMacOffset, int srcMacLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_xchacha20poly1305_ietf_decrypt_detached_handle(
+            @NotNull ByteBuffer dstPlain,
+            @NotNull ByteBuffer srcCipher,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_aead_xchacha20poly1305_ietf_decrypt(
             @NotNull ByteBuffer dstPlain,
             @NotNull ByteBuffer srcCipher,
             @NotNull ByteBuffer ad,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_aead_xchacha20poly1305_ietf_decrypt_address(
+            long dstPlain, int dstPlainLength,
+            long srcCipher, int srcCipherLength,
+            long ad, int adLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_aead_xchacha20poly1305_ietf_decrypt_array(
+            @NotNull byte[] dstPlain, int dstPlainOffset, int dstPlainLength,
+            @NotNull byte[] srcCipher, int srcCipherOffset, int srcCipherLength,
+            @Nullable byte[] ad, int adOffset, int adLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_aead_xchacha20poly1305_ietf_decrypt_handle(
+            @NotNull ByteBuffer dstPlain,
+            @NotNull ByteBuffer srcCipher,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            long key);
+    public static native int crypto_aead_xchacha20poly1305_ietf_encrypt_batch(
+            @NotNull ByteBuffer dstCipher, @NotNull int[] dstOffsets,
+            @NotNull ByteBuffer srcPlain, @NotNull int[] srcOffsets, @NotNull int[] srcLengths,
+            @Nullable ByteBuffer ad, @Nullable int[] adOffsets, @Nullable int[] adLengths,
+            @NotNull ByteBuffer nonces,
+            @NotNull ByteBuffer key,
+            @NotNull int[] status);
+    public static native int crypto_aead_xchacha20poly1305_ietf_decrypt_batch(
+            @NotNull ByteBuffer dstPlain, @NotNull int[] dstOffsets,
+            @NotNull ByteBuffer srcCipher, @NotNull int[] srcOffsets, @NotNull int[] srcLengths,
+            @Nullable ByteBuffer ad, @Nullable int[] adOffsets, @Nullable int[] adLengths,
+            @NotNull ByteBuffer nonces,
+            @NotNull ByteBuffer key,
+            @NotNull int[] status);
+    public static native int crypto_aead_xchacha20poly1305_ietf_encrypt_detachedv(
+            @NotNull ByteBuffer[] dstCipher,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer[] srcPlain,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_xchacha20poly1305_ietf_decrypt_detachedv(
+            @NotNull ByteBuffer[] dstPlain,
+            @NotNull ByteBuffer[] srcCipher,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_xchacha20poly1305_ietf_encrypt_inplace(
+            @NotNull ByteBuffer buf,
+            int plainLength,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_xchacha20poly1305_ietf_encrypt_detached_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_xchacha20poly1305_ietf_decrypt_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_xchacha20poly1305_ietf_decrypt_detached_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer ad,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_xchacha20poly1305_ietf_encrypt_chunks(
+            @NotNull ByteBuffer dstCipher,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer header,
+            int chunkSize, long firstChunk,
+            @NotNull ByteBuffer key);
+    public static native int crypto_aead_xchacha20poly1305_ietf_decrypt_chunks(
+            @NotNull ByteBuffer dstPlain,
+            @NotNull ByteBuffer srcCipher,
+            @NotNull ByteBuffer header,
+            int chunkSize, long firstChunk,
+            @NotNull ByteBuffer key);
 
     //
     // Auth
@@ -235,19 +799,75 @@ public class StodiumJNI {
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer in,
             @NotNull ByteBuffer key);
+    public static native int crypto_auth_hmacsha256_address(
+            long dst, int dstLength,
+            long in, int inLength,
+            long key, int keyLength);
+    public static native int crypto_auth_hmacsha256_array(
+            @NotNull byte[] dst, int dstOffset, int dstLength,
+            @NotNull byte[] in, int inOffset, int inLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_auth_hmacsha256_handle(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer in,
+            long key);
     public static native int crypto_auth_hmacsha256_verify(
             @NotNull ByteBuffer src,
             @NotNull ByteBuffer in,
             @NotNull ByteBuffer key);
+    public static native int crypto_auth_hmacsha256_verify_address(
+            long src, int srcLength,
+            long in, int inLength,
+            long key, int keyLength);
+    public static native int crypto_auth_hmacsha256_verify_array(
+            @NotNull byte[] src, int srcOffset, int srcLength,
+            @NotNull byte[] in, int inOffset, int inLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_auth_hmacsha256_verify_handle(
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer in,
+            long key);
     public static native int crypto_auth_hmacsha256_init(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer key);
+    public static native int crypto_auth_hmacsha256_init_array(
+            @NotNull ByteBuffer dst,
+            @NotNull byte[] key, int keyOffset, int keyLength);
     public static native int crypto_auth_hmacsha256_update(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer in);
+    public static native int crypto_auth_hmacsha256_update_array(
+            @NotNull ByteBuffer dst,
+            @NotNull byte[] in, int inOffset, int inLength);
+    public static native int crypto_auth_hmacsha256_updatev(
+            @NotNull ByteBuffer state,
+            @NotNull ByteBuffer[] srcs, int offset, int length);
     public static native int crypto_auth_hmacsha256_final(
             @NotNull ByteBuffer state,
             @NotNull ByteBuffer dst);
+    public static native int crypto_auth_hmacsha256_final_array(
+            @NotNull ByteBuffer state,
+            @NotNull byte[] dst, int dstOffset, int dstLength);
+    public static native int crypto_auth_hmacsha256_fd(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer key,
+            int fd, long offset, long length);
+    public static native int crypto_auth_hmacsha256_file(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer key,
+            @NotNull String path, long offset, long length);
+    public static native long crypto_auth_hmacsha256_beforenm(
+            @NotNull ByteBuffer key);
+    public static native void crypto_auth_hmacsha256_state_free(
+            long state);
+    public static native int crypto_auth_hmacsha256_afternm(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer in,
+            long state);
+    public static native int crypto_auth_hmacsha256_verify_afternm(
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer in,
+            long state);
 
     //
     // Auth - HMAC-SHA-512
@@ -260,19 +880,75 @@ public class StodiumJNI {
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer in,
             @NotNull ByteBuffer key);
+    public static native int crypto_auth_hmacsha512_address(
+            long dst, int dstLength,
+            long in, int inLength,
+            long key, int keyLength);
+    public static native int crypto_auth_hmacsha512_array(
+            @NotNull byte[] dst, int dstOffset, int dstLength,
+            @NotNull byte[] in, int inOffset, int inLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_auth_hmacsha512_handle(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer in,
+            long key);
     public static native int crypto_auth_hmacsha512_verify(
             @NotNull ByteBuffer src,
             @NotNull ByteBuffer in,
             @NotNull ByteBuffer key);
+    public static native int crypto_auth_hmacsha512_verify_address(
+            long src, int srcLength,
+            long in, int inLength,
+            long key, int keyLength);
+    public static native int crypto_auth_hmacsha512_verify_array(
+            @NotNull byte[] src, int srcOffset, int srcLength,
+            @NotNull byte[] in, int inOffset, int inLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_auth_hmacsha512_verify_handle(
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer in,
+            long key);
     public static native int crypto_auth_hmacsha512_init(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer key);
+    public static native int crypto_auth_hmacsha512_init_array(
+            @NotNull ByteBuffer dst,
+            @NotNull byte[] key, int keyOffset, int keyLength);
     public static native int crypto_auth_hmacsha512_update(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer in);
+    public static native int crypto_auth_hmacsha512_update_array(
+            @NotNull ByteBuffer dst,
+            @NotNull byte[] in, int inOffset, int inLength);
+    public static native int crypto_auth_hmacsha512_updatev(
+            @NotNull ByteBuffer state,
+            @NotNull ByteBuffer[] srcs, int offset, int length);
     public static native int crypto_auth_hmacsha512_final(
             @NotNull ByteBuffer state,
             @NotNull ByteBuffer dst);
+    public static native int crypto_auth_hmacsha512_final_array(
+            @NotNull ByteBuffer state,
+            @NotNull byte[] dst, int dstOffset, int dstLength);
+    public static native int crypto_auth_hmacsha512_fd(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer key,
+            int fd, long offset, long length);
+    public static native int crypto_auth_hmacsha512_file(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer key,
+            @NotNull String path, long offset, long length);
+    public static native long crypto_auth_hmacsha512_beforenm(
+            @NotNull ByteBuffer key);
+    public static native void crypto_auth_hmacsha512_state_free(
+            long state);
+    public static native int crypto_auth_hmacsha512_afternm(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer in,
+            long state);
+    public static native int crypto_auth_hmacsha512_verify_afternm(
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer in,
+            long state);
 
     //
     // Auth - HMAC-SHA-512/256
@@ -285,19 +961,75 @@ public class StodiumJNI {
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer in,
             @NotNull ByteBuffer key);
+    public static native int crypto_auth_hmacsha512256_address(
+            long dst, int dstLength,
+            long in, int inLength,
+            long key, int keyLength);
+    public static native int crypto_auth_hmacsha512256_array(
+            @NotNull byte[] dst, int dstOffset, int dstLength,
+            @NotNull byte[] in, int inOffset, int inLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_auth_hmacsha512256_handle(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer in,
+            long key);
     public static native int crypto_auth_hmacsha512256_verify(
             @NotNull ByteBuffer src,
             @NotNull ByteBuffer in,
             @NotNull ByteBuffer key);
+    public static native int crypto_auth_hmacsha512256_verify_address(
+            long src, int srcLength,
+            long in, int inLength,
+            long key, int keyLength);
+    public static native int crypto_auth_hmacsha512256_verify_array(
+            @NotNull byte[] src, int srcOffset, int srcLength,
+            @NotNull byte[] in, int inOffset, int inLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_auth_hmacsha512256_verify_handle(
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer in,
+            long key);
     public static native int crypto_auth_hmacsha512256_init(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer key);
+    public static native int crypto_auth_hmacsha512256_init_array(
+            @NotNull ByteBuffer dst,
+            @NotNull byte[] key, int keyOffset, int keyLength);
     public static native int crypto_auth_hmacsha512256_update(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer in);
+    public static native int crypto_auth_hmacsha512256_update_array(
+            @NotNull ByteBuffer dst,
+            @NotNull byte[] in, int inOffset, int inLength);
+    public static native int crypto_auth_hmacsha512256_updatev(
+            @NotNull ByteBuffer state,
+            @NotNull ByteBuffer[] srcs, int offset, int length);
     public static native int crypto_auth_hmacsha512256_final(
             @NotNull ByteBuffer state,
             @NotNull ByteBuffer dst);
+    public static native int crypto_auth_hmacsha512256_final_array(
+            @NotNull ByteBuffer state,
+            @NotNull byte[] dst, int dstOffset, int dstLength);
+    public static native int crypto_auth_hmacsha512256_fd(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer key,
+            int fd, long offset, long length);
+    public static native int crypto_auth_hmacsha512256_file(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer key,
+            @NotNull String path, long offset, long length);
+    public static native long crypto_auth_hmacsha512256_beforenm(
+            @NotNull ByteBuffer key);
+    public static native void crypto_auth_hmacsha512256_state_free(
+            long state);
+    public static native int crypto_auth_hmacsha512256_afternm(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer in,
+            long state);
+    public static native int crypto_auth_hmacsha512256_verify_afternm(
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer in,
+            long state);
 
     //
     // Box
@@ -309,11 +1041,29 @@ public class StodiumJNI {
             @NotNull ByteBuffer dstCipher,
             @NotNull ByteBuffer srcPlain,
             @NotNull ByteBuffer publicKey);
+    public static native int crypto_box_seal_array(
+            @NotNull byte[] dstCipher, int dstCipherOffset, int dstCipherLength,
+            @NotNull byte[] srcPlain, int srcPlainOffset, int srcPlainLength,
+            @NotNull byte[] publicKey, int publicKeyOffset, int publicKeyLength);
+    public static native int crypto_box_seal_ephemeral(
+            @NotNull ByteBuffer dstCipher,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer publicKey,
+            @NotNull ByteBuffer ephemeralKeypair);
+    public static native int crypto_box_seal_batch(
+            @NotNull ByteBuffer dstEntries,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer publicKeys);
     public static native int crypto_box_seal_open(
             @NotNull ByteBuffer dstPlain,
             @NotNull ByteBuffer srcCipher,
             @NotNull ByteBuffer publicKey,
             @NotNull ByteBuffer privateKey);
+    public static native int crypto_box_seal_open_array(
+            @NotNull byte[] dstPlain, int dstPlainOffset, int dstPlainLength,
+            @NotNull byte[] srcCipher, int srcCipherOffset, int srcCipherLength,
+            @NotNull byte[] publicKey, int publicKeyOffset, int publicKeyLength,
+            @NotNull byte[] privateKey, int privateKeyOffset, int privateKeyLength);
 
     // todo detached
 
@@ -340,28 +1090,103 @@ public class StodiumJNI {
             @NotNull ByteBuffer dstKey,
             @NotNull ByteBuffer srcPublic,
             @NotNull ByteBuffer srcPrivate);
+    public static native int crypto_box_curve25519xsalsa20poly1305_beforenm_array(
+            @NotNull byte[] dstKey, int dstKeyOffset, int dstKeyLength,
+            @NotNull byte[] srcPublic, int srcPublicOffset, int srcPublicLength,
+            @NotNull byte[] srcPrivate, int srcPrivateOffset, int srcPrivateLength);
+    public static native long crypto_box_curve25519xsalsa20poly1305_beforenm_handle(
+            @NotNull ByteBuffer srcPublic,
+            @NotNull ByteBuffer srcPrivate);
+    public static native int crypto_box_curve25519xsalsa20poly1305_beforenm_batch(
+            @NotNull ByteBuffer dstSharedKeys,
+            @NotNull ByteBuffer remotePubKeys,
+            @NotNull ByteBuffer localPrivKey,
+            @NotNull int[]      status,
+            boolean             parallel);
     public static native int crypto_box_curve25519xsalsa20poly1305_afternm(
             @NotNull ByteBuffer dstCipher,
             @NotNull ByteBuffer srcPlain,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_box_curve25519xsalsa20poly1305_easy_afternm_array(
+            @NotNull byte[] dstCipher, int dstCipherOffset, int dstCipherLength,
+            @NotNull byte[] srcPlain, int srcPlainOffset, int srcPlainLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_box_curve25519xsalsa20poly1305_easy_afternm_address(
+            long dstCipher, int dstCipherLength,
+            long srcPlain, int srcPlainLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_box_curve25519xsalsa20poly1305_easy_afternm_handle(
+            @NotNull ByteBuffer dstCipher,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_box_curve25519xsalsa20poly1305_open_afternm(
             @NotNull ByteBuffer dstPlain,
             @NotNull ByteBuffer srcCipher,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_box_curve25519xsalsa20poly1305_open_easy_afternm_array(
+            @NotNull byte[] dstPlain, int dstPlainOffset, int dstPlainLength,
+            @NotNull byte[] srcCipher, int srcCipherOffset, int srcCipherLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_box_curve25519xsalsa20poly1305_open_easy_afternm_address(
+            long dstPlain, int dstPlainLength,
+            long srcCipher, int srcCipherLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_box_curve25519xsalsa20poly1305_open_easy_afternm_handle(
+            @NotNull ByteBuffer dstPlain,
+            @NotNull ByteBuffer srcCipher,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_box_curve25519xsalsa20poly1305(
             @NotNull ByteBuffer dstCipher,
             @NotNull ByteBuffer srcPlain,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer publicKey,
             @NotNull ByteBuffer privateKey);
+    public static native int crypto_box_curve25519xsalsa20poly1305_easy_array(
+            @NotNull byte[] dstCipher, int dstCipherOffset, int dstCipherLength,
+            @NotNull byte[] srcPlain, int srcPlainOffset, int srcPlainLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] publicKey, int publicKeyOffset, int publicKeyLength,
+            @NotNull byte[] privateKey, int privateKeyOffset, int privateKeyLength);
     public static native int crypto_box_curve25519xsalsa20poly1305_open(
             @NotNull ByteBuffer dstPlain,
             @NotNull ByteBuffer srcCipher,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer publicKey,
             @NotNull ByteBuffer privateKey);
+    public static native int crypto_box_curve25519xsalsa20poly1305_open_easy_array(
+            @NotNull byte[] dstPlain, int dstPlainOffset, int dstPlainLength,
+            @NotNull byte[] srcCipher, int srcCipherOffset, int srcCipherLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] publicKey, int publicKeyOffset, int publicKeyLength,
+            @NotNull byte[] privateKey, int privateKeyOffset, int privateKeyLength);
+    public static native int crypto_box_curve25519xsalsa20poly1305_easy_inplace(
+            @NotNull ByteBuffer buf,
+            int plainLength,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer publicKey,
+            @NotNull ByteBuffer privateKey);
+    public static native int crypto_box_curve25519xsalsa20poly1305_open_easy_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer publicKey,
+            @NotNull ByteBuffer privateKey);
+    public static native int crypto_box_curve25519xsalsa20poly1305_easy_afternm_inplace(
+            @NotNull ByteBuffer buf,
+            int plainLength,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_box_curve25519xsalsa20poly1305_open_easy_afternm_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
 
     //
     // Box - X25519XChachaPoly1305
@@ -384,28 +1209,103 @@ public class StodiumJNI {
             @NotNull ByteBuffer dstKey,
             @NotNull ByteBuffer srcPublic,
             @NotNull ByteBuffer srcPrivate);
+    public static native int crypto_box_curve25519xchacha20poly1305_beforenm_array(
+            @NotNull byte[] dstKey, int dstKeyOffset, int dstKeyLength,
+            @NotNull byte[] srcPublic, int srcPublicOffset, int srcPublicLength,
+            @NotNull byte[] srcPrivate, int srcPrivateOffset, int srcPrivateLength);
+    public static native long crypto_box_curve25519xchacha20poly1305_beforenm_handle(
+            @NotNull ByteBuffer srcPublic,
+            @NotNull ByteBuffer srcPrivate);
+    public static native int crypto_box_curve25519xchacha20poly1305_beforenm_batch(
+            @NotNull ByteBuffer dstSharedKeys,
+            @NotNull ByteBuffer remotePubKeys,
+            @NotNull ByteBuffer localPrivKey,
+            @NotNull int[]      status,
+            boolean             parallel);
     public static native int crypto_box_curve25519xchacha20poly1305_easy_afternm(
             @NotNull ByteBuffer dstCipher,
             @NotNull ByteBuffer srcPlain,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_box_curve25519xchacha20poly1305_easy_afternm_address(
+            long dstCipher, int dstCipherLength,
+            long srcPlain, int srcPlainLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_box_curve25519xchacha20poly1305_easy_afternm_array(
+            @NotNull byte[] dstCipher, int dstCipherOffset, int dstCipherLength,
+            @NotNull byte[] srcPlain, int srcPlainOffset, int srcPlainLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_box_curve25519xchacha20poly1305_easy_afternm_handle(
+            @NotNull ByteBuffer dstCipher,
+            @NotNull ByteBuffer srcPlain,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_box_curve25519xchacha20poly1305_open_easy_afternm(
             @NotNull ByteBuffer dstPlain,
             @NotNull ByteBuffer srcCipher,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_box_curve25519xchacha20poly1305_open_easy_afternm_address(
+            long dstPlain, int dstPlainLength,
+            long srcCipher, int srcCipherLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_box_curve25519xchacha20poly1305_open_easy_afternm_array(
+            @NotNull byte[] dstPlain, int dstPlainOffset, int dstPlainLength,
+            @NotNull byte[] srcCipher, int srcCipherOffset, int srcCipherLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_box_curve25519xchacha20poly1305_open_easy_afternm_handle(
+            @NotNull ByteBuffer dstPlain,
+            @NotNull ByteBuffer srcCipher,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_box_curve25519xchacha20poly1305_easy(
             @NotNull ByteBuffer dstCipher,
             @NotNull ByteBuffer srcPlain,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer publicKey,
             @NotNull ByteBuffer privateKey);
+    public static native int crypto_box_curve25519xchacha20poly1305_easy_array(
+            @NotNull byte[] dstCipher, int dstCipherOffset, int dstCipherLength,
+            @NotNull byte[] srcPlain, int srcPlainOffset, int srcPlainLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] publicKey, int publicKeyOffset, int publicKeyLength,
+            @NotNull byte[] privateKey, int privateKeyOffset, int privateKeyLength);
     public static native int crypto_box_curve25519xchacha20poly1305_open_easy(
             @NotNull ByteBuffer dstPlain,
             @NotNull ByteBuffer srcCipher,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer publicKey,
             @NotNull ByteBuffer privateKey);
+    public static native int crypto_box_curve25519xchacha20poly1305_open_easy_array(
+            @NotNull byte[] dstPlain, int dstPlainOffset, int dstPlainLength,
+            @NotNull byte[] srcCipher, int srcCipherOffset, int srcCipherLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] publicKey, int publicKeyOffset, int publicKeyLength,
+            @NotNull byte[] privateKey, int privateKeyOffset, int privateKeyLength);
+    public static native int crypto_box_curve25519xchacha20poly1305_easy_inplace(
+            @NotNull ByteBuffer buf,
+            int plainLength,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer publicKey,
+            @NotNull ByteBuffer privateKey);
+    public static native int crypto_box_curve25519xchacha20poly1305_open_easy_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer publicKey,
+            @NotNull ByteBuffer privateKey);
+    public static native int crypto_box_curve25519xchacha20poly1305_easy_afternm_inplace(
+            @NotNull ByteBuffer buf,
+            int plainLength,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_box_curve25519xchacha20poly1305_open_easy_afternm_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
 
     // todo detached
 
@@ -466,6 +1366,14 @@ public class StodiumJNI {
             @NotNull  ByteBuffer dst,
             @NotNull  ByteBuffer src,
             @Nullable ByteBuffer key);
+    public static native int crypto_generichash_blake2b_address(
+            long dst, int dstLength,
+            long src, int srcLength,
+            long key, int keyLength);
+    public static native int crypto_generichash_blake2b_array(
+            @NotNull byte[] dst, int dstOffset, int dstLength,
+            @NotNull byte[] src, int srcOffset, int srcLength,
+            @Nullable byte[] key, int keyOffset, int keyLength);
     public static native int crypto_generichash_blake2b_salt_personal(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer src,
@@ -476,12 +1384,67 @@ public class StodiumJNI {
             @NotNull  ByteBuffer state,
             @Nullable ByteBuffer key,
                       int        outlen);
+    public static native int crypto_generichash_blake2b_init_address(
+            long state, int stateLength,
+            long key, int keyLength,
+            int outlen);
+    public static native int crypto_generichash_blake2b_init_array(
+            @NotNull ByteBuffer state,
+            @Nullable byte[] key, int keyOffset, int keyLength,
+            int outlen);
     public static native int crypto_generichash_blake2b_update(
             @NotNull ByteBuffer state,
             @NotNull ByteBuffer in);
+    public static native int crypto_generichash_blake2b_updatev(
+            @NotNull ByteBuffer state,
+            @NotNull ByteBuffer[] srcs, int offset, int length);
+    public static native int crypto_generichash_blake2b_update_address(
+            long state, int stateLength,
+            long in, int inLength);
+    public static native int crypto_generichash_blake2b_update_array(
+            @NotNull ByteBuffer state,
+            @NotNull byte[] in, int inOffset, int inLength);
     public static native int crypto_generichash_blake2b_final(
             @NotNull ByteBuffer state,
             @NotNull ByteBuffer out);
+    public static native int crypto_generichash_blake2b_final_address(
+            long state, int stateLength,
+            long out, int outLength);
+    public static native int crypto_generichash_blake2b_final_array(
+            @NotNull ByteBuffer state,
+            @NotNull byte[] out, int outOffset, int outLength);
+    public static native int crypto_generichash_blake2b_fd(
+            @NotNull ByteBuffer dst,
+            @Nullable ByteBuffer key,
+            int fd, long offset, long length);
+    public static native int crypto_generichash_blake2b_file(
+            @NotNull ByteBuffer dst,
+            @Nullable ByteBuffer key,
+            @NotNull String path, long offset, long length);
+    public static native int crypto_generichash_blake2b_tree_leafbytes();
+    public static native int crypto_generichash_blake2b_tree_leaves(
+            @NotNull ByteBuffer dstLeaves,
+            @NotNull ByteBuffer src,
+            @Nullable ByteBuffer key,
+            int leafSize, long firstLeaf);
+    public static native int crypto_generichash_blake2b_tree_leaves_fd(
+            @NotNull ByteBuffer dstLeaves,
+            @Nullable ByteBuffer key,
+            int fd, long length, int leafSize, long firstLeaf);
+    public static native int crypto_generichash_blake2b_tree_leaves_file(
+            @NotNull ByteBuffer dstLeaves,
+            @Nullable ByteBuffer key,
+            @NotNull String path, long length, int leafSize, long firstLeaf);
+    public static native int crypto_generichash_blake2b_tree_parents(
+            @NotNull ByteBuffer dstParents,
+            @NotNull ByteBuffer children,
+            @Nullable ByteBuffer key,
+            int leafSize, int depth, long firstNode);
+    public static native int crypto_generichash_blake2b_tree_root(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer leaves,
+            @Nullable ByteBuffer key,
+            int leafSize);
 
     //
     // Hash
@@ -497,14 +1460,40 @@ public class StodiumJNI {
     public static native int crypto_hash_sha256(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer in);
+    public static native int crypto_hash_sha256_address(
+            long dst, int dstLength,
+            long in, int inLength);
     public static native int crypto_hash_sha256_init(
             @NotNull ByteBuffer dst);
+    public static native int crypto_hash_sha256_init_address(
+            long dst, int dstLength);
     public static native int crypto_hash_sha256_update(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer in);
+    public static native int crypto_hash_sha256_updatev(
+            @NotNull ByteBuffer state,
+            @NotNull ByteBuffer[] srcs, int offset, int length);
+    public static native int crypto_hash_sha256_update_address(
+            long dst, int dstLength,
+            long in, int inLength);
+    public static native int crypto_hash_sha256_update_array(
+            @NotNull ByteBuffer dst,
+            @NotNull byte[] in, int inOffset, int inLength);
     public static native int crypto_hash_sha256_final(
             @NotNull ByteBuffer state,
             @NotNull ByteBuffer dst);
+    public static native int crypto_hash_sha256_final_address(
+            long state, int stateLength,
+            long dst, int dstLength);
+    public static native int crypto_hash_sha256_final_array(
+            @NotNull ByteBuffer state,
+            @NotNull byte[] dst, int dstOffset, int dstLength);
+    public static native int crypto_hash_sha256_fd(
+            @NotNull ByteBuffer dst,
+            int fd, long offset, long length);
+    public static native int crypto_hash_sha256_file(
+            @NotNull ByteBuffer dst,
+            @NotNull String path, long offset, long length);
 
     //
     // Hash - SHA-512
@@ -515,14 +1504,40 @@ public class StodiumJNI {
     public static native int crypto_hash_sha512(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer in);
+    public static native int crypto_hash_sha512_address(
+            long dst, int dstLength,
+            long in, int inLength);
     public static native int crypto_hash_sha512_init(
             @NotNull ByteBuffer dst);
+    public static native int crypto_hash_sha512_init_address(
+            long dst, int dstLength);
     public static native int crypto_hash_sha512_update(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer in);
+    public static native int crypto_hash_sha512_updatev(
+            @NotNull ByteBuffer state,
+            @NotNull ByteBuffer[] srcs, int offset, int length);
+    public static native int crypto_hash_sha512_update_address(
+            long dst, int dstLength,
+            long in, int inLength);
+    public static native int crypto_hash_sha512_update_array(
+            @NotNull ByteBuffer dst,
+            @NotNull byte[] in, int inOffset, int inLength);
     public static native int crypto_hash_sha512_final(
             @NotNull ByteBuffer state,
             @NotNull ByteBuffer dst);
+    public static native int crypto_hash_sha512_final_address(
+            long state, int stateLength,
+            long dst, int dstLength);
+    public static native int crypto_hash_sha512_final_array(
+            @NotNull ByteBuffer state,
+            @NotNull byte[] dst, int dstOffset, int dstLength);
+    public static native int crypto_hash_sha512_fd(
+            @NotNull ByteBuffer dst,
+            int fd, long offset, long length);
+    public static native int crypto_hash_sha512_file(
+            @NotNull ByteBuffer dst,
+            @NotNull String path, long offset, long length);
 
     //
     // Kdf
@@ -542,6 +1557,11 @@ public class StodiumJNI {
                      long       subId,
             @NotNull ByteBuffer context,
             @NotNull ByteBuffer key);
+    public static native int crypto_kdf_blake2b_derive_from_key_handle(
+            @NotNull ByteBuffer subkey,
+                     long       subId,
+            @NotNull ByteBuffer context,
+                     long       key);
 
     //
     // Kx
@@ -576,6 +1596,15 @@ public class StodiumJNI {
             @NotNull ByteBuffer serverSk,
             @NotNull ByteBuffer clientPk);
 
+    public static native int crypto_kx_server_session_keys_batch(
+            @NotNull ByteBuffer rx,
+            @NotNull ByteBuffer tx,
+            @NotNull ByteBuffer serverPk,
+            @NotNull ByteBuffer serverSk,
+            @NotNull ByteBuffer clientPks,
+            @NotNull int[]      status,
+            boolean             parallel);
+
     //
     // OneTimeAuth
     //
@@ -592,19 +1621,55 @@ public class StodiumJNI {
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer in,
             @NotNull ByteBuffer key);
+    public static native int crypto_onetimeauth_poly1305_array(
+            @NotNull byte[] dst, int dstOffset, int dstLength,
+            @NotNull byte[] in, int inOffset, int inLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_onetimeauth_poly1305_handle(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer in,
+            long key);
     public static native int crypto_onetimeauth_poly1305_verify(
             @NotNull ByteBuffer src,
             @NotNull ByteBuffer in,
             @NotNull ByteBuffer key);
+    public static native int crypto_onetimeauth_poly1305_verify_array(
+            @NotNull byte[] src, int srcOffset, int srcLength,
+            @NotNull byte[] in, int inOffset, int inLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_onetimeauth_poly1305_verify_handle(
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer in,
+            long key);
     public static native int crypto_onetimeauth_poly1305_init(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer key);
+    public static native int crypto_onetimeauth_poly1305_init_array(
+            @NotNull ByteBuffer dst,
+            @NotNull byte[] key, int keyOffset, int keyLength);
     public static native int crypto_onetimeauth_poly1305_update(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer in);
+    public static native int crypto_onetimeauth_poly1305_update_array(
+            @NotNull ByteBuffer dst,
+            @NotNull byte[] in, int inOffset, int inLength);
+    public static native int crypto_onetimeauth_poly1305_updatev(
+            @NotNull ByteBuffer state,
+            @NotNull ByteBuffer[] srcs, int offset, int length);
     public static native int crypto_onetimeauth_poly1305_final(
             @NotNull ByteBuffer state,
             @NotNull ByteBuffer dst);
+    public static native int crypto_onetimeauth_poly1305_final_array(
+            @NotNull ByteBuffer state,
+            @NotNull byte[] dst, int dstOffset, int dstLength);
+    public static native int crypto_onetimeauth_poly1305_fd(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer key,
+            int fd, long offset, long length);
+    public static native int crypto_onetimeauth_poly1305_file(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer key,
+            @NotNull String path, long offset, long length);
     //
     // PwHash
     //
@@ -697,6 +1762,12 @@ public class StodiumJNI {
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer src,
             @NotNull ByteBuffer elm);
+    public static native int crypto_scalarmult_curve25519_batch(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer elms,
+            @NotNull int[]      status,
+            boolean             parallel);
     public static native int crypto_scalarmult_curve25519_base(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer src);
@@ -718,23 +1789,120 @@ public class StodiumJNI {
             @NotNull ByteBuffer src,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xsalsa20poly1305_easy_address(
+            long dst, int dstLength,
+            long src, int srcLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_secretbox_xsalsa20poly1305_easy_array(
+            @NotNull byte[] dst, int dstOffset, int dstLength,
+            @NotNull byte[] src, int srcOffset, int srcLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_secretbox_xsalsa20poly1305_easy_handle(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_secretbox_xsalsa20poly1305_open_easy(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer src,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xsalsa20poly1305_open_easy_address(
+            long dst, int dstLength,
+            long src, int srcLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_secretbox_xsalsa20poly1305_open_easy_array(
+            @NotNull byte[] dst, int dstOffset, int dstLength,
+            @NotNull byte[] src, int srcOffset, int srcLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_secretbox_xsalsa20poly1305_open_easy_handle(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_secretbox_xsalsa20poly1305_detached(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer mac,
             @NotNull ByteBuffer src,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xsalsa20poly1305_detached_address(
+            long dst, int dstLength,
+            long mac, int macLength,
+            long src, int srcLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_secretbox_xsalsa20poly1305_detached_array(
+            @NotNull byte[] dst, int dstOffset, int dstLength,
+            @NotNull byte[] mac, int macOffset, int macLength,
+            @NotNull byte[] src, int srcOffset, int srcLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_secretbox_xsalsa20poly1305_detached_handle(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer mac,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_secretbox_xsalsa20poly1305_open_detached(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer src,
             @NotNull ByteBuffer mac,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xsalsa20poly1305_detachedv(
+            @NotNull ByteBuffer[] dstCipher,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer[] srcPlain,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xsalsa20poly1305_open_detachedv(
+            @NotNull ByteBuffer[] dstPlain,
+            @NotNull ByteBuffer[] srcCipher,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xsalsa20poly1305_easy_inplace(
+            @NotNull ByteBuffer buf,
+            int plainLength,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xsalsa20poly1305_open_easy_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xsalsa20poly1305_detached_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xsalsa20poly1305_open_detached_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xsalsa20poly1305_open_detached_address(
+            long dst, int dstLength,
+            long src, int srcLength,
+            long mac, int macLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_secretbox_xsalsa20poly1305_open_detached_array(
+            @NotNull byte[] dst, int dstOffset, int dstLength,
+            @NotNull byte[] src, int srcOffset, int srcLength,
+            @NotNull byte[] mac, int macOffset, int macLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_secretbox_xsalsa20poly1305_open_detached_handle(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer mac,
+            @NotNull ByteBuffer nonce,
+            long key);
 
     //
     // SecretBox XChacha20Poly1305
@@ -748,23 +1916,154 @@ public class StodiumJNI {
             @NotNull ByteBuffer src,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xchacha20poly1305_easy_address(
+            long dst, int dstLength,
+            long src, int srcLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_secretbox_xchacha20poly1305_easy_array(
+            @NotNull byte[] dst, int dstOffset, int dstLength,
+            @NotNull byte[] src, int srcOffset, int srcLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_secretbox_xchacha20poly1305_easy_handle(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_secretbox_xchacha20poly1305_open_easy(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer src,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xchacha20poly1305_open_easy_address(
+            long dst, int dstLength,
+            long src, int srcLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_secretbox_xchacha20poly1305_open_easy_array(
+            @NotNull byte[] dst, int dstOffset, int dstLength,
+            @NotNull byte[] src, int srcOffset, int srcLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_secretbox_xchacha20poly1305_open_easy_handle(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_secretbox_xchacha20poly1305_detached(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer mac,
             @NotNull ByteBuffer src,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xchacha20poly1305_detached_address(
+            long dst, int dstLength,
+            long mac, int macLength,
+            long src, int srcLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_secretbox_xchacha20poly1305_detached_array(
+            @NotNull byte[] dst, int dstOffset, int dstLength,
+            @NotNull byte[] mac, int macOffset, int macLength,
+            @NotNull byte[] src, int srcOffset, int srcLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_secretbox_xchacha20poly1305_detached_handle(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer mac,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer nonce,
+            long key);
     public static native int crypto_secretbox_xchacha20poly1305_open_detached(
             @NotNull ByteBuffer dst,
             @NotNull ByteBuffer src,
             @NotNull ByteBuffer mac,
             @NotNull ByteBuffer nonce,
             @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xchacha20poly1305_detachedv(
+            @NotNull ByteBuffer[] dstCipher,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer[] srcPlain,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xchacha20poly1305_open_detachedv(
+            @NotNull ByteBuffer[] dstPlain,
+            @NotNull ByteBuffer[] srcCipher,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xchacha20poly1305_easy_inplace(
+            @NotNull ByteBuffer buf,
+            int plainLength,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xchacha20poly1305_open_easy_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xchacha20poly1305_detached_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer dstMac,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xchacha20poly1305_open_detached_inplace(
+            @NotNull ByteBuffer buf,
+            @NotNull ByteBuffer srcMac,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_secretbox_xchacha20poly1305_open_detached_address(
+            long dst, int dstLength,
+            long src, int srcLength,
+            long mac, int macLength,
+            long nonce, int nonceLength,
+            long key, int keyLength);
+    public static native int crypto_secretbox_xchacha20poly1305_open_detached_array(
+            @NotNull byte[] dst, int dstOffset, int dstLength,
+            @NotNull byte[] src, int srcOffset, int srcLength,
+            @NotNull byte[] mac, int macOffset, int macLength,
+            @NotNull byte[] nonce, int nonceOffset, int nonceLength,
+            @NotNull byte[] key, int keyOffset, int keyLength);
+    public static native int crypto_secretbox_xchacha20poly1305_open_detached_handle(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer mac,
+            @NotNull ByteBuffer nonce,
+            long key);
+
+    //
+    // SecretStream XChacha20Poly1305
+    //
+    public static native int crypto_secretstream_xchacha20poly1305_abytes();
+    public static native int crypto_secretstream_xchacha20poly1305_headerbytes();
+    public static native int crypto_secretstream_xchacha20poly1305_keybytes();
+    public static native int crypto_secretstream_xchacha20poly1305_statebytes();
+    public static native int crypto_secretstream_xchacha20poly1305_tag_message();
+    public static native int crypto_secretstream_xchacha20poly1305_tag_push();
+    public static native int crypto_secretstream_xchacha20poly1305_tag_rekey();
+    public static native int crypto_secretstream_xchacha20poly1305_tag_final();
+
+    public static native int crypto_secretstream_xchacha20poly1305_init_push(
+            @NotNull ByteBuffer state,
+            @NotNull ByteBuffer header,
+            @NotNull ByteBuffer key);
+    public static native int crypto_secretstream_xchacha20poly1305_init_pull(
+            @NotNull ByteBuffer state,
+            @NotNull ByteBuffer header,
+            @NotNull ByteBuffer key);
+    public static native int crypto_secretstream_xchacha20poly1305_push(
+            @NotNull  ByteBuffer state,
+            @NotNull  ByteBuffer dst,
+            @NotNull  ByteBuffer src,
+            @Nullable ByteBuffer ad,
+                      int        tag);
+    public static native int crypto_secretstream_xchacha20poly1305_pull(
+            @NotNull  ByteBuffer state,
+            @NotNull  ByteBuffer dst,
+            @NotNull  ByteBuffer src,
+            @Nullable ByteBuffer ad);
+    public static native void crypto_secretstream_xchacha20poly1305_rekey(
+            @NotNull ByteBuffer state);
 
     //
     // ShortHash
@@ -781,6 +2080,14 @@ public class StodiumJNI {
             @NotNull ByteBuffer out,
             @NotNull ByteBuffer in,
             @NotNull ByteBuffer key);
+    public static native int crypto_shorthash_siphash24_address(
+            long out, int outLength,
+            long in, int inLength,
+            long key, int keyLength);
+    public static native int crypto_shorthash_siphash24_handle(
+            @NotNull ByteBuffer out,
+            @NotNull ByteBuffer in,
+            long key);
 
     //
     // ShortHash SipHashx24
@@ -792,6 +2099,14 @@ public class StodiumJNI {
             @NotNull ByteBuffer out,
             @NotNull ByteBuffer in,
             @NotNull ByteBuffer key);
+    public static native int crypto_shorthash_siphashx24_address(
+            long out, int outLength,
+            long in, int inLength,
+            long key, int keyLength);
+    public static native int crypto_shorthash_siphashx24_handle(
+            @NotNull ByteBuffer out,
+            @NotNull ByteBuffer in,
+            long key);
 
     //
     // Sign
@@ -818,31 +2133,155 @@ public class StodiumJNI {
             @NotNull ByteBuffer dstSigned,
             @NotNull ByteBuffer srcMsg,
             @NotNull ByteBuffer priv);
+    public static native int crypto_sign_ed25519_array(
+            @NotNull byte[] dstSigned, int dstSignedOffset, int dstSignedLength,
+            @NotNull byte[] srcMsg, int srcMsgOffset, int srcMsgLength,
+            @NotNull byte[] priv, int privOffset, int privLength);
     public static native int crypto_sign_ed25519_open(
             @NotNull ByteBuffer dstMsg,
             @NotNull ByteBuffer srcSigned,
             @NotNull ByteBuffer priv);
+    public static native int crypto_sign_ed25519_open_array(
+            @NotNull byte[] dstMsg, int dstMsgOffset, int dstMsgLength,
+            @NotNull byte[] srcSigned, int srcSignedOffset, int srcSignedLength,
+            @NotNull byte[] priv, int privOffset, int privLength);
     public static native int crypto_sign_ed25519_detached(
             @NotNull ByteBuffer dstSig,
             @NotNull ByteBuffer srcMsg,
             @NotNull ByteBuffer priv);
+    public static native int crypto_sign_ed25519_detached_array(
+            @NotNull byte[] dstSig, int dstSigOffset, int dstSigLength,
+            @NotNull byte[] srcMsg, int srcMsgOffset, int srcMsgLength,
+            @NotNull byte[] priv, int privOffset, int privLength);
     public static native int crypto_sign_ed25519_verify_detached(
             @NotNull ByteBuffer srcSig,
             @NotNull ByteBuffer srcMsg,
             @NotNull ByteBuffer priv);
+    public static native int crypto_sign_ed25519_verify_detached_array(
+            @NotNull byte[] srcSig, int srcSigOffset, int srcSigLength,
+            @NotNull byte[] srcMsg, int srcMsgOffset, int srcMsgLength,
+            @NotNull byte[] priv, int privOffset, int privLength);
+    public static native int crypto_sign_ed25519_verify_detached_batch(
+            @NotNull ByteBuffer sigs,
+            @NotNull ByteBuffer msgs, @NotNull int[] msgOffsets, @NotNull int[] msgLengths,
+            @NotNull ByteBuffer pubs,
+            @NotNull boolean[] valid);
     public static native int crypto_sign_ed25519ph_init(
             @NotNull ByteBuffer state);
     public static native int crypto_sign_ed25519ph_update(
             @NotNull ByteBuffer state,
             @NotNull ByteBuffer srcMsg);
+    public static native int crypto_sign_ed25519ph_update_array(
+            @NotNull ByteBuffer state,
+            @NotNull byte[] srcMsg, int srcMsgOffset, int srcMsgLength);
+    public static native int crypto_sign_ed25519ph_updatev(
+            @NotNull ByteBuffer state,
+            @NotNull ByteBuffer[] srcs, int offset, int length);
     public static native int crypto_sign_ed25519ph_final_create(
             @NotNull ByteBuffer state,
             @NotNull ByteBuffer dstSig,
             @NotNull ByteBuffer priv);
+    public static native int crypto_sign_ed25519ph_final_create_array(
+            @NotNull ByteBuffer state,
+            @NotNull byte[] dstSig, int dstSigOffset, int dstSigLength,
+            @NotNull byte[] priv, int privOffset, int privLength);
     public static native int crypto_sign_ed25519ph_final_verify(
             @NotNull ByteBuffer state,
             @NotNull ByteBuffer srcSig,
             @NotNull ByteBuffer priv);
+    public static native int crypto_sign_ed25519ph_final_verify_array(
+            @NotNull ByteBuffer state,
+            @NotNull byte[] srcSig, int srcSigOffset, int srcSigLength,
+            @NotNull byte[] pub, int pubOffset, int pubLength);
+
+    //
+    // Stream
+    //
+    public static native String crypto_stream_primitive();
+
+    //
+    // Stream XChacha20
+    //
+    public static native int crypto_stream_xchacha20_keybytes();
+    public static native int crypto_stream_xchacha20_noncebytes();
+
+    public static native int crypto_stream_xchacha20(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_stream_xchacha20_xor(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_stream_xchacha20_xor_ic(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer nonce,
+                     long       ic,
+            @NotNull ByteBuffer key);
+    public static native int crypto_stream_xchacha20_xor_at(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer nonce,
+                     long       offset,
+            @NotNull ByteBuffer key);
+
+    //
+    // Stream Chacha20 (ietf)
+    //
+    public static native int crypto_stream_chacha20_ietf_keybytes();
+    public static native int crypto_stream_chacha20_ietf_noncebytes();
+
+    public static native int crypto_stream_chacha20_ietf(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_stream_chacha20_ietf_xor(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_stream_chacha20_ietf_xor_ic(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer nonce,
+                     long       ic,
+            @NotNull ByteBuffer key);
+    public static native int crypto_stream_chacha20_ietf_xor_at(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer nonce,
+                     long       offset,
+            @NotNull ByteBuffer key);
+
+    //
+    // Stream XSalsa20
+    //
+    public static native int crypto_stream_xsalsa20_keybytes();
+    public static native int crypto_stream_xsalsa20_noncebytes();
+
+    public static native int crypto_stream_xsalsa20(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_stream_xsalsa20_xor(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer nonce,
+            @NotNull ByteBuffer key);
+    public static native int crypto_stream_xsalsa20_xor_ic(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer nonce,
+                     long       ic,
+            @NotNull ByteBuffer key);
+    public static native int crypto_stream_xsalsa20_xor_at(
+            @NotNull ByteBuffer dst,
+            @NotNull ByteBuffer src,
+            @NotNull ByteBuffer nonce,
+                     long       offset,
+            @NotNull ByteBuffer key);
 
     /*
       Load the native library
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium;
+
+import eu.artemisc.stodium.exceptions.ConstraintViolationException;
+
+/**
+ * ThreadPool controls the native worker threads used by operations that split
+ * their work into independent tasks, such as
+ * {@link eu.artemisc.stodium.aead.ChunkedAEAD}. The calling thread always
+ * takes part in its own operation, so with the default size of 0 all work
+ * runs on the calling thread, exactly like the other primitives.
+ * <p>
+ * The workers are shared by the whole process. They run native code only,
+ * and are never attached to the JVM.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public final class ThreadPool {
+
+    // block the constructor
+    private ThreadPool() {}
+
+    /**
+     * setThreads resizes the pool to the given number of worker threads. On a
+     * machine with n cores, n - 1 workers keep every core busy, as the calling
+     * thread does its share of the work as well.
+     *
+     * @param threads
+     * @return the new size of the pool, which is smaller than requested if not
+     *         all threads could be started
+     * @throws ConstraintViolationException
+     */
+    public static int setThreads(final int threads)
+            throws ConstraintViolationException {
+        Stodium.checkPositive(threads);
+        return StodiumJNI.stodium_pool_set_threads(threads);
+    }
+
+    /**
+     *
+     * @return the number of worker threads in the pool
+     */
+    public static int threads() {
+        return StodiumJNI.stodium_pool_threads();
+    }
+}
@@ -5,10 +5,19 @@ import org.jetbrains.annotations.Nullable;
 
 import java.nio.ByteBuffer;
 
+import eu.artemisc.stodium.KeyHandle;
+import eu.artemisc.stodium.NativeResource;
 import eu.artemisc.stodium.Singleton;
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.StodiumJNI;
+import eu.artemisc.stodium.exceptions.ConstraintViolationException;
 import eu.artemisc.stodium.exceptions.StodiumException;
 
 /**
+ * The destination and source buffers passed to the encrypt and decrypt
+ * methods must not overlap. To encrypt or decrypt a message within the buffer
+ * that holds it, use the *InPlace methods instead.
+ *
  * @author Jan van de Molengraft [jan@artemisc.eu]
  */
 public abstract class AEAD {
@@ -194,4 +203,1251 @@ public abstract class AEAD {
                                     final @NotNull ByteBuffer nonce,
                                     final @NotNull ByteBuffer key)
             throws StodiumException;
+
+    //
+    // precomputed keys
+    //
+
+    /**
+     * precompute expands key into a {@link PrecomputedKey}, which can be
+     * passed to the encrypt and decrypt methods in place of the raw key. This
+     * avoids redoing the key schedule for every message when many messages
+     * are processed under the same key.
+     * <p>
+     * Only supported by constructions with an expensive key setup (currently
+     * AES-256-GCM), see {@link #supportsPrecompute()}.
+     *
+     * @param key
+     * @return
+     * @throws StodiumException
+     * @throws UnsupportedOperationException if the construction does not
+     *         support precomputed keys
+     */
+    @NotNull
+    public PrecomputedKey precompute(final @NotNull ByteBuffer key)
+            throws StodiumException {
+        throw new UnsupportedOperationException("Stodium: precomputed keys are not supported");
+    }
+
+    /**
+     *
+     * @return true iff {@link #precompute(ByteBuffer)} is supported
+     */
+    public boolean supportsPrecompute() {
+        return false;
+    }
+
+    /**
+     *
+     * @param dstCipher
+     * @param dstMac
+     * @param srcPlain
+     * @param ad
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public void encryptDetached(final @NotNull ByteBuffer     dstCipher,
+                                final @NotNull ByteBuffer     dstMac,
+                                final @NotNull ByteBuffer     srcPlain,
+                                final @NotNull ByteBuffer     ad,
+                                final @NotNull ByteBuffer     nonce,
+                                final @NotNull PrecomputedKey key)
+            throws StodiumException {
+        throw new UnsupportedOperationException("Stodium: precomputed keys are not supported");
+    }
+
+    /**
+     *
+     * @param dstCipher
+     * @param srcPlain
+     * @param ad
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public void encrypt(final @NotNull ByteBuffer     dstCipher,
+                        final @NotNull ByteBuffer     srcPlain,
+                        final @NotNull ByteBuffer     ad,
+                        final @NotNull ByteBuffer     nonce,
+                        final @NotNull PrecomputedKey key)
+            throws StodiumException {
+        throw new UnsupportedOperationException("Stodium: precomputed keys are not supported");
+    }
+
+    /**
+     *
+     * @param dstPlain
+     * @param srcCipher
+     * @param srcMac
+     * @param ad
+     * @param nonce
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public boolean decryptDetached(final @NotNull ByteBuffer     dstPlain,
+                                   final @NotNull ByteBuffer     srcCipher,
+                                   final @NotNull ByteBuffer     srcMac,
+                                   final @NotNull ByteBuffer     ad,
+                                   final @NotNull ByteBuffer     nonce,
+                                   final @NotNull PrecomputedKey key)
+            throws StodiumException {
+        throw new UnsupportedOperationException("Stodium: precomputed keys are not supported");
+    }
+
+    /**
+     *
+     * @param dstPlain
+     * @param srcCipher
+     * @param ad
+     * @param nonce
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public boolean decrypt(final @NotNull ByteBuffer     dstPlain,
+                           final @NotNull ByteBuffer     srcCipher,
+                           final @NotNull ByteBuffer     ad,
+                           final @NotNull ByteBuffer     nonce,
+                           final @NotNull PrecomputedKey key)
+            throws StodiumException {
+        throw new UnsupportedOperationException("Stodium: precomputed keys are not supported");
+    }
+
+    //
+    // byte[] overloads
+    //
+
+    /**
+     * encryptDetached is the byte[] counterpart of the ByteBuffer based
+     * encryptDetached method. It writes srcPlainLength bytes of cipher text to
+     * dstCipher and {@link #aBytes()} bytes of mac to dstMac.
+     *
+     * @param dstCipher
+     * @param dstCipherOffset
+     * @param dstMac
+     * @param dstMacOffset
+     * @param srcPlain
+     * @param srcPlainOffset
+     * @param srcPlainLength
+     * @param ad
+     * @param adOffset
+     * @param adLength
+     * @param nonce
+     * @param nonceOffset
+     * @param key
+     * @param keyOffset
+     * @throws StodiumException
+     */
+    public final void encryptDetached(final @NotNull  byte[] dstCipher,
+                                      final           int    dstCipherOffset,
+                                      final @NotNull  byte[] dstMac,
+                                      final           int    dstMacOffset,
+                                      final @NotNull  byte[] srcPlain,
+                                      final           int    srcPlainOffset,
+                                      final           int    srcPlainLength,
+                                      final @Nullable byte[] ad,
+                                      final           int    adOffset,
+                                      final           int    adLength,
+                                      final @NotNull  byte[] nonce,
+                                      final           int    nonceOffset,
+                                      final @NotNull  byte[] key,
+                                      final           int    keyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcPlain.length, srcPlainOffset, srcPlainLength);
+        Stodium.checkOffsetParams(dstCipher.length, dstCipherOffset, srcPlainLength);
+        Stodium.checkOffsetParams(dstMac.length, dstMacOffset, ABYTES);
+        Stodium.checkOffsetParams(ad == null ? 0 : ad.length, adOffset, adLength);
+        Stodium.checkOffsetParams(nonce.length, nonceOffset, NPUBBYTES);
+        Stodium.checkOffsetParams(key.length, keyOffset, KEYBYTES);
+
+        Stodium.checkStatus(nativeEncryptDetached(
+                dstCipher, dstCipherOffset, srcPlainLength,
+                dstMac, dstMacOffset, ABYTES,
+                srcPlain, srcPlainOffset, srcPlainLength,
+                ad, adOffset, adLength,
+                nonce, nonceOffset, NPUBBYTES,
+                key, keyOffset, KEYBYTES));
+    }
+
+    /**
+     * encrypt is the byte[] counterpart of the ByteBuffer based encrypt method.
+     * It writes srcPlainLength + {@link #aBytes()} bytes to dstCipher.
+     *
+     * @param dstCipher
+     * @param dstCipherOffset
+     * @param srcPlain
+     * @param srcPlainOffset
+     * @param srcPlainLength
+     * @param ad
+     * @param adOffset
+     * @param adLength
+     * @param nonce
+     * @param nonceOffset
+     * @param key
+     * @param keyOffset
+     * @throws StodiumException
+     */
+    public final void encrypt(final @NotNull  byte[] dstCipher,
+                              final           int    dstCipherOffset,
+                              final @NotNull  byte[] srcPlain,
+                              final           int    srcPlainOffset,
+                              final           int    srcPlainLength,
+                              final @Nullable byte[] ad,
+                              final           int    adOffset,
+                              final           int    adLength,
+                              final @NotNull  byte[] nonce,
+                              final           int    nonceOffset,
+                              final @NotNull  byte[] key,
+                              final           int    keyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcPlain.length, srcPlainOffset, srcPlainLength);
+        Stodium.checkOffsetParams(dstCipher.length, dstCipherOffset, srcPlainLength + ABYTES);
+        Stodium.checkOffsetParams(ad == null ? 0 : ad.length, adOffset, adLength);
+        Stodium.checkOffsetParams(nonce.length, nonceOffset, NPUBBYTES);
+        Stodium.checkOffsetParams(key.length, keyOffset, KEYBYTES);
+
+        Stodium.checkStatus(nativeEncrypt(
+                dstCipher, dstCipherOffset, srcPlainLength + ABYTES,
+                srcPlain, srcPlainOffset, srcPlainLength,
+                ad, adOffset, adLength,
+                nonce, nonceOffset, NPUBBYTES,
+                key, keyOffset, KEYBYTES));
+    }
+
+    /**
+     * decryptDetached is the byte[] counterpart of the ByteBuffer based
+     * decryptDetached method. It writes srcCipherLength bytes of plain text to
+     * dstPlain.
+     *
+     * @param dstPlain
+     * @param dstPlainOffset
+     * @param srcCipher
+     * @param srcCipherOffset
+     * @param srcCipherLength
+     * @param srcMac
+     * @param srcMacOffset
+     * @param ad
+     * @param adOffset
+     * @param adLength
+     * @param nonce
+     * @param nonceOffset
+     * @param key
+     * @param keyOffset
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean decryptDetached(final @NotNull  byte[] dstPlain,
+                                         final           int    dstPlainOffset,
+                                         final @NotNull  byte[] srcCipher,
+                                         final           int    srcCipherOffset,
+                                         final           int    srcCipherLength,
+                                         final @NotNull  byte[] srcMac,
+                                         final           int    srcMacOffset,
+                                         final @Nullable byte[] ad,
+                                         final           int    adOffset,
+                                         final           int    adLength,
+                                         final @NotNull  byte[] nonce,
+                                         final           int    nonceOffset,
+                                         final @NotNull  byte[] key,
+                                         final           int    keyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcCipher.length, srcCipherOffset, srcCipherLength);
+        Stodium.checkOffsetParams(dstPlain.length, dstPlainOffset, srcCipherLength);
+        Stodium.checkOffsetParams(srcMac.length, srcMacOffset, ABYTES);
+        Stodium.checkOffsetParams(ad == null ? 0 : ad.length, adOffset, adLength);
+        Stodium.checkOffsetParams(nonce.length, nonceOffset, NPUBBYTES);
+        Stodium.checkOffsetParams(key.length, keyOffset, KEYBYTES);
+
+        return StodiumJNI.NOERR == nativeDecryptDetached(
+                dstPlain, dstPlainOffset, srcCipherLength,
+                srcCipher, srcCipherOffset, srcCipherLength,
+                srcMac, srcMacOffset, ABYTES,
+                ad, adOffset, adLength,
+                nonce, nonceOffset, NPUBBYTES,
+                key, keyOffset, KEYBYTES);
+    }
+
+    /**
+     * decrypt is the byte[] counterpart of the ByteBuffer based decrypt method.
+     * It writes srcCipherLength - {@link #aBytes()} bytes to dstPlain.
+     *
+     * @param dstPlain
+     * @param dstPlainOffset
+     * @param srcCipher
+     * @param srcCipherOffset
+     * @param srcCipherLength
+     * @param ad
+     * @param adOffset
+     * @param adLength
+     * @param nonce
+     * @param nonceOffset
+     * @param key
+     * @param keyOffset
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean decrypt(final @NotNull  byte[] dstPlain,
+                                 final           int    dstPlainOffset,
+                                 final @NotNull  byte[] srcCipher,
+                                 final           int    srcCipherOffset,
+                                 final           int    srcCipherLength,
+                                 final @Nullable byte[] ad,
+                                 final           int    adOffset,
+                                 final           int    adLength,
+                                 final @NotNull  byte[] nonce,
+                                 final           int    nonceOffset,
+                                 final @NotNull  byte[] key,
+                                 final           int    keyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcCipher.length, srcCipherOffset, srcCipherLength);
+        Stodium.checkSizeMin(srcCipherLength, ABYTES);
+        Stodium.checkOffsetParams(dstPlain.length, dstPlainOffset, srcCipherLength - ABYTES);
+        Stodium.checkOffsetParams(ad == null ? 0 : ad.length, adOffset, adLength);
+        Stodium.checkOffsetParams(nonce.length, nonceOffset, NPUBBYTES);
+        Stodium.checkOffsetParams(key.length, keyOffset, KEYBYTES);
+
+        return StodiumJNI.NOERR == nativeDecrypt(
+                dstPlain, dstPlainOffset, srcCipherLength - ABYTES,
+                srcCipher, srcCipherOffset, srcCipherLength,
+                ad, adOffset, adLength,
+                nonce, nonceOffset, NPUBBYTES,
+                key, keyOffset, KEYBYTES);
+    }
+
+    //
+    // byte[] bindings, implemented by the primitives
+    //
+
+    abstract int nativeEncryptDetached(final @NotNull  byte[] dstCipher,
+                                       final           int    dstCipherOffset,
+                                       final           int    dstCipherLength,
+                                       final @NotNull  byte[] dstMac,
+                                       final           int    dstMacOffset,
+                                       final           int    dstMacLength,
+                                       final @NotNull  byte[] srcPlain,
+                                       final           int    srcPlainOffset,
+                                       final           int    srcPlainLength,
+                                       final @Nullable byte[] ad,
+                                       final           int    adOffset,
+                                       final           int    adLength,
+                                       final @NotNull  byte[] nonce,
+                                       final           int    nonceOffset,
+                                       final           int    nonceLength,
+                                       final @NotNull  byte[] key,
+                                       final           int    keyOffset,
+                                       final           int    keyLength);
+
+    abstract int nativeEncrypt(final @NotNull  byte[] dstCipher,
+                               final           int    dstCipherOffset,
+                               final           int    dstCipherLength,
+                               final @NotNull  byte[] srcPlain,
+                               final           int    srcPlainOffset,
+                               final           int    srcPlainLength,
+                               final @Nullable byte[] ad,
+                               final           int    adOffset,
+                               final           int    adLength,
+                               final @NotNull  byte[] nonce,
+                               final           int    nonceOffset,
+                               final           int    nonceLength,
+                               final @NotNull  byte[] key,
+                               final           int    keyOffset,
+                               final           int    keyLength);
+
+    abstract int nativeDecryptDetached(final @NotNull  byte[] dstPlain,
+                                       final           int    dstPlainOffset,
+                                       final           int    dstPlainLength,
+                                       final @NotNull  byte[] srcCipher,
+                                       final           int    srcCipherOffset,
+                                       final           int    srcCipherLength,
+                                       final @NotNull  byte[] srcMac,
+                                       final           int    srcMacOffset,
+                                       final           int    srcMacLength,
+                                       final @Nullable byte[] ad,
+                                       final           int    adOffset,
+                                       final           int    adLength,
+                                       final @NotNull  byte[] nonce,
+                                       final           int    nonceOffset,
+                                       final           int    nonceLength,
+                                       final @NotNull  byte[] key,
+                                       final           int    keyOffset,
+                                       final           int    keyLength);
+
+    abstract int nativeDecrypt(final @NotNull  byte[] dstPlain,
+                               final           int    dstPlainOffset,
+                               final           int    dstPlainLength,
+                               final @NotNull  byte[] srcCipher,
+                               final           int    srcCipherOffset,
+                               final           int    srcCipherLength,
+                               final @Nullable byte[] ad,
+                               final           int    adOffset,
+                               final           int    adLength,
+                               final @NotNull  byte[] nonce,
+                               final           int    nonceOffset,
+                               final           int    nonceLength,
+                               final @NotNull  byte[] key,
+                               final           int    keyOffset,
+                               final           int    keyLength);
+
+    //
+    // raw address overloads
+    //
+
+    /**
+     * encryptDetached is the raw address counterpart of the ByteBuffer based
+     * encryptDetached method, for memory managed by the caller. It writes
+     * srcPlainLength bytes of cipher text to dstCipher and {@link #aBytes()}
+     * bytes of mac to dstMac. The ad may be omitted by passing 0 for both the
+     * address and its length.
+     *
+     * @param dstCipher
+     * @param dstCipherLength
+     * @param dstMac
+     * @param srcPlain
+     * @param srcPlainLength
+     * @param ad
+     * @param adLength
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public final void encryptDetached(final long dstCipher,
+                                      final int  dstCipherLength,
+                                      final long dstMac,
+                                      final long srcPlain,
+                                      final int  srcPlainLength,
+                                      final long ad,
+                                      final int  adLength,
+                                      final long nonce,
+                                      final long key)
+            throws StodiumException {
+        Stodium.checkAddress(srcPlain, srcPlainLength);
+        Stodium.checkAddress(dstCipher, dstCipherLength);
+        Stodium.checkSizeMin(dstCipherLength, srcPlainLength);
+        Stodium.checkAddress(dstMac, ABYTES);
+        Stodium.checkOptionalAddress(ad, adLength);
+        Stodium.checkAddress(nonce, NPUBBYTES);
+        Stodium.checkAddress(key, KEYBYTES);
+
+        Stodium.checkStatus(nativeEncryptDetached(
+                dstCipher, srcPlainLength,
+                dstMac, ABYTES,
+                srcPlain, srcPlainLength,
+                ad, adLength,
+                nonce, NPUBBYTES,
+                key, KEYBYTES));
+    }
+
+    /**
+     * encrypt is the raw address counterpart of the ByteBuffer based encrypt
+     * method. It writes srcPlainLength + {@link #aBytes()} bytes to dstCipher.
+     *
+     * @param dstCipher
+     * @param dstCipherLength
+     * @param srcPlain
+     * @param srcPlainLength
+     * @param ad
+     * @param adLength
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public final void encrypt(final long dstCipher,
+                              final int  dstCipherLength,
+                              final long srcPlain,
+                              final int  srcPlainLength,
+                              final long ad,
+                              final int  adLength,
+                              final long nonce,
+                              final long key)
+            throws StodiumException {
+        Stodium.checkAddress(srcPlain, srcPlainLength);
+        Stodium.checkAddress(dstCipher, dstCipherLength);
+        Stodium.checkSizeMin(dstCipherLength, srcPlainLength + ABYTES);
+        Stodium.checkOptionalAddress(ad, adLength);
+        Stodium.checkAddress(nonce, NPUBBYTES);
+        Stodium.checkAddress(key, KEYBYTES);
+
+        Stodium.checkStatus(nativeEncrypt(
+                dstCipher, srcPlainLength + ABYTES,
+                srcPlain, srcPlainLength,
+                ad, adLength,
+                nonce, NPUBBYTES,
+                key, KEYBYTES));
+    }
+
+    /**
+     * decryptDetached is the raw address counterpart of the ByteBuffer based
+     * decryptDetached method. It writes srcCipherLength bytes of plain text to
+     * dstPlain.
+     *
+     * @param dstPlain
+     * @param dstPlainLength
+     * @param srcCipher
+     * @param srcCipherLength
+     * @param srcMac
+     * @param ad
+     * @param adLength
+     * @param nonce
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean decryptDetached(final long dstPlain,
+                                         final int  dstPlainLength,
+                                         final long srcCipher,
+                                         final int  srcCipherLength,
+                                         final long srcMac,
+                                         final long ad,
+                                         final int  adLength,
+                                         final long nonce,
+                                         final long key)
+            throws StodiumException {
+        Stodium.checkAddress(srcCipher, srcCipherLength);
+        Stodium.checkAddress(dstPlain, dstPlainLength);
+        Stodium.checkSizeMin(dstPlainLength, srcCipherLength);
+        Stodium.checkAddress(srcMac, ABYTES);
+        Stodium.checkOptionalAddress(ad, adLength);
+        Stodium.checkAddress(nonce, NPUBBYTES);
+        Stodium.checkAddress(key, KEYBYTES);
+
+        return StodiumJNI.NOERR == nativeDecryptDetached(
+                dstPlain, srcCipherLength,
+                srcCipher, srcCipherLength,
+                srcMac, ABYTES,
+                ad, adLength,
+                nonce, NPUBBYTES,
+                key, KEYBYTES);
+    }
+
+    /**
+     * decrypt is the raw address counterpart of the ByteBuffer based decrypt
+     * method. It writes srcCipherLength - {@link #aBytes()} bytes to dstPlain.
+     *
+     * @param dstPlain
+     * @param dstPlainLength
+     * @param srcCipher
+     * @param srcCipherLength
+     * @param ad
+     * @param adLength
+     * @param nonce
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean decrypt(final long dstPlain,
+                                 final int  dstPlainLength,
+                                 final long srcCipher,
+                                 final int  srcCipherLength,
+                                 final long ad,
+                                 final int  adLength,
+                                 final long nonce,
+                                 final long key)
+            throws StodiumException {
+        Stodium.checkAddress(srcCipher, srcCipherLength);
+        Stodium.checkSizeMin(srcCipherLength, ABYTES);
+        Stodium.checkAddress(dstPlain, dstPlainLength);
+        Stodium.checkSizeMin(dstPlainLength, srcCipherLength - ABYTES);
+        Stodium.checkOptionalAddress(ad, adLength);
+        Stodium.checkAddress(nonce, NPUBBYTES);
+        Stodium.checkAddress(key, KEYBYTES);
+
+        return StodiumJNI.NOERR == nativeDecrypt(
+                dstPlain, srcCipherLength - ABYTES,
+                srcCipher, srcCipherLength,
+                ad, adLength,
+                nonce, NPUBBYTES,
+                key, KEYBYTES);
+    }
+
+    //
+    // raw address bindings, implemented by the primitives
+    //
+
+    abstract int nativeEncryptDetached(final long dstCipher,
+                                       final int  dstCipherLength,
+                                       final long dstMac,
+                                       final int  dstMacLength,
+                                       final long srcPlain,
+                                       final int  srcPlainLength,
+                                       final long ad,
+                                       final int  adLength,
+                                       final long nonce,
+                                       final int  nonceLength,
+                                       final long key,
+                                       final int  keyLength);
+
+    abstract int nativeEncrypt(final long dstCipher,
+                               final int  dstCipherLength,
+                               final long srcPlain,
+                               final int  srcPlainLength,
+                               final long ad,
+                               final int  adLength,
+                               final long nonce,
+                               final int  nonceLength,
+                               final long key,
+                               final int  keyLength);
+
+    abstract int nativeDecryptDetached(final long dstPlain,
+                                       final int  dstPlainLength,
+                                       final long srcCipher,
+                                       final int  srcCipherLength,
+                                       final long srcMac,
+                                       final int  srcMacLength,
+                                       final long ad,
+                                       final int  adLength,
+                                       final long nonce,
+                                       final int  nonceLength,
+                                       final long key,
+                                       final int  keyLength);
+
+    abstract int nativeDecrypt(final long dstPlain,
+                               final int  dstPlainLength,
+                               final long srcCipher,
+                               final int  srcCipherLength,
+                               final long ad,
+                               final int  adLength,
+                               final long nonce,
+                               final int  nonceLength,
+                               final long key,
+                               final int  keyLength);
+
+    //
+    // key handles
+    //
+
+    /**
+     * encryptDetached is the {@link KeyHandle} counterpart of the ByteBuffer
+     * based encryptDetached method, reading the key from guarded native
+     * memory.
+     *
+     * @param dstCipher
+     * @param dstMac
+     * @param srcPlain
+     * @param ad
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public final void encryptDetached(final @NotNull ByteBuffer dstCipher,
+                                      final @NotNull ByteBuffer dstMac,
+                                      final @NotNull ByteBuffer srcPlain,
+                                      final @NotNull ByteBuffer ad,
+                                      final @NotNull ByteBuffer nonce,
+                                      final @NotNull KeyHandle  key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstCipher);
+        Stodium.checkDestinationWritable(dstMac);
+
+        Stodium.checkSizeMin(dstCipher.remaining(), srcPlain.remaining());
+        Stodium.checkSizeMin(dstMac.remaining(), ABYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NPUBBYTES);
+        Stodium.checkSize(key.length(), KEYBYTES);
+
+        Stodium.checkStatus(key.call(new NativeResource.Call() {
+            @Override
+            public int run(final long handle) {
+                return nativeEncryptDetached(
+                        Stodium.ensureUsableByteBuffer(dstCipher),
+                        Stodium.ensureUsableByteBuffer(dstMac),
+                        Stodium.ensureUsableByteBuffer(srcPlain),
+                        Stodium.ensureUsableByteBuffer(ad),
+                        Stodium.ensureUsableByteBuffer(nonce),
+                        handle);
+            }
+        }));
+    }
+
+    /**
+     * encrypt is the {@link KeyHandle} counterpart of the ByteBuffer based
+     * encrypt method.
+     *
+     * @param dstCipher
+     * @param srcPlain
+     * @param ad
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public final void encrypt(final @NotNull ByteBuffer dstCipher,
+                              final @NotNull ByteBuffer srcPlain,
+                              final @NotNull ByteBuffer ad,
+                              final @NotNull ByteBuffer nonce,
+                              final @NotNull KeyHandle  key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstCipher);
+
+        Stodium.checkSizeMin(dstCipher.remaining(), srcPlain.remaining() + ABYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NPUBBYTES);
+        Stodium.checkSize(key.length(), KEYBYTES);
+
+        Stodium.checkStatus(key.call(new NativeResource.Call() {
+            @Override
+            public int run(final long handle) {
+                return nativeEncrypt(
+                        Stodium.ensureUsableByteBuffer(dstCipher),
+                        Stodium.ensureUsableByteBuffer(srcPlain),
+                        Stodium.ensureUsableByteBuffer(ad),
+                        Stodium.ensureUsableByteBuffer(nonce),
+                        handle);
+            }
+        }));
+    }
+
+    /**
+     * decryptDetached is the {@link KeyHandle} counterpart of the ByteBuffer
+     * based decryptDetached method.
+     *
+     * @param dstPlain
+     * @param srcCipher
+     * @param srcMac
+     * @param ad
+     * @param nonce
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean decryptDetached(final @NotNull ByteBuffer dstPlain,
+                                         final @NotNull ByteBuffer srcCipher,
+                                         final @NotNull ByteBuffer srcMac,
+                                         final @NotNull ByteBuffer ad,
+                                         final @NotNull ByteBuffer nonce,
+                                         final @NotNull KeyHandle  key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstPlain);
+
+        Stodium.checkSizeMin(dstPlain.remaining(), srcCipher.remaining());
+        Stodium.checkSizeMin(srcMac.remaining(), ABYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NPUBBYTES);
+        Stodium.checkSize(key.length(), KEYBYTES);
+
+        return StodiumJNI.NOERR == key.call(new NativeResource.Call() {
+            @Override
+            public int run(final long handle) {
+                return nativeDecryptDetached(
+                        Stodium.ensureUsableByteBuffer(dstPlain),
+                        Stodium.ensureUsableByteBuffer(srcCipher),
+                        Stodium.ensureUsableByteBuffer(srcMac),
+                        Stodium.ensureUsableByteBuffer(ad),
+                        Stodium.ensureUsableByteBuffer(nonce),
+                        handle);
+            }
+        });
+    }
+
+    /**
+     * decrypt is the {@link KeyHandle} counterpart of the ByteBuffer based
+     * decrypt method.
+     *
+     * @param dstPlain
+     * @param srcCipher
+     * @param ad
+     * @param nonce
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean decrypt(final @NotNull ByteBuffer dstPlain,
+                                 final @NotNull ByteBuffer srcCipher,
+                                 final @NotNull ByteBuffer ad,
+                                 final @NotNull ByteBuffer nonce,
+                                 final @NotNull KeyHandle  key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstPlain);
+
+        Stodium.checkSizeMin(srcCipher.remaining(), dstPlain.remaining() + ABYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NPUBBYTES);
+        Stodium.checkSize(key.length(), KEYBYTES);
+
+        return StodiumJNI.NOERR == key.call(new NativeResource.Call() {
+            @Override
+            public int run(final long handle) {
+                return nativeDecrypt(
+                        Stodium.ensureUsableByteBuffer(dstPlain),
+                        Stodium.ensureUsableByteBuffer(srcCipher),
+                        Stodium.ensureUsableByteBuffer(ad),
+                        Stodium.ensureUsableByteBuffer(nonce),
+                        handle);
+            }
+        });
+    }
+
+    //
+    // key handle bindings, implemented by the primitives
+    //
+
+    abstract int nativeEncryptDetached(final @NotNull ByteBuffer dstCipher,
+                                       final @NotNull ByteBuffer dstMac,
+                                       final @NotNull ByteBuffer srcPlain,
+                                       final @NotNull ByteBuffer ad,
+                                       final @NotNull ByteBuffer nonce,
+                                       final          long       key);
+
+    abstract int nativeEncrypt(final @NotNull ByteBuffer dstCipher,
+                               final @NotNull ByteBuffer srcPlain,
+                               final @NotNull ByteBuffer ad,
+                               final @NotNull ByteBuffer nonce,
+                               final          long       key);
+
+    abstract int nativeDecryptDetached(final @NotNull ByteBuffer dstPlain,
+                                       final @NotNull ByteBuffer srcCipher,
+                                       final @NotNull ByteBuffer srcMac,
+                                       final @NotNull ByteBuffer ad,
+                                       final @NotNull ByteBuffer nonce,
+                                       final          long       key);
+
+    abstract int nativeDecrypt(final @NotNull ByteBuffer dstPlain,
+                               final @NotNull ByteBuffer srcCipher,
+                               final @NotNull ByteBuffer ad,
+                               final @NotNull ByteBuffer nonce,
+                               final          long       key);
+
+    //
+    // batch operations
+    //
+
+    /**
+     * encryptBatch encrypts a batch of messages with the same key in a single
+     * call to the native code, which avoids paying the JNI transition for every
+     * message when encrypting many small packets.
+     * <p>
+     * Message i is read from srcPlain at srcOffsets[i] (relative to the
+     * buffer's position) for srcLengths[i] bytes, and its cipher text of
+     * srcLengths[i] + {@link #aBytes()} bytes is written to dstCipher at
+     * dstOffsets[i]. Its nonce is the i-th block of {@link #npubBytes()}
+     * bytes in nonces. The additional data is read from ad in the same way as
+     * the plain text, or omitted when ad, adOffsets and adLengths are all
+     * null.
+     * <p>
+     * The length of status determines the number of messages, and must match
+     * the length of every offset and length array. The status of every message
+     * is written to status, using {@link StodiumJNI#NOERR} for success.
+     *
+     * @param dstCipher
+     * @param dstOffsets
+     * @param srcPlain
+     * @param srcOffsets
+     * @param srcLengths
+     * @param ad
+     * @param adOffsets
+     * @param adLengths
+     * @param nonces
+     * @param key
+     * @param status
+     * @return the number of messages that failed
+     * @throws StodiumException
+     */
+    public final int encryptBatch(final @NotNull  ByteBuffer dstCipher,
+                                  final @NotNull  int[]      dstOffsets,
+                                  final @NotNull  ByteBuffer srcPlain,
+                                  final @NotNull  int[]      srcOffsets,
+                                  final @NotNull  int[]      srcLengths,
+                                  final @Nullable ByteBuffer ad,
+                                  final @Nullable int[]      adOffsets,
+                                  final @Nullable int[]      adLengths,
+                                  final @NotNull  ByteBuffer nonces,
+                                  final @NotNull  ByteBuffer key,
+                                  final @NotNull  int[]      status)
+            throws StodiumException {
+        checkBatch(dstCipher, dstOffsets, ABYTES,
+                srcPlain, srcOffsets, srcLengths,
+                ad, adOffsets, adLengths,
+                nonces, key, status);
+
+        return nativeEncryptBatch(
+                Stodium.ensureUsableByteBuffer(dstCipher), dstOffsets,
+                Stodium.ensureUsableByteBuffer(srcPlain), srcOffsets, srcLengths,
+                ad == null ? null : Stodium.ensureUsableByteBuffer(ad), adOffsets, adLengths,
+                Stodium.ensureUsableByteBuffer(nonces),
+                Stodium.ensureUsableByteBuffer(key),
+                status);
+    }
+
+    /**
+     * decryptBatch is the counterpart of
+     * {@link #encryptBatch(ByteBuffer, int[], ByteBuffer, int[], int[], ByteBuffer, int[], int[], ByteBuffer, ByteBuffer, int[])},
+     * decrypting and verifying a batch of messages in a single call to the
+     * native code. The plain text of message i, of srcLengths[i] -
+     * {@link #aBytes()} bytes, is written to dstPlain at dstOffsets[i].
+     * Messages that fail to verify have a non-zero status.
+     *
+     * @param dstPlain
+     * @param dstOffsets
+     * @param srcCipher
+     * @param srcOffsets
+     * @param srcLengths
+     * @param ad
+     * @param adOffsets
+     * @param adLengths
+     * @param nonces
+     * @param key
+     * @param status
+     * @return the number of messages that failed to decrypt
+     * @throws StodiumException
+     */
+    public final int decryptBatch(final @NotNull  ByteBuffer dstPlain,
+                                  final @NotNull  int[]      dstOffsets,
+                                  final @NotNull  ByteBuffer srcCipher,
+                                  final @NotNull  int[]      srcOffsets,
+                                  final @NotNull  int[]      srcLengths,
+                                  final @Nullable ByteBuffer ad,
+                                  final @Nullable int[]      adOffsets,
+                                  final @Nullable int[]      adLengths,
+                                  final @NotNull  ByteBuffer nonces,
+                                  final @NotNull  ByteBuffer key,
+                                  final @NotNull  int[]      status)
+            throws StodiumException {
+        checkBatch(dstPlain, dstOffsets, -ABYTES,
+                srcCipher, srcOffsets, srcLengths,
+                ad, adOffsets, adLengths,
+                nonces, key, status);
+
+        return nativeDecryptBatch(
+                Stodium.ensureUsableByteBuffer(dstPlain), dstOffsets,
+                Stodium.ensureUsableByteBuffer(srcCipher), srcOffsets, srcLengths,
+                ad == null ? null : Stodium.ensureUsableByteBuffer(ad), adOffsets, adLengths,
+                Stodium.ensureUsableByteBuffer(nonces),
+                Stodium.ensureUsableByteBuffer(key),
+                status);
+    }
+
+    /**
+     * checkBatch validates the descriptors of a batch up front, as the native
+     * code trusts them. dstDelta is the difference between the length of the
+     * output and the input of every message.
+     */
+    private void checkBatch(final @NotNull  ByteBuffer dst,
+                            final @NotNull  int[]      dstOffsets,
+                            final           int        dstDelta,
+                            final @NotNull  ByteBuffer src,
+                            final @NotNull  int[]      srcOffsets,
+                            final @NotNull  int[]      srcLengths,
+                            final @Nullable ByteBuffer ad,
+                            final @Nullable int[]      adOffsets,
+                            final @Nullable int[]      adLengths,
+                            final @NotNull  ByteBuffer nonces,
+                            final @NotNull  ByteBuffer key,
+                            final @NotNull  int[]      status)
+            throws StodiumException {
+        final long count = status.length;
+
+        Stodium.checkDestinationWritable(dst);
+
+        Stodium.checkSize(dstOffsets.length, count, count);
+        Stodium.checkSize(srcOffsets.length, count, count);
+        Stodium.checkSize(srcLengths.length, count, count);
+        if (ad != null || adOffsets != null || adLengths != null) {
+            if (ad == null || adOffsets == null || adLengths == null) {
+                throw new ConstraintViolationException("AEAD: ad, adOffsets and adLengths must be passed together");
+            }
+            Stodium.checkSize(adOffsets.length, count, count);
+            Stodium.checkSize(adLengths.length, count, count);
+        }
+        Stodium.checkSize(nonces.remaining(), count * NPUBBYTES, Integer.MAX_VALUE);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+
+        for (int i = 0; i < count; i++) {
+            Stodium.checkSizeMin(srcLengths[i], dstDelta < 0 ? -dstDelta : 0);
+            Stodium.checkOffsetParams(src.remaining(), srcOffsets[i], srcLengths[i]);
+            Stodium.checkOffsetParams(dst.remaining(), dstOffsets[i], srcLengths[i] + dstDelta);
+            if (ad != null) {
+                Stodium.checkOffsetParams(ad.remaining(), adOffsets[i], adLengths[i]);
+            }
+        }
+    }
+
+    //
+    // batch bindings, implemented by the primitives
+    //
+
+    abstract int nativeEncryptBatch(final @NotNull  ByteBuffer dstCipher,
+                                    final @NotNull  int[]      dstOffsets,
+                                    final @NotNull  ByteBuffer srcPlain,
+                                    final @NotNull  int[]      srcOffsets,
+                                    final @NotNull  int[]      srcLengths,
+                                    final @Nullable ByteBuffer ad,
+                                    final @Nullable int[]      adOffsets,
+                                    final @Nullable int[]      adLengths,
+                                    final @NotNull  ByteBuffer nonces,
+                                    final @NotNull  ByteBuffer key,
+                                    final @NotNull  int[]      status);
+
+    abstract int nativeDecryptBatch(final @NotNull  ByteBuffer dstPlain,
+                                    final @NotNull  int[]      dstOffsets,
+                                    final @NotNull  ByteBuffer srcCipher,
+                                    final @NotNull  int[]      srcOffsets,
+                                    final @NotNull  int[]      srcLengths,
+                                    final @Nullable ByteBuffer ad,
+                                    final @Nullable int[]      adOffsets,
+                                    final @Nullable int[]      adLengths,
+                                    final @NotNull  ByteBuffer nonces,
+                                    final @NotNull  ByteBuffer key,
+                                    final @NotNull  int[]      status);
+
+    //
+    // scatter/gather
+    //
+
+    /**
+     * encryptDetached is the scatter/gather counterpart of the ByteBuffer
+     * based encryptDetached method. The plain text is read from the buffers of
+     * srcPlain in order, as if they were concatenated, and the cipher text is
+     * written across the buffers of dstCipher, whose boundaries do not have to
+     * match those of srcPlain. This avoids copying a message that is made up
+     * of several parts into a single buffer first.
+     * <p>
+     * Only supported by the ChaCha20-Poly1305 constructions; AES-256-GCM
+     * throws an UnsupportedOperationException.
+     *
+     * @param dstCipher
+     * @param dstMac
+     * @param srcPlain
+     * @param ad
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public final void encryptDetached(final @NotNull ByteBuffer[] dstCipher,
+                                      final @NotNull ByteBuffer   dstMac,
+                                      final @NotNull ByteBuffer[] srcPlain,
+                                      final @NotNull ByteBuffer   ad,
+                                      final @NotNull ByteBuffer   nonce,
+                                      final @NotNull ByteBuffer   key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstCipher);
+        Stodium.checkDestinationWritable(dstMac);
+
+        Stodium.checkSize(Stodium.remaining(dstCipher), Stodium.remaining(srcPlain), Long.MAX_VALUE);
+        Stodium.checkSizeMin(dstMac.remaining(), ABYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NPUBBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+
+        Stodium.checkStatus(nativeEncryptDetached(
+                dstCipher,
+                Stodium.ensureUsableByteBuffer(dstMac),
+                Stodium.ensureUsableByteBuffers(srcPlain, 0, srcPlain.length),
+                Stodium.ensureUsableByteBuffer(ad),
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * decryptDetached is the scatter/gather counterpart of the ByteBuffer
+     * based decryptDetached method, see
+     * {@link #encryptDetached(ByteBuffer[], ByteBuffer, ByteBuffer[], ByteBuffer, ByteBuffer, ByteBuffer)}.
+     * The MAC is verified over all of srcCipher before any plain text is
+     * written, so dstPlain is left untouched if verification fails.
+     *
+     * @param dstPlain
+     * @param srcCipher
+     * @param srcMac
+     * @param ad
+     * @param nonce
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean decryptDetached(final @NotNull ByteBuffer[] dstPlain,
+                                         final @NotNull ByteBuffer[] srcCipher,
+                                         final @NotNull ByteBuffer   srcMac,
+                                         final @NotNull ByteBuffer   ad,
+                                         final @NotNull ByteBuffer   nonce,
+                                         final @NotNull ByteBuffer   key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstPlain);
+
+        Stodium.checkSize(Stodium.remaining(dstPlain), Stodium.remaining(srcCipher), Long.MAX_VALUE);
+        Stodium.checkSizeMin(srcMac.remaining(), ABYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NPUBBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+
+        return StodiumJNI.NOERR == nativeDecryptDetached(
+                dstPlain,
+                Stodium.ensureUsableByteBuffers(srcCipher, 0, srcCipher.length),
+                Stodium.ensureUsableByteBuffer(srcMac),
+                Stodium.ensureUsableByteBuffer(ad),
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key));
+    }
+
+    //
+    // scatter/gather bindings, implemented by the primitives
+    //
+
+    abstract int nativeEncryptDetached(final @NotNull ByteBuffer[] dstCipher,
+                                       final @NotNull ByteBuffer   dstMac,
+                                       final @NotNull ByteBuffer[] srcPlain,
+                                       final @NotNull ByteBuffer   ad,
+                                       final @NotNull ByteBuffer   nonce,
+                                       final @NotNull ByteBuffer   key);
+
+    abstract int nativeDecryptDetached(final @NotNull ByteBuffer[] dstPlain,
+                                       final @NotNull ByteBuffer[] srcCipher,
+                                       final @NotNull ByteBuffer   srcMac,
+                                       final @NotNull ByteBuffer   ad,
+                                       final @NotNull ByteBuffer   nonce,
+                                       final @NotNull ByteBuffer   key);
+
+    //
+    // in-place
+    //
+
+    /**
+     * encryptInPlace encrypts the first plainLength bytes of buf within buf
+     * itself, replacing them by the cipher text followed by the MAC. buf must
+     * therefore have room for at least plainLength + {@link #aBytes()} bytes.
+     * The position and limit of buf are not changed.
+     *
+     * @param buf
+     * @param plainLength
+     * @param ad
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public final void encryptInPlace(final @NotNull ByteBuffer buf,
+                                     final          int        plainLength,
+                                     final @NotNull ByteBuffer ad,
+                                     final @NotNull ByteBuffer nonce,
+                                     final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(buf);
+
+        Stodium.checkSize(plainLength, 0, buf.remaining() - ABYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NPUBBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+
+        Stodium.checkStatus(nativeEncryptInPlace(
+                Stodium.ensureUsableByteBuffer(buf),
+                plainLength,
+                Stodium.ensureUsableByteBuffer(ad),
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * encryptDetachedInPlace replaces the remaining bytes of buf by their
+     * cipher text, and writes the MAC to dstMac.
+     *
+     * @param buf
+     * @param dstMac
+     * @param ad
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public final void encryptDetachedInPlace(final @NotNull ByteBuffer buf,
+                                             final @NotNull ByteBuffer dstMac,
+                                             final @NotNull ByteBuffer ad,
+                                             final @NotNull ByteBuffer nonce,
+                                             final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(buf);
+        Stodium.checkDestinationWritable(dstMac);
+
+        Stodium.checkSizeMin(dstMac.remaining(), ABYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NPUBBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+
+        Stodium.checkStatus(nativeEncryptDetachedInPlace(
+                Stodium.ensureUsableByteBuffer(buf),
+                Stodium.ensureUsableByteBuffer(dstMac),
+                Stodium.ensureUsableByteBuffer(ad),
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * decryptInPlace decrypts the cipher text and MAC held by the remaining
+     * bytes of buf. On success, the first buf.remaining() - {@link #aBytes()}
+     * bytes of buf hold the plain text; the bytes after it are left
+     * unspecified. If verification fails, the first buf.remaining() -
+     * {@link #aBytes()} bytes of buf are wiped, so the cipher text has to be
+     * kept elsewhere if it is still needed after a failed decryption.
+     *
+     * @param buf
+     * @param ad
+     * @param nonce
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean decryptInPlace(final @NotNull ByteBuffer buf,
+                                        final @NotNull ByteBuffer ad,
+                                        final @NotNull ByteBuffer nonce,
+                                        final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(buf);
+
+        Stodium.checkSizeMin(buf.remaining(), ABYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NPUBBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+
+        return StodiumJNI.NOERR == nativeDecryptInPlace(
+                Stodium.ensureUsableByteBuffer(buf),
+                Stodium.ensureUsableByteBuffer(ad),
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key));
+    }
+
+    /**
+     * decryptDetachedInPlace replaces the remaining bytes of buf by their
+     * plain text, after verifying them against srcMac. If verification
+     * fails, the remaining bytes of buf are wiped.
+     *
+     * @param buf
+     * @param srcMac
+     * @param ad
+     * @param nonce
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean decryptDetachedInPlace(final @NotNull ByteBuffer buf,
+                                                final @NotNull ByteBuffer srcMac,
+                                                final @NotNull ByteBuffer ad,
+                                                final @NotNull ByteBuffer nonce,
+                                                final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(buf);
+
+        Stodium.checkSizeMin(srcMac.remaining(), ABYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NPUBBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+
+        return StodiumJNI.NOERR == nativeDecryptDetachedInPlace(
+                Stodium.ensureUsableByteBuffer(buf),
+                Stodium.ensureUsableByteBuffer(srcMac),
+                Stodium.ensureUsableByteBuffer(ad),
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key));
+    }
+
+    //
+    // in-place bindings, implemented by the primitives
+    //
+
+    abstract int nativeEncryptInPlace(final @NotNull ByteBuffer buf,
+                                      final          int        plainLength,
+                                      final @NotNull ByteBuffer ad,
+                                      final @NotNull ByteBuffer nonce,
+                                      final @NotNull ByteBuffer key);
+
+    abstract int nativeEncryptDetachedInPlace(final @NotNull ByteBuffer buf,
+                                              final @NotNull ByteBuffer dstMac,
+                                              final @NotNull ByteBuffer ad,
+                                              final @NotNull ByteBuffer nonce,
+                                              final @NotNull ByteBuffer key);
+
+    abstract int nativeDecryptInPlace(final @NotNull ByteBuffer buf,
+                                      final @NotNull ByteBuffer ad,
+                                      final @NotNull ByteBuffer nonce,
+                                      final @NotNull ByteBuffer key);
+
+    abstract int nativeDecryptDetachedInPlace(final @NotNull ByteBuffer buf,
+                                              final @NotNull ByteBuffer srcMac,
+                                              final @NotNull ByteBuffer ad,
+                                              final @NotNull ByteBuffer nonce,
+                                              final @NotNull ByteBuffer key);
 }
@@ -8,11 +8,14 @@
 package eu.artemisc.stodium.aead;
 
 import org.jetbrains.annotations.NotNull;
+import org.jetbrains.annotations.Nullable;
 
 import java.nio.ByteBuffer;
 
+import eu.artemisc.stodium.NativeResource;
 import eu.artemisc.stodium.Stodium;
 import eu.artemisc.stodium.StodiumJNI;
+import eu.artemisc.stodium.exceptions.OperationFailedException;
 import eu.artemisc.stodium.exceptions.StodiumException;
 
 /**
@@ -123,4 +126,459 @@ final class Aes256Gcm
                 Stodium.ensureUsableByteBuffer(nonce),
                 Stodium.ensureUsableByteBuffer(key));
     }
+
+    @Override
+    public boolean supportsPrecompute() {
+        return true;
+    }
+
+    @NotNull
+    @Override
+    public PrecomputedKey precompute(final @NotNull ByteBuffer key)
+            throws StodiumException {
+        final long state;
+
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+
+        state = StodiumJNI.crypto_aead_aes256gcm_beforenm(
+                Stodium.ensureUsableByteBuffer(key));
+        if (state == 0L) {
+            throw new OperationFailedException("Stodium: aes256gcm key expansion failed");
+        }
+        return new PrecomputedKey(this, state);
+    }
+
+    @Override
+    public void encryptDetached(final @NotNull ByteBuffer     dstCipher,
+                                final @NotNull ByteBuffer     dstMac,
+                                final @NotNull ByteBuffer     srcPlain,
+                                final @NotNull ByteBuffer     ad,
+                                final @NotNull ByteBuffer     nonce,
+                                final @NotNull PrecomputedKey key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstCipher);
+        Stodium.checkDestinationWritable(dstMac);
+
+        Stodium.checkSizeMin(dstCipher.remaining(), srcPlain.remaining());
+        Stodium.checkSizeMin(nonce.remaining(), NPUBBYTES);
+
+        Stodium.checkStatus(key.call(this, new NativeResource.Call() {
+            @Override
+            public int run(final long state) {
+                return StodiumJNI.crypto_aead_aes256gcm_encrypt_detached_afternm(
+                        Stodium.ensureUsableByteBuffer(dstCipher),
+                        Stodium.ensureUsableByteBuffer(dstMac),
+                        Stodium.ensureUsableByteBuffer(srcPlain),
+                        Stodium.ensureUsableByteBuffer(ad),
+                        Stodium.ensureUsableByteBuffer(nonce),
+                        state);
+            }
+        }));
+    }
+
+    @Override
+    public void encrypt(final @NotNull ByteBuffer     dstCipher,
+                        final @NotNull ByteBuffer     srcPlain,
+                        final @NotNull ByteBuffer     ad,
+                        final @NotNull ByteBuffer     nonce,
+                        final @NotNull PrecomputedKey key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstCipher);
+
+        Stodium.checkSizeMin(dstCipher.remaining(), srcPlain.remaining() + ABYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NPUBBYTES);
+
+        Stodium.checkStatus(key.call(this, new NativeResource.Call() {
+            @Override
+            public int run(final long state) {
+                return StodiumJNI.crypto_aead_aes256gcm_encrypt_afternm(
+                        Stodium.ensureUsableByteBuffer(dstCipher),
+                        Stodium.ensureUsableByteBuffer(srcPlain),
+                        Stodium.ensureUsableByteBuffer(ad),
+                        Stodium.ensureUsableByteBuffer(nonce),
+                        state);
+            }
+        }));
+    }
+
+    @Override
+    public boolean decryptDetached(final @NotNull ByteBuffer     dstPlain,
+                                   final @NotNull ByteBuffer     srcCipher,
+                                   final @NotNull ByteBuffer     srcMac,
+                                   final @NotNull ByteBuffer     ad,
+                                   final @NotNull ByteBuffer     nonce,
+                                   final @NotNull PrecomputedKey key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstPlain);
+
+        Stodium.checkSizeMin(dstPlain.remaining(), srcCipher.remaining());
+        Stodium.checkSizeMin(nonce.remaining(), NPUBBYTES);
+
+        return StodiumJNI.NOERR == key.call(this, new NativeResource.Call() {
+            @Override
+            public int run(final long state) {
+                return StodiumJNI.crypto_aead_aes256gcm_decrypt_detached_afternm(
+                        Stodium.ensureUsableByteBuffer(dstPlain),
+                        Stodium.ensureUsableByteBuffer(srcCipher),
+                        Stodium.ensureUsableByteBuffer(srcMac),
+                        Stodium.ensureUsableByteBuffer(ad),
+                        Stodium.ensureUsableByteBuffer(nonce),
+                        state);
+            }
+        });
+    }
+
+    @Override
+    public boolean decrypt(final @NotNull ByteBuffer     dstPlain,
+                           final @NotNull ByteBuffer     srcCipher,
+                           final @NotNull ByteBuffer     ad,
+                           final @NotNull ByteBuffer     nonce,
+                           final @NotNull PrecomputedKey key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstPlain);
+
+        Stodium.checkSizeMin(srcCipher.remaining(), dstPlain.remaining() + ABYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NPUBBYTES);
+
+        return StodiumJNI.NOERR == key.call(this, new NativeResource.Call() {
+            @Override
+            public int run(final long state) {
+                return StodiumJNI.crypto_aead_aes256gcm_decrypt_afternm(
+                        Stodium.ensureUsableByteBuffer(dstPlain),
+                        Stodium.ensureUsableByteBuffer(srcCipher),
+                        Stodium.ensureUsableByteBuffer(ad),
+                        Stodium.ensureUsableByteBuffer(nonce),
+                        state);
+            }
+        });
+    }
+
+    @Override
+    int nativeEncryptDetached(final @NotNull  byte[] dstCipher,
+                              final           int    dstCipherOffset,
+                              final           int    dstCipherLength,
+                              final @NotNull  byte[] dstMac,
+                              final           int    dstMacOffset,
+                              final           int    dstMacLength,
+                              final @NotNull  byte[] srcPlain,
+                              final           int    srcPlainOffset,
+                              final           int    srcPlainLength,
+                              final @Nullable byte[] ad,
+                              final           int    adOffset,
+                              final           int    adLength,
+                              final @NotNull  byte[] nonce,
+                              final           int    nonceOffset,
+                              final           int    nonceLength,
+                              final @NotNull  byte[] key,
+                              final           int    keyOffset,
+                              final           int    keyLength) {
+        return StodiumJNI.crypto_aead_aes256gcm_encrypt_detached_array(
+                dstCipher, dstCipherOffset, dstCipherLength,
+                dstMac, dstMacOffset, dstMacLength,
+                srcPlain, srcPlainOffset, srcPlainLength,
+                ad, adOffset, adLength,
+                nonce, nonceOffset, nonceLength,
+                key, keyOffset, keyLength);
+    }
+
+    @Override
+    int nativeEncrypt(final @NotNull  byte[] dstCipher,
+                      final           int    dstCipherOffset,
+                      final           int    dstCipherLength,
+                      final @NotNull  byte[] srcPlain,
+                      final           int    srcPlainOffset,
+                      final           int    srcPlainLength,
+                      final @Nullable byte[] ad,
+                      final           int    adOffset,
+                      final           int    adLength,
+                      final @NotNull  byte[] nonce,
+                      final           int    nonceOffset,
+                      final           int    nonceLength,
+                      final @NotNull  byte[] key,
+                      final           int    keyOffset,
+                      final           int    keyLength) {
+        return StodiumJNI.crypto_aead_aes256gcm_encrypt_array(
+                dstCipher, dstCipherOffset, dstCipherLength,
+                srcPlain, srcPlainOffset, srcPlainLength,
+                ad, adOffset, adLength,
+                nonce, nonceOffset, nonceLength,
+                key, keyOffset, keyLength);
+    }
+
+    @Override
+    int nativeDecryptDetached(final @NotNull  byte[] dstPlain,
+                              final           int    dstPlainOffset,
+                              final           int    dstPlainLength,
+                              final @NotNull  byte[] srcCipher,
+                              final           int    srcCipherOffset,
+                              final           int    srcCipherLength,
+                              final @NotNull  byte[] srcMac,
+                              final           int    srcMacOffset,
+                              final           int    srcMacLength,
+                              final @Nullable byte[] ad,
+                              final           int    adOffset,
+                              final           int    adLength,
+                              final @NotNull  byte[] nonce,
+                              final           int    nonceOffset,
+                              final           int    nonceLength,
+                              final @NotNull  byte[] key,
+                              final           int    keyOffset,
+                              final           int    keyLength) {
+        return StodiumJNI.crypto_aead_aes256gcm_decrypt_detached_array(
+                dstPlain, dstPlainOffset, dstPlainLength,
+                srcCipher, srcCipherOffset, srcCipherLength,
+                srcMac, srcMacOffset, srcMacLength,
+                ad, adOffset, adLength,
+                nonce, nonceOffset, nonceLength,
+                key, keyOffset, keyLength);
+    }
+
+    @Override
+    int nativeDecrypt(final @NotNull  byte[] dstPlain,
+                      final           int    dstPlainOffset,
+                      final           int    dstPlainLength,
+                      final @NotNull  byte[] srcCipher,
+                      final           int    srcCipherOffset,
+                      final           int    srcCipherLength,
+                      final @Nullable byte[] ad,
+                      final           int    adOffset,
+                      final           int    adLength,
+                      final @NotNull  byte[] nonce,
+                      final           int    nonceOffset,
+                      final           int    nonceLength,
+                      final @NotNull  byte[] key,
+                      final           int    keyOffset,
+                      final           int    keyLength) {
+        return StodiumJNI.crypto_aead_aes256gcm_decrypt_array(
+                dstPlain, dstPlainOffset, dstPlainLength,
+                srcCipher, srcCipherOffset, srcCipherLength,
+                ad, adOffset, adLength,
+                nonce, nonceOffset, nonceLength,
+                key, keyOffset, keyLength);
+    }
+
+    @Override
+    int nativeEncryptDetached(final long dstCipher,
+                              final int  dstCipherLength,
+                              final long dstMac,
+                              final int  dstMacLength,
+                              final long srcPlain,
+                              final int  srcPlainLength,
+                              final long ad,
+                              final int  adLength,
+                              final long nonce,
+                              final int  nonceLength,
+                              final long key,
+                              final int  keyLength) {
+        return StodiumJNI.crypto_aead_aes256gcm_encrypt_detached_address(
+                dstCipher, dstCipherLength,
+                dstMac, dstMacLength,
+                srcPlain, srcPlainLength,
+                ad, adLength,
+                nonce, nonceLength,
+                key, keyLength);
+    }
+
+    @Override
+    int nativeEncrypt(final long dstCipher,
+                      final int  dstCipherLength,
+                      final long srcPlain,
+                      final int  srcPlainLength,
+                      final long ad,
+                      final int  adLength,
+                      final long nonce,
+                      final int  nonceLength,
+                      final long key,
+                      final int  keyLength) {
+        return StodiumJNI.crypto_aead_aes256gcm_encrypt_address(
+                dstCipher, dstCipherLength,
+                srcPlain, srcPlainLength,
+                ad, adLength,
+                nonce, nonceLength,
+                key, keyLength);
+    }
+
+    @Override
+    int nativeDecryptDetached(final long dstPlain,
+                              final int  dstPlainLength,
+                              final long srcCipher,
+                              final int  srcCipherLength,
+                              final long srcMac,
+                              final int  srcMacLength,
+                              final long ad,
+                              final int  adLength,
+                              final long nonce,
+                              final int  nonceLength,
+                              final long key,
+                              final int  keyLength) {
+        return StodiumJNI.crypto_aead_aes256gcm_decrypt_detached_address(
+                dstPlain, dstPlainLength,
+                srcCipher, srcCipherLength,
+                srcMac, srcMacLength,
+                ad, adLength,
+                nonce, nonceLength,
+                key, keyLength);
+    }
+
+    @Override
+    int nativeDecrypt(final long dstPlain,
+                      final int  dstPlainLength,
+                      final long srcCipher,
+                      final int  srcCipherLength,
+                      final long ad,
+                      final int  adLength,
+                      final long nonce,
+                      final int  nonceLength,
+                      final long key,
+                      final int  keyLength) {
+        return StodiumJNI.crypto_aead_aes256gcm_decrypt_address(
+                dstPlain, dstPlainLength,
+                srcCipher, srcCipherLength,
+                ad, adLength,
+                nonce, nonceLength,
+                key, keyLength);
+    }
+
+    @Override
+    int nativeEncryptDetached(final @NotNull ByteBuffer dstCipher,
+                              final @NotNull ByteBuffer dstMac,
+                              final @NotNull ByteBuffer srcPlain,
+                              final @NotNull ByteBuffer ad,
+                              final @NotNull ByteBuffer nonce,
+                              final          long       key) {
+        return StodiumJNI.crypto_aead_aes256gcm_encrypt_detached_handle(
+                dstCipher, dstMac, srcPlain, ad, nonce, key);
+    }
+
+    @Override
+    int nativeEncrypt(final @NotNull ByteBuffer dstCipher,
+                      final @NotNull ByteBuffer srcPlain,
+                      final @NotNull ByteBuffer ad,
+                      final @NotNull ByteBuffer nonce,
+                      final          long       key) {
+        return StodiumJNI.crypto_aead_aes256gcm_encrypt_handle(
+                dstCipher, srcPlain, ad, nonce, key);
+    }
+
+    @Override
+    int nativeDecryptDetached(final @NotNull ByteBuffer dstPlain,
+                              final @NotNull ByteBuffer srcCipher,
+                              final @NotNull ByteBuffer srcMac,
+                              final @NotNull ByteBuffer ad,
+                              final @NotNull ByteBuffer nonce,
+                              final          long       key) {
+        return StodiumJNI.crypto_aead_aes256gcm_decrypt_detached_handle(
+                dstPlain, srcCipher, srcMac, ad, nonce, key);
+    }
+
+    @Override
+    int nativeDecrypt(final @NotNull ByteBuffer dstPlain,
+                      final @NotNull ByteBuffer srcCipher,
+                      final @NotNull ByteBuffer ad,
+                      final @NotNull ByteBuffer nonce,
+                      final          long       key) {
+        return StodiumJNI.crypto_aead_aes256gcm_decrypt_handle(
+                dstPlain, srcCipher, ad, nonce, key);
+    }
+
+    @Override
+    int nativeEncryptBatch(final @NotNull  ByteBuffer dstCipher,
+                           final @NotNull  int[]      dstOffsets,
+                           final @NotNull  ByteBuffer srcPlain,
+                           final @NotNull  int[]      srcOffsets,
+                           final @NotNull  int[]      srcLengths,
+                           final @Nullable ByteBuffer ad,
+                           final @Nullable int[]      adOffsets,
+                           final @Nullable int[]      adLengths,
+                           final @NotNull  ByteBuffer nonces,
+                           final @NotNull  ByteBuffer key,
+                           final @NotNull  int[]      status) {
+        return StodiumJNI.crypto_aead_aes256gcm_encrypt_batch(
+                dstCipher, dstOffsets,
+                srcPlain, srcOffsets, srcLengths,
+                ad, adOffsets, adLengths,
+                nonces,
+                key,
+                status);
+    }
+
+    @Override
+    int nativeDecryptBatch(final @NotNull  ByteBuffer dstPlain,
+                           final @NotNull  int[]      dstOffsets,
+                           final @NotNull  ByteBuffer srcCipher,
+                           final @NotNull  int[]      srcOffsets,
+                           final @NotNull  int[]      srcLengths,
+                           final @Nullable ByteBuffer ad,
+                           final @Nullable int[]      adOffsets,
+                           final @Nullable int[]      adLengths,
+                           final @NotNull  ByteBuffer nonces,
+                           final @NotNull  ByteBuffer key,
+                           final @NotNull  int[]      status) {
+        return StodiumJNI.crypto_aead_aes256gcm_decrypt_batch(
+                dstPlain, dstOffsets,
+                srcCipher, srcOffsets, srcLengths,
+                ad, adOffsets, adLengths,
+                nonces,
+                key,
+                status);
+    }
+
+    @Override
+    int nativeEncryptDetached(final @NotNull ByteBuffer[] dstCipher,
+                              final @NotNull ByteBuffer   dstMac,
+                              final @NotNull ByteBuffer[] srcPlain,
+                              final @NotNull ByteBuffer   ad,
+                              final @NotNull ByteBuffer   nonce,
+                              final @NotNull ByteBuffer   key) {
+        throw new UnsupportedOperationException("Stodium: aes256gcm does not support scatter/gather");
+    }
+
+    @Override
+    int nativeDecryptDetached(final @NotNull ByteBuffer[] dstPlain,
+                              final @NotNull ByteBuffer[] srcCipher,
+                              final @NotNull ByteBuffer   srcMac,
+                              final @NotNull ByteBuffer   ad,
+                              final @NotNull ByteBuffer   nonce,
+                              final @NotNull ByteBuffer   key) {
+        throw new UnsupportedOperationException("Stodium: aes256gcm does not support scatter/gather");
+    }
+
+    @Override
+    int nativeEncryptInPlace(final @NotNull ByteBuffer buf,
+                             final          int        plainLength,
+                             final @NotNull ByteBuffer ad,
+                             final @NotNull ByteBuffer nonce,
+                             final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_aead_aes256gcm_encrypt_inplace(
+                buf, plainLength, ad, nonce, key);
+    }
+
+    @Override
+    int nativeEncryptDetachedInPlace(final @NotNull ByteBuffer buf,
+                                     final @NotNull ByteBuffer dstMac,
+                                     final @NotNull ByteBuffer ad,
+                                     final @NotNull ByteBuffer nonce,
+                                     final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_aead_aes256gcm_encrypt_detached_inplace(
+                buf, dstMac, ad, nonce, key);
+    }
+
+    @Override
+    int nativeDecryptInPlace(final @NotNull ByteBuffer buf,
+                             final @NotNull ByteBuffer ad,
+                             final @NotNull ByteBuffer nonce,
+                             final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_aead_aes256gcm_decrypt_inplace(
+                buf, ad, nonce, key);
+    }
+
+    @Override
+    int nativeDecryptDetachedInPlace(final @NotNull ByteBuffer buf,
+                                     final @NotNull ByteBuffer srcMac,
+                                     final @NotNull ByteBuffer ad,
+                                     final @NotNull ByteBuffer nonce,
+                                     final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_aead_aes256gcm_decrypt_detached_inplace(
+                buf, srcMac, ad, nonce, key);
+    }
 }
@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.aead;
+
+import org.jetbrains.annotations.NotNull;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+import eu.artemisc.stodium.Singleton;
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.ThreadPool;
+import eu.artemisc.stodium.exceptions.ConstraintViolationException;
+import eu.artemisc.stodium.exceptions.OperationFailedException;
+import eu.artemisc.stodium.exceptions.StodiumException;
+import eu.artemisc.stodium.random.RandomBytes;
+
+/**
+ * ChunkedAEAD seals large objects as a sequence of fixed size chunks, each of
+ * which is encrypted independently with an ietf AEAD construction. The chunks
+ * are sealed and opened in parallel on the native {@link ThreadPool}, and any
+ * range of chunks can be opened without touching the rest of the object.
+ * <p>
+ * A sealed object consists of a header of {@link #headerBytes()} bytes,
+ * followed by the sealed chunks:
+ * <pre>
+ * header  = nonce (npubBytes) || chunk size (4 bytes) || plain length (8 bytes)
+ * chunk i = AEAD(plain chunk i, ad = header, nonce = header nonce ^ i)
+ * </pre>
+ * All integers are little endian, and the chunk index is xored into the last
+ * 8 bytes of the nonce. Every chunk is a full chunk of plain text, except for
+ * the last one. Each chunk authenticates the complete header, which fixes the
+ * length of the object and therefore the number of chunks, so chunks can not
+ * be reordered, dropped from the end, or moved to a different object. An empty
+ * object consists of a single empty chunk.
+ * <p>
+ * The header nonce is random, so a key can be reused for many objects. With
+ * the 96 bit nonce of chacha20poly1305-ietf, the number of objects sealed
+ * under a single key should be kept small; xchacha20poly1305-ietf does not
+ * have this limitation.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public abstract class ChunkedAEAD {
+
+    private static final @NotNull Singleton<ChunkedAEAD> CHACHA_IETF = new Singleton<ChunkedAEAD>() {
+        @NotNull
+        @Override
+        protected ChunkedAEAD initialize() {
+            return new ChunkedChacha20Poly1305Ietf();
+        }
+    };
+
+    private static final @NotNull Singleton<ChunkedAEAD> XCHACHA_IETF = new Singleton<ChunkedAEAD>() {
+        @NotNull
+        @Override
+        protected ChunkedAEAD initialize() {
+            return new ChunkedXChacha20Poly1305Ietf();
+        }
+    };
+
+    @NotNull
+    public static ChunkedAEAD instance() {
+        return xchachaIetfInstance();
+    }
+
+    @NotNull
+    public static ChunkedAEAD chachaIetfInstance() {
+        return CHACHA_IETF.get();
+    }
+
+    @NotNull
+    public static ChunkedAEAD xchachaIetfInstance() {
+        return XCHACHA_IETF.get();
+    }
+
+    /**
+     * PLAINBYTES_MAX is the largest object that can be described by a header,
+     * which keeps all offset computations within the range of a long.
+     */
+    static final long PLAINBYTES_MAX = 1L << 62;
+
+    // constants
+    final int KEYBYTES;
+    final int NPUBBYTES;
+    final int ABYTES;
+    final int HEADERBYTES;
+
+    /**
+     *
+     * @param aead the construction used to seal the chunks
+     */
+    ChunkedAEAD(final @NotNull AEAD aead) {
+        KEYBYTES    = aead.KEYBYTES;
+        NPUBBYTES   = aead.NPUBBYTES;
+        ABYTES      = aead.ABYTES;
+        HEADERBYTES = aead.NPUBBYTES + 4 + 8;
+    }
+
+    /**
+     *
+     * @return
+     */
+    public final int keyBytes() {
+        return KEYBYTES;
+    }
+
+    /**
+     *
+     * @return the number of bytes added to every chunk
+     */
+    public final int aBytes() {
+        return ABYTES;
+    }
+
+    /**
+     *
+     * @return
+     */
+    public final int headerBytes() {
+        return HEADERBYTES;
+    }
+
+    /**
+     * chunkCount returns the number of chunks an object of plainLength bytes
+     * is split into.
+     *
+     * @param chunkSize
+     * @param plainLength
+     * @return
+     */
+    public static long chunkCount(final int  chunkSize,
+                                  final long plainLength) {
+        return plainLength == 0L ? 1L : (plainLength + chunkSize - 1) / chunkSize;
+    }
+
+    /**
+     * sealedLength returns the size of the sealed form of an object of
+     * plainLength bytes, including the header.
+     *
+     * @param chunkSize
+     * @param plainLength
+     * @return
+     * @throws ConstraintViolationException
+     */
+    public final long sealedLength(final int  chunkSize,
+                                   final long plainLength)
+            throws ConstraintViolationException {
+        checkLayout(chunkSize, plainLength);
+        return HEADERBYTES + plainLength + chunkCount(chunkSize, plainLength) * ABYTES;
+    }
+
+    /**
+     * initHeader writes the header of a new object of plainLength bytes to
+     * dstHeader, with a random nonce. The same header has to be passed to
+     * every call to {@link #sealChunks(ByteBuffer, ByteBuffer, ByteBuffer, long, ByteBuffer)}
+     * for the object.
+     *
+     * @param dstHeader
+     * @param chunkSize
+     * @param plainLength
+     * @throws StodiumException
+     */
+    public final void initHeader(final @NotNull ByteBuffer dstHeader,
+                                 final          int        chunkSize,
+                                 final          long       plainLength)
+            throws StodiumException {
+        final ByteBuffer header;
+
+        Stodium.checkDestinationWritable(dstHeader);
+
+        Stodium.checkSizeMin(dstHeader.remaining(), HEADERBYTES);
+        checkLayout(chunkSize, plainLength);
+
+        header = Stodium.window(dstHeader, 0, HEADERBYTES).order(ByteOrder.LITTLE_ENDIAN);
+        RandomBytes.nextBytes(Stodium.window(header, 0, NPUBBYTES));
+        header.putInt(header.position() + NPUBBYTES, chunkSize);
+        header.putLong(header.position() + NPUBBYTES + 4, plainLength);
+    }
+
+    /**
+     *
+     * @param header
+     * @return the chunk size stored in the header
+     * @throws ConstraintViolationException if the header is malformed
+     */
+    public final int chunkSize(final @NotNull ByteBuffer header)
+            throws ConstraintViolationException {
+        final ByteBuffer le = checkHeader(header);
+        return le.getInt(le.position() + NPUBBYTES);
+    }
+
+    /**
+     *
+     * @param header
+     * @return the length of the plain text stored in the header
+     * @throws ConstraintViolationException if the header is malformed
+     */
+    public final long plainLength(final @NotNull ByteBuffer header)
+            throws ConstraintViolationException {
+        final ByteBuffer le = checkHeader(header);
+        return le.getLong(le.position() + NPUBBYTES + 4);
+    }
+
+    /**
+     * sealChunks seals srcPlain as the consecutive chunks of the object
+     * starting at chunk firstChunk, and writes the sealed chunks to dstCipher.
+     * srcPlain must consist of whole chunks, except when it ends at the end of
+     * the object. Large objects can therefore be sealed in as many calls as
+     * needed, in any order.
+     *
+     * @param dstCipher
+     * @param srcPlain
+     * @param header
+     * @param firstChunk
+     * @param key
+     * @throws StodiumException
+     */
+    public final void sealChunks(final @NotNull ByteBuffer dstCipher,
+                                 final @NotNull ByteBuffer srcPlain,
+                                 final @NotNull ByteBuffer header,
+                                 final          long       firstChunk,
+                                 final @NotNull ByteBuffer key)
+            throws StodiumException {
+        final int  chunkSize   = chunkSize(header);
+        final long plainLength = plainLength(header);
+        final int  plain       = srcPlain.remaining();
+        final long chunks      = plain == 0 ? 1L : (plain + (long) chunkSize - 1) / chunkSize;
+        final long start;
+
+        Stodium.checkDestinationWritable(dstCipher);
+
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+        Stodium.checkSize(firstChunk, 0L, chunkCount(chunkSize, plainLength) - chunks);
+        start = firstChunk * chunkSize;
+        Stodium.checkSize(start + plain, 0L, plainLength);
+        if (start + plain != plainLength && (plain == 0 || plain % chunkSize != 0)) {
+            throw new ConstraintViolationException("Stodium: chunks must be whole, except at the end of the object");
+        }
+        Stodium.checkSize(dstCipher.remaining(), plain + chunks * ABYTES, Long.MAX_VALUE);
+
+        Stodium.checkStatus(nativeSealChunks(
+                Stodium.ensureUsableByteBuffer(dstCipher),
+                Stodium.ensureUsableByteBuffer(srcPlain),
+                Stodium.ensureUsableByteBuffer(Stodium.window(header, 0, HEADERBYTES)),
+                chunkSize,
+                firstChunk,
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * openChunks verifies and decrypts the consecutive sealed chunks in
+     * srcCipher, starting at chunk firstChunk, and writes the plain text to
+     * dstPlain. Any range of chunks can be opened on its own, which provides
+     * random access into the object.
+     * <p>
+     * If any of the chunks fails to verify, an exception is thrown and
+     * dstPlain is wiped.
+     *
+     * @param dstPlain
+     * @param srcCipher
+     * @param header
+     * @param firstChunk
+     * @param key
+     * @throws StodiumException
+     */
+    public final void openChunks(final @NotNull ByteBuffer dstPlain,
+                                 final @NotNull ByteBuffer srcCipher,
+                                 final @NotNull ByteBuffer header,
+                                 final          long       firstChunk,
+                                 final @NotNull ByteBuffer key)
+            throws StodiumException {
+        final int  chunkSize   = chunkSize(header);
+        final long plainLength = plainLength(header);
+        final long sealed      = (long) chunkSize + ABYTES;
+        final long chunks;
+        final long plain;
+        final int  failed;
+
+        Stodium.checkDestinationWritable(dstPlain);
+
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+        Stodium.checkSizeMin(srcCipher.remaining(), ABYTES);
+        chunks = (srcCipher.remaining() + sealed - 1) / sealed;
+        Stodium.checkSize(firstChunk, 0L, chunkCount(chunkSize, plainLength) - chunks);
+        plain = Math.min(plainLength, (firstChunk + chunks) * chunkSize) - firstChunk * chunkSize;
+        Stodium.checkSize(srcCipher.remaining(), plain + chunks * ABYTES, plain + chunks * ABYTES);
+        Stodium.checkSize(dstPlain.remaining(), plain, Long.MAX_VALUE);
+
+        failed = nativeOpenChunks(
+                Stodium.ensureUsableByteBuffer(dstPlain),
+                Stodium.ensureUsableByteBuffer(srcCipher),
+                Stodium.ensureUsableByteBuffer(Stodium.window(header, 0, HEADERBYTES)),
+                chunkSize,
+                firstChunk,
+                Stodium.ensureUsableByteBuffer(key));
+        if (failed != 0) {
+            throw new OperationFailedException("Stodium: " + failed + " chunk(s) could not be verified");
+        }
+    }
+
+    /**
+     * seal seals srcPlain as a complete object, writing the header followed by
+     * all chunks to dst, which must hold {@link #sealedLength(int, long)}
+     * bytes.
+     *
+     * @param dst
+     * @param srcPlain
+     * @param chunkSize
+     * @param key
+     * @throws StodiumException
+     */
+    public final void seal(final @NotNull ByteBuffer dst,
+                           final @NotNull ByteBuffer srcPlain,
+                           final          int        chunkSize,
+                           final @NotNull ByteBuffer key)
+            throws StodiumException {
+        final ByteBuffer header;
+
+        Stodium.checkSizeMin(dst.remaining(), HEADERBYTES);
+        header = Stodium.window(dst, 0, HEADERBYTES);
+
+        initHeader(header, chunkSize, srcPlain.remaining());
+        sealChunks(Stodium.window(dst, HEADERBYTES, dst.remaining() - HEADERBYTES),
+                srcPlain, header, 0L, key);
+    }
+
+    /**
+     * open verifies and decrypts a complete object, as written by
+     * {@link #seal(ByteBuffer, ByteBuffer, int, ByteBuffer)}, to dstPlain.
+     *
+     * @param dstPlain
+     * @param src
+     * @param key
+     * @throws StodiumException
+     */
+    public final void open(final @NotNull ByteBuffer dstPlain,
+                           final @NotNull ByteBuffer src,
+                           final @NotNull ByteBuffer key)
+            throws StodiumException {
+        final ByteBuffer header;
+        final long       length;
+
+        Stodium.checkSizeMin(src.remaining(), HEADERBYTES);
+        header = Stodium.window(src, 0, HEADERBYTES);
+        length = sealedLength(chunkSize(header), plainLength(header));
+        Stodium.checkSize(src.remaining(), length, length);
+
+        openChunks(dstPlain, Stodium.window(src, HEADERBYTES, src.remaining() - HEADERBYTES),
+                header, 0L, key);
+    }
+
+    /**
+     * checkHeader validates the fields of header, and returns a little endian
+     * view of it.
+     */
+    @NotNull
+    private ByteBuffer checkHeader(final @NotNull ByteBuffer header)
+            throws ConstraintViolationException {
+        final ByteBuffer le;
+
+        Stodium.checkSizeMin(header.remaining(), HEADERBYTES);
+        le = header.duplicate().order(ByteOrder.LITTLE_ENDIAN);
+        checkLayout(le.getInt(le.position() + NPUBBYTES),
+                le.getLong(le.position() + NPUBBYTES + 4));
+
+        return le;
+    }
+
+    private void checkLayout(final int  chunkSize,
+                             final long plainLength)
+            throws ConstraintViolationException {
+        Stodium.checkSize(chunkSize, 1, Integer.MAX_VALUE - ABYTES);
+        Stodium.checkSize(plainLength, 0L, PLAINBYTES_MAX);
+    }
+
+    //
+    // bindings, implemented by the primitives
+    //
+
+    abstract int nativeSealChunks(final @NotNull ByteBuffer dstCipher,
+                                  final @NotNull ByteBuffer srcPlain,
+                                  final @NotNull ByteBuffer header,
+                                  final          int        chunkSize,
+                                  final          long       firstChunk,
+                                  final @NotNull ByteBuffer key);
+
+    abstract int nativeOpenChunks(final @NotNull ByteBuffer dstPlain,
+                                  final @NotNull ByteBuffer srcCipher,
+                                  final @NotNull ByteBuffer header,
+                                  final          int        chunkSize,
+                                  final          long       firstChunk,
+                                  final @NotNull ByteBuffer key);
+}
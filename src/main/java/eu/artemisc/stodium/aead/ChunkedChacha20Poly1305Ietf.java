@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.aead;
+
+import org.jetbrains.annotations.NotNull;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.StodiumJNI;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+final class ChunkedChacha20Poly1305Ietf
+        extends ChunkedAEAD {
+
+    ChunkedChacha20Poly1305Ietf() {
+        super(AEAD.chachaIetfInstance());
+    }
+
+    @Override
+    int nativeSealChunks(final @NotNull ByteBuffer dstCipher,
+                         final @NotNull ByteBuffer srcPlain,
+                         final @NotNull ByteBuffer header,
+                         final          int        chunkSize,
+                         final          long       firstChunk,
+                         final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_aead_chacha20poly1305_ietf_encrypt_chunks(
+                dstCipher, srcPlain, header, chunkSize, firstChunk, key);
+    }
+
+    @Override
+    int nativeOpenChunks(final @NotNull ByteBuffer dstPlain,
+                         final @NotNull ByteBuffer srcCipher,
+                         final @NotNull ByteBuffer header,
+                         final          int        chunkSize,
+                         final          long       firstChunk,
+                         final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_aead_chacha20poly1305_ietf_decrypt_chunks(
+                dstPlain, srcCipher, header, chunkSize, firstChunk, key);
+    }
+}
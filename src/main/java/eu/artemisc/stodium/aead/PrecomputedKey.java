@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.aead;
+
+import org.jetbrains.annotations.NotNull;
+
+import eu.artemisc.stodium.NativeResource;
+import eu.artemisc.stodium.StodiumJNI;
+
+/**
+ * PrecomputedKey holds the expanded key state of an AEAD construction in
+ * native memory, as returned by {@link AEAD#precompute(java.nio.ByteBuffer)}.
+ * Reusing it for every message under the same key avoids redoing the key
+ * schedule on every call.
+ * <p>
+ * The key state is wiped and released once the key is closed.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public final class PrecomputedKey
+        extends NativeResource {
+
+    private final @NotNull AEAD aead;
+
+    PrecomputedKey(final @NotNull AEAD aead,
+                   final          long state) {
+        super(state);
+        this.aead = aead;
+    }
+
+    /**
+     * call runs call with the address of the key state, after verifying that
+     * the key was precomputed by the given AEAD instance.
+     */
+    int call(final @NotNull AEAD aead,
+             final @NotNull Call call) {
+        if (this.aead != aead) {
+            throw new IllegalArgumentException("Stodium: key was precomputed for a different AEAD");
+        }
+        return call(call);
+    }
+
+    @Override
+    protected void free(final long pointer) {
+        StodiumJNI.crypto_aead_aes256gcm_state_free(pointer);
+    }
+}
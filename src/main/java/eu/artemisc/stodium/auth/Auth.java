@@ -11,8 +11,12 @@ import org.jetbrains.annotations.NotNull;
 
 import java.nio.ByteBuffer;
 
+import eu.artemisc.stodium.KeyHandle;
 import eu.artemisc.stodium.Multipart;
+import eu.artemisc.stodium.NativeResource;
 import eu.artemisc.stodium.Singleton;
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.StodiumJNI;
 import eu.artemisc.stodium.exceptions.StodiumException;
 
 /**
@@ -140,4 +144,340 @@ public abstract class Auth {
     @NotNull
     public abstract Multipart<Auth> init(final @NotNull ByteBuffer key)
             throws StodiumException;
+
+    /**
+     * init is the byte[] counterpart of {@link #init(ByteBuffer)}, reading
+     * {@link #keyBytes()} bytes of key, starting at keyOffset.
+     *
+     * @param key
+     * @param keyOffset
+     * @return
+     * @throws StodiumException
+     */
+    @NotNull
+    public abstract Multipart<Auth> init(final @NotNull byte[] key,
+                                         final          int    keyOffset)
+            throws StodiumException;
+
+    //
+    // byte[] overloads
+    //
+
+    /**
+     * mac is the byte[] counterpart of the ByteBuffer based mac method. It
+     * writes {@link #bytes()} bytes to dstMac.
+     *
+     * @param dstMac
+     * @param dstMacOffset
+     * @param src
+     * @param srcOffset
+     * @param srcLength
+     * @param key
+     * @param keyOffset
+     * @throws StodiumException
+     */
+    public final void mac(final @NotNull byte[] dstMac,
+                          final          int    dstMacOffset,
+                          final @NotNull byte[] src,
+                          final          int    srcOffset,
+                          final          int    srcLength,
+                          final @NotNull byte[] key,
+                          final          int    keyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(dstMac.length, dstMacOffset, BYTES);
+        Stodium.checkOffsetParams(src.length, srcOffset, srcLength);
+        Stodium.checkOffsetParams(key.length, keyOffset, KEYBYTES);
+
+        Stodium.checkStatus(nativeMac(
+                dstMac, dstMacOffset, BYTES,
+                src, srcOffset, srcLength,
+                key, keyOffset, KEYBYTES));
+    }
+
+    /**
+     * verify is the byte[] counterpart of the ByteBuffer based verify method.
+     *
+     * @param srcMac
+     * @param srcMacOffset
+     * @param src
+     * @param srcOffset
+     * @param srcLength
+     * @param key
+     * @param keyOffset
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean verify(final @NotNull byte[] srcMac,
+                                final          int    srcMacOffset,
+                                final @NotNull byte[] src,
+                                final          int    srcOffset,
+                                final          int    srcLength,
+                                final @NotNull byte[] key,
+                                final          int    keyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcMac.length, srcMacOffset, BYTES);
+        Stodium.checkOffsetParams(src.length, srcOffset, srcLength);
+        Stodium.checkOffsetParams(key.length, keyOffset, KEYBYTES);
+
+        return StodiumJNI.NOERR == nativeVerify(
+                srcMac, srcMacOffset, BYTES,
+                src, srcOffset, srcLength,
+                key, keyOffset, KEYBYTES);
+    }
+
+    //
+    // byte[] bindings, implemented by the primitives
+    //
+
+    protected abstract int nativeMac(final @NotNull byte[] dstMac,
+                                     final          int    dstMacOffset,
+                                     final          int    dstMacLength,
+                                     final @NotNull byte[] src,
+                                     final          int    srcOffset,
+                                     final          int    srcLength,
+                                     final @NotNull byte[] key,
+                                     final          int    keyOffset,
+                                     final          int    keyLength);
+
+    protected abstract int nativeVerify(final @NotNull byte[] srcMac,
+                                        final          int    srcMacOffset,
+                                        final          int    srcMacLength,
+                                        final @NotNull byte[] src,
+                                        final          int    srcOffset,
+                                        final          int    srcLength,
+                                        final @NotNull byte[] key,
+                                        final          int    keyOffset,
+                                        final          int    keyLength);
+
+    //
+    // key handles
+    //
+
+    /**
+     * mac is the {@link KeyHandle} counterpart of the ByteBuffer based mac
+     * method, reading the key from guarded native memory.
+     *
+     * @param dstMac
+     * @param src
+     * @param key
+     * @throws StodiumException
+     */
+    public final void mac(final @NotNull ByteBuffer dstMac,
+                          final @NotNull ByteBuffer src,
+                          final @NotNull KeyHandle  key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstMac);
+
+        Stodium.checkSizeMin(dstMac.remaining(), BYTES);
+        Stodium.checkSize(key.length(), KEYBYTES);
+
+        Stodium.checkStatus(key.call(new NativeResource.Call() {
+            @Override
+            public int run(final long handle) {
+                return nativeMac(
+                        Stodium.ensureUsableByteBuffer(dstMac),
+                        Stodium.ensureUsableByteBuffer(src),
+                        handle);
+            }
+        }));
+    }
+
+    /**
+     * verify is the {@link KeyHandle} counterpart of the ByteBuffer based
+     * verify method.
+     *
+     * @param srcMac
+     * @param src
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean verify(final @NotNull ByteBuffer srcMac,
+                                final @NotNull ByteBuffer src,
+                                final @NotNull KeyHandle  key)
+            throws StodiumException {
+        Stodium.checkSizeMin(srcMac.remaining(), BYTES);
+        Stodium.checkSize(key.length(), KEYBYTES);
+
+        return StodiumJNI.NOERR == key.call(new NativeResource.Call() {
+            @Override
+            public int run(final long handle) {
+                return nativeVerify(
+                        Stodium.ensureUsableByteBuffer(srcMac),
+                        Stodium.ensureUsableByteBuffer(src),
+                        handle);
+            }
+        });
+    }
+
+    //
+    // key handle bindings, implemented by the primitives
+    //
+
+    protected abstract int nativeMac(final @NotNull ByteBuffer dstMac,
+                                     final @NotNull ByteBuffer src,
+                                     final          long       key);
+
+    protected abstract int nativeVerify(final @NotNull ByteBuffer srcMac,
+                                        final @NotNull ByteBuffer src,
+                                        final          long       key);
+
+    //
+    // precomputed keys
+    //
+
+    /**
+     * precompute runs the key setup for key once, and returns the resulting
+     * {@link PrecomputedKey}, which can be passed to the mac and verify
+     * methods in place of the raw key. For HMAC this saves two compression
+     * function calls per message, which is significant for short messages.
+     * <p>
+     * Only supported by the HMAC constructions, see
+     * {@link #supportsPrecompute()}.
+     *
+     * @param key
+     * @return
+     * @throws StodiumException
+     * @throws UnsupportedOperationException if the construction does not
+     *         support precomputed keys
+     */
+    @NotNull
+    public PrecomputedKey precompute(final @NotNull ByteBuffer key)
+            throws StodiumException {
+        throw new UnsupportedOperationException("Stodium: precomputed keys are not supported");
+    }
+
+    /**
+     *
+     * @return true iff {@link #precompute(ByteBuffer)} is supported
+     */
+    public boolean supportsPrecompute() {
+        return false;
+    }
+
+    /**
+     *
+     * @param dstMac
+     * @param src
+     * @param key
+     * @throws StodiumException
+     */
+    public void mac(final @NotNull ByteBuffer     dstMac,
+                    final @NotNull ByteBuffer     src,
+                    final @NotNull PrecomputedKey key)
+            throws StodiumException {
+        throw new UnsupportedOperationException("Stodium: precomputed keys are not supported");
+    }
+
+    /**
+     *
+     * @param srcMac
+     * @param src
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public boolean verify(final @NotNull ByteBuffer     srcMac,
+                          final @NotNull ByteBuffer     src,
+                          final @NotNull PrecomputedKey key)
+            throws StodiumException {
+        throw new UnsupportedOperationException("Stodium: precomputed keys are not supported");
+    }
+
+    /**
+     * freePrecomputed releases the native state of a {@link PrecomputedKey}
+     * created by this instance.
+     *
+     * @param state
+     */
+    void freePrecomputed(final long state) {
+        throw new UnsupportedOperationException("Stodium: precomputed keys are not supported");
+    }
+
+    //
+    // files
+    //
+
+    /**
+     * macFile writes the authenticator of length bytes of the file behind the
+     * given descriptor, starting at offset, to dstMac. The file is mapped into
+     * memory by the native code and authenticated in place, so its contents
+     * never pass through the Java heap. A negative length covers the rest of
+     * the file.
+     * <p>
+     * The descriptor must refer to a regular file, and stays owned by the
+     * caller. The file must not be truncated while it is being read.
+     *
+     * @param dstMac
+     * @param fd
+     * @param offset
+     * @param length
+     * @param key
+     * @throws StodiumException if the range lies outside of the file, or the
+     *         file could not be read
+     */
+    public final void macFile(final @NotNull ByteBuffer dstMac,
+                              final          int        fd,
+                              final          long       offset,
+                              final          long       length,
+                              final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstMac);
+
+        Stodium.checkSizeMin(dstMac.remaining(), BYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+        Stodium.checkSize(fd, 0, Integer.MAX_VALUE);
+        Stodium.checkSize(offset, 0L, Long.MAX_VALUE);
+
+        Stodium.checkFileStatus(nativeMacFile(
+                Stodium.ensureUsableByteBuffer(dstMac),
+                fd, offset, length,
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * macFile is the same as
+     * {@link #macFile(ByteBuffer, int, long, long, ByteBuffer)}, for the file
+     * at the given path.
+     *
+     * @param dstMac
+     * @param path
+     * @param offset
+     * @param length
+     * @param key
+     * @throws StodiumException
+     */
+    public final void macFile(final @NotNull ByteBuffer dstMac,
+                              final @NotNull String     path,
+                              final          long       offset,
+                              final          long       length,
+                              final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstMac);
+
+        Stodium.checkSizeMin(dstMac.remaining(), BYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+        Stodium.checkSize(offset, 0L, Long.MAX_VALUE);
+
+        Stodium.checkFileStatus(nativeMacFile(
+                Stodium.ensureUsableByteBuffer(dstMac),
+                path, offset, length,
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    //
+    // file bindings, implemented by the primitives
+    //
+
+    protected abstract int nativeMacFile(final @NotNull ByteBuffer dstMac,
+                                         final          int        fd,
+                                         final          long       offset,
+                                         final          long       length,
+                                         final @NotNull ByteBuffer key);
+
+    protected abstract int nativeMacFile(final @NotNull ByteBuffer dstMac,
+                                         final @NotNull String     path,
+                                         final          long       offset,
+                                         final          long       length,
+                                         final @NotNull ByteBuffer key);
 }
@@ -5,8 +5,11 @@ import org.jetbrains.annotations.NotNull;
 import java.nio.ByteBuffer;
 
 import eu.artemisc.stodium.Multipart;
+import eu.artemisc.stodium.NativeResource;
+import eu.artemisc.stodium.StatePool;
 import eu.artemisc.stodium.Stodium;
 import eu.artemisc.stodium.StodiumJNI;
+import eu.artemisc.stodium.exceptions.OperationFailedException;
 import eu.artemisc.stodium.exceptions.StodiumException;
 
 /**
@@ -59,12 +62,28 @@ final class HmacSha512
         final ByteBuffer state;
 
         Stodium.checkSize(key.remaining(), KEYBYTES);
-        state = ByteBuffer.allocateDirect(STATEBYTES);
+        state = StatePool.acquire(STATEBYTES);
 
         Stodium.checkStatus(StodiumJNI.crypto_auth_hmacsha512_init(
                 state, Stodium.ensureUsableByteBuffer(key)));
 
-        return new Multipart<>(this, state);
+        return new Multipart<>(this, state, true);
+    }
+
+    @NotNull
+    @Override
+    public Multipart<Auth> init(final @NotNull byte[] key,
+                                final          int    keyOffset)
+            throws StodiumException {
+        final ByteBuffer state;
+
+        Stodium.checkOffsetParams(key.length, keyOffset, KEYBYTES);
+        state = StatePool.acquire(STATEBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_auth_hmacsha512_init_array(
+                state, key, keyOffset, KEYBYTES));
+
+        return new Multipart<>(this, state, true);
     }
 
     @Override
@@ -79,6 +98,21 @@ final class HmacSha512
                 Stodium.ensureUsableByteBuffer(in)));
     }
 
+    @Override
+    public void update(final @NotNull ByteBuffer   state,
+                       final @NotNull ByteBuffer[] in,
+                       final          int          offset,
+                       final          int          length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_auth_hmacsha512_updatev(
+                Stodium.ensureUsableByteBuffer(state),
+                Stodium.ensureUsableByteBuffers(in, offset, length),
+                offset, length));
+    }
+
     @Override
     public void doFinal(final @NotNull ByteBuffer state,
                         final @NotNull ByteBuffer dst)
@@ -93,4 +127,164 @@ final class HmacSha512
                 Stodium.ensureUsableByteBuffer(state),
                 Stodium.ensureUsableByteBuffer(dst)));
     }
+
+    @Override
+    public void update(final @NotNull ByteBuffer state,
+                       final @NotNull byte[]     in,
+                       final          int        offset,
+                       final          int        length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_auth_hmacsha512_update_array(
+                Stodium.ensureUsableByteBuffer(state),
+                in, offset, length));
+    }
+
+    @Override
+    public void doFinal(final @NotNull ByteBuffer state,
+                        final @NotNull byte[]     dst,
+                        final          int        offset,
+                        final          int        length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+        Stodium.checkSizeMin(length, BYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_auth_hmacsha512_final_array(
+                Stodium.ensureUsableByteBuffer(state),
+                dst, offset, BYTES));
+    }
+
+    @NotNull
+    @Override
+    public PrecomputedKey precompute(final @NotNull ByteBuffer key)
+            throws StodiumException {
+        final long state;
+
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+
+        state = StodiumJNI.crypto_auth_hmacsha512_beforenm(
+                Stodium.ensureUsableByteBuffer(key));
+        if (state == 0L) {
+            throw new OperationFailedException("Stodium: hmacsha512 key setup failed");
+        }
+        return new PrecomputedKey(this, state);
+    }
+
+    @Override
+    public boolean supportsPrecompute() {
+        return true;
+    }
+
+    @Override
+    public void mac(final @NotNull ByteBuffer     dstMac,
+                    final @NotNull ByteBuffer     src,
+                    final @NotNull PrecomputedKey key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstMac);
+
+        Stodium.checkSizeMin(dstMac.remaining(), BYTES);
+
+        Stodium.checkStatus(key.call(this, new NativeResource.Call() {
+            @Override
+            public int run(final long state) {
+                return StodiumJNI.crypto_auth_hmacsha512_afternm(
+                        Stodium.ensureUsableByteBuffer(dstMac),
+                        Stodium.ensureUsableByteBuffer(src),
+                        state);
+            }
+        }));
+    }
+
+    @Override
+    public boolean verify(final @NotNull ByteBuffer     srcMac,
+                          final @NotNull ByteBuffer     src,
+                          final @NotNull PrecomputedKey key)
+            throws StodiumException {
+        Stodium.checkSizeMin(srcMac.remaining(), BYTES);
+
+        return StodiumJNI.NOERR == key.call(this, new NativeResource.Call() {
+            @Override
+            public int run(final long state) {
+                return StodiumJNI.crypto_auth_hmacsha512_verify_afternm(
+                        Stodium.ensureUsableByteBuffer(srcMac),
+                        Stodium.ensureUsableByteBuffer(src),
+                        state);
+            }
+        });
+    }
+
+    @Override
+    void freePrecomputed(final long state) {
+        StodiumJNI.crypto_auth_hmacsha512_state_free(state);
+    }
+
+    @Override
+    protected int nativeMac(final @NotNull byte[] dstMac,
+                            final          int    dstMacOffset,
+                            final          int    dstMacLength,
+                            final @NotNull byte[] src,
+                            final          int    srcOffset,
+                            final          int    srcLength,
+                            final @NotNull byte[] key,
+                            final          int    keyOffset,
+                            final          int    keyLength) {
+        return StodiumJNI.crypto_auth_hmacsha512_array(
+                dstMac, dstMacOffset, dstMacLength,
+                src, srcOffset, srcLength,
+                key, keyOffset, keyLength);
+    }
+
+    @Override
+    protected int nativeVerify(final @NotNull byte[] srcMac,
+                               final          int    srcMacOffset,
+                               final          int    srcMacLength,
+                               final @NotNull byte[] src,
+                               final          int    srcOffset,
+                               final          int    srcLength,
+                               final @NotNull byte[] key,
+                               final          int    keyOffset,
+                               final          int    keyLength) {
+        return StodiumJNI.crypto_auth_hmacsha512_verify_array(
+                srcMac, srcMacOffset, srcMacLength,
+                src, srcOffset, srcLength,
+                key, keyOffset, keyLength);
+    }
+
+    @Override
+    protected int nativeMac(final @NotNull ByteBuffer dstMac,
+                            final @NotNull ByteBuffer src,
+                            final          long       key) {
+        return StodiumJNI.crypto_auth_hmacsha512_handle(
+                dstMac, src, key);
+    }
+
+    @Override
+    protected int nativeVerify(final @NotNull ByteBuffer srcMac,
+                               final @NotNull ByteBuffer src,
+                               final          long       key) {
+        return StodiumJNI.crypto_auth_hmacsha512_verify_handle(
+                srcMac, src, key);
+    }
+
+    @Override
+    protected int nativeMacFile(final @NotNull ByteBuffer dstMac,
+                                final          int        fd,
+                                final          long       offset,
+                                final          long       length,
+                                final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_auth_hmacsha512_fd(dstMac, key, fd, offset, length);
+    }
+
+    @Override
+    protected int nativeMacFile(final @NotNull ByteBuffer dstMac,
+                                final @NotNull String     path,
+                                final          long       offset,
+                                final          long       length,
+                                final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_auth_hmacsha512_file(dstMac, key, path, offset, length);
+    }
 }
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.auth;
+
+import org.jetbrains.annotations.NotNull;
+
+import eu.artemisc.stodium.NativeResource;
+
+/**
+ * PrecomputedKey holds the HMAC state of a key in native memory, as returned
+ * by {@link Auth#precompute(java.nio.ByteBuffer)}: the inner and outer hash
+ * states after absorbing the padded key. Every MAC computed with it starts
+ * from a copy of these states, which saves hashing the key and both pads
+ * again for every message.
+ * <p>
+ * The key state is wiped and released once the key is closed.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public final class PrecomputedKey
+        extends NativeResource {
+
+    private final @NotNull Auth auth;
+
+    PrecomputedKey(final @NotNull Auth auth,
+                   final          long state) {
+        super(state);
+        this.auth = auth;
+    }
+
+    /**
+     * call runs call with the address of the key state, after verifying that
+     * the key was precomputed by the given Auth instance.
+     */
+    int call(final @NotNull Auth auth,
+             final @NotNull Call call) {
+        if (this.auth != auth) {
+            throw new IllegalArgumentException("Stodium: key was precomputed for a different Auth");
+        }
+        return call(call);
+    }
+
+    @Override
+    protected void free(final long pointer) {
+        auth.freePrecomputed(pointer);
+    }
+}
@@ -11,12 +11,19 @@ import org.jetbrains.annotations.NotNull;
 
 import java.nio.ByteBuffer;
 
+import eu.artemisc.stodium.NativeResource;
 import eu.artemisc.stodium.Singleton;
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.StodiumJNI;
 import eu.artemisc.stodium.exceptions.StodiumException;
 
 /**
  * ox is a static class that maps all calls to the corresponding native
  * implementations. All the methods are crypto_box_* functions.
+ * <p>
+ * The destination and source buffers passed to the easy methods must not
+ * overlap. To seal or open a message within the buffer that holds it, use the
+ * *InPlace methods instead.
  *
  * @author Jan van de Molengraft [jan@artemisc.eu]
  */
@@ -296,4 +303,712 @@ public abstract class Box {
                                      final @NotNull ByteBuffer localPubKey,
                                      final @NotNull ByteBuffer localPrivKey)
             throws StodiumException;
+
+    //
+    // byte[] overloads
+    //
+
+    /**
+     * easy is the byte[] counterpart of the ByteBuffer based easy method. It
+     * writes srcPlainLength + {@link #macBytes()} bytes to dstCipher.
+     *
+     * @param dstCipher
+     * @param dstCipherOffset
+     * @param srcPlain
+     * @param srcPlainOffset
+     * @param srcPlainLength
+     * @param nonce
+     * @param nonceOffset
+     * @param remotePubKey
+     * @param remotePubKeyOffset
+     * @param localPrivKey
+     * @param localPrivKeyOffset
+     * @throws StodiumException
+     */
+    public final void easy(final @NotNull byte[] dstCipher,
+                           final          int    dstCipherOffset,
+                           final @NotNull byte[] srcPlain,
+                           final          int    srcPlainOffset,
+                           final          int    srcPlainLength,
+                           final @NotNull byte[] nonce,
+                           final          int    nonceOffset,
+                           final @NotNull byte[] remotePubKey,
+                           final          int    remotePubKeyOffset,
+                           final @NotNull byte[] localPrivKey,
+                           final          int    localPrivKeyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcPlain.length, srcPlainOffset, srcPlainLength);
+        Stodium.checkOffsetParams(dstCipher.length, dstCipherOffset, srcPlainLength + MACBYTES);
+        Stodium.checkOffsetParams(nonce.length, nonceOffset, NONCEBYTES);
+        Stodium.checkOffsetParams(remotePubKey.length, remotePubKeyOffset, PUBLICKEYBYTES);
+        Stodium.checkOffsetParams(localPrivKey.length, localPrivKeyOffset, SECRETKEYBYTES);
+
+        Stodium.checkStatus(nativeEasy(
+                dstCipher, dstCipherOffset, srcPlainLength + MACBYTES,
+                srcPlain, srcPlainOffset, srcPlainLength,
+                nonce, nonceOffset, NONCEBYTES,
+                remotePubKey, remotePubKeyOffset, PUBLICKEYBYTES,
+                localPrivKey, localPrivKeyOffset, SECRETKEYBYTES));
+    }
+
+    /**
+     * openEasy is the byte[] counterpart of the ByteBuffer based openEasy
+     * method. It writes srcCipherLength - {@link #macBytes()} bytes to
+     * dstPlain.
+     *
+     * @param dstPlain
+     * @param dstPlainOffset
+     * @param srcCipher
+     * @param srcCipherOffset
+     * @param srcCipherLength
+     * @param nonce
+     * @param nonceOffset
+     * @param remotePubKey
+     * @param remotePubKeyOffset
+     * @param localPrivKey
+     * @param localPrivKeyOffset
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean openEasy(final @NotNull byte[] dstPlain,
+                                  final          int    dstPlainOffset,
+                                  final @NotNull byte[] srcCipher,
+                                  final          int    srcCipherOffset,
+                                  final          int    srcCipherLength,
+                                  final @NotNull byte[] nonce,
+                                  final          int    nonceOffset,
+                                  final @NotNull byte[] remotePubKey,
+                                  final          int    remotePubKeyOffset,
+                                  final @NotNull byte[] localPrivKey,
+                                  final          int    localPrivKeyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcCipher.length, srcCipherOffset, srcCipherLength);
+        Stodium.checkSizeMin(srcCipherLength, MACBYTES);
+        Stodium.checkOffsetParams(dstPlain.length, dstPlainOffset, srcCipherLength - MACBYTES);
+        Stodium.checkOffsetParams(nonce.length, nonceOffset, NONCEBYTES);
+        Stodium.checkOffsetParams(remotePubKey.length, remotePubKeyOffset, PUBLICKEYBYTES);
+        Stodium.checkOffsetParams(localPrivKey.length, localPrivKeyOffset, SECRETKEYBYTES);
+
+        return StodiumJNI.NOERR == nativeOpenEasy(
+                dstPlain, dstPlainOffset, srcCipherLength - MACBYTES,
+                srcCipher, srcCipherOffset, srcCipherLength,
+                nonce, nonceOffset, NONCEBYTES,
+                remotePubKey, remotePubKeyOffset, PUBLICKEYBYTES,
+                localPrivKey, localPrivKeyOffset, SECRETKEYBYTES);
+    }
+
+    /**
+     * beforenm is the byte[] counterpart of the ByteBuffer based beforenm
+     * method. It writes {@link #beforenmBytes()} bytes to dstSharedKey.
+     *
+     * @param dstSharedKey
+     * @param dstSharedKeyOffset
+     * @param remotePubKey
+     * @param remotePubKeyOffset
+     * @param localPrivKey
+     * @param localPrivKeyOffset
+     * @throws StodiumException
+     */
+    public final void beforenm(final @NotNull byte[] dstSharedKey,
+                               final          int    dstSharedKeyOffset,
+                               final @NotNull byte[] remotePubKey,
+                               final          int    remotePubKeyOffset,
+                               final @NotNull byte[] localPrivKey,
+                               final          int    localPrivKeyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(dstSharedKey.length, dstSharedKeyOffset, BEFORENMBYTES);
+        Stodium.checkOffsetParams(remotePubKey.length, remotePubKeyOffset, PUBLICKEYBYTES);
+        Stodium.checkOffsetParams(localPrivKey.length, localPrivKeyOffset, SECRETKEYBYTES);
+
+        Stodium.checkStatus(nativeBeforenm(
+                dstSharedKey, dstSharedKeyOffset, BEFORENMBYTES,
+                remotePubKey, remotePubKeyOffset, PUBLICKEYBYTES,
+                localPrivKey, localPrivKeyOffset, SECRETKEYBYTES));
+    }
+
+    /**
+     * easyAfternm is the byte[] counterpart of the ByteBuffer based
+     * easyAfternm method. It writes srcPlainLength + {@link #macBytes()} bytes
+     * to dstCipher.
+     *
+     * @param dstCipher
+     * @param dstCipherOffset
+     * @param srcPlain
+     * @param srcPlainOffset
+     * @param srcPlainLength
+     * @param nonce
+     * @param nonceOffset
+     * @param key
+     * @param keyOffset
+     * @throws StodiumException
+     */
+    public final void easyAfternm(final @NotNull byte[] dstCipher,
+                                  final          int    dstCipherOffset,
+                                  final @NotNull byte[] srcPlain,
+                                  final          int    srcPlainOffset,
+                                  final          int    srcPlainLength,
+                                  final @NotNull byte[] nonce,
+                                  final          int    nonceOffset,
+                                  final @NotNull byte[] key,
+                                  final          int    keyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcPlain.length, srcPlainOffset, srcPlainLength);
+        Stodium.checkOffsetParams(dstCipher.length, dstCipherOffset, srcPlainLength + MACBYTES);
+        Stodium.checkOffsetParams(nonce.length, nonceOffset, NONCEBYTES);
+        Stodium.checkOffsetParams(key.length, keyOffset, BEFORENMBYTES);
+
+        Stodium.checkStatus(nativeEasyAfternm(
+                dstCipher, dstCipherOffset, srcPlainLength + MACBYTES,
+                srcPlain, srcPlainOffset, srcPlainLength,
+                nonce, nonceOffset, NONCEBYTES,
+                key, keyOffset, BEFORENMBYTES));
+    }
+
+    /**
+     * openEasyAfternm is the byte[] counterpart of the ByteBuffer based
+     * openEasyAfternm method. It writes srcCipherLength - {@link #macBytes()}
+     * bytes to dstPlain.
+     *
+     * @param dstPlain
+     * @param dstPlainOffset
+     * @param srcCipher
+     * @param srcCipherOffset
+     * @param srcCipherLength
+     * @param nonce
+     * @param nonceOffset
+     * @param key
+     * @param keyOffset
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean openEasyAfternm(final @NotNull byte[] dstPlain,
+                                         final          int    dstPlainOffset,
+                                         final @NotNull byte[] srcCipher,
+                                         final          int    srcCipherOffset,
+                                         final          int    srcCipherLength,
+                                         final @NotNull byte[] nonce,
+                                         final          int    nonceOffset,
+                                         final @NotNull byte[] key,
+                                         final          int    keyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcCipher.length, srcCipherOffset, srcCipherLength);
+        Stodium.checkSizeMin(srcCipherLength, MACBYTES);
+        Stodium.checkOffsetParams(dstPlain.length, dstPlainOffset, srcCipherLength - MACBYTES);
+        Stodium.checkOffsetParams(nonce.length, nonceOffset, NONCEBYTES);
+        Stodium.checkOffsetParams(key.length, keyOffset, BEFORENMBYTES);
+
+        return StodiumJNI.NOERR == nativeOpenEasyAfternm(
+                dstPlain, dstPlainOffset, srcCipherLength - MACBYTES,
+                srcCipher, srcCipherOffset, srcCipherLength,
+                nonce, nonceOffset, NONCEBYTES,
+                key, keyOffset, BEFORENMBYTES);
+    }
+
+    /**
+     * seal is the byte[] counterpart of the ByteBuffer based seal method. It
+     * writes srcPlainLength + {@link #sealBytes()} bytes to dstCipher.
+     *
+     * @param dstCipher
+     * @param dstCipherOffset
+     * @param srcPlain
+     * @param srcPlainOffset
+     * @param srcPlainLength
+     * @param remotePubKey
+     * @param remotePubKeyOffset
+     * @throws StodiumException
+     */
+    public final void seal(final @NotNull byte[] dstCipher,
+                           final          int    dstCipherOffset,
+                           final @NotNull byte[] srcPlain,
+                           final          int    srcPlainOffset,
+                           final          int    srcPlainLength,
+                           final @NotNull byte[] remotePubKey,
+                           final          int    remotePubKeyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcPlain.length, srcPlainOffset, srcPlainLength);
+        Stodium.checkOffsetParams(dstCipher.length, dstCipherOffset, srcPlainLength + SEALBYTES);
+        Stodium.checkOffsetParams(remotePubKey.length, remotePubKeyOffset, PUBLICKEYBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_box_seal_array(
+                dstCipher, dstCipherOffset, srcPlainLength + SEALBYTES,
+                srcPlain, srcPlainOffset, srcPlainLength,
+                remotePubKey, remotePubKeyOffset, PUBLICKEYBYTES));
+    }
+
+    /**
+     * sealOpen is the byte[] counterpart of the ByteBuffer based sealOpen
+     * method. It writes srcCipherLength - {@link #sealBytes()} bytes to
+     * dstPlain.
+     *
+     * @param dstPlain
+     * @param dstPlainOffset
+     * @param srcCipher
+     * @param srcCipherOffset
+     * @param srcCipherLength
+     * @param localPubKey
+     * @param localPubKeyOffset
+     * @param localPrivKey
+     * @param localPrivKeyOffset
+     * @return true if the sealed box was decrypted correctly, false otherwise.
+     * @throws StodiumException
+     */
+    public final boolean sealOpen(final @NotNull byte[] dstPlain,
+                                  final          int    dstPlainOffset,
+                                  final @NotNull byte[] srcCipher,
+                                  final          int    srcCipherOffset,
+                                  final          int    srcCipherLength,
+                                  final @NotNull byte[] localPubKey,
+                                  final          int    localPubKeyOffset,
+                                  final @NotNull byte[] localPrivKey,
+                                  final          int    localPrivKeyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcCipher.length, srcCipherOffset, srcCipherLength);
+        Stodium.checkSizeMin(srcCipherLength, SEALBYTES);
+        Stodium.checkOffsetParams(dstPlain.length, dstPlainOffset, srcCipherLength - SEALBYTES);
+        Stodium.checkOffsetParams(localPubKey.length, localPubKeyOffset, PUBLICKEYBYTES);
+        Stodium.checkOffsetParams(localPrivKey.length, localPrivKeyOffset, SECRETKEYBYTES);
+
+        return StodiumJNI.NOERR == StodiumJNI.crypto_box_seal_open_array(
+                dstPlain, dstPlainOffset, srcCipherLength - SEALBYTES,
+                srcCipher, srcCipherOffset, srcCipherLength,
+                localPubKey, localPubKeyOffset, PUBLICKEYBYTES,
+                localPrivKey, localPrivKeyOffset, SECRETKEYBYTES);
+    }
+
+    //
+    // byte[] bindings, implemented by the primitives
+    //
+
+    abstract int nativeEasy(final @NotNull byte[] dstCipher,
+                            final          int    dstCipherOffset,
+                            final          int    dstCipherLength,
+                            final @NotNull byte[] srcPlain,
+                            final          int    srcPlainOffset,
+                            final          int    srcPlainLength,
+                            final @NotNull byte[] nonce,
+                            final          int    nonceOffset,
+                            final          int    nonceLength,
+                            final @NotNull byte[] remotePubKey,
+                            final          int    remotePubKeyOffset,
+                            final          int    remotePubKeyLength,
+                            final @NotNull byte[] localPrivKey,
+                            final          int    localPrivKeyOffset,
+                            final          int    localPrivKeyLength);
+
+    abstract int nativeOpenEasy(final @NotNull byte[] dstPlain,
+                                final          int    dstPlainOffset,
+                                final          int    dstPlainLength,
+                                final @NotNull byte[] srcCipher,
+                                final          int    srcCipherOffset,
+                                final          int    srcCipherLength,
+                                final @NotNull byte[] nonce,
+                                final          int    nonceOffset,
+                                final          int    nonceLength,
+                                final @NotNull byte[] remotePubKey,
+                                final          int    remotePubKeyOffset,
+                                final          int    remotePubKeyLength,
+                                final @NotNull byte[] localPrivKey,
+                                final          int    localPrivKeyOffset,
+                                final          int    localPrivKeyLength);
+
+    abstract int nativeBeforenm(final @NotNull byte[] dstSharedKey,
+                                final          int    dstSharedKeyOffset,
+                                final          int    dstSharedKeyLength,
+                                final @NotNull byte[] remotePubKey,
+                                final          int    remotePubKeyOffset,
+                                final          int    remotePubKeyLength,
+                                final @NotNull byte[] localPrivKey,
+                                final          int    localPrivKeyOffset,
+                                final          int    localPrivKeyLength);
+
+    abstract int nativeEasyAfternm(final @NotNull byte[] dstCipher,
+                                   final          int    dstCipherOffset,
+                                   final          int    dstCipherLength,
+                                   final @NotNull byte[] srcPlain,
+                                   final          int    srcPlainOffset,
+                                   final          int    srcPlainLength,
+                                   final @NotNull byte[] nonce,
+                                   final          int    nonceOffset,
+                                   final          int    nonceLength,
+                                   final @NotNull byte[] key,
+                                   final          int    keyOffset,
+                                   final          int    keyLength);
+
+    abstract int nativeOpenEasyAfternm(final @NotNull byte[] dstPlain,
+                                       final          int    dstPlainOffset,
+                                       final          int    dstPlainLength,
+                                       final @NotNull byte[] srcCipher,
+                                       final          int    srcCipherOffset,
+                                       final          int    srcCipherLength,
+                                       final @NotNull byte[] nonce,
+                                       final          int    nonceOffset,
+                                       final          int    nonceLength,
+                                       final @NotNull byte[] key,
+                                       final          int    keyOffset,
+                                       final          int    keyLength);
+
+    //
+    // in-place
+    //
+
+    /**
+     * easyInPlace seals the first plainLength bytes of buf within buf itself,
+     * replacing them by the MAC followed by the cipher text. buf must
+     * therefore have room for at least plainLength + {@link #macBytes()}
+     * bytes. The position and limit of buf are not changed.
+     *
+     * @param buf
+     * @param plainLength
+     * @param nonce
+     * @param remotePubKey
+     * @param localPrivKey
+     * @throws StodiumException
+     */
+    public final void easyInPlace(final @NotNull ByteBuffer buf,
+                                  final          int        plainLength,
+                                  final @NotNull ByteBuffer nonce,
+                                  final @NotNull ByteBuffer remotePubKey,
+                                  final @NotNull ByteBuffer localPrivKey)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(buf);
+
+        Stodium.checkSize(plainLength, 0, buf.remaining() - MACBYTES);
+        Stodium.checkSize(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSizeMin(remotePubKey.remaining(), PUBLICKEYBYTES);
+        Stodium.checkSize(localPrivKey.remaining(), SECRETKEYBYTES);
+
+        Stodium.checkStatus(nativeEasyInPlace(
+                Stodium.ensureUsableByteBuffer(buf),
+                plainLength,
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(remotePubKey),
+                Stodium.ensureUsableByteBuffer(localPrivKey)));
+    }
+
+    /**
+     * openEasyInPlace opens the MAC and cipher text held by the remaining
+     * bytes of buf. On success, the first buf.remaining() -
+     * {@link #macBytes()} bytes of buf hold the plain text; the bytes after it
+     * are left unspecified. If verification fails, buf is not modified.
+     *
+     * @param buf
+     * @param nonce
+     * @param remotePubKey
+     * @param localPrivKey
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean openEasyInPlace(final @NotNull ByteBuffer buf,
+                                         final @NotNull ByteBuffer nonce,
+                                         final @NotNull ByteBuffer remotePubKey,
+                                         final @NotNull ByteBuffer localPrivKey)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(buf);
+
+        Stodium.checkSizeMin(buf.remaining(), MACBYTES);
+        Stodium.checkSize(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSizeMin(remotePubKey.remaining(), PUBLICKEYBYTES);
+        Stodium.checkSize(localPrivKey.remaining(), SECRETKEYBYTES);
+
+        return StodiumJNI.NOERR == nativeOpenEasyInPlace(
+                Stodium.ensureUsableByteBuffer(buf),
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(remotePubKey),
+                Stodium.ensureUsableByteBuffer(localPrivKey));
+    }
+
+    /**
+     * easyAfternmInPlace is the counterpart of
+     * {@link #easyInPlace(ByteBuffer, int, ByteBuffer, ByteBuffer, ByteBuffer)}
+     * for a shared key computed by
+     * {@link #beforenm(ByteBuffer, ByteBuffer, ByteBuffer)}.
+     *
+     * @param buf
+     * @param plainLength
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public final void easyAfternmInPlace(final @NotNull ByteBuffer buf,
+                                         final          int        plainLength,
+                                         final @NotNull ByteBuffer nonce,
+                                         final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(buf);
+
+        Stodium.checkSize(plainLength, 0, buf.remaining() - MACBYTES);
+        Stodium.checkSize(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.remaining(), BEFORENMBYTES);
+
+        Stodium.checkStatus(nativeEasyAfternmInPlace(
+                Stodium.ensureUsableByteBuffer(buf),
+                plainLength,
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * openEasyAfternmInPlace is the counterpart of
+     * {@link #openEasyInPlace(ByteBuffer, ByteBuffer, ByteBuffer, ByteBuffer)}
+     * for a shared key computed by
+     * {@link #beforenm(ByteBuffer, ByteBuffer, ByteBuffer)}.
+     *
+     * @param buf
+     * @param nonce
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean openEasyAfternmInPlace(final @NotNull ByteBuffer buf,
+                                                final @NotNull ByteBuffer nonce,
+                                                final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(buf);
+
+        Stodium.checkSizeMin(buf.remaining(), MACBYTES);
+        Stodium.checkSize(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.remaining(), BEFORENMBYTES);
+
+        return StodiumJNI.NOERR == nativeOpenEasyAfternmInPlace(
+                Stodium.ensureUsableByteBuffer(buf),
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key));
+    }
+
+    //
+    // in-place bindings, implemented by the primitives
+    //
+
+    abstract int nativeEasyInPlace(final @NotNull ByteBuffer buf,
+                                   final          int        plainLength,
+                                   final @NotNull ByteBuffer nonce,
+                                   final @NotNull ByteBuffer remotePubKey,
+                                   final @NotNull ByteBuffer localPrivKey);
+
+    abstract int nativeOpenEasyInPlace(final @NotNull ByteBuffer buf,
+                                       final @NotNull ByteBuffer nonce,
+                                       final @NotNull ByteBuffer remotePubKey,
+                                       final @NotNull ByteBuffer localPrivKey);
+
+    abstract int nativeEasyAfternmInPlace(final @NotNull ByteBuffer buf,
+                                          final          int        plainLength,
+                                          final @NotNull ByteBuffer nonce,
+                                          final @NotNull ByteBuffer key);
+
+    abstract int nativeOpenEasyAfternmInPlace(final @NotNull ByteBuffer buf,
+                                              final @NotNull ByteBuffer nonce,
+                                              final @NotNull ByteBuffer key);
+
+    //
+    // shared key cache
+    //
+
+    /**
+     * easy is the {@link SharedKeyCache} counterpart of the ByteBuffer based
+     * easy method. The shared key of remotePubKey and localPrivKey is taken
+     * from the cache, and only computed if the cache does not hold it yet.
+     * The message is sealed in the combined format of crypto_box_easy: the
+     * MAC followed by the cipher text.
+     *
+     * @param dstCipher
+     * @param srcPlain
+     * @param nonce
+     * @param remotePubKey
+     * @param localPrivKey
+     * @param cache
+     * @throws StodiumException
+     */
+    public final void easy(final @NotNull ByteBuffer     dstCipher,
+                           final @NotNull ByteBuffer     srcPlain,
+                           final @NotNull ByteBuffer     nonce,
+                           final @NotNull ByteBuffer     remotePubKey,
+                           final @NotNull ByteBuffer     localPrivKey,
+                           final @NotNull SharedKeyCache cache)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstCipher);
+
+        Stodium.checkSize(localPrivKey.remaining(), SECRETKEYBYTES);
+        Stodium.checkSize(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSizeMin(remotePubKey.remaining(), PUBLICKEYBYTES);
+        Stodium.checkSize(srcPlain.remaining(), 0, dstCipher.remaining() - MACBYTES);
+
+        final SharedKey key = cache.acquire(this, remotePubKey, localPrivKey);
+        try {
+            Stodium.checkStatus(key.call(new NativeResource.Call() {
+                @Override
+                public int run(final long handle) {
+                    return nativeEasyAfternm(
+                            Stodium.ensureUsableByteBuffer(dstCipher),
+                            Stodium.ensureUsableByteBuffer(srcPlain),
+                            Stodium.ensureUsableByteBuffer(nonce),
+                            handle);
+                }
+            }));
+        } finally {
+            key.release();
+        }
+    }
+
+    /**
+     * openEasy is the {@link SharedKeyCache} counterpart of the ByteBuffer
+     * based openEasy method, opening messages sealed by
+     * {@link #easy(ByteBuffer, ByteBuffer, ByteBuffer, ByteBuffer, ByteBuffer, SharedKeyCache)}.
+     *
+     * @param dstPlain
+     * @param srcCipher
+     * @param nonce
+     * @param remotePubKey
+     * @param localPrivKey
+     * @param cache
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean openEasy(final @NotNull ByteBuffer     dstPlain,
+                                  final @NotNull ByteBuffer     srcCipher,
+                                  final @NotNull ByteBuffer     nonce,
+                                  final @NotNull ByteBuffer     remotePubKey,
+                                  final @NotNull ByteBuffer     localPrivKey,
+                                  final @NotNull SharedKeyCache cache)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstPlain);
+
+        Stodium.checkSize(localPrivKey.remaining(), SECRETKEYBYTES);
+        Stodium.checkSize(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSizeMin(remotePubKey.remaining(), PUBLICKEYBYTES);
+        Stodium.checkPositive(srcCipher.remaining() - MACBYTES);
+        Stodium.checkSizeMin(dstPlain.remaining(), srcCipher.remaining() - MACBYTES);
+
+        final SharedKey key = cache.acquire(this, remotePubKey, localPrivKey);
+        try {
+            return StodiumJNI.NOERR == key.call(new NativeResource.Call() {
+                @Override
+                public int run(final long handle) {
+                    return nativeOpenEasyAfternm(
+                            Stodium.ensureUsableByteBuffer(dstPlain),
+                            Stodium.ensureUsableByteBuffer(srcCipher),
+                            Stodium.ensureUsableByteBuffer(nonce),
+                            handle);
+                }
+            });
+        } finally {
+            key.release();
+        }
+    }
+
+    //
+    // pooled ephemeral keys
+    //
+
+    /**
+     * seal is the {@link EphemeralKeyPool} counterpart of the ByteBuffer
+     * based seal method. The ephemeral key pair is taken from the pool rather
+     * than generated on the calling thread, and wiped after use. The output
+     * is a regular sealed box, which can be opened by sealOpen.
+     *
+     * @param dstCipher
+     * @param srcPlain
+     * @param remotePubKey
+     * @param pool
+     * @throws StodiumException
+     */
+    public final void seal(final @NotNull ByteBuffer       dstCipher,
+                           final @NotNull ByteBuffer       srcPlain,
+                           final @NotNull ByteBuffer       remotePubKey,
+                           final @NotNull EphemeralKeyPool pool)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstCipher);
+
+        Stodium.checkSize(srcPlain.remaining(), 0, dstCipher.remaining() - SEALBYTES);
+        Stodium.checkSizeMin(remotePubKey.remaining(), PUBLICKEYBYTES);
+
+        final ByteBuffer ephemeral = pool.take(this);
+        try {
+            Stodium.checkStatus(nativeSeal(
+                    Stodium.ensureUsableByteBuffer(dstCipher),
+                    Stodium.ensureUsableByteBuffer(srcPlain),
+                    Stodium.ensureUsableByteBuffer(remotePubKey),
+                    ephemeral));
+        } finally {
+            pool.recycle(ephemeral);
+        }
+    }
+
+    //
+    // batch operations
+    //
+
+    /**
+     * beforenmBatch precomputes the shared keys between localPrivKey and a
+     * batch of remote public keys in a single call to the native code, such as
+     * when a server accepts a burst of new peers.
+     * <p>
+     * Peer i is the i-th block of {@link #publicBytes()} bytes in
+     * remotePubKeys, and its shared key is written to the i-th block of
+     * {@link #beforenmBytes()} bytes in dstSharedKeys. The length of status
+     * determines the number of peers, and receives the status of every peer.
+     * When parallel is set, the batch is spread over the native
+     * {@link eu.artemisc.stodium.ThreadPool}.
+     *
+     * @param dstSharedKeys
+     * @param remotePubKeys
+     * @param localPrivKey
+     * @param status
+     * @param parallel
+     * @return the number of peers that failed
+     * @throws StodiumException
+     */
+    public final int beforenmBatch(final @NotNull ByteBuffer dstSharedKeys,
+                                   final @NotNull ByteBuffer remotePubKeys,
+                                   final @NotNull ByteBuffer localPrivKey,
+                                   final @NotNull int[]      status,
+                                   final          boolean    parallel)
+            throws StodiumException {
+        final long count = status.length;
+
+        Stodium.checkDestinationWritable(dstSharedKeys);
+
+        Stodium.checkSize(localPrivKey.remaining(), SECRETKEYBYTES);
+        Stodium.checkSize(remotePubKeys.remaining(), count * PUBLICKEYBYTES, count * PUBLICKEYBYTES);
+        Stodium.checkSize(dstSharedKeys.remaining(), count * BEFORENMBYTES, Integer.MAX_VALUE);
+
+        return nativeBeforenmBatch(
+                Stodium.ensureUsableByteBuffer(dstSharedKeys),
+                Stodium.ensureUsableByteBuffer(remotePubKeys),
+                Stodium.ensureUsableByteBuffer(localPrivKey),
+                status,
+                parallel);
+    }
+
+    //
+    // shared key bindings, implemented by the primitives
+    //
+
+    /**
+     * nativeBeforenm computes the shared key of a key pair into guarded native
+     * memory, returning the address of the resulting key handle, or 0 on
+     * failure.
+     */
+    abstract long nativeBeforenm(final @NotNull ByteBuffer remotePubKey,
+                                 final @NotNull ByteBuffer localPrivKey);
+
+    abstract int nativeEasyAfternm(final @NotNull ByteBuffer dstCipher,
+                                   final @NotNull ByteBuffer srcPlain,
+                                   final @NotNull ByteBuffer nonce,
+                                   final          long       key);
+
+    abstract int nativeOpenEasyAfternm(final @NotNull ByteBuffer dstPlain,
+                                       final @NotNull ByteBuffer srcCipher,
+                                       final @NotNull ByteBuffer nonce,
+                                       final          long       key);
+
+    abstract int nativeSeal(final @NotNull ByteBuffer dstCipher,
+                            final @NotNull ByteBuffer srcPlain,
+                            final @NotNull ByteBuffer remotePubKey,
+                            final @NotNull ByteBuffer ephemeralKeypair);
+
+    abstract int nativeBeforenmBatch(final @NotNull ByteBuffer dstSharedKeys,
+                                     final @NotNull ByteBuffer remotePubKeys,
+                                     final @NotNull ByteBuffer localPrivKey,
+                                     final @NotNull int[]      status,
+                                     final          boolean    parallel);
 }
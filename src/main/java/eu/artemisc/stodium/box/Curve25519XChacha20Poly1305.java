@@ -187,4 +187,187 @@ final class Curve25519XChacha20Poly1305
             throws StodiumException {
         throw new UnsupportedOperationException("not supported yet");
     }
+
+    @Override
+    int nativeEasy(final @NotNull byte[] dstCipher,
+                   final          int    dstCipherOffset,
+                   final          int    dstCipherLength,
+                   final @NotNull byte[] srcPlain,
+                   final          int    srcPlainOffset,
+                   final          int    srcPlainLength,
+                   final @NotNull byte[] nonce,
+                   final          int    nonceOffset,
+                   final          int    nonceLength,
+                   final @NotNull byte[] remotePubKey,
+                   final          int    remotePubKeyOffset,
+                   final          int    remotePubKeyLength,
+                   final @NotNull byte[] localPrivKey,
+                   final          int    localPrivKeyOffset,
+                   final          int    localPrivKeyLength) {
+        return StodiumJNI.crypto_box_curve25519xchacha20poly1305_easy_array(
+                dstCipher, dstCipherOffset, dstCipherLength,
+                srcPlain, srcPlainOffset, srcPlainLength,
+                nonce, nonceOffset, nonceLength,
+                remotePubKey, remotePubKeyOffset, remotePubKeyLength,
+                localPrivKey, localPrivKeyOffset, localPrivKeyLength);
+    }
+
+    @Override
+    int nativeOpenEasy(final @NotNull byte[] dstPlain,
+                       final          int    dstPlainOffset,
+                       final          int    dstPlainLength,
+                       final @NotNull byte[] srcCipher,
+                       final          int    srcCipherOffset,
+                       final          int    srcCipherLength,
+                       final @NotNull byte[] nonce,
+                       final          int    nonceOffset,
+                       final          int    nonceLength,
+                       final @NotNull byte[] remotePubKey,
+                       final          int    remotePubKeyOffset,
+                       final          int    remotePubKeyLength,
+                       final @NotNull byte[] localPrivKey,
+                       final          int    localPrivKeyOffset,
+                       final          int    localPrivKeyLength) {
+        return StodiumJNI.crypto_box_curve25519xchacha20poly1305_open_easy_array(
+                dstPlain, dstPlainOffset, dstPlainLength,
+                srcCipher, srcCipherOffset, srcCipherLength,
+                nonce, nonceOffset, nonceLength,
+                remotePubKey, remotePubKeyOffset, remotePubKeyLength,
+                localPrivKey, localPrivKeyOffset, localPrivKeyLength);
+    }
+
+    @Override
+    int nativeBeforenm(final @NotNull byte[] dstSharedKey,
+                       final          int    dstSharedKeyOffset,
+                       final          int    dstSharedKeyLength,
+                       final @NotNull byte[] remotePubKey,
+                       final          int    remotePubKeyOffset,
+                       final          int    remotePubKeyLength,
+                       final @NotNull byte[] localPrivKey,
+                       final          int    localPrivKeyOffset,
+                       final          int    localPrivKeyLength) {
+        return StodiumJNI.crypto_box_curve25519xchacha20poly1305_beforenm_array(
+                dstSharedKey, dstSharedKeyOffset, dstSharedKeyLength,
+                remotePubKey, remotePubKeyOffset, remotePubKeyLength,
+                localPrivKey, localPrivKeyOffset, localPrivKeyLength);
+    }
+
+    @Override
+    int nativeEasyAfternm(final @NotNull byte[] dstCipher,
+                          final          int    dstCipherOffset,
+                          final          int    dstCipherLength,
+                          final @NotNull byte[] srcPlain,
+                          final          int    srcPlainOffset,
+                          final          int    srcPlainLength,
+                          final @NotNull byte[] nonce,
+                          final          int    nonceOffset,
+                          final          int    nonceLength,
+                          final @NotNull byte[] key,
+                          final          int    keyOffset,
+                          final          int    keyLength) {
+        return StodiumJNI.crypto_box_curve25519xchacha20poly1305_easy_afternm_array(
+                dstCipher, dstCipherOffset, dstCipherLength,
+                srcPlain, srcPlainOffset, srcPlainLength,
+                nonce, nonceOffset, nonceLength,
+                key, keyOffset, keyLength);
+    }
+
+    @Override
+    int nativeOpenEasyAfternm(final @NotNull byte[] dstPlain,
+                              final          int    dstPlainOffset,
+                              final          int    dstPlainLength,
+                              final @NotNull byte[] srcCipher,
+                              final          int    srcCipherOffset,
+                              final          int    srcCipherLength,
+                              final @NotNull byte[] nonce,
+                              final          int    nonceOffset,
+                              final          int    nonceLength,
+                              final @NotNull byte[] key,
+                              final          int    keyOffset,
+                              final          int    keyLength) {
+        return StodiumJNI.crypto_box_curve25519xchacha20poly1305_open_easy_afternm_array(
+                dstPlain, dstPlainOffset, dstPlainLength,
+                srcCipher, srcCipherOffset, srcCipherLength,
+                nonce, nonceOffset, nonceLength,
+                key, keyOffset, keyLength);
+    }
+
+    @Override
+    int nativeEasyInPlace(final @NotNull ByteBuffer buf,
+                          final          int        plainLength,
+                          final @NotNull ByteBuffer nonce,
+                          final @NotNull ByteBuffer remotePubKey,
+                          final @NotNull ByteBuffer localPrivKey) {
+        return StodiumJNI.crypto_box_curve25519xchacha20poly1305_easy_inplace(
+                buf, plainLength, nonce, remotePubKey, localPrivKey);
+    }
+
+    @Override
+    int nativeOpenEasyInPlace(final @NotNull ByteBuffer buf,
+                              final @NotNull ByteBuffer nonce,
+                              final @NotNull ByteBuffer remotePubKey,
+                              final @NotNull ByteBuffer localPrivKey) {
+        return StodiumJNI.crypto_box_curve25519xchacha20poly1305_open_easy_inplace(
+                buf, nonce, remotePubKey, localPrivKey);
+    }
+
+    @Override
+    int nativeEasyAfternmInPlace(final @NotNull ByteBuffer buf,
+                                 final          int        plainLength,
+                                 final @NotNull ByteBuffer nonce,
+                                 final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_box_curve25519xchacha20poly1305_easy_afternm_inplace(
+                buf, plainLength, nonce, key);
+    }
+
+    @Override
+    int nativeOpenEasyAfternmInPlace(final @NotNull ByteBuffer buf,
+                                     final @NotNull ByteBuffer nonce,
+                                     final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_box_curve25519xchacha20poly1305_open_easy_afternm_inplace(
+                buf, nonce, key);
+    }
+
+    @Override
+    long nativeBeforenm(final @NotNull ByteBuffer remotePubKey,
+                        final @NotNull ByteBuffer localPrivKey) {
+        return StodiumJNI.crypto_box_curve25519xchacha20poly1305_beforenm_handle(
+                remotePubKey, localPrivKey);
+    }
+
+    @Override
+    int nativeEasyAfternm(final @NotNull ByteBuffer dstCipher,
+                          final @NotNull ByteBuffer srcPlain,
+                          final @NotNull ByteBuffer nonce,
+                          final          long       key) {
+        return StodiumJNI.crypto_box_curve25519xchacha20poly1305_easy_afternm_handle(
+                dstCipher, srcPlain, nonce, key);
+    }
+
+    @Override
+    int nativeOpenEasyAfternm(final @NotNull ByteBuffer dstPlain,
+                              final @NotNull ByteBuffer srcCipher,
+                              final @NotNull ByteBuffer nonce,
+                              final          long       key) {
+        return StodiumJNI.crypto_box_curve25519xchacha20poly1305_open_easy_afternm_handle(
+                dstPlain, srcCipher, nonce, key);
+    }
+
+    @Override
+    int nativeSeal(final @NotNull ByteBuffer dstCipher,
+                   final @NotNull ByteBuffer srcPlain,
+                   final @NotNull ByteBuffer remotePubKey,
+                   final @NotNull ByteBuffer ephemeralKeypair) {
+        throw new UnsupportedOperationException("not supported yet");
+    }
+
+    @Override
+    int nativeBeforenmBatch(final @NotNull ByteBuffer dstSharedKeys,
+                            final @NotNull ByteBuffer remotePubKeys,
+                            final @NotNull ByteBuffer localPrivKey,
+                            final @NotNull int[]      status,
+                            final          boolean    parallel) {
+        return StodiumJNI.crypto_box_curve25519xchacha20poly1305_beforenm_batch(
+                dstSharedKeys, remotePubKeys, localPrivKey, status, parallel);
+    }
 }
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.box;
+
+import org.jetbrains.annotations.NotNull;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+import eu.artemisc.stodium.StatePool;
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.StodiumJNI;
+import eu.artemisc.stodium.aead.AEAD;
+import eu.artemisc.stodium.exceptions.ConstraintViolationException;
+import eu.artemisc.stodium.exceptions.StodiumException;
+import eu.artemisc.stodium.generichash.GenericHash;
+import eu.artemisc.stodium.random.RandomBytes;
+
+/**
+ * Envelope encrypts a message for multiple recipients. The payload is
+ * encrypted once with xchacha20poly1305-ietf under a random key, and only that
+ * key is sealed for every recipient, with a curve25519xsalsa20poly1305 sealed
+ * box. The sealed boxes are computed in a single native call, spread over the
+ * native {@link eu.artemisc.stodium.ThreadPool}.
+ * <p>
+ * An envelope consists of a header of {@link #headerBytes(int)} bytes,
+ * followed by the encrypted payload:
+ * <pre>
+ * header  = nonce (24 bytes) || recipient count (4 bytes) || entry 0 || ... || entry n-1
+ * entry i = key id (8 bytes) || sealed box of the payload key for recipient i
+ * body    = AEAD(payload, ad = header, nonce)
+ * </pre>
+ * All integers are little endian. The key id is the first 8 bytes of the
+ * BLAKE2b digest of the recipient's public key, so a recipient only needs to
+ * try to open its own entries. As the header is authenticated by the body,
+ * entries can not be added, removed or replaced without opening failing.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public final class Envelope {
+
+    private static final int IDBYTES    = 8;
+    private static final int COUNTBYTES = 4;
+
+    // block the constructor
+    private Envelope() {}
+
+    @NotNull
+    private static Box box() {
+        return Box.curve25519xsalsa20poly1305Instance();
+    }
+
+    @NotNull
+    private static AEAD aead() {
+        return AEAD.xchachaIetfInstance();
+    }
+
+    private static int entryBytes() {
+        return IDBYTES + box().SEALBYTES + aead().keyBytes();
+    }
+
+    /**
+     *
+     * @param recipients
+     * @return the length of the header of an envelope for recipients recipients
+     */
+    public static int headerBytes(final int recipients) {
+        return aead().npubBytes() + COUNTBYTES + recipients * entryBytes();
+    }
+
+    /**
+     *
+     * @param recipients
+     * @param plainLength
+     * @return the length of the envelope of a payload of plainLength bytes
+     */
+    public static int sealedLength(final int recipients,
+                                   final int plainLength) {
+        return headerBytes(recipients) + plainLength + aead().aBytes();
+    }
+
+    /**
+     *
+     * @param src
+     * @return the number of recipients stored in the header of src
+     * @throws ConstraintViolationException if the header is malformed
+     */
+    public static int recipients(final @NotNull ByteBuffer src)
+            throws ConstraintViolationException {
+        final ByteBuffer le;
+        final int        count;
+
+        Stodium.checkSizeMin(src.remaining(), headerBytes(0));
+        le    = src.duplicate().order(ByteOrder.LITTLE_ENDIAN);
+        count = le.getInt(le.position() + aead().npubBytes());
+        Stodium.checkSize(count, 1, (src.remaining() - headerBytes(0) - aead().aBytes()) / entryBytes());
+
+        return count;
+    }
+
+    /**
+     * seal encrypts srcPlain for every public key in recipientPubKeys, and
+     * writes the envelope of {@link #sealedLength(int, int)} bytes to the
+     * start of dst.
+     *
+     * @param dst
+     * @param srcPlain
+     * @param recipientPubKeys
+     * @throws StodiumException
+     */
+    public static void seal(final @NotNull ByteBuffer   dst,
+                            final @NotNull ByteBuffer   srcPlain,
+                            final @NotNull ByteBuffer[] recipientPubKeys)
+            throws StodiumException {
+        final Box        box   = box();
+        final AEAD       aead  = aead();
+        final int        count = recipientPubKeys.length;
+        final ByteBuffer pubs;
+        final ByteBuffer header;
+        final ByteBuffer key;
+
+        Stodium.checkDestinationWritable(dst);
+
+        Stodium.checkSize(count, 1, (Integer.MAX_VALUE - headerBytes(0) - aead.aBytes()) / entryBytes());
+        Stodium.checkSize(srcPlain.remaining(), 0, Integer.MAX_VALUE - headerBytes(count) - aead.aBytes());
+        Stodium.checkSizeMin(dst.remaining(), sealedLength(count, srcPlain.remaining()));
+
+        pubs = ByteBuffer.allocateDirect(count * box.PUBLICKEYBYTES);
+        for (final ByteBuffer pub : recipientPubKeys) {
+            Stodium.checkSize(pub.remaining(), box.PUBLICKEYBYTES);
+            pubs.put(pub.duplicate());
+        }
+        pubs.flip();
+
+        header = Stodium.window(dst, 0, headerBytes(count)).order(ByteOrder.LITTLE_ENDIAN);
+        RandomBytes.nextBytes(Stodium.window(header, 0, aead.npubBytes()));
+        header.putInt(header.position() + aead.npubBytes(), count);
+
+        key = StatePool.acquire(aead.keyBytes());
+        try {
+            RandomBytes.nextBytes(key);
+            Stodium.checkStatus(StodiumJNI.crypto_box_seal_batch(
+                    Stodium.ensureUsableByteBuffer(Stodium.window(header, headerBytes(0), count * entryBytes())),
+                    key,
+                    pubs));
+
+            aead.encrypt(Stodium.window(dst, headerBytes(count), srcPlain.remaining() + aead.aBytes()),
+                    srcPlain,
+                    header,
+                    Stodium.window(header, 0, aead.npubBytes()),
+                    key);
+        } finally {
+            StatePool.release(key);
+        }
+    }
+
+    /**
+     * open looks up the entries of the envelope src that belong to the key
+     * pair localPubKey/localPrivKey, and uses the key sealed in them to
+     * decrypt the payload to dstPlain.
+     *
+     * @param dstPlain
+     * @param src
+     * @param localPubKey
+     * @param localPrivKey
+     * @return true if the envelope was decrypted correctly, false if it was
+     *         not addressed to the key pair or has been tampered with.
+     * @throws StodiumException
+     */
+    public static boolean open(final @NotNull ByteBuffer dstPlain,
+                               final @NotNull ByteBuffer src,
+                               final @NotNull ByteBuffer localPubKey,
+                               final @NotNull ByteBuffer localPrivKey)
+            throws StodiumException {
+        final Box        box   = box();
+        final AEAD       aead  = aead();
+        final int        count = recipients(src);
+        final int        body  = src.remaining() - headerBytes(count);
+        final ByteBuffer header;
+        final ByteBuffer id;
+        final ByteBuffer key;
+
+        Stodium.checkDestinationWritable(dstPlain);
+
+        Stodium.checkSize(localPubKey.remaining(), box.PUBLICKEYBYTES);
+        Stodium.checkSize(localPrivKey.remaining(), box.SECRETKEYBYTES);
+        Stodium.checkSize(dstPlain.remaining(), body - aead.aBytes(), Integer.MAX_VALUE);
+
+        header = Stodium.window(src, 0, headerBytes(count));
+        id     = ByteBuffer.allocateDirect(GenericHash.instance().bytesMin());
+        GenericHash.instance().hash(id, localPubKey.duplicate(), null);
+        id.limit(IDBYTES);
+
+        key = StatePool.acquire(aead.keyBytes());
+        try {
+            for (int i = 0; i < count; i++) {
+                final int        offset = headerBytes(i);
+                final ByteBuffer entry  = Stodium.window(header, offset + IDBYTES, entryBytes() - IDBYTES);
+
+                if (!Stodium.isEqual(id, Stodium.window(header, offset, IDBYTES).slice())
+                        || !box.sealOpen(key.duplicate(), entry, localPubKey, localPrivKey)) {
+                    continue;
+                }
+
+                return aead.decrypt(dstPlain,
+                        Stodium.window(src, headerBytes(count), body),
+                        header,
+                        Stodium.window(header, 0, aead.npubBytes()),
+                        key);
+            }
+            return false;
+        } finally {
+            StatePool.release(key);
+        }
+    }
+}
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.box;
+
+import org.jetbrains.annotations.NotNull;
+
+import java.io.Closeable;
+import java.nio.ByteBuffer;
+import java.util.ArrayDeque;
+import java.util.IdentityHashMap;
+import java.util.Map;
+
+import eu.artemisc.stodium.StatePool;
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.exceptions.ConstraintViolationException;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * EphemeralKeyPool generates the ephemeral key pairs used by sealed boxes
+ * ahead of time, on a background thread, so that
+ * {@link Box#seal(ByteBuffer, ByteBuffer, ByteBuffer, EphemeralKeyPool)} does
+ * not have to compute one on the caller's thread. The pool holds at most
+ * capacity key pairs, and refills itself whenever key pairs are taken.
+ * <p>
+ * Every key pair is used for a single message, after which it is wiped. When
+ * the pool has run dry, seal falls back to generating a key pair inline.
+ * The key pairs are kept in a direct buffer, outside of the Java heap.
+ * <p>
+ * The background thread only references the state of the pool, not the pool
+ * itself, so a pool that is dropped without being closed is still closed by
+ * finalization. As finalization may run arbitrarily late, pools should be
+ * closed explicitly once they are no longer needed.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public final class EphemeralKeyPool
+        implements Closeable {
+
+    private final @NotNull State state;
+
+    /**
+     *
+     * @param box the primitive the key pairs are generated for
+     * @param capacity the maximum number of key pairs kept by the pool
+     * @throws ConstraintViolationException
+     */
+    public EphemeralKeyPool(final @NotNull Box box,
+                            final          int capacity)
+            throws ConstraintViolationException {
+        Stodium.checkSize(capacity, 1, Integer.MAX_VALUE / (box.PUBLICKEYBYTES + box.SECRETKEYBYTES));
+
+        this.state = new State(box, capacity);
+        this.state.start();
+    }
+
+    /**
+     *
+     * @return the number of key pairs that are ready to be used
+     */
+    public int available() {
+        synchronized (state.ready) {
+            return state.ready.size();
+        }
+    }
+
+    /**
+     * close stops the background thread and wipes all key pairs that have not
+     * been used. Sealing with a closed pool throws an IllegalStateException.
+     */
+    @Override
+    public void close() {
+        state.close();
+    }
+
+    /**
+     * take returns a key pair (the public key followed by the secret key) for
+     * a single message, which must be handed back through
+     * {@link #recycle(ByteBuffer)} once the message is sealed.
+     *
+     * @param owner
+     * @return
+     * @throws StodiumException
+     */
+    @NotNull
+    ByteBuffer take(final @NotNull Box owner)
+            throws StodiumException {
+        if (owner != state.box) {
+            throw new IllegalArgumentException("Stodium: EphemeralKeyPool belongs to a different Box primitive");
+        }
+
+        synchronized (state.ready) {
+            if (state.closed) {
+                throw new IllegalStateException("Stodium: EphemeralKeyPool has been closed");
+            }
+            final Integer slot = state.ready.pollFirst();
+            if (slot != null) {
+                return state.slots[slot];
+            }
+        }
+
+        final ByteBuffer keypair = StatePool.acquire(state.box.PUBLICKEYBYTES + state.box.SECRETKEYBYTES);
+        state.generate(keypair);
+        return keypair;
+    }
+
+    /**
+     * recycle wipes a key pair obtained from {@link #take(Box)}, and makes its
+     * slot available to the background thread again.
+     *
+     * @param keypair
+     */
+    void recycle(final @NotNull ByteBuffer keypair) {
+        final Integer slot = state.index.get(keypair);
+        if (slot == null) {
+            StatePool.release(keypair);
+            return;
+        }
+
+        Stodium.wipeBytes(keypair.duplicate());
+        synchronized (state.ready) {
+            state.free.addLast(slot);
+            state.ready.notifyAll();
+        }
+    }
+
+    @Override
+    protected void finalize()
+            throws Throwable {
+        try {
+            close();
+        } finally {
+            super.finalize();
+        }
+    }
+
+    /**
+     * State holds the key pairs of a pool, and is shared with the background
+     * thread that fills it.
+     */
+    private static final class State {
+        private final @NotNull Box          box;
+        private final @NotNull ByteBuffer[] slots;
+        private final @NotNull Map<ByteBuffer, Integer> index;
+
+        private final @NotNull ArrayDeque<Integer> ready;
+        private final @NotNull ArrayDeque<Integer> free;
+
+        private boolean closed;
+
+        State(final @NotNull Box box,
+              final          int capacity) {
+            final int        keypairBytes = box.PUBLICKEYBYTES + box.SECRETKEYBYTES;
+            final ByteBuffer arena        = ByteBuffer.allocateDirect(capacity * keypairBytes);
+
+            this.box   = box;
+            this.slots = new ByteBuffer[capacity];
+            this.index = new IdentityHashMap<>(capacity);
+            this.ready = new ArrayDeque<>(capacity);
+            this.free  = new ArrayDeque<>(capacity);
+            for (int i = 0; i < capacity; i++) {
+                final ByteBuffer slot = arena.duplicate();
+                slot.position(i * keypairBytes).limit((i + 1) * keypairBytes);
+                slots[i] = slot.slice();
+                index.put(slots[i], i);
+                free.addLast(i);
+            }
+        }
+
+        void start() {
+            final Thread producer = new Thread(new Runnable() {
+                @Override
+                public void run() {
+                    produce();
+                }
+            }, "stodium-ephemeral-keys");
+            producer.setDaemon(true);
+            producer.start();
+        }
+
+        void close() {
+            synchronized (ready) {
+                closed = true;
+                for (final Integer slot : ready) {
+                    Stodium.wipeBytes(slots[slot].duplicate());
+                }
+                ready.clear();
+                ready.notifyAll();
+            }
+        }
+
+        void generate(final @NotNull ByteBuffer keypair)
+                throws StodiumException {
+            final ByteBuffer pub  = keypair.duplicate();
+            final ByteBuffer priv = keypair.duplicate();
+            pub.limit(box.PUBLICKEYBYTES);
+            priv.position(box.PUBLICKEYBYTES);
+            box.keypair(pub, priv);
+        }
+
+        private void produce() {
+            while (true) {
+                final int slot;
+                synchronized (ready) {
+                    while (!closed && free.isEmpty()) {
+                        try {
+                            ready.wait();
+                        } catch (InterruptedException e) {
+                            return;
+                        }
+                    }
+                    if (closed) {
+                        return;
+                    }
+                    slot = free.pollFirst();
+                }
+
+                try {
+                    generate(slots[slot]);
+                } catch (StodiumException e) {
+                    // leave the slot out of rotation; seal falls back to
+                    // generating key pairs inline
+                    return;
+                }
+
+                synchronized (ready) {
+                    if (closed) {
+                        Stodium.wipeBytes(slots[slot].duplicate());
+                        return;
+                    }
+                    ready.addLast(slot);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.box;
+
+import eu.artemisc.stodium.NativeResource;
+import eu.artemisc.stodium.StodiumJNI;
+
+/**
+ * SharedKey is a reference counted precomputed Box key, held in guarded native
+ * memory with the same layout as a {@link eu.artemisc.stodium.KeyHandle}. The
+ * {@link SharedKeyCache} holds one reference for as long as the key is cached,
+ * and every operation using the key holds another, so that a key evicted by
+ * one thread is not freed while another thread is still using it.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+final class SharedKey
+        extends NativeResource {
+
+    private int refs = 1;
+
+    SharedKey(final long handle) {
+        super(handle);
+    }
+
+    synchronized void retain() {
+        refs++;
+    }
+
+    void release() {
+        final boolean last;
+        synchronized (this) {
+            last = --refs == 0;
+        }
+        if (last) {
+            close();
+        }
+    }
+
+    @Override
+    protected void free(final long pointer) {
+        StodiumJNI.stodium_key_handle_free(pointer);
+    }
+}
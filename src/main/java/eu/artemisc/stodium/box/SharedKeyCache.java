@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.box;
+
+import org.jetbrains.annotations.NotNull;
+
+import java.io.Closeable;
+import java.nio.ByteBuffer;
+import java.util.LinkedHashMap;
+import java.util.Map;
+
+import eu.artemisc.stodium.KeyHandle;
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.exceptions.OperationFailedException;
+import eu.artemisc.stodium.exceptions.StodiumException;
+import eu.artemisc.stodium.shorthash.ShortHash;
+
+/**
+ * SharedKeyCache keeps the shared keys computed by
+ * {@link Box#beforenm(ByteBuffer, ByteBuffer, ByteBuffer)} for the most
+ * recently used (local secret key, remote public key) pairs, so that the Box
+ * methods that accept a cache only pay for the X25519 scalar multiplication
+ * the first time a peer is seen.
+ * <p>
+ * Entries are looked up by the 128 bit SipHash (siphashx24) of the secret key
+ * and the public key, under a random key generated for every cache, so
+ * neither key is kept on the heap. The shared keys themselves live in guarded
+ * native memory. Once the cache holds capacity entries, the least recently
+ * used entry is evicted; its memory is wiped and freed as soon as no other
+ * thread is using it anymore.
+ * <p>
+ * A cache belongs to a single Box primitive, and may be shared between
+ * threads.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public final class SharedKeyCache
+        implements Closeable {
+
+    private static final @NotNull ShortHash SIPHASH = ShortHash.siphashx24Instance();
+
+    private final @NotNull Box       box;
+    private final @NotNull KeyHandle idKey;
+    private final @NotNull Map<Id, SharedKey> entries;
+
+    private final @NotNull ThreadLocal<ByteBuffer> scratch;
+
+    private boolean closed;
+
+    /**
+     *
+     * @param box the primitive the cached keys are computed for
+     * @param capacity the maximum number of keys kept by the cache
+     * @throws StodiumException if the guarded memory could not be allocated
+     */
+    public SharedKeyCache(final @NotNull Box box,
+                          final          int capacity)
+            throws StodiumException {
+        Stodium.checkSize(capacity, 1, Integer.MAX_VALUE);
+
+        this.box   = box;
+        this.idKey = KeyHandle.random(SIPHASH.keyBytes());
+        this.entries = new LinkedHashMap<Id, SharedKey>(16, 0.75f, true) {
+            @Override
+            protected boolean removeEldestEntry(final Map.Entry<Id, SharedKey> eldest) {
+                if (size() <= capacity) {
+                    return false;
+                }
+                eldest.getValue().release();
+                return true;
+            }
+        };
+
+        final int inputBytes = box.SECRETKEYBYTES + box.PUBLICKEYBYTES + SIPHASH.bytes();
+        this.scratch = new ThreadLocal<ByteBuffer>() {
+            @Override
+            protected ByteBuffer initialValue() {
+                return ByteBuffer.allocateDirect(inputBytes);
+            }
+        };
+    }
+
+    /**
+     *
+     * @return the number of keys currently held by the cache
+     */
+    public int size() {
+        synchronized (entries) {
+            return entries.size();
+        }
+    }
+
+    /**
+     * clear evicts all keys from the cache.
+     */
+    public void clear() {
+        synchronized (entries) {
+            for (final SharedKey key : entries.values()) {
+                key.release();
+            }
+            entries.clear();
+        }
+    }
+
+    /**
+     * close evicts all keys and wipes the lookup key. Operations that are
+     * still using a key keep it alive until they complete; later operations
+     * on a closed cache throw an IllegalStateException.
+     */
+    @Override
+    public void close() {
+        synchronized (entries) {
+            closed = true;
+        }
+        clear();
+        idKey.close();
+    }
+
+    /**
+     * acquire returns the shared key for the given key pair, computing it if
+     * it is not cached. The caller owns a reference to the returned key, and
+     * must release it once it is done.
+     *
+     * @param owner
+     * @param remotePubKey
+     * @param localPrivKey
+     * @return
+     * @throws StodiumException
+     */
+    @NotNull
+    SharedKey acquire(final @NotNull Box        owner,
+                      final @NotNull ByteBuffer remotePubKey,
+                      final @NotNull ByteBuffer localPrivKey)
+            throws StodiumException {
+        if (owner != box) {
+            throw new IllegalArgumentException("Stodium: SharedKeyCache belongs to a different Box primitive");
+        }
+        Stodium.checkSize(localPrivKey.remaining(), box.SECRETKEYBYTES);
+        Stodium.checkSizeMin(remotePubKey.remaining(), box.PUBLICKEYBYTES);
+
+        final Id id = id(remotePubKey, localPrivKey);
+        synchronized (entries) {
+            final SharedKey cached = entries.get(id);
+            if (cached != null) {
+                cached.retain();
+                return cached;
+            }
+        }
+
+        // The scalar multiplication runs outside of the lock; if another
+        // thread computed the same key in the meantime, its key is kept
+        final long handle = box.nativeBeforenm(
+                Stodium.ensureUsableByteBuffer(remotePubKey),
+                Stodium.ensureUsableByteBuffer(localPrivKey));
+        if (handle == 0L) {
+            throw new OperationFailedException("Stodium: could not compute shared key");
+        }
+        final SharedKey key = new SharedKey(handle);
+
+        synchronized (entries) {
+            final SharedKey cached = entries.get(id);
+            if (cached != null) {
+                cached.retain();
+                key.release();
+                return cached;
+            }
+            if (!closed) {
+                key.retain();
+                entries.put(id, key);
+            }
+        }
+        return key;
+    }
+
+    /**
+     * id computes the lookup key of a key pair. The secret key is only copied
+     * into a direct scratch buffer, which is wiped before returning.
+     */
+    @NotNull
+    private Id id(final @NotNull ByteBuffer remotePubKey,
+                  final @NotNull ByteBuffer localPrivKey)
+            throws StodiumException {
+        final ByteBuffer buff = scratch.get();
+        buff.clear();
+
+        final ByteBuffer in = buff.duplicate();
+        in.limit(box.SECRETKEYBYTES + box.PUBLICKEYBYTES);
+        final ByteBuffer priv = localPrivKey.duplicate();
+        priv.limit(priv.position() + box.SECRETKEYBYTES);
+        in.put(priv);
+        final ByteBuffer pub = remotePubKey.duplicate();
+        pub.limit(pub.position() + box.PUBLICKEYBYTES);
+        in.put(pub);
+        in.flip();
+
+        final ByteBuffer out = buff.duplicate();
+        out.position(box.SECRETKEYBYTES + box.PUBLICKEYBYTES);
+
+        try {
+            SIPHASH.hash(out, in, idKey);
+            return new Id(out.getLong(out.position()), out.getLong(out.position() + 8));
+        } finally {
+            Stodium.wipeBytes(buff.duplicate());
+        }
+    }
+
+    private static final class Id {
+        private final long high;
+        private final long low;
+
+        Id(final long high,
+           final long low) {
+            this.high = high;
+            this.low  = low;
+        }
+
+        @Override
+        public boolean equals(final Object other) {
+            if (!(other instanceof Id)) {
+                return false;
+            }
+            final Id id = (Id) other;
+            return high == id.high && low == id.low;
+        }
+
+        @Override
+        public int hashCode() {
+            return (int) (high ^ (high >>> 32));
+        }
+    }
+}
@@ -6,6 +6,7 @@ import org.jetbrains.annotations.Nullable;
 import java.nio.ByteBuffer;
 
 import eu.artemisc.stodium.Multipart;
+import eu.artemisc.stodium.StatePool;
 import eu.artemisc.stodium.Stodium;
 import eu.artemisc.stodium.StodiumJNI;
 import eu.artemisc.stodium.exceptions.StodiumException;
@@ -25,7 +26,8 @@ final class Blake
                 StodiumJNI.crypto_generichash_blake2b_keybytes(),
                 StodiumJNI.crypto_generichash_blake2b_keybytes_min(),
                 StodiumJNI.crypto_generichash_blake2b_keybytes_max(),
-                StodiumJNI.crypto_generichash_blake2b_statebytes());
+                StodiumJNI.crypto_generichash_blake2b_statebytes(),
+                StodiumJNI.crypto_generichash_blake2b_tree_leafbytes());
     }
 
     @Override
@@ -77,12 +79,34 @@ final class Blake
             Stodium.checkSize(key.remaining(), KEYBYTES_MIN, KEYBYTES_MAX);
         }
         Stodium.checkSize(outlen, BYTES_MIN, BYTES_MAX);
-        state = ByteBuffer.allocateDirect(STATEBYTES);
+        state = StatePool.acquire(STATEBYTES);
 
         Stodium.checkStatus(StodiumJNI.crypto_generichash_blake2b_init(
                 state, key == null ? null : Stodium.ensureUsableByteBuffer(key), outlen));
 
-        return new Multipart<>(this, state);
+        return new Multipart<>(this, state, true);
+    }
+
+    @NotNull
+    @Override
+    public Multipart<Hash> init(final @Nullable byte[] key,
+                                final           int    keyOffset,
+                                final           int    keyLength,
+                                final           int    outlen)
+            throws StodiumException {
+        final ByteBuffer state;
+
+        if (key != null) {
+            Stodium.checkSize(keyLength, KEYBYTES_MIN, KEYBYTES_MAX);
+            Stodium.checkOffsetParams(key.length, keyOffset, keyLength);
+        }
+        Stodium.checkSize(outlen, BYTES_MIN, BYTES_MAX);
+        state = StatePool.acquire(STATEBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_generichash_blake2b_init_array(
+                state, key, keyOffset, key == null ? 0 : keyLength, outlen));
+
+        return new Multipart<>(this, state, true);
     }
 
     @Override
@@ -97,6 +121,21 @@ final class Blake
                 Stodium.ensureUsableByteBuffer(in)));
     }
 
+    @Override
+    public void update(final @NotNull ByteBuffer   state,
+                       final @NotNull ByteBuffer[] in,
+                       final          int          offset,
+                       final          int          length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_generichash_blake2b_updatev(
+                Stodium.ensureUsableByteBuffer(state),
+                Stodium.ensureUsableByteBuffers(in, offset, length),
+                offset, length));
+    }
+
     @Override
     public void doFinal(final @NotNull ByteBuffer state,
                         final @NotNull ByteBuffer dst)
@@ -111,4 +150,181 @@ final class Blake
                 Stodium.ensureUsableByteBuffer(state),
                 Stodium.ensureUsableByteBuffer(dst)));
     }
+
+    @Override
+    public void update(final @NotNull ByteBuffer state,
+                       final @NotNull byte[]     in,
+                       final          int        offset,
+                       final          int        length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_generichash_blake2b_update_array(
+                Stodium.ensureUsableByteBuffer(state),
+                in, offset, length));
+    }
+
+    @Override
+    public void doFinal(final @NotNull ByteBuffer state,
+                        final @NotNull byte[]     dst,
+                        final          int        offset,
+                        final          int        length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+        Stodium.checkSize(length, BYTES_MIN, BYTES_MAX);
+
+        Stodium.checkStatus(StodiumJNI.crypto_generichash_blake2b_final_array(
+                Stodium.ensureUsableByteBuffer(state),
+                dst, offset, length));
+    }
+
+    @Override
+    protected int nativeHash(final @NotNull  byte[] dstHash,
+                             final           int    dstHashOffset,
+                             final           int    dstHashLength,
+                             final @NotNull  byte[] src,
+                             final           int    srcOffset,
+                             final           int    srcLength,
+                             final @Nullable byte[] key,
+                             final           int    keyOffset,
+                             final           int    keyLength) {
+        return StodiumJNI.crypto_generichash_blake2b_array(
+                dstHash, dstHashOffset, dstHashLength,
+                src, srcOffset, srcLength,
+                key, keyOffset, keyLength);
+    }
+
+    @Override
+    protected int nativeHash(final long dstHash,
+                             final int  dstHashLength,
+                             final long src,
+                             final int  srcLength,
+                             final long key,
+                             final int  keyLength) {
+        return StodiumJNI.crypto_generichash_blake2b_address(
+                dstHash, dstHashLength,
+                src, srcLength,
+                key, keyLength);
+    }
+
+    @Override
+    protected int nativeInit(final long state,
+                             final int  stateLength,
+                             final long key,
+                             final int  keyLength,
+                             final int  outlen) {
+        return StodiumJNI.crypto_generichash_blake2b_init_address(
+                state, stateLength,
+                key, keyLength,
+                outlen);
+    }
+
+    @Override
+    protected int nativeUpdate(final long state,
+                               final int  stateLength,
+                               final long src,
+                               final int  srcLength) {
+        return StodiumJNI.crypto_generichash_blake2b_update_address(
+                state, stateLength,
+                src, srcLength);
+    }
+
+    @Override
+    protected int nativeFinal(final long state,
+                              final int  stateLength,
+                              final long dst,
+                              final int  dstLength) {
+        return StodiumJNI.crypto_generichash_blake2b_final_address(
+                state, stateLength,
+                dst, dstLength);
+    }
+
+    @Override
+    protected int nativeHashFile(final @NotNull ByteBuffer dstHash,
+                                 final          int        fd,
+                                 final          long       offset,
+                                 final          long       length) {
+        return nativeHashFile(dstHash, fd, offset, length, null);
+    }
+
+    @Override
+    protected int nativeHashFile(final @NotNull ByteBuffer dstHash,
+                                 final @NotNull String     path,
+                                 final          long       offset,
+                                 final          long       length) {
+        return nativeHashFile(dstHash, path, offset, length, null);
+    }
+
+    @Override
+    protected int nativeHashFile(final @NotNull  ByteBuffer dstHash,
+                                 final           int        fd,
+                                 final           long       offset,
+                                 final           long       length,
+                                 final @Nullable ByteBuffer key) {
+        return StodiumJNI.crypto_generichash_blake2b_fd(dstHash, key, fd, offset, length);
+    }
+
+    @Override
+    protected int nativeHashFile(final @NotNull  ByteBuffer dstHash,
+                                 final @NotNull  String     path,
+                                 final           long       offset,
+                                 final           long       length,
+                                 final @Nullable ByteBuffer key) {
+        return StodiumJNI.crypto_generichash_blake2b_file(dstHash, key, path, offset, length);
+    }
+
+    @Override
+    protected int nativeHashTreeLeaves(final @NotNull  ByteBuffer dstLeaves,
+                                       final @NotNull  ByteBuffer src,
+                                       final           int        leafSize,
+                                       final           long       firstLeaf,
+                                       final @Nullable ByteBuffer key) {
+        return StodiumJNI.crypto_generichash_blake2b_tree_leaves(
+                dstLeaves, src, key, leafSize, firstLeaf);
+    }
+
+    @Override
+    protected int nativeHashTreeLeaves(final @NotNull  ByteBuffer dstLeaves,
+                                       final           int        fd,
+                                       final           long       length,
+                                       final           int        leafSize,
+                                       final           long       firstLeaf,
+                                       final @Nullable ByteBuffer key) {
+        return StodiumJNI.crypto_generichash_blake2b_tree_leaves_fd(
+                dstLeaves, key, fd, length, leafSize, firstLeaf);
+    }
+
+    @Override
+    protected int nativeHashTreeLeaves(final @NotNull  ByteBuffer dstLeaves,
+                                       final @NotNull  String     path,
+                                       final           long       length,
+                                       final           int        leafSize,
+                                       final           long       firstLeaf,
+                                       final @Nullable ByteBuffer key) {
+        return StodiumJNI.crypto_generichash_blake2b_tree_leaves_file(
+                dstLeaves, key, path, length, leafSize, firstLeaf);
+    }
+
+    @Override
+    protected int nativeHashTreeParents(final @NotNull  ByteBuffer dstParents,
+                                        final @NotNull  ByteBuffer children,
+                                        final           int        leafSize,
+                                        final           int        depth,
+                                        final           long       firstNode,
+                                        final @Nullable ByteBuffer key) {
+        return StodiumJNI.crypto_generichash_blake2b_tree_parents(
+                dstParents, children, key, leafSize, depth, firstNode);
+    }
+
+    @Override
+    protected int nativeHashTreeRoot(final @NotNull  ByteBuffer dstHash,
+                                     final @NotNull  ByteBuffer leaves,
+                                     final           int        leafSize,
+                                     final @Nullable ByteBuffer key) {
+        return StodiumJNI.crypto_generichash_blake2b_tree_root(
+                dstHash, leaves, key, leafSize);
+    }
 }
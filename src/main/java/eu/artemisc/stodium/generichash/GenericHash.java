@@ -10,10 +10,14 @@ package eu.artemisc.stodium.generichash;
 import org.jetbrains.annotations.NotNull;
 import org.jetbrains.annotations.Nullable;
 
+import java.io.File;
 import java.nio.ByteBuffer;
 
 import eu.artemisc.stodium.Multipart;
 import eu.artemisc.stodium.Singleton;
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.ThreadPool;
+import eu.artemisc.stodium.exceptions.ConstraintViolationException;
 import eu.artemisc.stodium.exceptions.StodiumException;
 import eu.artemisc.stodium.hash.Hash;
 
@@ -48,6 +52,7 @@ public abstract class GenericHash
     final int KEYBYTES_MAX;
     final int BYTES_MIN;
     final int BYTES_MAX;
+    final int TREE_LEAFBYTES;
 
     /**
      *
@@ -58,6 +63,7 @@ public abstract class GenericHash
      * @param keyMin
      * @param keyMax
      * @param state
+     * @param treeLeaf
      */
     protected GenericHash(final int bytes,
                           final int bytesMin,
@@ -65,13 +71,15 @@ public abstract class GenericHash
                           final int key,
                           final int keyMin,
                           final int keyMax,
-                          final int state) {
+                          final int state,
+                          final int treeLeaf) {
         super(bytes, state);
-        KEYBYTES     = key;
-        KEYBYTES_MIN = keyMin;
-        KEYBYTES_MAX = keyMax;
-        BYTES_MIN    = bytesMin;
-        BYTES_MAX    = bytesMax;
+        KEYBYTES       = key;
+        KEYBYTES_MIN   = keyMin;
+        KEYBYTES_MAX   = keyMax;
+        BYTES_MIN      = bytesMin;
+        BYTES_MAX      = bytesMax;
+        TREE_LEAFBYTES = treeLeaf;
     }
 
     /**
@@ -114,6 +122,14 @@ public abstract class GenericHash
         return KEYBYTES_MAX;
     }
 
+    /**
+     *
+     * @return the size of a single leaf digest of a tree hash
+     */
+    public final int treeLeafBytes() {
+        return TREE_LEAFBYTES;
+    }
+
     /**
      *
      * @param dstHash
@@ -147,4 +163,626 @@ public abstract class GenericHash
     public abstract Multipart<Hash> init(final @Nullable ByteBuffer key,
                                          final           int        outlen)
             throws StodiumException;
+
+    /**
+     * init is the byte[] counterpart of {@link #init(ByteBuffer, int)}. The
+     * key may be omitted by passing null.
+     *
+     * @param key
+     * @param keyOffset
+     * @param keyLength
+     * @param outlen
+     * @return
+     * @throws StodiumException
+     */
+    @NotNull
+    public abstract Multipart<Hash> init(final @Nullable byte[] key,
+                                         final           int    keyOffset,
+                                         final           int    keyLength,
+                                         final           int    outlen)
+            throws StodiumException;
+
+    //
+    // byte[] overloads
+    //
+
+    /**
+     * hash is the byte[] counterpart of the ByteBuffer based hash method. The
+     * length of the digest is given by dstHashLength, which must lie between
+     * {@link #bytesMin()} and {@link #bytesMax()}.
+     *
+     * @param dstHash
+     * @param dstHashOffset
+     * @param dstHashLength
+     * @param src
+     * @param srcOffset
+     * @param srcLength
+     * @param key
+     * @param keyOffset
+     * @param keyLength
+     * @throws StodiumException
+     */
+    public final void hash(final @NotNull  byte[] dstHash,
+                           final           int    dstHashOffset,
+                           final           int    dstHashLength,
+                           final @NotNull  byte[] src,
+                           final           int    srcOffset,
+                           final           int    srcLength,
+                           final @Nullable byte[] key,
+                           final           int    keyOffset,
+                           final           int    keyLength)
+            throws StodiumException {
+        Stodium.checkSize(dstHashLength, BYTES_MIN, BYTES_MAX);
+        Stodium.checkOffsetParams(dstHash.length, dstHashOffset, dstHashLength);
+        Stodium.checkOffsetParams(src.length, srcOffset, srcLength);
+        if (key != null) {
+            Stodium.checkSize(keyLength, KEYBYTES_MIN, KEYBYTES_MAX);
+            Stodium.checkOffsetParams(key.length, keyOffset, keyLength);
+        }
+
+        Stodium.checkStatus(nativeHash(
+                dstHash, dstHashOffset, dstHashLength,
+                src, srcOffset, srcLength,
+                key, keyOffset, key == null ? 0 : keyLength));
+    }
+
+    //
+    // byte[] bindings, implemented by the primitives
+    //
+
+    protected abstract int nativeHash(final @NotNull  byte[] dstHash,
+                                      final           int    dstHashOffset,
+                                      final           int    dstHashLength,
+                                      final @NotNull  byte[] src,
+                                      final           int    srcOffset,
+                                      final           int    srcLength,
+                                      final @Nullable byte[] key,
+                                      final           int    keyOffset,
+                                      final           int    keyLength);
+
+    //
+    // raw address overloads
+    //
+
+    /**
+     * hash is the raw address counterpart of the ByteBuffer based hash method,
+     * for memory managed by the caller. The length of the digest is given by
+     * dstHashLength, which must lie between {@link #bytesMin()} and
+     * {@link #bytesMax()}. The key may be omitted by passing 0 for both the
+     * address and its length.
+     *
+     * @param dstHash
+     * @param dstHashLength
+     * @param src
+     * @param srcLength
+     * @param key
+     * @param keyLength
+     * @throws StodiumException
+     */
+    public final void hash(final long dstHash,
+                           final int  dstHashLength,
+                           final long src,
+                           final int  srcLength,
+                           final long key,
+                           final int  keyLength)
+            throws StodiumException {
+        Stodium.checkSize(dstHashLength, BYTES_MIN, BYTES_MAX);
+        Stodium.checkAddress(dstHash, dstHashLength);
+        Stodium.checkAddress(src, srcLength);
+        Stodium.checkOptionalAddress(key, keyLength);
+        if (key != 0L) {
+            Stodium.checkSize(keyLength, KEYBYTES_MIN, KEYBYTES_MAX);
+        }
+
+        Stodium.checkStatus(nativeHash(
+                dstHash, dstHashLength,
+                src, srcLength,
+                key, keyLength));
+    }
+
+    /**
+     * init initializes the {@link #stateBytes()} bytes of hash state at the
+     * given address, for a digest of outlen bytes.
+     *
+     * @param state
+     * @param key
+     * @param keyLength
+     * @param outlen
+     * @throws StodiumException
+     */
+    public final void init(final long state,
+                           final long key,
+                           final int  keyLength,
+                           final int  outlen)
+            throws StodiumException {
+        Stodium.checkAddress(state, STATEBYTES);
+        Stodium.checkOptionalAddress(key, keyLength);
+        if (key != 0L) {
+            Stodium.checkSize(keyLength, KEYBYTES_MIN, KEYBYTES_MAX);
+        }
+        Stodium.checkSize(outlen, BYTES_MIN, BYTES_MAX);
+
+        Stodium.checkStatus(nativeInit(
+                state, STATEBYTES,
+                key, keyLength,
+                outlen));
+    }
+
+    /**
+     * update absorbs srcLength bytes at src into the hash state at the given
+     * address, which was set up through {@link #init(long, long, int, int)}.
+     *
+     * @param state
+     * @param src
+     * @param srcLength
+     * @throws StodiumException
+     */
+    public final void update(final long state,
+                             final long src,
+                             final int  srcLength)
+            throws StodiumException {
+        Stodium.checkAddress(state, STATEBYTES);
+        Stodium.checkAddress(src, srcLength);
+
+        Stodium.checkStatus(nativeUpdate(
+                state, STATEBYTES,
+                src, srcLength));
+    }
+
+    /**
+     * doFinal writes the digest of the hash state at the given address to
+     * dst. dstLength must match the outlen the state was initialized with.
+     *
+     * @param state
+     * @param dst
+     * @param dstLength
+     * @throws StodiumException
+     */
+    public final void doFinal(final long state,
+                              final long dst,
+                              final int  dstLength)
+            throws StodiumException {
+        Stodium.checkAddress(state, STATEBYTES);
+        Stodium.checkSize(dstLength, BYTES_MIN, BYTES_MAX);
+        Stodium.checkAddress(dst, dstLength);
+
+        Stodium.checkStatus(nativeFinal(
+                state, STATEBYTES,
+                dst, dstLength));
+    }
+
+    //
+    // raw address bindings, implemented by the primitives
+    //
+
+    protected abstract int nativeHash(final long dstHash,
+                                      final int  dstHashLength,
+                                      final long src,
+                                      final int  srcLength,
+                                      final long key,
+                                      final int  keyLength);
+
+    protected abstract int nativeInit(final long state,
+                                      final int  stateLength,
+                                      final long key,
+                                      final int  keyLength,
+                                      final int  outlen);
+
+    protected abstract int nativeUpdate(final long state,
+                                        final int  stateLength,
+                                        final long src,
+                                        final int  srcLength);
+
+    protected abstract int nativeFinal(final long state,
+                                       final int  stateLength,
+                                       final long dst,
+                                       final int  dstLength);
+
+    //
+    // keyed files
+    //
+
+    /**
+     * hashFile is the keyed variant of
+     * {@link Hash#hashFile(ByteBuffer, int, long, long)}. The length of the
+     * digest is given by dstHash.remaining(), which must lie between
+     * {@link #bytesMin()} and {@link #bytesMax()}.
+     *
+     * @param dstHash
+     * @param fd
+     * @param offset
+     * @param length
+     * @param key
+     * @throws StodiumException
+     */
+    public final void hashFile(final @NotNull  ByteBuffer dstHash,
+                               final           int        fd,
+                               final           long       offset,
+                               final           long       length,
+                               final @Nullable ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstHash);
+
+        Stodium.checkSize(dstHash.remaining(), BYTES_MIN, BYTES_MAX);
+        if (key != null) {
+            Stodium.checkSize(key.remaining(), KEYBYTES_MIN, KEYBYTES_MAX);
+        }
+        Stodium.checkSize(fd, 0, Integer.MAX_VALUE);
+        Stodium.checkSize(offset, 0L, Long.MAX_VALUE);
+
+        Stodium.checkFileStatus(nativeHashFile(
+                Stodium.ensureUsableByteBuffer(dstHash),
+                fd, offset, length,
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * hashFile is the keyed variant of
+     * {@link Hash#hashFile(ByteBuffer, String, long, long)}.
+     *
+     * @param dstHash
+     * @param path
+     * @param offset
+     * @param length
+     * @param key
+     * @throws StodiumException
+     * @see #hashFile(ByteBuffer, int, long, long, ByteBuffer)
+     */
+    public final void hashFile(final @NotNull  ByteBuffer dstHash,
+                               final @NotNull  String     path,
+                               final           long       offset,
+                               final           long       length,
+                               final @Nullable ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstHash);
+
+        Stodium.checkSize(dstHash.remaining(), BYTES_MIN, BYTES_MAX);
+        if (key != null) {
+            Stodium.checkSize(key.remaining(), KEYBYTES_MIN, KEYBYTES_MAX);
+        }
+        Stodium.checkSize(offset, 0L, Long.MAX_VALUE);
+
+        Stodium.checkFileStatus(nativeHashFile(
+                Stodium.ensureUsableByteBuffer(dstHash),
+                path, offset, length,
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    //
+    // keyed file bindings, implemented by the primitives
+    //
+
+    protected abstract int nativeHashFile(final @NotNull  ByteBuffer dstHash,
+                                          final           int        fd,
+                                          final           long       offset,
+                                          final           long       length,
+                                          final @Nullable ByteBuffer key);
+
+    protected abstract int nativeHashFile(final @NotNull  ByteBuffer dstHash,
+                                          final @NotNull  String     path,
+                                          final           long       offset,
+                                          final           long       length,
+                                          final @Nullable ByteBuffer key);
+
+    //
+    // tree hashing
+    //
+
+    /**
+     * treeLeafCount returns the number of leaves of a tree hash over length
+     * bytes of data. Empty data consists of a single empty leaf.
+     *
+     * @param leafSize
+     * @param length
+     * @return
+     */
+    public static long treeLeafCount(final int  leafSize,
+                                     final long length) {
+        return length == 0L ? 1L : (length + leafSize - 1) / leafSize;
+    }
+
+    /**
+     * hashTree computes the tree hash of src. The data is split in leaves of
+     * leafSize bytes, which are hashed in parallel on the native
+     * {@link ThreadPool}, after which the leaf digests are combined into the
+     * root digest that is written to dstHash.
+     * <p>
+     * A tree hash differs from the plain hash of the same data, and depends on
+     * the leaf size. Every node is hashed with a dedicated personalization and
+     * a salt that holds its position in the tree, in place of the BLAKE2b node
+     * parameters.
+     *
+     * @param dstHash
+     * @param src
+     * @param leafSize
+     * @param key
+     * @throws StodiumException
+     */
+    public final void hashTree(final @NotNull  ByteBuffer dstHash,
+                               final @NotNull  ByteBuffer src,
+                               final           int        leafSize,
+                               final @Nullable ByteBuffer key)
+            throws StodiumException {
+        final long       count;
+        final ByteBuffer leaves;
+
+        Stodium.checkSize(leafSize, 1, Integer.MAX_VALUE);
+        count = treeLeafCount(leafSize, src.remaining());
+        Stodium.checkSize(count, 1L, Integer.MAX_VALUE / TREE_LEAFBYTES);
+        leaves = ByteBuffer.allocateDirect((int) count * TREE_LEAFBYTES);
+
+        hashTreeLeaves(leaves, src, leafSize, 0L, key);
+        hashTreeRoot(dstHash, leaves, leafSize, key);
+    }
+
+    /**
+     * hashTreeFile computes the tree hash of the file at the given path,
+     * mapping the file into memory one leaf at a time.
+     *
+     * @param dstHash
+     * @param path
+     * @param leafSize
+     * @param key
+     * @throws StodiumException
+     * @see #hashTree(ByteBuffer, ByteBuffer, int, ByteBuffer)
+     */
+    public final void hashTreeFile(final @NotNull  ByteBuffer dstHash,
+                                   final @NotNull  String     path,
+                                   final           int        leafSize,
+                                   final @Nullable ByteBuffer key)
+            throws StodiumException {
+        final long       length, count;
+        final ByteBuffer leaves;
+
+        Stodium.checkSize(leafSize, 1, Integer.MAX_VALUE);
+        length = new File(path).length();
+        count  = treeLeafCount(leafSize, length);
+        Stodium.checkSize(count, 1L, Integer.MAX_VALUE / TREE_LEAFBYTES);
+        leaves = ByteBuffer.allocateDirect((int) count * TREE_LEAFBYTES);
+
+        hashTreeLeaves(leaves, path, length, leafSize, 0L, key);
+        hashTreeRoot(dstHash, leaves, leafSize, key);
+    }
+
+    /**
+     * hashTreeLeaves hashes src as the consecutive leaves of a tree starting
+     * at leaf firstLeaf, and writes their digests to dstLeaves. Only the last
+     * leaf of the data may be shorter than leafSize.
+     * <p>
+     * When part of the data changes, only the affected leaves have to be
+     * hashed again: pass the changed leaves, and the matching window of the
+     * stored leaf digests as dstLeaves, then recompute the root through
+     * {@link #hashTreeRoot(ByteBuffer, ByteBuffer, int, ByteBuffer)}.
+     *
+     * @param dstLeaves
+     * @param src
+     * @param leafSize
+     * @param firstLeaf
+     * @param key
+     * @throws StodiumException
+     */
+    public final void hashTreeLeaves(final @NotNull  ByteBuffer dstLeaves,
+                                     final @NotNull  ByteBuffer src,
+                                     final           int        leafSize,
+                                     final           long       firstLeaf,
+                                     final @Nullable ByteBuffer key)
+            throws StodiumException {
+        final int leaves;
+
+        Stodium.checkDestinationWritable(dstLeaves);
+
+        Stodium.checkSize(leafSize, 1, Integer.MAX_VALUE);
+        Stodium.checkSize(firstLeaf, 0L, Long.MAX_VALUE);
+        checkTreeKey(key);
+        leaves = (int) treeLeafCount(leafSize, src.remaining());
+        Stodium.checkSize(dstLeaves.remaining(), (long) leaves * TREE_LEAFBYTES, Long.MAX_VALUE);
+
+        Stodium.checkStatus(nativeHashTreeLeaves(
+                Stodium.ensureUsableByteBuffer(Stodium.window(dstLeaves, 0, leaves * TREE_LEAFBYTES)),
+                Stodium.ensureUsableByteBuffer(src),
+                leafSize,
+                firstLeaf,
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * hashTreeLeaves hashes dstLeaves.remaining() / {@link #treeLeafBytes()}
+     * consecutive leaves of the file behind the given descriptor, starting at
+     * leaf firstLeaf. The leaves must lie within the file, which must be
+     * exactly length bytes long: the call fails if the file has been resized,
+     * as its leaves would no longer match the tree.
+     *
+     * @param dstLeaves
+     * @param fd
+     * @param length
+     * @param leafSize
+     * @param firstLeaf
+     * @param key
+     * @throws StodiumException
+     * @see #hashTreeLeaves(ByteBuffer, ByteBuffer, int, long, ByteBuffer)
+     */
+    public final void hashTreeLeaves(final @NotNull  ByteBuffer dstLeaves,
+                                     final           int        fd,
+                                     final           long       length,
+                                     final           int        leafSize,
+                                     final           long       firstLeaf,
+                                     final @Nullable ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstLeaves);
+
+        checkTreeLeaves(dstLeaves);
+        Stodium.checkSize(fd, 0, Integer.MAX_VALUE);
+        Stodium.checkSize(length, 0L, Long.MAX_VALUE);
+        Stodium.checkSize(leafSize, 1, Integer.MAX_VALUE);
+        Stodium.checkSize(firstLeaf, 0L, Long.MAX_VALUE / leafSize);
+        checkTreeKey(key);
+
+        Stodium.checkFileStatus(nativeHashTreeLeaves(
+                Stodium.ensureUsableByteBuffer(dstLeaves),
+                fd,
+                length,
+                leafSize,
+                firstLeaf,
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * hashTreeLeaves is the same as
+     * {@link #hashTreeLeaves(ByteBuffer, int, long, int, long, ByteBuffer)}, for
+     * the file at the given path.
+     *
+     * @param dstLeaves
+     * @param path
+     * @param length
+     * @param leafSize
+     * @param firstLeaf
+     * @param key
+     * @throws StodiumException
+     */
+    public final void hashTreeLeaves(final @NotNull  ByteBuffer dstLeaves,
+                                     final @NotNull  String     path,
+                                     final           long       length,
+                                     final           int        leafSize,
+                                     final           long       firstLeaf,
+                                     final @Nullable ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstLeaves);
+
+        checkTreeLeaves(dstLeaves);
+        Stodium.checkSize(length, 0L, Long.MAX_VALUE);
+        Stodium.checkSize(leafSize, 1, Integer.MAX_VALUE);
+        Stodium.checkSize(firstLeaf, 0L, Long.MAX_VALUE / leafSize);
+        checkTreeKey(key);
+
+        Stodium.checkFileStatus(nativeHashTreeLeaves(
+                Stodium.ensureUsableByteBuffer(dstLeaves),
+                path,
+                length,
+                leafSize,
+                firstLeaf,
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * hashTreeRoot combines all leaf digests of a tree into the root digest,
+     * written to dstHash. The length of the digest is given by
+     * dstHash.remaining(), which must lie between {@link #bytesMin()} and
+     * {@link #bytesMax()}.
+     *
+     * @param dstHash
+     * @param leaves
+     * @param leafSize
+     * @param key
+     * @throws StodiumException
+     */
+    public final void hashTreeRoot(final @NotNull  ByteBuffer dstHash,
+                                   final @NotNull  ByteBuffer leaves,
+                                   final           int        leafSize,
+                                   final @Nullable ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstHash);
+
+        Stodium.checkSize(dstHash.remaining(), BYTES_MIN, BYTES_MAX);
+        checkTreeLeaves(leaves);
+        Stodium.checkSize(leafSize, 1, Integer.MAX_VALUE);
+        checkTreeKey(key);
+
+        Stodium.checkStatus(nativeHashTreeRoot(
+                Stodium.ensureUsableByteBuffer(dstHash),
+                Stodium.ensureUsableByteBuffer(leaves),
+                leafSize,
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * hashTreeParents hashes the consecutive child digests in children into
+     * the interior nodes at the given depth of a binary tree, starting at node
+     * firstNode, and writes their digests to dstParents. Node i covers
+     * children 2i and 2i + 1; the last node of a level may cover a single
+     * child. This is the building block of {@link MerkleTree}.
+     *
+     * @param dstParents
+     * @param children
+     * @param leafSize
+     * @param depth the depth of the parents, 1 for the parents of the leaves
+     * @param firstNode
+     * @param key
+     * @throws StodiumException
+     */
+    public final void hashTreeParents(final @NotNull  ByteBuffer dstParents,
+                                      final @NotNull  ByteBuffer children,
+                                      final           int        leafSize,
+                                      final           int        depth,
+                                      final           long       firstNode,
+                                      final @Nullable ByteBuffer key)
+            throws StodiumException {
+        final int parents;
+
+        Stodium.checkDestinationWritable(dstParents);
+
+        checkTreeLeaves(children);
+        Stodium.checkSize(leafSize, 1, Integer.MAX_VALUE);
+        Stodium.checkSize(depth, 1, 255);
+        Stodium.checkSize(firstNode, 0L, Long.MAX_VALUE);
+        checkTreeKey(key);
+        parents = (children.remaining() / TREE_LEAFBYTES + 1) / 2;
+        Stodium.checkSizeMin(dstParents.remaining(), parents * TREE_LEAFBYTES);
+
+        Stodium.checkStatus(nativeHashTreeParents(
+                Stodium.ensureUsableByteBuffer(Stodium.window(dstParents, 0, parents * TREE_LEAFBYTES)),
+                Stodium.ensureUsableByteBuffer(children),
+                leafSize,
+                depth,
+                firstNode,
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    private void checkTreeLeaves(final @NotNull ByteBuffer leaves)
+            throws ConstraintViolationException {
+        Stodium.checkSizeMin(leaves.remaining(), TREE_LEAFBYTES);
+        Stodium.checkSize(leaves.remaining() % TREE_LEAFBYTES, 0, 0);
+    }
+
+    private void checkTreeKey(final @Nullable ByteBuffer key)
+            throws ConstraintViolationException {
+        if (key != null) {
+            Stodium.checkSize(key.remaining(), KEYBYTES_MIN, KEYBYTES_MAX);
+        }
+    }
+
+    //
+    // tree bindings, implemented by the primitives
+    //
+
+    protected abstract int nativeHashTreeLeaves(final @NotNull  ByteBuffer dstLeaves,
+                                                final @NotNull  ByteBuffer src,
+                                                final           int        leafSize,
+                                                final           long       firstLeaf,
+                                                final @Nullable ByteBuffer key);
+
+    protected abstract int nativeHashTreeLeaves(final @NotNull  ByteBuffer dstLeaves,
+                                                final           int        fd,
+                                                final           long       length,
+                                                final           int        leafSize,
+                                                final           long       firstLeaf,
+                                                final @Nullable ByteBuffer key);
+
+    protected abstract int nativeHashTreeLeaves(final @NotNull  ByteBuffer dstLeaves,
+                                                final @NotNull  String     path,
+                                                final           long       length,
+                                                final           int        leafSize,
+                                                final           long       firstLeaf,
+                                                final @Nullable ByteBuffer key);
+
+    protected abstract int nativeHashTreeParents(final @NotNull  ByteBuffer dstParents,
+                                                 final @NotNull  ByteBuffer children,
+                                                 final           int        leafSize,
+                                                 final           int        depth,
+                                                 final           long       firstNode,
+                                                 final @Nullable ByteBuffer key);
+
+    protected abstract int nativeHashTreeRoot(final @NotNull  ByteBuffer dstHash,
+                                              final @NotNull  ByteBuffer leaves,
+                                              final           int        leafSize,
+                                              final @Nullable ByteBuffer key);
 }
@@ -0,0 +1,391 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.generichash;
+
+import org.jetbrains.annotations.NotNull;
+import org.jetbrains.annotations.Nullable;
+
+import java.io.File;
+import java.nio.ByteBuffer;
+import java.util.BitSet;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.exceptions.ConstraintViolationException;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * MerkleTree keeps the digests of a binary BLAKE2b hash tree over a fixed
+ * length of data, so that the root can be brought up to date after an edit by
+ * hashing only the changed leaves and their paths to the root.
+ * <p>
+ * All digests are stored in a single flat buffer, level by level, starting
+ * with the leaves. The buffer is owned by the caller: it can be a
+ * MappedByteBuffer over a sidecar file, in which case the tree survives a
+ * restart. A tree created over existing storage trusts its contents, and
+ * starts out clean.
+ * <p>
+ * The leaves and interior nodes are hashed through
+ * {@link GenericHash#hashTreeLeaves(ByteBuffer, ByteBuffer, int, long, ByteBuffer)}
+ * and {@link GenericHash#hashTreeParents(ByteBuffer, ByteBuffer, int, int, long, ByteBuffer)},
+ * so large runs of dirty nodes are spread over the native thread pool.
+ * <p>
+ * Instances are not thread safe.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public final class MerkleTree {
+
+    /**
+     * LeafSource hashes a run of consecutive leaves from wherever the data is
+     * kept.
+     */
+    private interface LeafSource {
+        void hash(final @NotNull ByteBuffer dstLeaves,
+                  final          int        firstLeaf,
+                  final          int        leaves)
+                throws StodiumException;
+    }
+
+    private final @NotNull  GenericHash spec;
+    private final @NotNull  ByteBuffer  storage;
+    private final @Nullable ByteBuffer  key;
+    private final           long        length;
+    private final           int         leafSize;
+
+    // first node and number of nodes of every level, the leaves at index 0
+    private final @NotNull int[] levelOffsets;
+    private final @NotNull int[] levelCounts;
+
+    private final @NotNull BitSet dirty;
+
+    /**
+     * storageBytes returns the number of bytes needed to store the tree over
+     * length bytes of data.
+     *
+     * @param length
+     * @param leafSize
+     * @return
+     * @throws ConstraintViolationException
+     */
+    public static int storageBytes(final long length,
+                                   final int  leafSize)
+            throws ConstraintViolationException {
+        final int leafBytes = GenericHash.blake2bInstance().treeLeafBytes();
+        final int nodes     = countNodes(length, leafSize, null, null);
+
+        Stodium.checkSize(nodes, 1, Integer.MAX_VALUE / leafBytes);
+        return nodes * leafBytes;
+    }
+
+    /**
+     *
+     * @param storage at least {@link #storageBytes(long, int)} bytes
+     * @param length the length of the data covered by the tree
+     * @param leafSize
+     * @param key the key of the tree hash, or null
+     * @throws StodiumException
+     */
+    public MerkleTree(final @NotNull  ByteBuffer storage,
+                      final           long       length,
+                      final           int        leafSize,
+                      final @Nullable ByteBuffer key)
+            throws StodiumException {
+        final int levels;
+
+        Stodium.checkDestinationWritable(storage);
+
+        Stodium.checkSizeMin(storage.remaining(), storageBytes(length, leafSize));
+
+        this.spec     = GenericHash.blake2bInstance();
+        this.storage  = storage.duplicate();
+        this.key      = key == null ? null : key.duplicate();
+        this.length   = length;
+        this.leafSize = leafSize;
+
+        levels            = countLevels(GenericHash.treeLeafCount(leafSize, length));
+        this.levelOffsets = new int[levels];
+        this.levelCounts  = new int[levels];
+        countNodes(length, leafSize, levelOffsets, levelCounts);
+
+        this.dirty = new BitSet(levelCounts[0]);
+    }
+
+    /**
+     *
+     * @return the length of the data covered by the tree
+     */
+    public long length() {
+        return length;
+    }
+
+    /**
+     *
+     * @return
+     */
+    public int leafSize() {
+        return leafSize;
+    }
+
+    /**
+     *
+     * @return
+     */
+    public int leafCount() {
+        return levelCounts[0];
+    }
+
+    /**
+     * markDirty records that length bytes of the data, starting at offset,
+     * have changed since the last update.
+     *
+     * @param offset
+     * @param length
+     * @throws ConstraintViolationException
+     */
+    public void markDirty(final long offset,
+                          final long length)
+            throws ConstraintViolationException {
+        Stodium.checkSize(offset, 0L, this.length);
+        Stodium.checkSize(length, 0L, this.length - offset);
+        if (length == 0L) {
+            return;
+        }
+        dirty.set((int) (offset / leafSize), (int) ((offset + length - 1) / leafSize) + 1);
+    }
+
+    /**
+     *
+     * @return true iff there are changes that have not been hashed yet
+     */
+    public boolean isDirty() {
+        return !dirty.isEmpty();
+    }
+
+    /**
+     * build marks all of the data as dirty, and hashes the complete tree.
+     *
+     * @param data
+     * @throws StodiumException
+     */
+    public void build(final @NotNull ByteBuffer data)
+            throws StodiumException {
+        dirty.set(0, levelCounts[0]);
+        update(data);
+    }
+
+    /**
+     * build is the same as {@link #build(ByteBuffer)}, for the file behind the
+     * given descriptor.
+     *
+     * @param fd
+     * @throws StodiumException
+     */
+    public void build(final int fd)
+            throws StodiumException {
+        dirty.set(0, levelCounts[0]);
+        update(fd);
+    }
+
+    /**
+     * build is the same as {@link #build(ByteBuffer)}, for the file at the
+     * given path.
+     *
+     * @param path
+     * @throws StodiumException
+     */
+    public void build(final @NotNull String path)
+            throws StodiumException {
+        dirty.set(0, levelCounts[0]);
+        update(path);
+    }
+
+    /**
+     * update hashes the dirty leaves of data, which must hold exactly
+     * {@link #length()} bytes, and recomputes their paths to the root.
+     *
+     * @param data
+     * @throws StodiumException
+     */
+    public void update(final @NotNull ByteBuffer data)
+            throws StodiumException {
+        Stodium.checkSize((long) data.remaining(), length, length);
+
+        update(new LeafSource() {
+            @Override
+            public void hash(final @NotNull ByteBuffer dstLeaves,
+                             final          int        firstLeaf,
+                             final          int        leaves)
+                    throws StodiumException {
+                final long start = (long) firstLeaf * leafSize;
+                final long end   = Math.min(length, (long) (firstLeaf + leaves) * leafSize);
+                final ByteBuffer src = data.duplicate();
+
+                src.position(data.position() + (int) start);
+                src.limit(data.position() + (int) end);
+                spec.hashTreeLeaves(dstLeaves, src, leafSize, firstLeaf, key);
+            }
+        });
+    }
+
+    /**
+     * update is the same as {@link #update(ByteBuffer)}, for the file behind
+     * the given descriptor, which is mapped into memory one leaf at a time.
+     * The file must be exactly {@link #length()} bytes long; the update fails
+     * otherwise, and the changes stay marked as dirty.
+     *
+     * @param fd
+     * @throws StodiumException
+     */
+    public void update(final int fd)
+            throws StodiumException {
+        update(new LeafSource() {
+            @Override
+            public void hash(final @NotNull ByteBuffer dstLeaves,
+                             final          int        firstLeaf,
+                             final          int        leaves)
+                    throws StodiumException {
+                spec.hashTreeLeaves(dstLeaves, fd, length, leafSize, firstLeaf, key);
+            }
+        });
+    }
+
+    /**
+     * update is the same as {@link #update(ByteBuffer)}, for the file at the
+     * given path.
+     *
+     * @param path
+     * @throws StodiumException
+     */
+    public void update(final @NotNull String path)
+            throws StodiumException {
+        Stodium.checkSize(new File(path).length(), length, length);
+
+        update(new LeafSource() {
+            @Override
+            public void hash(final @NotNull ByteBuffer dstLeaves,
+                             final          int        firstLeaf,
+                             final          int        leaves)
+                    throws StodiumException {
+                spec.hashTreeLeaves(dstLeaves, path, length, leafSize, firstLeaf, key);
+            }
+        });
+    }
+
+    /**
+     * root copies the root digest of the tree to dst.
+     *
+     * @param dst
+     * @throws ConstraintViolationException
+     * @throws IllegalStateException if there are changes that have not been
+     *         hashed yet
+     */
+    public void root(final @NotNull ByteBuffer dst)
+            throws ConstraintViolationException {
+        Stodium.checkDestinationWritable(dst);
+
+        Stodium.checkSizeMin(dst.remaining(), spec.treeLeafBytes());
+        if (isDirty()) {
+            throw new IllegalStateException("Stodium: MerkleTree has pending changes");
+        }
+        dst.duplicate().put(nodes(levelCounts.length - 1, 0, 1));
+    }
+
+    /**
+     * update hashes every run of dirty leaves through source, and then every
+     * run of interior nodes above them, one level at a time.
+     */
+    private void update(final @NotNull LeafSource source)
+            throws StodiumException {
+        BitSet level = dirty;
+        int    start, end;
+
+        for (start = level.nextSetBit(0); start >= 0; start = level.nextSetBit(end)) {
+            end = level.nextClearBit(start);
+            source.hash(nodes(0, start, end - start), start, end - start);
+        }
+
+        for (int depth = 1; depth < levelCounts.length; depth++) {
+            final BitSet parents = new BitSet(levelCounts[depth]);
+
+            for (start = level.nextSetBit(0); start >= 0; start = level.nextSetBit(end)) {
+                end = level.nextClearBit(start);
+                parents.set(start / 2, (end - 1) / 2 + 1);
+            }
+            for (start = parents.nextSetBit(0); start >= 0; start = parents.nextSetBit(end)) {
+                end = parents.nextClearBit(start);
+                spec.hashTreeParents(
+                        nodes(depth, start, end - start),
+                        nodes(depth - 1, 2 * start, Math.min(2 * end, levelCounts[depth - 1]) - 2 * start),
+                        leafSize, depth, start, key);
+            }
+            level = parents;
+        }
+
+        dirty.clear();
+    }
+
+    /**
+     * nodes returns a view of count digests of the given level of the tree,
+     * starting at node first.
+     */
+    @NotNull
+    private ByteBuffer nodes(final int level,
+                             final int first,
+                             final int count) {
+        final int        leafBytes = spec.treeLeafBytes();
+        final ByteBuffer dup       = storage.duplicate();
+
+        dup.position(storage.position() + (levelOffsets[level] + first) * leafBytes);
+        dup.limit(dup.position() + count * leafBytes);
+        return dup;
+    }
+
+    private static int countLevels(final long leaves) {
+        int  levels = 1;
+        long count  = leaves;
+
+        do {
+            count = (count + 1) / 2;
+            levels++;
+        } while (count > 1);
+
+        return levels;
+    }
+
+    /**
+     * countNodes returns the total number of nodes of the tree, and fills in
+     * the offset and size of every level if offsets and counts are not null.
+     * There is always at least one level above the leaves.
+     */
+    private static int countNodes(final           long  length,
+                                  final           int   leafSize,
+                                  final @Nullable int[] offsets,
+                                  final @Nullable int[] counts)
+            throws ConstraintViolationException {
+        long count, total = 0L;
+        int  level = 0;
+
+        Stodium.checkSize(leafSize, 1, Integer.MAX_VALUE);
+        Stodium.checkSize(length, 0L, Long.MAX_VALUE);
+
+        count = GenericHash.treeLeafCount(leafSize, length);
+        Stodium.checkSize(count, 1L, Integer.MAX_VALUE);
+        do {
+            if (offsets != null && counts != null) {
+                offsets[level] = (int) total;
+                counts[level]  = (int) count;
+            }
+            total += count;
+            level++;
+            count = level == 1 || count > 1 ? (count + 1) / 2 : 0L;
+        } while (count > 0L);
+
+        Stodium.checkSize(total, 1L, Integer.MAX_VALUE);
+        return (int) total;
+    }
+}
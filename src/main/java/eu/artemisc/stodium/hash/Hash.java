@@ -13,9 +13,14 @@ import java.nio.ByteBuffer;
 
 import eu.artemisc.stodium.Multipart;
 import eu.artemisc.stodium.Singleton;
+import eu.artemisc.stodium.Stodium;
 import eu.artemisc.stodium.exceptions.StodiumException;
 
 /**
+ * Hash computes the digest of a message, either in a single call, through
+ * the {@link Multipart} API, or directly from a file with
+ * {@link #hashFile(ByteBuffer, String, long, long)}.
+ *
  * @author Jan van de Molengraft [jan@artemisc.eu]
  */
 public abstract class Hash {
@@ -99,4 +104,81 @@ public abstract class Hash {
     @NotNull
     public abstract Multipart<Hash> init()
             throws StodiumException;
+
+    //
+    // files
+    //
+
+    /**
+     * hashFile writes the digest of length bytes of the file behind the given
+     * descriptor, starting at offset, to dstHash. The file is mapped into
+     * memory by the native code and hashed in place, so its contents never
+     * pass through the Java heap. A negative length hashes the rest of the
+     * file.
+     * <p>
+     * The descriptor must refer to a regular file (for example obtained
+     * through ParcelFileDescriptor.getFd()), and stays owned by the caller.
+     * The file must not be truncated while it is being hashed.
+     *
+     * @param dstHash
+     * @param fd
+     * @param offset
+     * @param length
+     * @throws StodiumException if the range lies outside of the file, or the
+     *         file could not be read
+     */
+    public final void hashFile(final @NotNull ByteBuffer dstHash,
+                               final          int        fd,
+                               final          long       offset,
+                               final          long       length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstHash);
+
+        Stodium.checkSizeMin(dstHash.remaining(), BYTES);
+        Stodium.checkSize(fd, 0, Integer.MAX_VALUE);
+        Stodium.checkSize(offset, 0L, Long.MAX_VALUE);
+
+        Stodium.checkFileStatus(nativeHashFile(
+                Stodium.ensureUsableByteBuffer(dstHash),
+                fd, offset, length));
+    }
+
+    /**
+     * hashFile is the same as {@link #hashFile(ByteBuffer, int, long, long)},
+     * for the file at the given path.
+     *
+     * @param dstHash
+     * @param path
+     * @param offset
+     * @param length
+     * @throws StodiumException
+     */
+    public final void hashFile(final @NotNull ByteBuffer dstHash,
+                               final @NotNull String     path,
+                               final          long       offset,
+                               final          long       length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstHash);
+
+        Stodium.checkSizeMin(dstHash.remaining(), BYTES);
+        Stodium.checkSize(offset, 0L, Long.MAX_VALUE);
+
+        Stodium.checkFileStatus(nativeHashFile(
+                Stodium.ensureUsableByteBuffer(dstHash),
+                path, offset, length));
+    }
+
+    //
+    // file bindings, implemented by the primitives
+    //
+
+    protected abstract int nativeHashFile(final @NotNull ByteBuffer dstHash,
+                                          final          int        fd,
+                                          final          long       offset,
+                                          final          long       length);
+
+    protected abstract int nativeHashFile(final @NotNull ByteBuffer dstHash,
+                                          final @NotNull String     path,
+                                          final          long       offset,
+                                          final          long       length);
 }
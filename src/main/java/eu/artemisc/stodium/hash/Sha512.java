@@ -5,6 +5,7 @@ import org.jetbrains.annotations.NotNull;
 import java.nio.ByteBuffer;
 
 import eu.artemisc.stodium.Multipart;
+import eu.artemisc.stodium.StatePool;
 import eu.artemisc.stodium.Stodium;
 import eu.artemisc.stodium.StodiumJNI;
 import eu.artemisc.stodium.exceptions.StodiumException;
@@ -40,10 +41,10 @@ final class Sha512
             throws StodiumException {
         final ByteBuffer state;
 
-        state = ByteBuffer.allocateDirect(STATEBYTES);
+        state = StatePool.acquire(STATEBYTES);
         Stodium.checkStatus(StodiumJNI.crypto_hash_sha512_init(state));
 
-        return new Multipart<>(this, state);
+        return new Multipart<>(this, state, true);
     }
 
     @Override
@@ -58,6 +59,21 @@ final class Sha512
                 Stodium.ensureUsableByteBuffer(in)));
     }
 
+    @Override
+    public void update(final @NotNull ByteBuffer   state,
+                       final @NotNull ByteBuffer[] in,
+                       final          int          offset,
+                       final          int          length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_hash_sha512_updatev(
+                Stodium.ensureUsableByteBuffer(state),
+                Stodium.ensureUsableByteBuffers(in, offset, length),
+                offset, length));
+    }
+
     @Override
     public void doFinal(final @NotNull ByteBuffer state,
                         final @NotNull ByteBuffer dst)
@@ -72,4 +88,50 @@ final class Sha512
                 Stodium.ensureUsableByteBuffer(state),
                 Stodium.ensureUsableByteBuffer(dst)));
     }
+
+    @Override
+    public void update(final @NotNull ByteBuffer state,
+                       final @NotNull byte[]     in,
+                       final          int        offset,
+                       final          int        length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_hash_sha512_update_array(
+                Stodium.ensureUsableByteBuffer(state),
+                in, offset, length));
+    }
+
+    @Override
+    public void doFinal(final @NotNull ByteBuffer state,
+                        final @NotNull byte[]     dst,
+                        final          int        offset,
+                        final          int        length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+        Stodium.checkSizeMin(length, BYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_hash_sha512_final_array(
+                Stodium.ensureUsableByteBuffer(state),
+                dst, offset, BYTES));
+    }
+
+    @Override
+    protected int nativeHashFile(final @NotNull ByteBuffer dstHash,
+                                 final          int        fd,
+                                 final          long       offset,
+                                 final          long       length) {
+        return StodiumJNI.crypto_hash_sha512_fd(dstHash, fd, offset, length);
+    }
+
+    @Override
+    protected int nativeHashFile(final @NotNull ByteBuffer dstHash,
+                                 final @NotNull String     path,
+                                 final          long       offset,
+                                 final          long       length) {
+        return StodiumJNI.crypto_hash_sha512_file(dstHash, path, offset, length);
+    }
 }
@@ -38,4 +38,13 @@ public final class Blake2b
                 Stodium.ensureUsableByteBuffer(context),
                 Stodium.ensureUsableByteBuffer(key)));
     }
+
+    @Override
+    int nativeDeriveFromKey(final @NotNull ByteBuffer subKey,
+                            final          long       subKeyId,
+                            final @NotNull ByteBuffer context,
+                            final          long       key) {
+        return StodiumJNI.crypto_kdf_blake2b_derive_from_key_handle(
+                subKey, subKeyId, context, key);
+    }
 }
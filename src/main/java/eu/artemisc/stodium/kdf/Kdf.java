@@ -4,7 +4,10 @@ import org.jetbrains.annotations.NotNull;
 
 import java.nio.ByteBuffer;
 
+import eu.artemisc.stodium.KeyHandle;
+import eu.artemisc.stodium.NativeResource;
 import eu.artemisc.stodium.Singleton;
+import eu.artemisc.stodium.Stodium;
 import eu.artemisc.stodium.exceptions.StodiumException;
 
 /**
@@ -90,4 +93,43 @@ public abstract class Kdf {
                                        final @NotNull ByteBuffer context,
                                        final @NotNull ByteBuffer key)
             throws StodiumException;
+
+    /**
+     * deriveFromKey is the {@link KeyHandle} counterpart of the ByteBuffer
+     * based deriveFromKey method, reading the master key from guarded native
+     * memory.
+     *
+     * @param subKey
+     * @param subKeyId
+     * @param context
+     * @param key
+     * @throws StodiumException
+     */
+    public final void deriveFromKey(final @NotNull ByteBuffer subKey,
+                                    final          long       subKeyId,
+                                    final @NotNull ByteBuffer context,
+                                    final @NotNull KeyHandle  key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(subKey);
+
+        Stodium.checkSize(subKey.remaining(), BYTES_MIN, BYTES_MAX);
+        Stodium.checkSize(context.remaining(), CONTEXTBYTES);
+        Stodium.checkSize(key.length(), KEYBYTES);
+
+        Stodium.checkStatus(key.call(new NativeResource.Call() {
+            @Override
+            public int run(final long handle) {
+                return nativeDeriveFromKey(
+                        Stodium.ensureUsableByteBuffer(subKey),
+                        subKeyId,
+                        Stodium.ensureUsableByteBuffer(context),
+                        handle);
+            }
+        }));
+    }
+
+    abstract int nativeDeriveFromKey(final @NotNull ByteBuffer subKey,
+                                     final          long       subKeyId,
+                                     final @NotNull ByteBuffer context,
+                                     final          long       key);
 }
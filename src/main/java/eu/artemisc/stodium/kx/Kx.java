@@ -5,6 +5,7 @@ import org.jetbrains.annotations.NotNull;
 import java.nio.ByteBuffer;
 
 import eu.artemisc.stodium.Singleton;
+import eu.artemisc.stodium.Stodium;
 import eu.artemisc.stodium.exceptions.StodiumException;
 
 /**
@@ -126,4 +127,71 @@ public abstract class Kx {
                                            final @NotNull ByteBuffer serverSk,
                                            final @NotNull ByteBuffer clientPk)
             throws StodiumException;
+
+    //
+    // batch operations
+    //
+
+    /**
+     * serverSessionKeysBatch computes the session keys of the server key pair
+     * serverPk/serverSk for a batch of clients in a single call to the native
+     * code, avoiding the JNI transition for every handshake.
+     * <p>
+     * Client i is the i-th block of {@link #publicKeyBytes()} bytes in
+     * clientPks, and its session keys are written to the i-th block of
+     * {@link #sessionKeyBytes()} bytes in rx and tx. The length of status
+     * determines the number of clients, and receives the status of every
+     * client. When parallel is set, the batch is spread over the native
+     * {@link eu.artemisc.stodium.ThreadPool}.
+     *
+     * @param rx
+     * @param tx
+     * @param serverPk
+     * @param serverSk
+     * @param clientPks
+     * @param status
+     * @param parallel
+     * @return the number of clients that failed
+     * @throws StodiumException
+     */
+    public final int serverSessionKeysBatch(final @NotNull ByteBuffer rx,
+                                            final @NotNull ByteBuffer tx,
+                                            final @NotNull ByteBuffer serverPk,
+                                            final @NotNull ByteBuffer serverSk,
+                                            final @NotNull ByteBuffer clientPks,
+                                            final @NotNull int[]      status,
+                                            final          boolean    parallel)
+            throws StodiumException {
+        final long count = status.length;
+
+        Stodium.checkDestinationWritable(rx);
+        Stodium.checkDestinationWritable(tx);
+
+        Stodium.checkSizeMin(serverPk.remaining(), PUBLICKEYBYTES);
+        Stodium.checkSize(serverSk.remaining(), SECRETKEYBYTES);
+        Stodium.checkSize(clientPks.remaining(), count * PUBLICKEYBYTES, count * PUBLICKEYBYTES);
+        Stodium.checkSize(rx.remaining(), count * SESSIONKEYBYTES, Integer.MAX_VALUE);
+        Stodium.checkSize(tx.remaining(), count * SESSIONKEYBYTES, Integer.MAX_VALUE);
+
+        return nativeServerSessionKeysBatch(
+                Stodium.ensureUsableByteBuffer(rx),
+                Stodium.ensureUsableByteBuffer(tx),
+                Stodium.ensureUsableByteBuffer(serverPk),
+                Stodium.ensureUsableByteBuffer(serverSk),
+                Stodium.ensureUsableByteBuffer(clientPks),
+                status,
+                parallel);
+    }
+
+    //
+    // batch bindings, implemented by the primitives
+    //
+
+    abstract int nativeServerSessionKeysBatch(final @NotNull ByteBuffer rx,
+                                              final @NotNull ByteBuffer tx,
+                                              final @NotNull ByteBuffer serverPk,
+                                              final @NotNull ByteBuffer serverSk,
+                                              final @NotNull ByteBuffer clientPks,
+                                              final @NotNull int[]      status,
+                                              final          boolean    parallel);
 }
@@ -96,4 +96,16 @@ public final class X25519Blake2b
                 Stodium.ensureUsableByteBuffer(serverSk),
                 Stodium.ensureUsableByteBuffer(clientPk)));
     }
+
+    @Override
+    int nativeServerSessionKeysBatch(final @NotNull ByteBuffer rx,
+                                     final @NotNull ByteBuffer tx,
+                                     final @NotNull ByteBuffer serverPk,
+                                     final @NotNull ByteBuffer serverSk,
+                                     final @NotNull ByteBuffer clientPks,
+                                     final @NotNull int[]      status,
+                                     final          boolean    parallel) {
+        return StodiumJNI.crypto_kx_server_session_keys_batch(
+                rx, tx, serverPk, serverSk, clientPks, status, parallel);
+    }
 }
@@ -5,6 +5,7 @@ import org.jetbrains.annotations.NotNull;
 import java.nio.ByteBuffer;
 
 import eu.artemisc.stodium.Multipart;
+import eu.artemisc.stodium.StatePool;
 import eu.artemisc.stodium.Stodium;
 import eu.artemisc.stodium.StodiumJNI;
 import eu.artemisc.stodium.auth.Auth;
@@ -60,12 +61,28 @@ final class Poly1305
         final ByteBuffer state;
 
         Stodium.checkSize(key.remaining(), KEYBYTES);
-        state = ByteBuffer.allocateDirect(STATEBYTES);
+        state = StatePool.acquire(STATEBYTES);
 
         Stodium.checkStatus(StodiumJNI.crypto_onetimeauth_poly1305_init(
                 state, Stodium.ensureUsableByteBuffer(key)));
 
-        return new Multipart<>(this, state);
+        return new Multipart<>(this, state, true);
+    }
+
+    @NotNull
+    @Override
+    public Multipart<Auth> init(final @NotNull byte[] key,
+                                final          int    keyOffset)
+            throws StodiumException {
+        final ByteBuffer state;
+
+        Stodium.checkOffsetParams(key.length, keyOffset, KEYBYTES);
+        state = StatePool.acquire(STATEBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_onetimeauth_poly1305_init_array(
+                state, key, keyOffset, KEYBYTES));
+
+        return new Multipart<>(this, state, true);
     }
 
     @Override
@@ -80,6 +97,21 @@ final class Poly1305
                 Stodium.ensureUsableByteBuffer(in)));
     }
 
+    @Override
+    public void update(final @NotNull ByteBuffer   state,
+                       final @NotNull ByteBuffer[] in,
+                       final          int          offset,
+                       final          int          length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_onetimeauth_poly1305_updatev(
+                Stodium.ensureUsableByteBuffer(state),
+                Stodium.ensureUsableByteBuffers(in, offset, length),
+                offset, length));
+    }
+
     @Override
     public void doFinal(final @NotNull ByteBuffer state,
                         final @NotNull ByteBuffer dst)
@@ -94,4 +126,100 @@ final class Poly1305
                 Stodium.ensureUsableByteBuffer(state),
                 Stodium.ensureUsableByteBuffer(dst)));
     }
+
+    @Override
+    public void update(final @NotNull ByteBuffer state,
+                       final @NotNull byte[]     in,
+                       final          int        offset,
+                       final          int        length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_onetimeauth_poly1305_update_array(
+                Stodium.ensureUsableByteBuffer(state),
+                in, offset, length));
+    }
+
+    @Override
+    public void doFinal(final @NotNull ByteBuffer state,
+                        final @NotNull byte[]     dst,
+                        final          int        offset,
+                        final          int        length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+        Stodium.checkSizeMin(length, BYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_onetimeauth_poly1305_final_array(
+                Stodium.ensureUsableByteBuffer(state),
+                dst, offset, BYTES));
+    }
+
+    @Override
+    protected int nativeMac(final @NotNull byte[] dstMac,
+                            final          int    dstMacOffset,
+                            final          int    dstMacLength,
+                            final @NotNull byte[] src,
+                            final          int    srcOffset,
+                            final          int    srcLength,
+                            final @NotNull byte[] key,
+                            final          int    keyOffset,
+                            final          int    keyLength) {
+        return StodiumJNI.crypto_onetimeauth_poly1305_array(
+                dstMac, dstMacOffset, dstMacLength,
+                src, srcOffset, srcLength,
+                key, keyOffset, keyLength);
+    }
+
+    @Override
+    protected int nativeVerify(final @NotNull byte[] srcMac,
+                               final          int    srcMacOffset,
+                               final          int    srcMacLength,
+                               final @NotNull byte[] src,
+                               final          int    srcOffset,
+                               final          int    srcLength,
+                               final @NotNull byte[] key,
+                               final          int    keyOffset,
+                               final          int    keyLength) {
+        return StodiumJNI.crypto_onetimeauth_poly1305_verify_array(
+                srcMac, srcMacOffset, srcMacLength,
+                src, srcOffset, srcLength,
+                key, keyOffset, keyLength);
+    }
+
+    @Override
+    protected int nativeMac(final @NotNull ByteBuffer dstMac,
+                            final @NotNull ByteBuffer src,
+                            final          long       key) {
+        return StodiumJNI.crypto_onetimeauth_poly1305_handle(
+                dstMac, src, key);
+    }
+
+    @Override
+    protected int nativeVerify(final @NotNull ByteBuffer srcMac,
+                               final @NotNull ByteBuffer src,
+                               final          long       key) {
+        return StodiumJNI.crypto_onetimeauth_poly1305_verify_handle(
+                srcMac, src, key);
+    }
+
+    @Override
+    protected int nativeMacFile(final @NotNull ByteBuffer dstMac,
+                                final          int        fd,
+                                final          long       offset,
+                                final          long       length,
+                                final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_onetimeauth_poly1305_fd(dstMac, key, fd, offset, length);
+    }
+
+    @Override
+    protected int nativeMacFile(final @NotNull ByteBuffer dstMac,
+                                final @NotNull String     path,
+                                final          long       offset,
+                                final          long       length,
+                                final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_onetimeauth_poly1305_file(dstMac, key, path, offset, length);
+    }
 }
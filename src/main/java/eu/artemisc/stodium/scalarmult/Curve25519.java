@@ -50,4 +50,14 @@ final class Curve25519
                 Stodium.ensureUsableByteBuffer(dst),
                 Stodium.ensureUsableByteBuffer(src)));
     }
+
+    @Override
+    int nativeScalarMultBatch(final @NotNull ByteBuffer dst,
+                              final @NotNull ByteBuffer src,
+                              final @NotNull ByteBuffer groupElements,
+                              final @NotNull int[]      status,
+                              final          boolean    parallel) {
+        return StodiumJNI.crypto_scalarmult_curve25519_batch(
+                dst, src, groupElements, status, parallel);
+    }
 }
@@ -5,6 +5,7 @@ import org.jetbrains.annotations.NotNull;
 import java.nio.ByteBuffer;
 
 import eu.artemisc.stodium.Singleton;
+import eu.artemisc.stodium.Stodium;
 import eu.artemisc.stodium.exceptions.StodiumException;
 
 /**
@@ -82,4 +83,60 @@ public abstract class ScalarMult {
     public abstract void scalarMultBase(final @NotNull ByteBuffer dst,
                                         final @NotNull ByteBuffer src)
             throws StodiumException;
-}
\ No newline at end of file
+
+    //
+    // batch operations
+    //
+
+    /**
+     * scalarMultBatch multiplies a batch of group elements by the same scalar
+     * in a single call to the native code, such as when a server computes the
+     * shared secrets for a burst of incoming handshakes.
+     * <p>
+     * Element i is the i-th block of {@link #bytes()} bytes in groupElements,
+     * and its result is written to the i-th block of {@link #bytes()} bytes in
+     * dst. The length of status determines the number of elements, and
+     * receives the status of every multiplication, which is non-zero for
+     * elements of small order. When parallel is set, the batch is spread over
+     * the native {@link eu.artemisc.stodium.ThreadPool}.
+     *
+     * @param dst
+     * @param src
+     * @param groupElements
+     * @param status
+     * @param parallel
+     * @return the number of elements that failed
+     * @throws StodiumException
+     */
+    public final int scalarMultBatch(final @NotNull ByteBuffer dst,
+                                     final @NotNull ByteBuffer src,
+                                     final @NotNull ByteBuffer groupElements,
+                                     final @NotNull int[]      status,
+                                     final          boolean    parallel)
+            throws StodiumException {
+        final long count = status.length;
+
+        Stodium.checkDestinationWritable(dst);
+
+        Stodium.checkSize(src.remaining(), SCALARBYTES);
+        Stodium.checkSize(groupElements.remaining(), count * BYTES, count * BYTES);
+        Stodium.checkSize(dst.remaining(), count * BYTES, Integer.MAX_VALUE);
+
+        return nativeScalarMultBatch(
+                Stodium.ensureUsableByteBuffer(dst),
+                Stodium.ensureUsableByteBuffer(src),
+                Stodium.ensureUsableByteBuffer(groupElements),
+                status,
+                parallel);
+    }
+
+    //
+    // batch bindings, implemented by the primitives
+    //
+
+    abstract int nativeScalarMultBatch(final @NotNull ByteBuffer dst,
+                                       final @NotNull ByteBuffer src,
+                                       final @NotNull ByteBuffer groupElements,
+                                       final @NotNull int[]      status,
+                                       final          boolean    parallel);
+}
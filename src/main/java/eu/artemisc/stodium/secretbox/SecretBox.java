@@ -4,10 +4,18 @@ import org.jetbrains.annotations.NotNull;
 
 import java.nio.ByteBuffer;
 
+import eu.artemisc.stodium.KeyHandle;
+import eu.artemisc.stodium.NativeResource;
 import eu.artemisc.stodium.Singleton;
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.StodiumJNI;
 import eu.artemisc.stodium.exceptions.StodiumException;
 
 /**
+ * The destination and source buffers passed to the easy and detached methods
+ * must not overlap. To seal or open a message within the buffer that holds
+ * it, use the *InPlace methods instead.
+ *
  * @author Jan van de Molengraft [jan@artemisc.eu]
  */
 public abstract class SecretBox {
@@ -147,4 +155,644 @@ public abstract class SecretBox {
                                          final @NotNull ByteBuffer nonce,
                                          final @NotNull ByteBuffer key)
             throws StodiumException;
+
+    //
+    // byte[] overloads
+    //
+
+    /**
+     * easy is the byte[] counterpart of the ByteBuffer based easy method. It
+     * writes srcPlainLength + {@link #macBytes()} bytes to dstCipher.
+     *
+     * @param dstCipher
+     * @param dstCipherOffset
+     * @param srcPlain
+     * @param srcPlainOffset
+     * @param srcPlainLength
+     * @param nonce
+     * @param nonceOffset
+     * @param key
+     * @param keyOffset
+     * @throws StodiumException
+     */
+    public final void easy(final @NotNull byte[] dstCipher,
+                           final          int    dstCipherOffset,
+                           final @NotNull byte[] srcPlain,
+                           final          int    srcPlainOffset,
+                           final          int    srcPlainLength,
+                           final @NotNull byte[] nonce,
+                           final          int    nonceOffset,
+                           final @NotNull byte[] key,
+                           final          int    keyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcPlain.length, srcPlainOffset, srcPlainLength);
+        Stodium.checkOffsetParams(dstCipher.length, dstCipherOffset, srcPlainLength + MACBYTES);
+        Stodium.checkOffsetParams(nonce.length, nonceOffset, NONCEBYTES);
+        Stodium.checkOffsetParams(key.length, keyOffset, KEYBYTES);
+
+        Stodium.checkStatus(nativeEasy(
+                dstCipher, dstCipherOffset, srcPlainLength + MACBYTES,
+                srcPlain, srcPlainOffset, srcPlainLength,
+                nonce, nonceOffset, NONCEBYTES,
+                key, keyOffset, KEYBYTES));
+    }
+
+    /**
+     * easyOpen is the byte[] counterpart of the ByteBuffer based easyOpen
+     * method. It writes srcCipherLength - {@link #macBytes()} bytes to
+     * dstPlain.
+     *
+     * @param dstPlain
+     * @param dstPlainOffset
+     * @param srcCipher
+     * @param srcCipherOffset
+     * @param srcCipherLength
+     * @param nonce
+     * @param nonceOffset
+     * @param key
+     * @param keyOffset
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean easyOpen(final @NotNull byte[] dstPlain,
+                                  final          int    dstPlainOffset,
+                                  final @NotNull byte[] srcCipher,
+                                  final          int    srcCipherOffset,
+                                  final          int    srcCipherLength,
+                                  final @NotNull byte[] nonce,
+                                  final          int    nonceOffset,
+                                  final @NotNull byte[] key,
+                                  final          int    keyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcCipher.length, srcCipherOffset, srcCipherLength);
+        Stodium.checkSizeMin(srcCipherLength, MACBYTES);
+        Stodium.checkOffsetParams(dstPlain.length, dstPlainOffset, srcCipherLength - MACBYTES);
+        Stodium.checkOffsetParams(nonce.length, nonceOffset, NONCEBYTES);
+        Stodium.checkOffsetParams(key.length, keyOffset, KEYBYTES);
+
+        return StodiumJNI.NOERR == nativeEasyOpen(
+                dstPlain, dstPlainOffset, srcCipherLength - MACBYTES,
+                srcCipher, srcCipherOffset, srcCipherLength,
+                nonce, nonceOffset, NONCEBYTES,
+                key, keyOffset, KEYBYTES);
+    }
+
+    /**
+     * detached is the byte[] counterpart of the ByteBuffer based detached
+     * method. It writes srcPlainLength bytes to dstCipher and
+     * {@link #macBytes()} bytes to dstMac.
+     *
+     * @param dstCipher
+     * @param dstCipherOffset
+     * @param dstMac
+     * @param dstMacOffset
+     * @param srcPlain
+     * @param srcPlainOffset
+     * @param srcPlainLength
+     * @param nonce
+     * @param nonceOffset
+     * @param key
+     * @param keyOffset
+     * @throws StodiumException
+     */
+    public final void detached(final @NotNull byte[] dstCipher,
+                               final          int    dstCipherOffset,
+                               final @NotNull byte[] dstMac,
+                               final          int    dstMacOffset,
+                               final @NotNull byte[] srcPlain,
+                               final          int    srcPlainOffset,
+                               final          int    srcPlainLength,
+                               final @NotNull byte[] nonce,
+                               final          int    nonceOffset,
+                               final @NotNull byte[] key,
+                               final          int    keyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcPlain.length, srcPlainOffset, srcPlainLength);
+        Stodium.checkOffsetParams(dstCipher.length, dstCipherOffset, srcPlainLength);
+        Stodium.checkOffsetParams(dstMac.length, dstMacOffset, MACBYTES);
+        Stodium.checkOffsetParams(nonce.length, nonceOffset, NONCEBYTES);
+        Stodium.checkOffsetParams(key.length, keyOffset, KEYBYTES);
+
+        Stodium.checkStatus(nativeDetached(
+                dstCipher, dstCipherOffset, srcPlainLength,
+                dstMac, dstMacOffset, MACBYTES,
+                srcPlain, srcPlainOffset, srcPlainLength,
+                nonce, nonceOffset, NONCEBYTES,
+                key, keyOffset, KEYBYTES));
+    }
+
+    /**
+     * detachedOpen is the byte[] counterpart of the ByteBuffer based
+     * detachedOpen method. It writes srcCipherLength bytes to dstPlain.
+     *
+     * @param dstPlain
+     * @param dstPlainOffset
+     * @param srcCipher
+     * @param srcCipherOffset
+     * @param srcCipherLength
+     * @param srcMac
+     * @param srcMacOffset
+     * @param nonce
+     * @param nonceOffset
+     * @param key
+     * @param keyOffset
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean detachedOpen(final @NotNull byte[] dstPlain,
+                                      final          int    dstPlainOffset,
+                                      final @NotNull byte[] srcCipher,
+                                      final          int    srcCipherOffset,
+                                      final          int    srcCipherLength,
+                                      final @NotNull byte[] srcMac,
+                                      final          int    srcMacOffset,
+                                      final @NotNull byte[] nonce,
+                                      final          int    nonceOffset,
+                                      final @NotNull byte[] key,
+                                      final          int    keyOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcCipher.length, srcCipherOffset, srcCipherLength);
+        Stodium.checkOffsetParams(dstPlain.length, dstPlainOffset, srcCipherLength);
+        Stodium.checkOffsetParams(srcMac.length, srcMacOffset, MACBYTES);
+        Stodium.checkOffsetParams(nonce.length, nonceOffset, NONCEBYTES);
+        Stodium.checkOffsetParams(key.length, keyOffset, KEYBYTES);
+
+        return StodiumJNI.NOERR == nativeDetachedOpen(
+                dstPlain, dstPlainOffset, srcCipherLength,
+                srcCipher, srcCipherOffset, srcCipherLength,
+                srcMac, srcMacOffset, MACBYTES,
+                nonce, nonceOffset, NONCEBYTES,
+                key, keyOffset, KEYBYTES);
+    }
+
+    //
+    // byte[] bindings, implemented by the primitives
+    //
+
+    abstract int nativeEasy(final @NotNull byte[] dstCipher,
+                            final          int    dstCipherOffset,
+                            final          int    dstCipherLength,
+                            final @NotNull byte[] srcPlain,
+                            final          int    srcPlainOffset,
+                            final          int    srcPlainLength,
+                            final @NotNull byte[] nonce,
+                            final          int    nonceOffset,
+                            final          int    nonceLength,
+                            final @NotNull byte[] key,
+                            final          int    keyOffset,
+                            final          int    keyLength);
+
+    abstract int nativeEasyOpen(final @NotNull byte[] dstPlain,
+                                final          int    dstPlainOffset,
+                                final          int    dstPlainLength,
+                                final @NotNull byte[] srcCipher,
+                                final          int    srcCipherOffset,
+                                final          int    srcCipherLength,
+                                final @NotNull byte[] nonce,
+                                final          int    nonceOffset,
+                                final          int    nonceLength,
+                                final @NotNull byte[] key,
+                                final          int    keyOffset,
+                                final          int    keyLength);
+
+    abstract int nativeDetached(final @NotNull byte[] dstCipher,
+                                final          int    dstCipherOffset,
+                                final          int    dstCipherLength,
+                                final @NotNull byte[] dstMac,
+                                final          int    dstMacOffset,
+                                final          int    dstMacLength,
+                                final @NotNull byte[] srcPlain,
+                                final          int    srcPlainOffset,
+                                final          int    srcPlainLength,
+                                final @NotNull byte[] nonce,
+                                final          int    nonceOffset,
+                                final          int    nonceLength,
+                                final @NotNull byte[] key,
+                                final          int    keyOffset,
+                                final          int    keyLength);
+
+    abstract int nativeDetachedOpen(final @NotNull byte[] dstPlain,
+                                    final          int    dstPlainOffset,
+                                    final          int    dstPlainLength,
+                                    final @NotNull byte[] srcCipher,
+                                    final          int    srcCipherOffset,
+                                    final          int    srcCipherLength,
+                                    final @NotNull byte[] srcMac,
+                                    final          int    srcMacOffset,
+                                    final          int    srcMacLength,
+                                    final @NotNull byte[] nonce,
+                                    final          int    nonceOffset,
+                                    final          int    nonceLength,
+                                    final @NotNull byte[] key,
+                                    final          int    keyOffset,
+                                    final          int    keyLength);
+
+    //
+    // key handles
+    //
+
+    /**
+     * easy is the {@link KeyHandle} counterpart of the ByteBuffer based easy
+     * method, reading the key from guarded native memory.
+     *
+     * @param dstCipher
+     * @param srcPlain
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public final void easy(final @NotNull ByteBuffer dstCipher,
+                           final @NotNull ByteBuffer srcPlain,
+                           final @NotNull ByteBuffer nonce,
+                           final @NotNull KeyHandle  key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstCipher);
+
+        Stodium.checkSizeMin(dstCipher.remaining(), srcPlain.remaining() + MACBYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.length(), KEYBYTES);
+
+        Stodium.checkStatus(key.call(new NativeResource.Call() {
+            @Override
+            public int run(final long handle) {
+                return nativeEasy(
+                        Stodium.ensureUsableByteBuffer(dstCipher),
+                        Stodium.ensureUsableByteBuffer(srcPlain),
+                        Stodium.ensureUsableByteBuffer(nonce),
+                        handle);
+            }
+        }));
+    }
+
+    /**
+     * easyOpen is the {@link KeyHandle} counterpart of the ByteBuffer based
+     * easyOpen method.
+     *
+     * @param dstPlain
+     * @param srcCipher
+     * @param nonce
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean easyOpen(final @NotNull ByteBuffer dstPlain,
+                                  final @NotNull ByteBuffer srcCipher,
+                                  final @NotNull ByteBuffer nonce,
+                                  final @NotNull KeyHandle  key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstPlain);
+
+        Stodium.checkSizeMin(srcCipher.remaining(), MACBYTES);
+        Stodium.checkSizeMin(dstPlain.remaining(), srcCipher.remaining() - MACBYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.length(), KEYBYTES);
+
+        return StodiumJNI.NOERR == key.call(new NativeResource.Call() {
+            @Override
+            public int run(final long handle) {
+                return nativeEasyOpen(
+                        Stodium.ensureUsableByteBuffer(dstPlain),
+                        Stodium.ensureUsableByteBuffer(srcCipher),
+                        Stodium.ensureUsableByteBuffer(nonce),
+                        handle);
+            }
+        });
+    }
+
+    /**
+     * detached is the {@link KeyHandle} counterpart of the ByteBuffer based
+     * detached method.
+     *
+     * @param dstCipher
+     * @param dstMac
+     * @param srcPlain
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public final void detached(final @NotNull ByteBuffer dstCipher,
+                               final @NotNull ByteBuffer dstMac,
+                               final @NotNull ByteBuffer srcPlain,
+                               final @NotNull ByteBuffer nonce,
+                               final @NotNull KeyHandle  key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstCipher);
+        Stodium.checkDestinationWritable(dstMac);
+
+        Stodium.checkSizeMin(dstCipher.remaining(), srcPlain.remaining());
+        Stodium.checkSizeMin(dstMac.remaining(), MACBYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.length(), KEYBYTES);
+
+        Stodium.checkStatus(key.call(new NativeResource.Call() {
+            @Override
+            public int run(final long handle) {
+                return nativeDetached(
+                        Stodium.ensureUsableByteBuffer(dstCipher),
+                        Stodium.ensureUsableByteBuffer(dstMac),
+                        Stodium.ensureUsableByteBuffer(srcPlain),
+                        Stodium.ensureUsableByteBuffer(nonce),
+                        handle);
+            }
+        }));
+    }
+
+    /**
+     * detachedOpen is the {@link KeyHandle} counterpart of the ByteBuffer
+     * based detachedOpen method.
+     *
+     * @param dstPlain
+     * @param srcCipher
+     * @param srcMac
+     * @param nonce
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean detachedOpen(final @NotNull ByteBuffer dstPlain,
+                                      final @NotNull ByteBuffer srcCipher,
+                                      final @NotNull ByteBuffer srcMac,
+                                      final @NotNull ByteBuffer nonce,
+                                      final @NotNull KeyHandle  key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstPlain);
+
+        Stodium.checkSizeMin(dstPlain.remaining(), srcCipher.remaining());
+        Stodium.checkSizeMin(srcMac.remaining(), MACBYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.length(), KEYBYTES);
+
+        return StodiumJNI.NOERR == key.call(new NativeResource.Call() {
+            @Override
+            public int run(final long handle) {
+                return nativeDetachedOpen(
+                        Stodium.ensureUsableByteBuffer(dstPlain),
+                        Stodium.ensureUsableByteBuffer(srcCipher),
+                        Stodium.ensureUsableByteBuffer(srcMac),
+                        Stodium.ensureUsableByteBuffer(nonce),
+                        handle);
+            }
+        });
+    }
+
+    //
+    // key handle bindings, implemented by the primitives
+    //
+
+    abstract int nativeEasy(final @NotNull ByteBuffer dstCipher,
+                            final @NotNull ByteBuffer srcPlain,
+                            final @NotNull ByteBuffer nonce,
+                            final          long       key);
+
+    abstract int nativeEasyOpen(final @NotNull ByteBuffer dstPlain,
+                                final @NotNull ByteBuffer srcCipher,
+                                final @NotNull ByteBuffer nonce,
+                                final          long       key);
+
+    abstract int nativeDetached(final @NotNull ByteBuffer dstCipher,
+                                final @NotNull ByteBuffer dstMac,
+                                final @NotNull ByteBuffer srcPlain,
+                                final @NotNull ByteBuffer nonce,
+                                final          long       key);
+
+    abstract int nativeDetachedOpen(final @NotNull ByteBuffer dstPlain,
+                                    final @NotNull ByteBuffer srcCipher,
+                                    final @NotNull ByteBuffer srcMac,
+                                    final @NotNull ByteBuffer nonce,
+                                    final          long       key);
+
+    //
+    // scatter/gather
+    //
+
+    /**
+     * detached is the scatter/gather counterpart of the ByteBuffer based
+     * detached method. The plain text is read from the buffers of srcPlain in
+     * order, as if they were concatenated, and the cipher text is written
+     * across the buffers of dstCipher, whose boundaries do not have to match
+     * those of srcPlain.
+     *
+     * @param dstCipher
+     * @param dstMac
+     * @param srcPlain
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public final void detached(final @NotNull ByteBuffer[] dstCipher,
+                               final @NotNull ByteBuffer   dstMac,
+                               final @NotNull ByteBuffer[] srcPlain,
+                               final @NotNull ByteBuffer   nonce,
+                               final @NotNull ByteBuffer   key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstCipher);
+        Stodium.checkDestinationWritable(dstMac);
+
+        Stodium.checkSize(Stodium.remaining(dstCipher), Stodium.remaining(srcPlain), Long.MAX_VALUE);
+        Stodium.checkSizeMin(dstMac.remaining(), MACBYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+
+        Stodium.checkStatus(nativeDetached(
+                dstCipher,
+                Stodium.ensureUsableByteBuffer(dstMac),
+                Stodium.ensureUsableByteBuffers(srcPlain, 0, srcPlain.length),
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * detachedOpen is the scatter/gather counterpart of the ByteBuffer based
+     * detachedOpen method. The MAC is verified over all of srcCipher before
+     * any plain text is written, so dstPlain is left untouched if verification
+     * fails.
+     *
+     * @param dstPlain
+     * @param srcCipher
+     * @param srcMac
+     * @param nonce
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean detachedOpen(final @NotNull ByteBuffer[] dstPlain,
+                                      final @NotNull ByteBuffer[] srcCipher,
+                                      final @NotNull ByteBuffer   srcMac,
+                                      final @NotNull ByteBuffer   nonce,
+                                      final @NotNull ByteBuffer   key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstPlain);
+
+        Stodium.checkSize(Stodium.remaining(dstPlain), Stodium.remaining(srcCipher), Long.MAX_VALUE);
+        Stodium.checkSizeMin(srcMac.remaining(), MACBYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+
+        return StodiumJNI.NOERR == nativeDetachedOpen(
+                dstPlain,
+                Stodium.ensureUsableByteBuffers(srcCipher, 0, srcCipher.length),
+                Stodium.ensureUsableByteBuffer(srcMac),
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key));
+    }
+
+    //
+    // scatter/gather bindings, implemented by the primitives
+    //
+
+    abstract int nativeDetached(final @NotNull ByteBuffer[] dstCipher,
+                                final @NotNull ByteBuffer   dstMac,
+                                final @NotNull ByteBuffer[] srcPlain,
+                                final @NotNull ByteBuffer   nonce,
+                                final @NotNull ByteBuffer   key);
+
+    abstract int nativeDetachedOpen(final @NotNull ByteBuffer[] dstPlain,
+                                    final @NotNull ByteBuffer[] srcCipher,
+                                    final @NotNull ByteBuffer   srcMac,
+                                    final @NotNull ByteBuffer   nonce,
+                                    final @NotNull ByteBuffer   key);
+
+    //
+    // in-place
+    //
+
+    /**
+     * easyInPlace seals the first plainLength bytes of buf within buf itself,
+     * replacing them by the MAC followed by the cipher text. buf must
+     * therefore have room for at least plainLength + {@link #macBytes()}
+     * bytes. The position and limit of buf are not changed.
+     *
+     * @param buf
+     * @param plainLength
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public final void easyInPlace(final @NotNull ByteBuffer buf,
+                                  final          int        plainLength,
+                                  final @NotNull ByteBuffer nonce,
+                                  final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(buf);
+
+        Stodium.checkSize(plainLength, 0, buf.remaining() - MACBYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+
+        Stodium.checkStatus(nativeEasyInPlace(
+                Stodium.ensureUsableByteBuffer(buf),
+                plainLength,
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * easyOpenInPlace opens the MAC and cipher text held by the remaining
+     * bytes of buf. On success, the first buf.remaining() -
+     * {@link #macBytes()} bytes of buf hold the plain text; the bytes after it
+     * are left unspecified. If verification fails, buf is not modified.
+     *
+     * @param buf
+     * @param nonce
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean easyOpenInPlace(final @NotNull ByteBuffer buf,
+                                         final @NotNull ByteBuffer nonce,
+                                         final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(buf);
+
+        Stodium.checkSizeMin(buf.remaining(), MACBYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+
+        return StodiumJNI.NOERR == nativeEasyOpenInPlace(
+                Stodium.ensureUsableByteBuffer(buf),
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key));
+    }
+
+    /**
+     * detachedInPlace replaces the remaining bytes of buf by their cipher
+     * text, and writes the MAC to dstMac.
+     *
+     * @param buf
+     * @param dstMac
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public final void detachedInPlace(final @NotNull ByteBuffer buf,
+                                      final @NotNull ByteBuffer dstMac,
+                                      final @NotNull ByteBuffer nonce,
+                                      final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(buf);
+        Stodium.checkDestinationWritable(dstMac);
+
+        Stodium.checkSizeMin(dstMac.remaining(), MACBYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+
+        Stodium.checkStatus(nativeDetachedInPlace(
+                Stodium.ensureUsableByteBuffer(buf),
+                Stodium.ensureUsableByteBuffer(dstMac),
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * detachedOpenInPlace replaces the remaining bytes of buf by their plain
+     * text, after verifying them against srcMac. If verification fails, buf
+     * is not modified.
+     *
+     * @param buf
+     * @param srcMac
+     * @param nonce
+     * @param key
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean detachedOpenInPlace(final @NotNull ByteBuffer buf,
+                                             final @NotNull ByteBuffer srcMac,
+                                             final @NotNull ByteBuffer nonce,
+                                             final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(buf);
+
+        Stodium.checkSizeMin(srcMac.remaining(), MACBYTES);
+        Stodium.checkSizeMin(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+
+        return StodiumJNI.NOERR == nativeDetachedOpenInPlace(
+                Stodium.ensureUsableByteBuffer(buf),
+                Stodium.ensureUsableByteBuffer(srcMac),
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key));
+    }
+
+    //
+    // in-place bindings, implemented by the primitives
+    //
+
+    abstract int nativeEasyInPlace(final @NotNull ByteBuffer buf,
+                                   final          int        plainLength,
+                                   final @NotNull ByteBuffer nonce,
+                                   final @NotNull ByteBuffer key);
+
+    abstract int nativeEasyOpenInPlace(final @NotNull ByteBuffer buf,
+                                       final @NotNull ByteBuffer nonce,
+                                       final @NotNull ByteBuffer key);
+
+    abstract int nativeDetachedInPlace(final @NotNull ByteBuffer buf,
+                                       final @NotNull ByteBuffer dstMac,
+                                       final @NotNull ByteBuffer nonce,
+                                       final @NotNull ByteBuffer key);
+
+    abstract int nativeDetachedOpenInPlace(final @NotNull ByteBuffer buf,
+                                           final @NotNull ByteBuffer srcMac,
+                                           final @NotNull ByteBuffer nonce,
+                                           final @NotNull ByteBuffer key);
 }
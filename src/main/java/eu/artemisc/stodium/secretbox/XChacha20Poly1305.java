@@ -103,4 +103,185 @@ final class XChacha20Poly1305
                 Stodium.ensureUsableByteBuffer(nonce),
                 Stodium.ensureUsableByteBuffer(key));
     }
+
+    @Override
+    int nativeEasy(final @NotNull byte[] dstCipher,
+                   final          int    dstCipherOffset,
+                   final          int    dstCipherLength,
+                   final @NotNull byte[] srcPlain,
+                   final          int    srcPlainOffset,
+                   final          int    srcPlainLength,
+                   final @NotNull byte[] nonce,
+                   final          int    nonceOffset,
+                   final          int    nonceLength,
+                   final @NotNull byte[] key,
+                   final          int    keyOffset,
+                   final          int    keyLength) {
+        return StodiumJNI.crypto_secretbox_xchacha20poly1305_easy_array(
+                dstCipher, dstCipherOffset, dstCipherLength,
+                srcPlain, srcPlainOffset, srcPlainLength,
+                nonce, nonceOffset, nonceLength,
+                key, keyOffset, keyLength);
+    }
+
+    @Override
+    int nativeEasyOpen(final @NotNull byte[] dstPlain,
+                       final          int    dstPlainOffset,
+                       final          int    dstPlainLength,
+                       final @NotNull byte[] srcCipher,
+                       final          int    srcCipherOffset,
+                       final          int    srcCipherLength,
+                       final @NotNull byte[] nonce,
+                       final          int    nonceOffset,
+                       final          int    nonceLength,
+                       final @NotNull byte[] key,
+                       final          int    keyOffset,
+                       final          int    keyLength) {
+        return StodiumJNI.crypto_secretbox_xchacha20poly1305_open_easy_array(
+                dstPlain, dstPlainOffset, dstPlainLength,
+                srcCipher, srcCipherOffset, srcCipherLength,
+                nonce, nonceOffset, nonceLength,
+                key, keyOffset, keyLength);
+    }
+
+    @Override
+    int nativeDetached(final @NotNull byte[] dstCipher,
+                       final          int    dstCipherOffset,
+                       final          int    dstCipherLength,
+                       final @NotNull byte[] dstMac,
+                       final          int    dstMacOffset,
+                       final          int    dstMacLength,
+                       final @NotNull byte[] srcPlain,
+                       final          int    srcPlainOffset,
+                       final          int    srcPlainLength,
+                       final @NotNull byte[] nonce,
+                       final          int    nonceOffset,
+                       final          int    nonceLength,
+                       final @NotNull byte[] key,
+                       final          int    keyOffset,
+                       final          int    keyLength) {
+        return StodiumJNI.crypto_secretbox_xchacha20poly1305_detached_array(
+                dstCipher, dstCipherOffset, dstCipherLength,
+                dstMac, dstMacOffset, dstMacLength,
+                srcPlain, srcPlainOffset, srcPlainLength,
+                nonce, nonceOffset, nonceLength,
+                key, keyOffset, keyLength);
+    }
+
+    @Override
+    int nativeDetachedOpen(final @NotNull byte[] dstPlain,
+                           final          int    dstPlainOffset,
+                           final          int    dstPlainLength,
+                           final @NotNull byte[] srcCipher,
+                           final          int    srcCipherOffset,
+                           final          int    srcCipherLength,
+                           final @NotNull byte[] srcMac,
+                           final          int    srcMacOffset,
+                           final          int    srcMacLength,
+                           final @NotNull byte[] nonce,
+                           final          int    nonceOffset,
+                           final          int    nonceLength,
+                           final @NotNull byte[] key,
+                           final          int    keyOffset,
+                           final          int    keyLength) {
+        return StodiumJNI.crypto_secretbox_xchacha20poly1305_open_detached_array(
+                dstPlain, dstPlainOffset, dstPlainLength,
+                srcCipher, srcCipherOffset, srcCipherLength,
+                srcMac, srcMacOffset, srcMacLength,
+                nonce, nonceOffset, nonceLength,
+                key, keyOffset, keyLength);
+    }
+
+    @Override
+    int nativeEasy(final @NotNull ByteBuffer dstCipher,
+                   final @NotNull ByteBuffer srcPlain,
+                   final @NotNull ByteBuffer nonce,
+                   final          long       key) {
+        return StodiumJNI.crypto_secretbox_xchacha20poly1305_easy_handle(
+                dstCipher, srcPlain, nonce, key);
+    }
+
+    @Override
+    int nativeEasyOpen(final @NotNull ByteBuffer dstPlain,
+                       final @NotNull ByteBuffer srcCipher,
+                       final @NotNull ByteBuffer nonce,
+                       final          long       key) {
+        return StodiumJNI.crypto_secretbox_xchacha20poly1305_open_easy_handle(
+                dstPlain, srcCipher, nonce, key);
+    }
+
+    @Override
+    int nativeDetached(final @NotNull ByteBuffer dstCipher,
+                       final @NotNull ByteBuffer dstMac,
+                       final @NotNull ByteBuffer srcPlain,
+                       final @NotNull ByteBuffer nonce,
+                       final          long       key) {
+        return StodiumJNI.crypto_secretbox_xchacha20poly1305_detached_handle(
+                dstCipher, dstMac, srcPlain, nonce, key);
+    }
+
+    @Override
+    int nativeDetachedOpen(final @NotNull ByteBuffer dstPlain,
+                           final @NotNull ByteBuffer srcCipher,
+                           final @NotNull ByteBuffer srcMac,
+                           final @NotNull ByteBuffer nonce,
+                           final          long       key) {
+        return StodiumJNI.crypto_secretbox_xchacha20poly1305_open_detached_handle(
+                dstPlain, srcCipher, srcMac, nonce, key);
+    }
+
+    @Override
+    int nativeDetached(final @NotNull ByteBuffer[] dstCipher,
+                       final @NotNull ByteBuffer   dstMac,
+                       final @NotNull ByteBuffer[] srcPlain,
+                       final @NotNull ByteBuffer   nonce,
+                       final @NotNull ByteBuffer   key) {
+        return StodiumJNI.crypto_secretbox_xchacha20poly1305_detachedv(
+                dstCipher, dstMac, srcPlain, nonce, key);
+    }
+
+    @Override
+    int nativeDetachedOpen(final @NotNull ByteBuffer[] dstPlain,
+                           final @NotNull ByteBuffer[] srcCipher,
+                           final @NotNull ByteBuffer   srcMac,
+                           final @NotNull ByteBuffer   nonce,
+                           final @NotNull ByteBuffer   key) {
+        return StodiumJNI.crypto_secretbox_xchacha20poly1305_open_detachedv(
+                dstPlain, srcCipher, srcMac, nonce, key);
+    }
+
+    @Override
+    int nativeEasyInPlace(final @NotNull ByteBuffer buf,
+                          final          int        plainLength,
+                          final @NotNull ByteBuffer nonce,
+                          final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_secretbox_xchacha20poly1305_easy_inplace(
+                buf, plainLength, nonce, key);
+    }
+
+    @Override
+    int nativeEasyOpenInPlace(final @NotNull ByteBuffer buf,
+                              final @NotNull ByteBuffer nonce,
+                              final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_secretbox_xchacha20poly1305_open_easy_inplace(
+                buf, nonce, key);
+    }
+
+    @Override
+    int nativeDetachedInPlace(final @NotNull ByteBuffer buf,
+                              final @NotNull ByteBuffer dstMac,
+                              final @NotNull ByteBuffer nonce,
+                              final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_secretbox_xchacha20poly1305_detached_inplace(
+                buf, dstMac, nonce, key);
+    }
+
+    @Override
+    int nativeDetachedOpenInPlace(final @NotNull ByteBuffer buf,
+                                  final @NotNull ByteBuffer srcMac,
+                                  final @NotNull ByteBuffer nonce,
+                                  final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_secretbox_xchacha20poly1305_open_detached_inplace(
+                buf, srcMac, nonce, key);
+    }
 }
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.secretstream;
+
+import org.jetbrains.annotations.NotNull;
+import org.jetbrains.annotations.Nullable;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Singleton;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * SecretStream encrypts a sequence of chunks under a single key, as an
+ * alternative to splitting a large message into separately nonced SecretBox
+ * messages. Every chunk is authenticated together with its position in the
+ * stream, so chunks cannot be reordered, dropped or replayed, and a stream
+ * that was cut short is detected by the absence of the final tag.
+ * <p>
+ * A stream is started through {@link #initPush(ByteBuffer, ByteBuffer)} on the
+ * encrypting side, which produces a header to send ahead of the first chunk,
+ * and through {@link #initPull(ByteBuffer, ByteBuffer)} on the decrypting side.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public abstract class SecretStream {
+
+    private static final @NotNull Singleton<SecretStream> XCHACHA = new Singleton<SecretStream>() {
+        @NotNull
+        @Override
+        protected SecretStream initialize() {
+            return new XChacha20Poly1305();
+        }
+    };
+
+    @NotNull
+    public static SecretStream instance() {
+        return xchacha20poly1305Instance();
+    }
+
+    @NotNull
+    public static SecretStream xchacha20poly1305Instance() {
+        return XCHACHA.get();
+    }
+
+    // constants
+    final int ABYTES;
+    final int HEADERBYTES;
+    final int KEYBYTES;
+    final int STATEBYTES;
+    final int TAG_MESSAGE;
+    final int TAG_PUSH;
+    final int TAG_REKEY;
+    final int TAG_FINAL;
+
+    /**
+     *
+     * @param abytes
+     * @param header
+     * @param key
+     * @param state
+     * @param message
+     * @param push
+     * @param rekey
+     * @param fin
+     */
+    SecretStream(final int abytes,
+                 final int header,
+                 final int key,
+                 final int state,
+                 final int message,
+                 final int push,
+                 final int rekey,
+                 final int fin) {
+        this.ABYTES      = abytes;
+        this.HEADERBYTES = header;
+        this.KEYBYTES    = key;
+        this.STATEBYTES  = state;
+        this.TAG_MESSAGE = message;
+        this.TAG_PUSH    = push;
+        this.TAG_REKEY   = rekey;
+        this.TAG_FINAL   = fin;
+    }
+
+    /**
+     *
+     * @return the number of bytes each chunk grows by when encrypted
+     */
+    public final int aBytes() {
+        return ABYTES;
+    }
+
+    /**
+     *
+     * @return
+     */
+    public final int headerBytes() {
+        return HEADERBYTES;
+    }
+
+    /**
+     *
+     * @return
+     */
+    public final int keyBytes() {
+        return KEYBYTES;
+    }
+
+    /**
+     *
+     * @return
+     */
+    public final int stateBytes() {
+        return STATEBYTES;
+    }
+
+    /**
+     *
+     * @return the tag of a regular chunk
+     */
+    public final int tagMessage() {
+        return TAG_MESSAGE;
+    }
+
+    /**
+     *
+     * @return the tag marking the end of a set of chunks, without ending the
+     *         stream
+     */
+    public final int tagPush() {
+        return TAG_PUSH;
+    }
+
+    /**
+     *
+     * @return the tag that makes both sides rekey after the chunk
+     */
+    public final int tagRekey() {
+        return TAG_REKEY;
+    }
+
+    /**
+     *
+     * @return the tag marking the last chunk of the stream
+     */
+    public final int tagFinal() {
+        return TAG_FINAL;
+    }
+
+    /**
+     * initPush starts a new stream under key, writing the header that the
+     * receiving side needs to {@link #initPull(ByteBuffer, ByteBuffer)} the
+     * stream to dstHeader.
+     *
+     * @param dstHeader
+     * @param key
+     * @return the encrypting end of the stream
+     * @throws StodiumException
+     */
+    @NotNull
+    public abstract SecretStreamPush initPush(final @NotNull ByteBuffer dstHeader,
+                                              final @NotNull ByteBuffer key)
+            throws StodiumException;
+
+    /**
+     * initPull opens the stream started with the given header under key.
+     *
+     * @param srcHeader
+     * @param key
+     * @return the decrypting end of the stream
+     * @throws StodiumException
+     */
+    @NotNull
+    public abstract SecretStreamPull initPull(final @NotNull ByteBuffer srcHeader,
+                                              final @NotNull ByteBuffer key)
+            throws StodiumException;
+
+    //
+    // chunk operations on a stream state, called by SecretStreamPush and
+    // SecretStreamPull
+    //
+
+    abstract void push(final @NotNull  ByteBuffer state,
+                       final @NotNull  ByteBuffer dstCipher,
+                       final @NotNull  ByteBuffer srcPlain,
+                       final @Nullable ByteBuffer ad,
+                       final           int        tag)
+            throws StodiumException;
+
+    abstract int pull(final @NotNull  ByteBuffer state,
+                      final @NotNull  ByteBuffer dstPlain,
+                      final @NotNull  ByteBuffer srcCipher,
+                      final @Nullable ByteBuffer ad)
+            throws StodiumException;
+
+    abstract void rekey(final @NotNull ByteBuffer state);
+}
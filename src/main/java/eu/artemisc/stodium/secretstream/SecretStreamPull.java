@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.secretstream;
+
+import org.jetbrains.annotations.NotNull;
+import org.jetbrains.annotations.Nullable;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * SecretStreamPull is the decrypting end of a {@link SecretStream}. It keeps
+ * the stream state in a direct buffer, and decrypts every chunk straight into
+ * the destination buffer passed by the caller.
+ * <p>
+ * A stream that runs out of chunks before {@link #isFinished()} returns true
+ * has been truncated, and should be rejected by the caller.
+ * <p>
+ * Instances are not thread safe.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public final class SecretStreamPull {
+
+    private final @NotNull SecretStream spec;
+    private final @NotNull ByteBuffer   state;
+
+    private boolean finished;
+
+    SecretStreamPull(final @NotNull SecretStream spec,
+                     final @NotNull ByteBuffer   state) {
+        this.spec  = spec;
+        this.state = state;
+    }
+
+    /**
+     * pull verifies and decrypts the next chunk of the stream, writing
+     * srcCipher.remaining() - {@link SecretStream#aBytes()} bytes to dstPlain.
+     * The ad must match the ad passed when the chunk was pushed, and may be
+     * null.
+     *
+     * @param dstPlain
+     * @param srcCipher
+     * @param ad
+     * @return the tag attached to the chunk
+     * @throws StodiumException if the chunk could not be verified, in which
+     *         case the stream state is left unchanged
+     * @throws IllegalStateException if the final chunk has already been pulled
+     */
+    public int pull(final @NotNull  ByteBuffer dstPlain,
+                    final @NotNull  ByteBuffer srcCipher,
+                    final @Nullable ByteBuffer ad)
+            throws StodiumException {
+        final int tag;
+
+        if (finished) {
+            throw new IllegalStateException("Stodium: secretstream has already been finished");
+        }
+        tag = spec.pull(state, dstPlain, srcCipher, ad);
+        finished = tag == spec.TAG_FINAL;
+        return tag;
+    }
+
+    /**
+     * pull verifies and decrypts the next chunk of the stream, which was pushed
+     * without additional data.
+     *
+     * @param dstPlain
+     * @param srcCipher
+     * @return the tag attached to the chunk
+     * @throws StodiumException
+     * @see #pull(ByteBuffer, ByteBuffer, ByteBuffer)
+     */
+    public int pull(final @NotNull ByteBuffer dstPlain,
+                    final @NotNull ByteBuffer srcCipher)
+            throws StodiumException {
+        return pull(dstPlain, srcCipher, null);
+    }
+
+    /**
+     * rekey mirrors a call to {@link SecretStreamPush#rekey()} on the sending
+     * side.
+     */
+    public void rekey() {
+        spec.rekey(state);
+    }
+
+    /**
+     *
+     * @return true iff the chunk tagged with {@link SecretStream#tagFinal()}
+     *         has been pulled
+     */
+    public boolean isFinished() {
+        return finished;
+    }
+}
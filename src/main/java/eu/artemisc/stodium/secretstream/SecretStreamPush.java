@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.secretstream;
+
+import org.jetbrains.annotations.NotNull;
+import org.jetbrains.annotations.Nullable;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * SecretStreamPush is the encrypting end of a {@link SecretStream}. It keeps
+ * the stream state in a direct buffer, and encrypts every chunk straight into
+ * the destination buffer passed by the caller.
+ * <p>
+ * Instances are not thread safe.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public final class SecretStreamPush {
+
+    private final @NotNull SecretStream spec;
+    private final @NotNull ByteBuffer   state;
+
+    private boolean finished;
+
+    SecretStreamPush(final @NotNull SecretStream spec,
+                     final @NotNull ByteBuffer   state) {
+        this.spec  = spec;
+        this.state = state;
+    }
+
+    /**
+     * push encrypts srcPlain as the next chunk of the stream, writing
+     * srcPlain.remaining() + {@link SecretStream#aBytes()} bytes to dstCipher.
+     * The ad is authenticated along with the chunk, but not encrypted, and may
+     * be null.
+     * <p>
+     * Pushing a chunk tagged with {@link SecretStream#tagFinal()} ends the
+     * stream.
+     *
+     * @param dstCipher
+     * @param srcPlain
+     * @param ad
+     * @param tag
+     * @throws StodiumException
+     * @throws IllegalStateException if the stream has already been ended
+     */
+    public void push(final @NotNull  ByteBuffer dstCipher,
+                     final @NotNull  ByteBuffer srcPlain,
+                     final @Nullable ByteBuffer ad,
+                     final           int        tag)
+            throws StodiumException {
+        if (finished) {
+            throw new IllegalStateException("Stodium: secretstream has already been finished");
+        }
+        spec.push(state, dstCipher, srcPlain, ad, tag);
+        finished = tag == spec.TAG_FINAL;
+    }
+
+    /**
+     * push encrypts srcPlain as the next chunk of the stream, without
+     * additional data.
+     *
+     * @param dstCipher
+     * @param srcPlain
+     * @param tag
+     * @throws StodiumException
+     * @see #push(ByteBuffer, ByteBuffer, ByteBuffer, int)
+     */
+    public void push(final @NotNull ByteBuffer dstCipher,
+                     final @NotNull ByteBuffer srcPlain,
+                     final          int        tag)
+            throws StodiumException {
+        push(dstCipher, srcPlain, null, tag);
+    }
+
+    /**
+     * rekey derives a new key for the rest of the stream, without sending a
+     * {@link SecretStream#tagRekey()} chunk. The receiving side has to call
+     * {@link SecretStreamPull#rekey()} at the same point in the stream.
+     */
+    public void rekey() {
+        spec.rekey(state);
+    }
+
+    /**
+     *
+     * @return true iff a chunk tagged with {@link SecretStream#tagFinal()} has
+     *         been pushed
+     */
+    public boolean isFinished() {
+        return finished;
+    }
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.secretstream;
+
+import org.jetbrains.annotations.NotNull;
+import org.jetbrains.annotations.Nullable;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.StodiumJNI;
+import eu.artemisc.stodium.exceptions.OperationFailedException;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+final class XChacha20Poly1305
+        extends SecretStream {
+
+    XChacha20Poly1305() {
+        super(StodiumJNI.crypto_secretstream_xchacha20poly1305_abytes(),
+                StodiumJNI.crypto_secretstream_xchacha20poly1305_headerbytes(),
+                StodiumJNI.crypto_secretstream_xchacha20poly1305_keybytes(),
+                StodiumJNI.crypto_secretstream_xchacha20poly1305_statebytes(),
+                StodiumJNI.crypto_secretstream_xchacha20poly1305_tag_message(),
+                StodiumJNI.crypto_secretstream_xchacha20poly1305_tag_push(),
+                StodiumJNI.crypto_secretstream_xchacha20poly1305_tag_rekey(),
+                StodiumJNI.crypto_secretstream_xchacha20poly1305_tag_final());
+    }
+
+    @NotNull
+    @Override
+    public SecretStreamPush initPush(final @NotNull ByteBuffer dstHeader,
+                                     final @NotNull ByteBuffer key)
+            throws StodiumException {
+        final ByteBuffer state;
+
+        Stodium.checkDestinationWritable(dstHeader);
+
+        Stodium.checkSizeMin(dstHeader.remaining(), HEADERBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+        state = ByteBuffer.allocateDirect(STATEBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_secretstream_xchacha20poly1305_init_push(
+                state,
+                Stodium.ensureUsableByteBuffer(dstHeader),
+                Stodium.ensureUsableByteBuffer(key)));
+
+        return new SecretStreamPush(this, state);
+    }
+
+    @NotNull
+    @Override
+    public SecretStreamPull initPull(final @NotNull ByteBuffer srcHeader,
+                                     final @NotNull ByteBuffer key)
+            throws StodiumException {
+        final ByteBuffer state;
+
+        Stodium.checkSizeMin(srcHeader.remaining(), HEADERBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+        state = ByteBuffer.allocateDirect(STATEBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_secretstream_xchacha20poly1305_init_pull(
+                state,
+                Stodium.ensureUsableByteBuffer(srcHeader),
+                Stodium.ensureUsableByteBuffer(key)));
+
+        return new SecretStreamPull(this, state);
+    }
+
+    @Override
+    void push(final @NotNull  ByteBuffer state,
+              final @NotNull  ByteBuffer dstCipher,
+              final @NotNull  ByteBuffer srcPlain,
+              final @Nullable ByteBuffer ad,
+              final           int        tag)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dstCipher);
+
+        Stodium.checkSizeMin(dstCipher.remaining(), srcPlain.remaining() + ABYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_secretstream_xchacha20poly1305_push(
+                state,
+                Stodium.ensureUsableByteBuffer(dstCipher),
+                Stodium.ensureUsableByteBuffer(srcPlain),
+                Stodium.ensureUsableByteBuffer(ad),
+                tag));
+    }
+
+    @Override
+    int pull(final @NotNull  ByteBuffer state,
+             final @NotNull  ByteBuffer dstPlain,
+             final @NotNull  ByteBuffer srcCipher,
+             final @Nullable ByteBuffer ad)
+            throws StodiumException {
+        final int tag;
+
+        Stodium.checkDestinationWritable(dstPlain);
+
+        Stodium.checkSizeMin(srcCipher.remaining(), ABYTES);
+        Stodium.checkSizeMin(dstPlain.remaining(), srcCipher.remaining() - ABYTES);
+
+        tag = StodiumJNI.crypto_secretstream_xchacha20poly1305_pull(
+                state,
+                Stodium.ensureUsableByteBuffer(dstPlain),
+                Stodium.ensureUsableByteBuffer(srcCipher),
+                Stodium.ensureUsableByteBuffer(ad));
+        if (tag < 0) {
+            throw new OperationFailedException("Stodium: secretstream chunk could not be verified");
+        }
+        return tag;
+    }
+
+    @Override
+    void rekey(final @NotNull ByteBuffer state) {
+        StodiumJNI.crypto_secretstream_xchacha20poly1305_rekey(state);
+    }
+}
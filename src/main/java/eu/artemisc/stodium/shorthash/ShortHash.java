@@ -11,7 +11,10 @@ import org.jetbrains.annotations.NotNull;
 
 import java.nio.ByteBuffer;
 
+import eu.artemisc.stodium.KeyHandle;
+import eu.artemisc.stodium.NativeResource;
 import eu.artemisc.stodium.Singleton;
+import eu.artemisc.stodium.Stodium;
 import eu.artemisc.stodium.exceptions.StodiumException;
 
 /**
@@ -92,4 +95,37 @@ public abstract class ShortHash {
                               final @NotNull ByteBuffer in,
                               final @NotNull ByteBuffer key)
             throws StodiumException;
+
+    /**
+     * hash is the {@link KeyHandle} counterpart of the ByteBuffer based hash
+     * method, reading the key from guarded native memory.
+     *
+     * @param out
+     * @param in
+     * @param key
+     * @throws StodiumException
+     */
+    public final void hash(final @NotNull ByteBuffer out,
+                           final @NotNull ByteBuffer in,
+                           final @NotNull KeyHandle  key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(out);
+
+        Stodium.checkSizeMin(out.remaining(), BYTES);
+        Stodium.checkSize(key.length(), KEYBYTES);
+
+        Stodium.checkStatus(key.call(new NativeResource.Call() {
+            @Override
+            public int run(final long handle) {
+                return nativeHash(
+                        Stodium.ensureUsableByteBuffer(out),
+                        Stodium.ensureUsableByteBuffer(in),
+                        handle);
+            }
+        }));
+    }
+
+    abstract int nativeHash(final @NotNull ByteBuffer out,
+                            final @NotNull ByteBuffer in,
+                            final          long       key);
 }
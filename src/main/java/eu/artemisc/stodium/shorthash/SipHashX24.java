@@ -34,4 +34,12 @@ final class SipHashX24
                 Stodium.ensureUsableByteBuffer(in),
                 Stodium.ensureUsableByteBuffer(key)));
     }
+
+    @Override
+    int nativeHash(final @NotNull ByteBuffer out,
+                   final @NotNull ByteBuffer in,
+                   final          long       key) {
+        return StodiumJNI.crypto_shorthash_siphashx24_handle(
+                out, in, key);
+    }
 }
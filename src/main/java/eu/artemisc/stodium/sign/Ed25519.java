@@ -4,6 +4,7 @@ import org.jetbrains.annotations.NotNull;
 
 import java.nio.ByteBuffer;
 
+import eu.artemisc.stodium.StatePool;
 import eu.artemisc.stodium.Stodium;
 import eu.artemisc.stodium.StodiumJNI;
 import eu.artemisc.stodium.exceptions.StodiumException;
@@ -125,10 +126,10 @@ final class Ed25519
             throws StodiumException {
         final ByteBuffer state;
 
-        state = ByteBuffer.allocateDirect(STATEBYTES);
+        state = StatePool.acquire(STATEBYTES);
         Stodium.checkStatus(StodiumJNI.crypto_sign_ed25519ph_init(state));
 
-        return new MultipartSign(this, state);
+        return new MultipartSign(this, state, true);
     }
 
     @Override
@@ -144,6 +145,22 @@ final class Ed25519
                 Stodium.ensureUsableByteBuffer(in)));
     }
 
+    @Override
+    public void update(final @NotNull ByteBuffer   state,
+                       final @NotNull ByteBuffer[] in,
+                       final          int          offset,
+                       final          int          length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_sign_ed25519ph_updatev(
+                Stodium.ensureUsableByteBuffer(state),
+                Stodium.ensureUsableByteBuffers(in, offset, length),
+                offset, length));
+    }
+
     @Override
     public void doFinal(final @NotNull ByteBuffer state,
                         final @NotNull ByteBuffer dst,
@@ -178,4 +195,135 @@ final class Ed25519
                 Stodium.ensureUsableByteBuffer(sig),
                 Stodium.ensureUsableByteBuffer(priv));
     }
+
+    @Override
+    public void update(final @NotNull ByteBuffer state,
+                       final @NotNull byte[]     in,
+                       final          int        offset,
+                       final          int        length)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_sign_ed25519ph_update_array(
+                Stodium.ensureUsableByteBuffer(state),
+                in, offset, length));
+    }
+
+    @Override
+    public void doFinal(final @NotNull ByteBuffer state,
+                        final @NotNull byte[]     dst,
+                        final          int        dstOffset,
+                        final @NotNull byte[]     priv,
+                        final          int        privOffset)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+        Stodium.checkOffsetParams(dst.length, dstOffset, BYTES);
+        Stodium.checkOffsetParams(priv.length, privOffset, SECRETKEYBYTES);
+
+        Stodium.checkStatus(StodiumJNI.crypto_sign_ed25519ph_final_create_array(
+                Stodium.ensureUsableByteBuffer(state),
+                dst, dstOffset, BYTES,
+                priv, privOffset, SECRETKEYBYTES));
+    }
+
+    @Override
+    public boolean doFinalVerify(final @NotNull ByteBuffer state,
+                                 final @NotNull byte[]     sig,
+                                 final          int        sigOffset,
+                                 final @NotNull byte[]     pub,
+                                 final          int        pubOffset)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(state);
+
+        Stodium.checkSize(state.remaining(), STATEBYTES);
+        Stodium.checkOffsetParams(sig.length, sigOffset, BYTES);
+        Stodium.checkOffsetParams(pub.length, pubOffset, PUBLICKEYBYTES);
+
+        return StodiumJNI.NOERR == StodiumJNI.crypto_sign_ed25519ph_final_verify_array(
+                Stodium.ensureUsableByteBuffer(state),
+                sig, sigOffset, BYTES,
+                pub, pubOffset, PUBLICKEYBYTES);
+    }
+
+    @Override
+    int nativeSign(final @NotNull byte[] dstSigned,
+                   final          int    dstSignedOffset,
+                   final          int    dstSignedLength,
+                   final @NotNull byte[] srcMsg,
+                   final          int    srcMsgOffset,
+                   final          int    srcMsgLength,
+                   final @NotNull byte[] priv,
+                   final          int    privOffset,
+                   final          int    privLength) {
+        return StodiumJNI.crypto_sign_ed25519_array(
+                dstSigned, dstSignedOffset, dstSignedLength,
+                srcMsg, srcMsgOffset, srcMsgLength,
+                priv, privOffset, privLength);
+    }
+
+    @Override
+    int nativeOpen(final @NotNull byte[] dstMsg,
+                   final          int    dstMsgOffset,
+                   final          int    dstMsgLength,
+                   final @NotNull byte[] srcSigned,
+                   final          int    srcSignedOffset,
+                   final          int    srcSignedLength,
+                   final @NotNull byte[] pub,
+                   final          int    pubOffset,
+                   final          int    pubLength) {
+        return StodiumJNI.crypto_sign_ed25519_open_array(
+                dstMsg, dstMsgOffset, dstMsgLength,
+                srcSigned, srcSignedOffset, srcSignedLength,
+                pub, pubOffset, pubLength);
+    }
+
+    @Override
+    int nativeSignDetached(final @NotNull byte[] dstSig,
+                           final          int    dstSigOffset,
+                           final          int    dstSigLength,
+                           final @NotNull byte[] srcMsg,
+                           final          int    srcMsgOffset,
+                           final          int    srcMsgLength,
+                           final @NotNull byte[] priv,
+                           final          int    privOffset,
+                           final          int    privLength) {
+        return StodiumJNI.crypto_sign_ed25519_detached_array(
+                dstSig, dstSigOffset, dstSigLength,
+                srcMsg, srcMsgOffset, srcMsgLength,
+                priv, privOffset, privLength);
+    }
+
+    @Override
+    int nativeVerifyDetached(final @NotNull byte[] srcSig,
+                             final          int    srcSigOffset,
+                             final          int    srcSigLength,
+                             final @NotNull byte[] srcMsg,
+                             final          int    srcMsgOffset,
+                             final          int    srcMsgLength,
+                             final @NotNull byte[] pub,
+                             final          int    pubOffset,
+                             final          int    pubLength) {
+        return StodiumJNI.crypto_sign_ed25519_verify_detached_array(
+                srcSig, srcSigOffset, srcSigLength,
+                srcMsg, srcMsgOffset, srcMsgLength,
+                pub, pubOffset, pubLength);
+    }
+
+    @Override
+    int nativeVerifyBatch(final @NotNull ByteBuffer sigs,
+                          final @NotNull ByteBuffer msgs,
+                          final @NotNull int[]      msgOffsets,
+                          final @NotNull int[]      msgLengths,
+                          final @NotNull ByteBuffer pubs,
+                          final @NotNull boolean[]  valid) {
+        return StodiumJNI.crypto_sign_ed25519_verify_detached_batch(
+                sigs,
+                msgs, msgOffsets, msgLengths,
+                pubs,
+                valid);
+    }
 }
@@ -4,6 +4,8 @@ import org.jetbrains.annotations.NotNull;
 
 import java.nio.ByteBuffer;
 
+import eu.artemisc.stodium.StatePool;
+import eu.artemisc.stodium.Stodium;
 import eu.artemisc.stodium.exceptions.StodiumException;
 
 /**
@@ -25,6 +27,22 @@ public final class MultipartSign {
                     final @NotNull ByteBuffer in)
                 throws StodiumException;
 
+        /**
+         * update absorbs length buffers of in, starting at index offset, in
+         * order, as if update was called for each of them.
+         *
+         * @param state
+         * @param in
+         * @param offset
+         * @param length
+         * @throws StodiumException
+         */
+        void update(final @NotNull ByteBuffer   state,
+                    final @NotNull ByteBuffer[] in,
+                    final          int          offset,
+                    final          int          length)
+                throws StodiumException;
+
         /**
          *
          * @param state
@@ -40,6 +58,61 @@ public final class MultipartSign {
                               final @NotNull ByteBuffer sign,
                               final @NotNull ByteBuffer priv)
                 throws StodiumException;
+
+        /**
+         * update is the byte[] counterpart of
+         * {@link #update(ByteBuffer, ByteBuffer)}, absorbing length bytes of
+         * in, starting at offset.
+         *
+         * @param state
+         * @param in
+         * @param offset
+         * @param length
+         * @throws StodiumException
+         */
+        void update(final @NotNull ByteBuffer state,
+                    final @NotNull byte[]     in,
+                    final          int        offset,
+                    final          int        length)
+                throws StodiumException;
+
+        /**
+         * doFinal is the byte[] counterpart of
+         * {@link #doFinal(ByteBuffer, ByteBuffer, ByteBuffer)}.
+         *
+         * @param state
+         * @param dst
+         * @param dstOffset
+         * @param priv
+         * @param privOffset
+         * @throws StodiumException
+         */
+        void doFinal(final @NotNull ByteBuffer state,
+                     final @NotNull byte[]     dst,
+                     final          int        dstOffset,
+                     final @NotNull byte[]     priv,
+                     final          int        privOffset)
+                throws StodiumException;
+
+        /**
+         * doFinalVerify is the byte[] counterpart of
+         * {@link #doFinalVerify(ByteBuffer, ByteBuffer, ByteBuffer)}, and
+         * verifies sign against the public key pub.
+         *
+         * @param state
+         * @param sign
+         * @param signOffset
+         * @param pub
+         * @param pubOffset
+         * @return
+         * @throws StodiumException
+         */
+        boolean doFinalVerify(final @NotNull ByteBuffer state,
+                              final @NotNull byte[]     sign,
+                              final          int        signOffset,
+                              final @NotNull byte[]     pub,
+                              final          int        pubOffset)
+                throws StodiumException;
     }
 
     /**
@@ -53,23 +126,80 @@ public final class MultipartSign {
     private final @NotNull ByteBuffer state;
 
     /**
+     *
+     */
+    private final boolean pooled;
+
+    /**
+     *
+     */
+    private boolean released;
+
+    /**
+     * Creates an instance on a state buffer owned by the caller. The buffer is
+     * wiped by {@link #release()}, but never handed to the {@link StatePool}.
      *
      * @param spec
      * @param state
      */
     public MultipartSign(final @NotNull Spec       spec,
                          final @NotNull ByteBuffer state) {
-        this.spec  = spec;
-        this.state = state;
+        this(spec, state, false);
     }
 
     /**
+     * Creates an instance on state. If pooled is true, state must have been
+     * obtained from {@link StatePool#acquire(int)} and is owned by the new
+     * instance, which returns it to the pool on {@link #release()}.
+     *
+     * @param spec
+     * @param state
+     * @param pooled
+     */
+    public MultipartSign(final @NotNull Spec       spec,
+                         final @NotNull ByteBuffer state,
+                         final          boolean    pooled) {
+        this.spec   = spec;
+        this.state  = state;
+        this.pooled = pooled;
+    }
+
+    /**
+     * duplicate copies the current state into a new instance, taken from the
+     * {@link StatePool}. Both instances can be updated and finalized
+     * independently afterwards, so a common prefix only needs to be absorbed
+     * once.
      *
      * @return
+     * @throws IllegalStateException if the instance has been released
      */
     @NotNull
     public MultipartSign duplicate() {
-        throw new UnsupportedOperationException();
+        final ByteBuffer copy, src;
+
+        checkLive();
+        src  = state.duplicate();
+        copy = StatePool.acquire(src.remaining());
+        copy.put(src).clear();
+
+        return new MultipartSign(spec, copy, true);
+    }
+
+    /**
+     * release wipes the state. If the state was taken from the
+     * {@link StatePool}, its buffer is returned to the pool. The instance can
+     * not be used afterwards.
+     */
+    public void release() {
+        if (released) {
+            return;
+        }
+        released = true;
+        if (pooled) {
+            StatePool.release(state);
+        } else {
+            Stodium.wipeBytes(state.duplicate());
+        }
     }
 
     /**
@@ -81,10 +211,53 @@ public final class MultipartSign {
     @NotNull
     public MultipartSign update(final @NotNull ByteBuffer src)
             throws StodiumException {
+        checkLive();
         spec.update(state, src);
         return this;
     }
 
+    /**
+     * update absorbs all buffers of srcs, in order, in a single native call.
+     *
+     * @param srcs
+     * @return
+     * @throws StodiumException
+     */
+    @NotNull
+    public MultipartSign update(final @NotNull ByteBuffer[] srcs)
+            throws StodiumException {
+        return update(srcs, 0, srcs.length);
+    }
+
+    /**
+     * update absorbs length buffers of srcs, starting at index offset, in
+     * order, in a single native call. This gives the same result as calling
+     * {@link #update(ByteBuffer)} for each of them.
+     *
+     * @param srcs
+     * @param offset
+     * @param length
+     * @return
+     * @throws StodiumException
+     */
+    @NotNull
+    public MultipartSign update(final @NotNull ByteBuffer[] srcs,
+                                final          int          offset,
+                                final          int          length)
+            throws StodiumException {
+        checkLive();
+        Stodium.checkSize(offset, 0, srcs.length);
+        Stodium.checkSize(length, 0, srcs.length - offset);
+        for (int i = offset; i < offset + length; i++) {
+            if (srcs[i] == null) {
+                throw new NullPointerException("Stodium: srcs[" + i + "] is null");
+            }
+        }
+
+        spec.update(state, srcs, offset, length);
+        return this;
+    }
+
     /**
      *
      * @param dst
@@ -94,6 +267,7 @@ public final class MultipartSign {
     public void doFinal(final @NotNull ByteBuffer dst,
                         final @NotNull ByteBuffer priv)
             throws StodiumException {
+        checkLive();
         spec.doFinal(state, dst, priv);
     }
 
@@ -107,6 +281,75 @@ public final class MultipartSign {
     public boolean doFinalVerify(final @NotNull ByteBuffer sign,
                                  final @NotNull ByteBuffer priv)
             throws StodiumException {
+        checkLive();
         return spec.doFinalVerify(state, sign, priv);
     }
+
+    /**
+     * update is the byte[] counterpart of {@link #update(ByteBuffer)}, and
+     * absorbs length bytes of src, starting at offset.
+     *
+     * @param src
+     * @param offset
+     * @param length
+     * @return
+     * @throws StodiumException
+     */
+    @NotNull
+    public MultipartSign update(final @NotNull byte[] src,
+                                final          int    offset,
+                                final          int    length)
+            throws StodiumException {
+        checkLive();
+        Stodium.checkOffsetParams(src.length, offset, length);
+
+        spec.update(state, src, offset, length);
+        return this;
+    }
+
+    /**
+     * doFinal is the byte[] counterpart of
+     * {@link #doFinal(ByteBuffer, ByteBuffer)}.
+     *
+     * @param dst
+     * @param dstOffset
+     * @param priv
+     * @param privOffset
+     * @throws StodiumException
+     */
+    public void doFinal(final @NotNull byte[] dst,
+                        final          int    dstOffset,
+                        final @NotNull byte[] priv,
+                        final          int    privOffset)
+            throws StodiumException {
+        checkLive();
+        spec.doFinal(state, dst, dstOffset, priv, privOffset);
+    }
+
+    /**
+     * doFinalVerify is the byte[] counterpart of
+     * {@link #doFinalVerify(ByteBuffer, ByteBuffer)}, and verifies sign
+     * against the public key pub.
+     *
+     * @param sign
+     * @param signOffset
+     * @param pub
+     * @param pubOffset
+     * @return
+     * @throws StodiumException
+     */
+    public boolean doFinalVerify(final @NotNull byte[] sign,
+                                 final          int    signOffset,
+                                 final @NotNull byte[] pub,
+                                 final          int    pubOffset)
+            throws StodiumException {
+        checkLive();
+        return spec.doFinalVerify(state, sign, signOffset, pub, pubOffset);
+    }
+
+    private void checkLive() {
+        if (released) {
+            throw new IllegalStateException("Stodium: multipart state has been released");
+        }
+    }
 }
@@ -12,6 +12,8 @@ import org.jetbrains.annotations.NotNull;
 import java.nio.ByteBuffer;
 
 import eu.artemisc.stodium.Singleton;
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.StodiumJNI;
 import eu.artemisc.stodium.exceptions.StodiumException;
 
 /**
@@ -175,4 +177,238 @@ public abstract class Sign {
     @NotNull
     public abstract MultipartSign init()
             throws StodiumException;
+
+    //
+    // byte[] overloads
+    //
+
+    /**
+     * sign is the byte[] counterpart of the ByteBuffer based sign method. It
+     * writes srcMsgLength + {@link #bytes()} bytes to dstSigned.
+     *
+     * @param dstSigned
+     * @param dstSignedOffset
+     * @param srcMsg
+     * @param srcMsgOffset
+     * @param srcMsgLength
+     * @param priv
+     * @param privOffset
+     * @throws StodiumException
+     */
+    public final void sign(final @NotNull byte[] dstSigned,
+                           final          int    dstSignedOffset,
+                           final @NotNull byte[] srcMsg,
+                           final          int    srcMsgOffset,
+                           final          int    srcMsgLength,
+                           final @NotNull byte[] priv,
+                           final          int    privOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(dstSigned.length, dstSignedOffset, srcMsgLength + BYTES);
+        Stodium.checkOffsetParams(srcMsg.length, srcMsgOffset, srcMsgLength);
+        Stodium.checkOffsetParams(priv.length, privOffset, SECRETKEYBYTES);
+
+        Stodium.checkStatus(nativeSign(
+                dstSigned, dstSignedOffset, srcMsgLength + BYTES,
+                srcMsg, srcMsgOffset, srcMsgLength,
+                priv, privOffset, SECRETKEYBYTES));
+    }
+
+    /**
+     * open is the byte[] counterpart of the ByteBuffer based open method. It
+     * writes srcSignedLength - {@link #bytes()} bytes to dstMsg.
+     *
+     * @param dstMsg
+     * @param dstMsgOffset
+     * @param srcSigned
+     * @param srcSignedOffset
+     * @param srcSignedLength
+     * @param pub
+     * @param pubOffset
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean open(final @NotNull byte[] dstMsg,
+                              final          int    dstMsgOffset,
+                              final @NotNull byte[] srcSigned,
+                              final          int    srcSignedOffset,
+                              final          int    srcSignedLength,
+                              final @NotNull byte[] pub,
+                              final          int    pubOffset)
+            throws StodiumException {
+        Stodium.checkSizeMin(srcSignedLength, BYTES);
+        Stodium.checkOffsetParams(dstMsg.length, dstMsgOffset, srcSignedLength - BYTES);
+        Stodium.checkOffsetParams(srcSigned.length, srcSignedOffset, srcSignedLength);
+        Stodium.checkOffsetParams(pub.length, pubOffset, PUBLICKEYBYTES);
+
+        return StodiumJNI.NOERR == nativeOpen(
+                dstMsg, dstMsgOffset, srcSignedLength - BYTES,
+                srcSigned, srcSignedOffset, srcSignedLength,
+                pub, pubOffset, PUBLICKEYBYTES);
+    }
+
+    /**
+     * signDetached is the byte[] counterpart of the ByteBuffer based
+     * signDetached method. It writes {@link #bytes()} bytes to dstSig.
+     *
+     * @param dstSig
+     * @param dstSigOffset
+     * @param srcMsg
+     * @param srcMsgOffset
+     * @param srcMsgLength
+     * @param priv
+     * @param privOffset
+     * @throws StodiumException
+     */
+    public final void signDetached(final @NotNull byte[] dstSig,
+                                   final          int    dstSigOffset,
+                                   final @NotNull byte[] srcMsg,
+                                   final          int    srcMsgOffset,
+                                   final          int    srcMsgLength,
+                                   final @NotNull byte[] priv,
+                                   final          int    privOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(dstSig.length, dstSigOffset, BYTES);
+        Stodium.checkOffsetParams(srcMsg.length, srcMsgOffset, srcMsgLength);
+        Stodium.checkOffsetParams(priv.length, privOffset, SECRETKEYBYTES);
+
+        Stodium.checkStatus(nativeSignDetached(
+                dstSig, dstSigOffset, BYTES,
+                srcMsg, srcMsgOffset, srcMsgLength,
+                priv, privOffset, SECRETKEYBYTES));
+    }
+
+    /**
+     * verifyDetached is the byte[] counterpart of the ByteBuffer based
+     * verifyDetached method.
+     *
+     * @param srcSig
+     * @param srcSigOffset
+     * @param srcMsg
+     * @param srcMsgOffset
+     * @param srcMsgLength
+     * @param pub
+     * @param pubOffset
+     * @return
+     * @throws StodiumException
+     */
+    public final boolean verifyDetached(final @NotNull byte[] srcSig,
+                                        final          int    srcSigOffset,
+                                        final @NotNull byte[] srcMsg,
+                                        final          int    srcMsgOffset,
+                                        final          int    srcMsgLength,
+                                        final @NotNull byte[] pub,
+                                        final          int    pubOffset)
+            throws StodiumException {
+        Stodium.checkOffsetParams(srcSig.length, srcSigOffset, BYTES);
+        Stodium.checkOffsetParams(srcMsg.length, srcMsgOffset, srcMsgLength);
+        Stodium.checkOffsetParams(pub.length, pubOffset, PUBLICKEYBYTES);
+
+        return StodiumJNI.NOERR == nativeVerifyDetached(
+                srcSig, srcSigOffset, BYTES,
+                srcMsg, srcMsgOffset, srcMsgLength,
+                pub, pubOffset, PUBLICKEYBYTES);
+    }
+
+    //
+    // byte[] bindings, implemented by the primitives
+    //
+
+    abstract int nativeSign(final @NotNull byte[] dstSigned,
+                            final          int    dstSignedOffset,
+                            final          int    dstSignedLength,
+                            final @NotNull byte[] srcMsg,
+                            final          int    srcMsgOffset,
+                            final          int    srcMsgLength,
+                            final @NotNull byte[] priv,
+                            final          int    privOffset,
+                            final          int    privLength);
+
+    abstract int nativeOpen(final @NotNull byte[] dstMsg,
+                            final          int    dstMsgOffset,
+                            final          int    dstMsgLength,
+                            final @NotNull byte[] srcSigned,
+                            final          int    srcSignedOffset,
+                            final          int    srcSignedLength,
+                            final @NotNull byte[] pub,
+                            final          int    pubOffset,
+                            final          int    pubLength);
+
+    abstract int nativeSignDetached(final @NotNull byte[] dstSig,
+                                    final          int    dstSigOffset,
+                                    final          int    dstSigLength,
+                                    final @NotNull byte[] srcMsg,
+                                    final          int    srcMsgOffset,
+                                    final          int    srcMsgLength,
+                                    final @NotNull byte[] priv,
+                                    final          int    privOffset,
+                                    final          int    privLength);
+
+    abstract int nativeVerifyDetached(final @NotNull byte[] srcSig,
+                                      final          int    srcSigOffset,
+                                      final          int    srcSigLength,
+                                      final @NotNull byte[] srcMsg,
+                                      final          int    srcMsgOffset,
+                                      final          int    srcMsgLength,
+                                      final @NotNull byte[] pub,
+                                      final          int    pubOffset,
+                                      final          int    pubLength);
+
+    //
+    // batch operations
+    //
+
+    /**
+     * verifyBatch verifies a batch of detached signatures in a single call to
+     * the native code, avoiding the JNI transition for every signature.
+     * <p>
+     * Signature i is the i-th block of {@link #bytes()} bytes in sigs, and is
+     * checked against the i-th block of {@link #publicKeyBytes()} bytes in
+     * pubs. Its message is read from msgs at msgOffsets[i] (relative to the
+     * buffer's position) for msgLengths[i] bytes. The length of valid
+     * determines the number of signatures, and receives the outcome of every
+     * verification.
+     *
+     * @param sigs
+     * @param msgs
+     * @param msgOffsets
+     * @param msgLengths
+     * @param pubs
+     * @param valid
+     * @return true iff all signatures in the batch are valid
+     * @throws StodiumException
+     */
+    public final boolean verifyBatch(final @NotNull ByteBuffer sigs,
+                                     final @NotNull ByteBuffer msgs,
+                                     final @NotNull int[]      msgOffsets,
+                                     final @NotNull int[]      msgLengths,
+                                     final @NotNull ByteBuffer pubs,
+                                     final @NotNull boolean[]  valid)
+            throws StodiumException {
+        final long count = valid.length;
+
+        Stodium.checkSize(msgOffsets.length, count, count);
+        Stodium.checkSize(msgLengths.length, count, count);
+        Stodium.checkSize(sigs.remaining(), count * BYTES, Integer.MAX_VALUE);
+        Stodium.checkSize(pubs.remaining(), count * PUBLICKEYBYTES, Integer.MAX_VALUE);
+        for (int i = 0; i < count; i++) {
+            Stodium.checkOffsetParams(msgs.remaining(), msgOffsets[i], msgLengths[i]);
+        }
+
+        return 0 == nativeVerifyBatch(
+                Stodium.ensureUsableByteBuffer(sigs),
+                Stodium.ensureUsableByteBuffer(msgs), msgOffsets, msgLengths,
+                Stodium.ensureUsableByteBuffer(pubs),
+                valid);
+    }
+
+    //
+    // batch bindings, implemented by the primitives
+    //
+
+    abstract int nativeVerifyBatch(final @NotNull ByteBuffer sigs,
+                                   final @NotNull ByteBuffer msgs,
+                                   final @NotNull int[]      msgOffsets,
+                                   final @NotNull int[]      msgLengths,
+                                   final @NotNull ByteBuffer pubs,
+                                   final @NotNull boolean[]  valid);
 }
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.stream;
+
+import org.jetbrains.annotations.NotNull;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.StodiumJNI;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+final class Chacha20Ietf
+        extends Stream {
+
+    Chacha20Ietf() {
+        super(StodiumJNI.crypto_stream_chacha20_ietf_keybytes(),
+                StodiumJNI.crypto_stream_chacha20_ietf_noncebytes(),
+                1L << 32); // 32 bit block counter
+    }
+
+    @Override
+    int nativeStream(final @NotNull ByteBuffer dst,
+                     final @NotNull ByteBuffer nonce,
+                     final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_stream_chacha20_ietf(dst, nonce, key);
+    }
+
+    @Override
+    int nativeXor(final @NotNull ByteBuffer dst,
+                  final @NotNull ByteBuffer src,
+                  final @NotNull ByteBuffer nonce,
+                  final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_stream_chacha20_ietf_xor(dst, src, nonce, key);
+    }
+
+    @Override
+    int nativeXorIc(final @NotNull ByteBuffer dst,
+                    final @NotNull ByteBuffer src,
+                    final @NotNull ByteBuffer nonce,
+                    final          long       ic,
+                    final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_stream_chacha20_ietf_xor_ic(dst, src, nonce, ic, key);
+    }
+
+    @Override
+    int nativeXorAt(final @NotNull ByteBuffer dst,
+                    final @NotNull ByteBuffer src,
+                    final @NotNull ByteBuffer nonce,
+                    final          long       offset,
+                    final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_stream_chacha20_ietf_xor_at(dst, src, nonce, offset, key);
+    }
+}
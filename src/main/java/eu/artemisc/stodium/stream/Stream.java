@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.stream;
+
+import org.jetbrains.annotations.NotNull;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Singleton;
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * Stream exposes the raw Salsa20 and ChaCha20 based stream ciphers. The
+ * output is not authenticated, so a stream cipher should only be used as a
+ * building block, for example to decrypt an arbitrary byte range of a large
+ * blob that is authenticated separately.
+ * <p>
+ * The keystream is divided in blocks of {@link #blockBytes()} bytes.
+ * {@link #xorIc(ByteBuffer, ByteBuffer, ByteBuffer, long, ByteBuffer)} starts
+ * at a given block, while
+ * {@link #xorAt(ByteBuffer, ByteBuffer, ByteBuffer, long, ByteBuffer)} starts
+ * at any byte offset into the stream, which allows a window of the stream to
+ * be decrypted without processing the data in front of it.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public abstract class Stream {
+
+    private static final @NotNull Singleton<Stream> XCHACHA = new Singleton<Stream>() {
+        @NotNull
+        @Override
+        protected Stream initialize() {
+            return new XChacha20();
+        }
+    };
+
+    private static final @NotNull Singleton<Stream> CHACHA_IETF = new Singleton<Stream>() {
+        @NotNull
+        @Override
+        protected Stream initialize() {
+            return new Chacha20Ietf();
+        }
+    };
+
+    private static final @NotNull Singleton<Stream> XSALSA = new Singleton<Stream>() {
+        @NotNull
+        @Override
+        protected Stream initialize() {
+            return new XSalsa20();
+        }
+    };
+
+    @NotNull
+    public static Stream instance() {
+        return xchacha20Instance();
+    }
+
+    @NotNull
+    public static Stream xchacha20Instance() {
+        return XCHACHA.get();
+    }
+
+    @NotNull
+    public static Stream chacha20IetfInstance() {
+        return CHACHA_IETF.get();
+    }
+
+    @NotNull
+    public static Stream xsalsa20Instance() {
+        return XSALSA.get();
+    }
+
+    /**
+     * BLOCKBYTES is the size of a single keystream block, shared by all
+     * Salsa20 and ChaCha20 based ciphers.
+     */
+    static final int BLOCKBYTES = 64;
+
+    // constants
+    final int  KEYBYTES;
+    final int  NONCEBYTES;
+    final long BLOCKS_MAX;
+
+    /**
+     *
+     * @param key
+     * @param nonce
+     * @param blocks the number of keystream blocks that can be addressed
+     *               through the block counter
+     */
+    Stream(final int  key,
+           final int  nonce,
+           final long blocks) {
+        this.KEYBYTES   = key;
+        this.NONCEBYTES = nonce;
+        this.BLOCKS_MAX = blocks;
+    }
+
+    /**
+     *
+     * @return
+     */
+    public final int keyBytes() {
+        return KEYBYTES;
+    }
+
+    /**
+     *
+     * @return
+     */
+    public final int nonceBytes() {
+        return NONCEBYTES;
+    }
+
+    /**
+     *
+     * @return the number of bytes in a single keystream block
+     */
+    public final int blockBytes() {
+        return BLOCKBYTES;
+    }
+
+    /**
+     * stream fills dst with keystream, starting at block 0.
+     *
+     * @param dst
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public final void stream(final @NotNull ByteBuffer dst,
+                             final @NotNull ByteBuffer nonce,
+                             final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dst);
+
+        Stodium.checkSizeMin(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+        checkBlocks(0L, dst.remaining());
+
+        Stodium.checkStatus(nativeStream(
+                Stodium.ensureUsableByteBuffer(dst),
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * xor encrypts (or decrypts) src by xoring it with the keystream starting
+     * at block 0, writing src.remaining() bytes to dst.
+     *
+     * @param dst
+     * @param src
+     * @param nonce
+     * @param key
+     * @throws StodiumException
+     */
+    public final void xor(final @NotNull ByteBuffer dst,
+                          final @NotNull ByteBuffer src,
+                          final @NotNull ByteBuffer nonce,
+                          final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dst);
+
+        Stodium.checkSizeMin(dst.remaining(), src.remaining());
+        Stodium.checkSizeMin(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+        checkBlocks(0L, src.remaining());
+
+        Stodium.checkStatus(nativeXor(
+                Stodium.ensureUsableByteBuffer(dst),
+                Stodium.ensureUsableByteBuffer(src),
+                Stodium.ensureUsableByteBuffer(nonce),
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * xorIc is the same as xor, except the keystream starts at block ic
+     * instead of block 0. The data at byte offset ic * {@link #blockBytes()}
+     * of a stream can therefore be decrypted on its own.
+     *
+     * @param dst
+     * @param src
+     * @param nonce
+     * @param ic the initial block counter
+     * @param key
+     * @throws StodiumException
+     */
+    public final void xorIc(final @NotNull ByteBuffer dst,
+                            final @NotNull ByteBuffer src,
+                            final @NotNull ByteBuffer nonce,
+                            final          long       ic,
+                            final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dst);
+
+        Stodium.checkSizeMin(dst.remaining(), src.remaining());
+        Stodium.checkSizeMin(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+        checkBlocks(ic, src.remaining());
+
+        Stodium.checkStatus(nativeXorIc(
+                Stodium.ensureUsableByteBuffer(dst),
+                Stodium.ensureUsableByteBuffer(src),
+                Stodium.ensureUsableByteBuffer(nonce),
+                ic,
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * xorAt is the same as xor, except the keystream starts at the given byte
+     * offset into the stream, which does not have to be aligned to a block.
+     * This serves byte range requests on an encrypted blob: only the
+     * requested window is decrypted.
+     *
+     * @param dst
+     * @param src
+     * @param nonce
+     * @param offset the byte offset of src within the stream
+     * @param key
+     * @throws StodiumException
+     */
+    public final void xorAt(final @NotNull ByteBuffer dst,
+                            final @NotNull ByteBuffer src,
+                            final @NotNull ByteBuffer nonce,
+                            final          long       offset,
+                            final @NotNull ByteBuffer key)
+            throws StodiumException {
+        Stodium.checkDestinationWritable(dst);
+
+        Stodium.checkSizeMin(dst.remaining(), src.remaining());
+        Stodium.checkSizeMin(nonce.remaining(), NONCEBYTES);
+        Stodium.checkSize(key.remaining(), KEYBYTES);
+        Stodium.checkSize(offset, 0L, Long.MAX_VALUE);
+        checkBlocks(offset / BLOCKBYTES, (int) (offset % BLOCKBYTES) + src.remaining());
+
+        Stodium.checkStatus(nativeXorAt(
+                Stodium.ensureUsableByteBuffer(dst),
+                Stodium.ensureUsableByteBuffer(src),
+                Stodium.ensureUsableByteBuffer(nonce),
+                offset,
+                Stodium.ensureUsableByteBuffer(key)));
+    }
+
+    /**
+     * checkBlocks verifies that length bytes of keystream starting at block ic
+     * can be produced without the block counter wrapping around.
+     */
+    private void checkBlocks(final long ic,
+                             final int  length)
+            throws StodiumException {
+        final long blocks = (length + (long) BLOCKBYTES - 1) / BLOCKBYTES;
+
+        Stodium.checkSize(ic, 0L, BLOCKS_MAX);
+        Stodium.checkSize(blocks, 0L, BLOCKS_MAX - ic);
+    }
+
+    //
+    // bindings, implemented by the primitives
+    //
+
+    abstract int nativeStream(final @NotNull ByteBuffer dst,
+                              final @NotNull ByteBuffer nonce,
+                              final @NotNull ByteBuffer key);
+
+    abstract int nativeXor(final @NotNull ByteBuffer dst,
+                           final @NotNull ByteBuffer src,
+                           final @NotNull ByteBuffer nonce,
+                           final @NotNull ByteBuffer key);
+
+    abstract int nativeXorIc(final @NotNull ByteBuffer dst,
+                             final @NotNull ByteBuffer src,
+                             final @NotNull ByteBuffer nonce,
+                             final          long       ic,
+                             final @NotNull ByteBuffer key);
+
+    abstract int nativeXorAt(final @NotNull ByteBuffer dst,
+                             final @NotNull ByteBuffer src,
+                             final @NotNull ByteBuffer nonce,
+                             final          long       offset,
+                             final @NotNull ByteBuffer key);
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2017 Project ArteMisc
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+package eu.artemisc.stodium.stream;
+
+import org.jetbrains.annotations.NotNull;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.StodiumJNI;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+final class XSalsa20
+        extends Stream {
+
+    XSalsa20() {
+        super(StodiumJNI.crypto_stream_xsalsa20_keybytes(),
+                StodiumJNI.crypto_stream_xsalsa20_noncebytes(),
+                Long.MAX_VALUE);
+    }
+
+    @Override
+    int nativeStream(final @NotNull ByteBuffer dst,
+                     final @NotNull ByteBuffer nonce,
+                     final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_stream_xsalsa20(dst, nonce, key);
+    }
+
+    @Override
+    int nativeXor(final @NotNull ByteBuffer dst,
+                  final @NotNull ByteBuffer src,
+                  final @NotNull ByteBuffer nonce,
+                  final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_stream_xsalsa20_xor(dst, src, nonce, key);
+    }
+
+    @Override
+    int nativeXorIc(final @NotNull ByteBuffer dst,
+                    final @NotNull ByteBuffer src,
+                    final @NotNull ByteBuffer nonce,
+                    final          long       ic,
+                    final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_stream_xsalsa20_xor_ic(dst, src, nonce, ic, key);
+    }
+
+    @Override
+    int nativeXorAt(final @NotNull ByteBuffer dst,
+                    final @NotNull ByteBuffer src,
+                    final @NotNull ByteBuffer nonce,
+                    final          long       offset,
+                    final @NotNull ByteBuffer key) {
+        return StodiumJNI.crypto_stream_xsalsa20_xor_at(dst, src, nonce, offset, key);
+    }
+}
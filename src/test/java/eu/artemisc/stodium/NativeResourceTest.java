@@ -0,0 +1,59 @@
+package eu.artemisc.stodium;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class NativeResourceTest {
+
+    private static final class Resource
+            extends NativeResource {
+        int freed;
+
+        Resource() {
+            super(42L);
+        }
+
+        @Override
+        protected void free(final long pointer) {
+            Assert.assertEquals(42L, pointer);
+            freed++;
+        }
+    }
+
+    @Test
+    public void closeIsDeferredUntilCallReturns() {
+        final Resource resource = new Resource();
+
+        final int result = resource.call(new NativeResource.Call() {
+            @Override
+            public int run(final long pointer) {
+                Assert.assertEquals(42L, pointer);
+                resource.close();
+                Assert.assertTrue(resource.isClosed());
+                Assert.assertEquals(0, resource.freed);
+                return 7;
+            }
+        });
+
+        Assert.assertEquals(7, result);
+        Assert.assertEquals(1, resource.freed);
+
+        resource.close();
+        Assert.assertEquals(1, resource.freed);
+    }
+
+    @Test(expected = IllegalStateException.class)
+    public void callAfterCloseFails() {
+        final Resource resource = new Resource();
+        resource.close();
+        resource.call(new NativeResource.Call() {
+            @Override
+            public int run(final long pointer) {
+                return 0;
+            }
+        });
+    }
+}
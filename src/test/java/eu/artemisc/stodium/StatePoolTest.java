@@ -0,0 +1,65 @@
+package eu.artemisc.stodium;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class StatePoolTest {
+
+    // a size no primitive uses, so other tests do not share the pool
+    private static final int SIZE = 123;
+
+    private static final Multipart.Spec SPEC = new Multipart.Spec() {
+        @Override
+        public void update(final ByteBuffer state,
+                           final ByteBuffer in) {
+        }
+
+        @Override
+        public void update(final ByteBuffer   state,
+                           final ByteBuffer[] in,
+                           final int          offset,
+                           final int          length) {
+        }
+
+        @Override
+        public void doFinal(final ByteBuffer state,
+                            final ByteBuffer dst) {
+        }
+
+        @Override
+        public void update(final ByteBuffer state,
+                           final byte[]     in,
+                           final int        offset,
+                           final int        length) {
+        }
+
+        @Override
+        public void doFinal(final ByteBuffer state,
+                            final byte[]     dst,
+                            final int        offset,
+                            final int        length) {
+        }
+    };
+
+    @Test
+    public void userStateIsNotPooled() {
+        final ByteBuffer state = TestBuffers.fill(SIZE, 1);
+
+        new Multipart<Void>(SPEC, state).release();
+        Assert.assertTrue(Stodium.isEqual(ByteBuffer.allocate(SIZE), state));
+        Assert.assertNotSame(state, StatePool.acquire(SIZE));
+    }
+
+    @Test
+    public void pooledStateIsReused() {
+        final ByteBuffer state = StatePool.acquire(SIZE);
+
+        new Multipart<Void>(SPEC, state, true).release();
+        Assert.assertSame(state, StatePool.acquire(SIZE));
+    }
+}
@@ -0,0 +1,71 @@
+package eu.artemisc.stodium;
+
+import java.lang.reflect.Field;
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.util.Arrays;
+
+/**
+ * TestBuffers holds the buffer helpers shared by the tests.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public final class TestBuffers {
+
+    // block the constructor
+    private TestBuffers() {}
+
+    /**
+     * fill returns a direct buffer of length bytes, where byte i holds
+     * i * step.
+     */
+    public static ByteBuffer fill(final int length,
+                                  final int step) {
+        final ByteBuffer buff = ByteBuffer.allocateDirect(length);
+        for (int i = 0; i < length; i++) {
+            buff.put(i, (byte) (i * step));
+        }
+        return buff;
+    }
+
+    /**
+     * window returns a slice of length bytes of buff, starting at the
+     * absolute index offset.
+     */
+    public static ByteBuffer window(final ByteBuffer buff,
+                                    final int        offset,
+                                    final int        length) {
+        final ByteBuffer dup = buff.duplicate();
+        dup.position(offset).limit(offset + length);
+        return dup.slice();
+    }
+
+    /**
+     * pad returns a byte[] holding the remaining bytes of buff, surrounded by
+     * offset leading and trailing trailing bytes of 0x5a.
+     */
+    public static byte[] pad(final ByteBuffer buff,
+                             final int        offset,
+                             final int        trailing) {
+        final byte[] arr = new byte[offset + buff.remaining() + trailing];
+        Arrays.fill(arr, (byte) 0x5a);
+        buff.duplicate().get(arr, offset, buff.remaining());
+        return arr;
+    }
+
+    /**
+     * address returns the native address of the first byte of the direct
+     * buffer buff, for the tests of the raw address overloads.
+     */
+    public static long address(final ByteBuffer buff) {
+        try {
+            final Field field = Buffer.class.getDeclaredField("address");
+            field.setAccessible(true);
+            return field.getLong(buff);
+        } catch (final NoSuchFieldException e) {
+            throw new AssertionError(e);
+        } catch (final IllegalAccessException e) {
+            throw new AssertionError(e);
+        }
+    }
+}
@@ -0,0 +1,91 @@
+package eu.artemisc.stodium.aead;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.StodiumJNI;
+import eu.artemisc.stodium.TestBuffers;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class AEADBatchTest {
+
+    private static final int[] LENGTHS = new int[] { 0, 64, 200 };
+
+    @Test
+    public void batchMatchesSingleCalls()
+            throws StodiumException {
+        final AEAD aead = AEAD.xchachaIetfInstance();
+        final int  count = LENGTHS.length;
+
+        final int[] srcOffsets = new int[count];
+        final int[] dstOffsets = new int[count];
+        final int[] status     = new int[count];
+
+        int srcTotal = 0, dstTotal = 0;
+        for (int i = 0; i < count; i++) {
+            srcOffsets[i] = srcTotal;
+            dstOffsets[i] = dstTotal;
+            srcTotal += LENGTHS[i];
+            dstTotal += LENGTHS[i] + aead.aBytes();
+        }
+
+        final ByteBuffer key    = ByteBuffer.allocateDirect(aead.keyBytes());
+        final ByteBuffer nonces = ByteBuffer.allocateDirect(count * aead.npubBytes());
+        final ByteBuffer plain  = ByteBuffer.allocateDirect(srcTotal);
+        final ByteBuffer cipher = ByteBuffer.allocateDirect(dstTotal);
+        final ByteBuffer opened = ByteBuffer.allocateDirect(srcTotal);
+        for (int i = 0; i < key.capacity(); i++) {
+            key.put(i, (byte) i);
+        }
+        for (int i = 0; i < nonces.capacity(); i++) {
+            nonces.put(i, (byte) (i * 7));
+        }
+        for (int i = 0; i < plain.capacity(); i++) {
+            plain.put(i, (byte) (i * 13));
+        }
+
+        Assert.assertEquals(0, aead.encryptBatch(cipher, dstOffsets,
+                plain, srcOffsets, LENGTHS,
+                null, null, null,
+                nonces, key, status));
+
+        final ByteBuffer ad = ByteBuffer.allocateDirect(0);
+        for (int i = 0; i < count; i++) {
+            Assert.assertEquals(StodiumJNI.NOERR, status[i]);
+
+            final ByteBuffer single = ByteBuffer.allocateDirect(LENGTHS[i] + aead.aBytes());
+            aead.encrypt(single,
+                    TestBuffers.window(plain, srcOffsets[i], LENGTHS[i]),
+                    ad,
+                    TestBuffers.window(nonces, i * aead.npubBytes(), aead.npubBytes()),
+                    key);
+            Assert.assertTrue(Stodium.isEqual(single,
+                    TestBuffers.window(cipher, dstOffsets[i], LENGTHS[i] + aead.aBytes())));
+        }
+
+        // Corrupt the second message only
+        cipher.put(dstOffsets[1], (byte) (cipher.get(dstOffsets[1]) ^ 0x01));
+
+        final int[] cipherLengths = new int[count];
+        for (int i = 0; i < count; i++) {
+            cipherLengths[i] = LENGTHS[i] + aead.aBytes();
+        }
+
+        Assert.assertEquals(1, aead.decryptBatch(opened, srcOffsets,
+                cipher, dstOffsets, cipherLengths,
+                null, null, null,
+                nonces, key, status));
+        Assert.assertEquals(StodiumJNI.NOERR, status[0]);
+        Assert.assertNotEquals(StodiumJNI.NOERR, status[1]);
+        Assert.assertEquals(StodiumJNI.NOERR, status[2]);
+        Assert.assertTrue(Stodium.isEqual(
+                TestBuffers.window(plain, srcOffsets[2], LENGTHS[2]),
+                TestBuffers.window(opened, srcOffsets[2], LENGTHS[2])));
+    }
+}
@@ -2,11 +2,13 @@ package eu.artemisc.stodium.aead;
 
 import org.jetbrains.annotations.NotNull;
 import org.junit.Assert;
+import org.junit.Assume;
 import org.junit.Test;
 
 import java.nio.ByteBuffer;
 
 import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.TestBuffers;
 import eu.artemisc.stodium.codecs.Codec;
 import eu.artemisc.stodium.exceptions.StodiumException;
 
@@ -148,6 +150,48 @@ public class Aes256GcmTest {
         }
     }
 
+    @Test
+    public void precomputedMatchesRawKey()
+            throws StodiumException {
+        Assume.assumeTrue(Aes256Gcm.isAvailable());
+
+        final AEAD       aead  = AEAD.aesInstance();
+        final ByteBuffer key   = TestBuffers.fill(aead.keyBytes(), 3);
+        final ByteBuffer nonce = TestBuffers.fill(aead.npubBytes(), 5);
+        final ByteBuffer ad    = TestBuffers.fill(40, 11);
+        final ByteBuffer msg   = TestBuffers.fill(300, 13);
+
+        final ByteBuffer raw         = ByteBuffer.allocateDirect(msg.capacity() + aead.aBytes());
+        final ByteBuffer precomputed = ByteBuffer.allocateDirect(msg.capacity() + aead.aBytes());
+        final ByteBuffer cipher      = ByteBuffer.allocateDirect(msg.capacity());
+        final ByteBuffer mac         = ByteBuffer.allocateDirect(aead.aBytes());
+        final ByteBuffer plain       = ByteBuffer.allocateDirect(msg.capacity());
+
+        final PrecomputedKey state = aead.precompute(key);
+        try {
+            aead.encrypt(raw, msg, ad, nonce, key);
+            aead.encrypt(precomputed, msg, ad, nonce, state);
+            Assert.assertTrue(Stodium.isEqual(raw, precomputed));
+
+            aead.encryptDetached(cipher, mac, msg, ad, nonce, state);
+            Assert.assertTrue(Stodium.isEqual(TestBuffers.window(raw, 0, msg.capacity()), cipher));
+            Assert.assertTrue(Stodium.isEqual(TestBuffers.window(raw, msg.capacity(), aead.aBytes()), mac));
+
+            Assert.assertTrue(aead.decrypt(plain, raw, ad, nonce, state));
+            Assert.assertTrue(Stodium.isEqual(msg, plain));
+
+            Stodium.wipeBytes(plain.duplicate());
+            Assert.assertTrue(aead.decryptDetached(plain, cipher, mac, ad, nonce, state));
+            Assert.assertTrue(Stodium.isEqual(msg, plain));
+
+            // A tampered cipher text is rejected under the precomputed key
+            raw.put(0, (byte) (raw.get(0) ^ 0x01));
+            Assert.assertFalse(aead.decrypt(plain, raw, ad, nonce, state));
+        } finally {
+            state.close();
+        }
+    }
+
     @NotNull
     private static String keyHex(final int i) {
         return tests[i][0];
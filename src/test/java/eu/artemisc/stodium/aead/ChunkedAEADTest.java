@@ -0,0 +1,59 @@
+package eu.artemisc.stodium.aead;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.TestBuffers;
+import eu.artemisc.stodium.ThreadPool;
+import eu.artemisc.stodium.exceptions.OperationFailedException;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class ChunkedAEADTest {
+
+    private static final int CHUNK = 1000;
+
+    @Test
+    public void sealOpenAndRandomAccess()
+            throws StodiumException {
+        final ChunkedAEAD aead   = ChunkedAEAD.xchachaIetfInstance();
+        final ByteBuffer  key    = ByteBuffer.allocateDirect(aead.keyBytes());
+        final ByteBuffer  plain  = ByteBuffer.allocateDirect(10 * CHUNK + 123);
+        final ByteBuffer  sealed = ByteBuffer.allocateDirect(
+                (int) aead.sealedLength(CHUNK, plain.capacity()));
+        for (int i = 0; i < plain.capacity(); i++) {
+            plain.put(i, (byte) (i * 13));
+        }
+
+        ThreadPool.setThreads(3);
+        try {
+            aead.seal(sealed, plain, CHUNK, key);
+
+            final ByteBuffer opened = ByteBuffer.allocateDirect(plain.capacity());
+            aead.open(opened, sealed, key);
+            Assert.assertTrue(Stodium.isEqual(plain, opened));
+
+            // Open the short last chunk on its own
+            final ByteBuffer header = TestBuffers.window(sealed, 0, aead.headerBytes());
+            final int        offset = aead.headerBytes() + 10 * (CHUNK + aead.aBytes());
+            final ByteBuffer last   = ByteBuffer.allocateDirect(123);
+            aead.openChunks(last, TestBuffers.window(sealed, offset, sealed.capacity() - offset), header, 10L, key);
+            Assert.assertTrue(Stodium.isEqual(TestBuffers.window(plain, 10 * CHUNK, 123), last));
+
+            // A chunk opened under the wrong index must fail
+            try {
+                aead.openChunks(opened, TestBuffers.window(sealed, aead.headerBytes(), CHUNK + aead.aBytes()),
+                        header, 1L, key);
+                Assert.fail();
+            } catch (final OperationFailedException ignored) {
+            }
+        } finally {
+            ThreadPool.setThreads(0);
+        }
+    }
+}
@@ -0,0 +1,94 @@
+package eu.artemisc.stodium.aead;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.TestBuffers;
+import eu.artemisc.stodium.exceptions.StodiumException;
+import eu.artemisc.stodium.secretbox.SecretBox;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class InPlaceTest {
+
+    private static final int LENGTH = 100;
+
+    @Test
+    public void aeadInPlaceMatchesSeparateBuffers()
+            throws StodiumException {
+        final AEAD aead = AEAD.xchachaIetfInstance();
+
+        final ByteBuffer key   = TestBuffers.fill(aead.keyBytes(), 1);
+        final ByteBuffer nonce = TestBuffers.fill(aead.npubBytes(), 3);
+        final ByteBuffer ad    = TestBuffers.fill(13, 5);
+        final ByteBuffer plain = TestBuffers.fill(LENGTH, 7);
+
+        final ByteBuffer cipher = ByteBuffer.allocateDirect(LENGTH + aead.aBytes());
+        aead.encrypt(cipher, plain, ad, nonce, key);
+
+        // heap buffer with a window, to cover the copying path as well
+        final ByteBuffer buf = TestBuffers.window(ByteBuffer.allocate(LENGTH + aead.aBytes() + 8), 4,
+                LENGTH + aead.aBytes());
+        buf.duplicate().put(plain.duplicate());
+        aead.encryptInPlace(buf, LENGTH, ad, nonce, key);
+        Assert.assertTrue(Stodium.isEqual(cipher, buf));
+
+        Assert.assertTrue(aead.decryptInPlace(buf, ad, nonce, key));
+        Assert.assertTrue(Stodium.isEqual(plain, TestBuffers.window(buf, 0, LENGTH)));
+
+        // a failed decryption wipes the cipher text
+        buf.duplicate().put(cipher.duplicate());
+        buf.put(0, (byte) (buf.get(0) ^ 0x01));
+        Assert.assertFalse(aead.decryptInPlace(buf, ad, nonce, key));
+        Assert.assertTrue(Stodium.isEqual(ByteBuffer.allocate(LENGTH), TestBuffers.window(buf, 0, LENGTH)));
+    }
+
+    @Test
+    public void aeadDetachedInPlaceRoundTrips()
+            throws StodiumException {
+        final AEAD aead = AEAD.chachaIetfInstance();
+
+        final ByteBuffer key   = TestBuffers.fill(aead.keyBytes(), 1);
+        final ByteBuffer nonce = TestBuffers.fill(aead.npubBytes(), 3);
+        final ByteBuffer ad    = TestBuffers.fill(13, 5);
+        final ByteBuffer plain = TestBuffers.fill(LENGTH, 7);
+
+        final ByteBuffer cipher = ByteBuffer.allocateDirect(LENGTH);
+        final ByteBuffer mac    = ByteBuffer.allocateDirect(aead.aBytes());
+        aead.encryptDetached(cipher, mac, plain, ad, nonce, key);
+
+        final ByteBuffer buf    = TestBuffers.fill(LENGTH, 7);
+        final ByteBuffer bufMac = ByteBuffer.allocateDirect(aead.aBytes());
+        aead.encryptDetachedInPlace(buf, bufMac, ad, nonce, key);
+        Assert.assertTrue(Stodium.isEqual(cipher, buf));
+        Assert.assertTrue(Stodium.isEqual(mac, bufMac));
+
+        Assert.assertTrue(aead.decryptDetachedInPlace(buf, bufMac, ad, nonce, key));
+        Assert.assertTrue(Stodium.isEqual(plain, buf));
+    }
+
+    @Test
+    public void secretBoxInPlaceMatchesSeparateBuffers()
+            throws StodiumException {
+        final SecretBox box = SecretBox.instance();
+
+        final ByteBuffer key   = TestBuffers.fill(box.keyBytes(), 1);
+        final ByteBuffer nonce = TestBuffers.fill(box.nonceBytes(), 3);
+        final ByteBuffer plain = TestBuffers.fill(LENGTH, 7);
+
+        final ByteBuffer cipher = ByteBuffer.allocateDirect(LENGTH + box.macBytes());
+        box.easy(cipher, plain, nonce, key);
+
+        final ByteBuffer buf = ByteBuffer.allocateDirect(LENGTH + box.macBytes());
+        buf.duplicate().put(plain.duplicate());
+        box.easyInPlace(buf, LENGTH, nonce, key);
+        Assert.assertTrue(Stodium.isEqual(cipher, buf));
+
+        Assert.assertTrue(box.easyOpenInPlace(buf, nonce, key));
+        Assert.assertTrue(Stodium.isEqual(plain, TestBuffers.window(buf, 0, LENGTH)));
+    }
+}
@@ -0,0 +1,179 @@
+package eu.artemisc.stodium.aead;
+
+import org.junit.Assert;
+import org.junit.Before;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.TestBuffers;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * MarshallingTest runs the same encryption through every way of passing
+ * memory to the native code, and checks each against the plain direct buffer
+ * result.
+ *
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class MarshallingTest {
+
+    private static final int MSG_LEN = 300;
+    private static final int AD_LEN  = 40;
+    private static final int OFFSET  = 7;
+    private static final int PADDING = 5;
+
+    private AEAD       aead;
+    private ByteBuffer key;
+    private ByteBuffer nonce;
+    private ByteBuffer ad;
+    private ByteBuffer msg;
+    private ByteBuffer expected;
+
+    @Before
+    public void setUp()
+            throws StodiumException {
+        aead  = AEAD.xchachaIetfInstance();
+        key   = TestBuffers.fill(aead.keyBytes(), 3);
+        nonce = TestBuffers.fill(aead.npubBytes(), 5);
+        ad    = TestBuffers.fill(AD_LEN, 11);
+        msg   = TestBuffers.fill(MSG_LEN, 13);
+
+        expected = ByteBuffer.allocateDirect(MSG_LEN + aead.aBytes());
+        aead.encrypt(expected, msg, ad, nonce, key);
+    }
+
+    @Test
+    public void wrappedWithPosition()
+            throws StodiumException {
+        final byte[] out = new byte[OFFSET + expected.capacity() + PADDING];
+
+        aead.encrypt(wrap(out, expected.capacity()), wrap(msg), wrap(ad), wrap(nonce), wrap(key));
+        checkCipher(out);
+
+        final byte[] plain = new byte[OFFSET + MSG_LEN + PADDING];
+        Assert.assertTrue(aead.decrypt(wrap(plain, MSG_LEN), wrap(expected), wrap(ad), wrap(nonce), wrap(key)));
+        checkPlain(plain);
+    }
+
+    @Test
+    public void readOnlyHeap()
+            throws StodiumException {
+        final ByteBuffer out = ByteBuffer.allocate(expected.capacity());
+
+        aead.encrypt(out,
+                wrap(msg).asReadOnlyBuffer(),
+                wrap(ad).asReadOnlyBuffer(),
+                wrap(nonce).asReadOnlyBuffer(),
+                wrap(key).asReadOnlyBuffer());
+        Assert.assertTrue(Stodium.isEqual(expected, out));
+    }
+
+    @Test
+    public void slicedDirect()
+            throws StodiumException {
+        final ByteBuffer arena = ByteBuffer.allocateDirect(
+                2 * expected.capacity() + AD_LEN + aead.npubBytes() + aead.keyBytes() + 5 * PADDING);
+
+        int at = PADDING;
+        final ByteBuffer out = TestBuffers.window(arena, at, expected.capacity());
+        at += expected.capacity() + PADDING;
+        final ByteBuffer src = TestBuffers.window(arena, at, MSG_LEN);
+        at += MSG_LEN + PADDING;
+        final ByteBuffer adSlice = TestBuffers.window(arena, at, AD_LEN);
+        at += AD_LEN + PADDING;
+        final ByteBuffer nonceSlice = TestBuffers.window(arena, at, aead.npubBytes());
+        at += aead.npubBytes() + PADDING;
+        final ByteBuffer keySlice = TestBuffers.window(arena, at, aead.keyBytes());
+
+        src.duplicate().put(msg.duplicate());
+        adSlice.duplicate().put(ad.duplicate());
+        nonceSlice.duplicate().put(nonce.duplicate());
+        keySlice.duplicate().put(key.duplicate());
+
+        aead.encrypt(out, src, adSlice, nonceSlice, keySlice);
+        Assert.assertTrue(Stodium.isEqual(expected, out));
+    }
+
+    @Test
+    public void arrays()
+            throws StodiumException {
+        final byte[] out = new byte[OFFSET + expected.capacity() + PADDING];
+
+        aead.encrypt(out, OFFSET,
+                TestBuffers.pad(msg, OFFSET, PADDING), OFFSET, MSG_LEN,
+                TestBuffers.pad(ad, OFFSET, PADDING), OFFSET, AD_LEN,
+                TestBuffers.pad(nonce, OFFSET, PADDING), OFFSET,
+                TestBuffers.pad(key, OFFSET, PADDING), OFFSET);
+        checkCipher(out);
+
+        final byte[] plain = new byte[OFFSET + MSG_LEN + PADDING];
+        Assert.assertTrue(aead.decrypt(plain, OFFSET,
+                TestBuffers.pad(expected, OFFSET, PADDING), OFFSET, expected.capacity(),
+                TestBuffers.pad(ad, OFFSET, PADDING), OFFSET, AD_LEN,
+                TestBuffers.pad(nonce, OFFSET, PADDING), OFFSET,
+                TestBuffers.pad(key, OFFSET, PADDING), OFFSET));
+        checkPlain(plain);
+    }
+
+    @Test
+    public void addresses()
+            throws StodiumException {
+        final ByteBuffer out   = ByteBuffer.allocateDirect(expected.capacity());
+        final ByteBuffer plain = ByteBuffer.allocateDirect(MSG_LEN);
+
+        aead.encrypt(TestBuffers.address(out), out.capacity(),
+                TestBuffers.address(msg), MSG_LEN,
+                TestBuffers.address(ad), AD_LEN,
+                TestBuffers.address(nonce),
+                TestBuffers.address(key));
+        Assert.assertTrue(Stodium.isEqual(expected, out));
+
+        Assert.assertTrue(aead.decrypt(TestBuffers.address(plain), MSG_LEN,
+                TestBuffers.address(out), out.capacity(),
+                TestBuffers.address(ad), AD_LEN,
+                TestBuffers.address(nonce),
+                TestBuffers.address(key)));
+        Assert.assertTrue(Stodium.isEqual(msg, plain));
+    }
+
+    /**
+     * wrap copies buff into a padded array, and wraps its window so that the
+     * returned buffer has a non-zero position.
+     */
+    private static ByteBuffer wrap(final ByteBuffer buff) {
+        return ByteBuffer.wrap(TestBuffers.pad(buff, OFFSET, PADDING), OFFSET, buff.remaining());
+    }
+
+    private static ByteBuffer wrap(final byte[] arr,
+                                   final int    length) {
+        return ByteBuffer.wrap(arr, OFFSET, length);
+    }
+
+    /**
+     * checkCipher checks that out holds the expected cipher text at OFFSET,
+     * and that the bytes around it were left alone.
+     */
+    private void checkCipher(final byte[] out) {
+        Assert.assertTrue(Stodium.isEqual(expected,
+                TestBuffers.window(ByteBuffer.wrap(out), OFFSET, expected.capacity())));
+        checkUntouched(out, expected.capacity());
+    }
+
+    private void checkPlain(final byte[] plain) {
+        Assert.assertTrue(Stodium.isEqual(msg,
+                TestBuffers.window(ByteBuffer.wrap(plain), OFFSET, MSG_LEN)));
+        checkUntouched(plain, MSG_LEN);
+    }
+
+    private static void checkUntouched(final byte[] arr,
+                                       final int    length) {
+        for (int i = 0; i < OFFSET; i++) {
+            Assert.assertEquals(0, arr[i]);
+        }
+        for (int i = OFFSET + length; i < arr.length; i++) {
+            Assert.assertEquals(0, arr[i]);
+        }
+    }
+}
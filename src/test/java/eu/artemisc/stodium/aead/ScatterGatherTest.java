@@ -0,0 +1,89 @@
+package eu.artemisc.stodium.aead;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.TestBuffers;
+import eu.artemisc.stodium.exceptions.StodiumException;
+import eu.artemisc.stodium.secretbox.SecretBox;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class ScatterGatherTest {
+
+    // segment boundaries deliberately differ between sources and destinations,
+    // and do not line up with the 64 byte keystream blocks
+    private static final int[] SRC_SPLIT = new int[] { 0, 5, 64, 71, 200 };
+    private static final int[] DST_SPLIT = new int[] { 0, 63, 130, 130, 200 };
+
+    @Test
+    public void aeadScatterMatchesContiguous()
+            throws StodiumException {
+        final AEAD aead = AEAD.xchachaIetfInstance();
+
+        final ByteBuffer key   = TestBuffers.fill(aead.keyBytes(), 1);
+        final ByteBuffer nonce = TestBuffers.fill(aead.npubBytes(), 3);
+        final ByteBuffer ad    = TestBuffers.fill(21, 5);
+        final ByteBuffer plain = TestBuffers.fill(200, 7);
+
+        final ByteBuffer cipher = ByteBuffer.allocateDirect(200);
+        final ByteBuffer mac    = ByteBuffer.allocateDirect(aead.aBytes());
+        aead.encryptDetached(cipher, mac, plain.duplicate(), ad.duplicate(), nonce, key);
+
+        final ByteBuffer sgCipher = ByteBuffer.allocateDirect(200);
+        final ByteBuffer sgMac    = ByteBuffer.allocateDirect(aead.aBytes());
+        aead.encryptDetached(split(sgCipher, DST_SPLIT), sgMac, split(plain, SRC_SPLIT),
+                ad.duplicate(), nonce, key);
+        Assert.assertTrue(Stodium.isEqual(cipher, sgCipher));
+        Assert.assertTrue(Stodium.isEqual(mac, sgMac));
+
+        final ByteBuffer opened = ByteBuffer.allocateDirect(200);
+        Assert.assertTrue(aead.decryptDetached(split(opened, SRC_SPLIT),
+                split(sgCipher, DST_SPLIT), sgMac, ad.duplicate(), nonce, key));
+        Assert.assertTrue(Stodium.isEqual(plain, opened));
+
+        sgMac.put(0, (byte) (sgMac.get(0) ^ 0x01));
+        Assert.assertFalse(aead.decryptDetached(split(opened, SRC_SPLIT),
+                split(sgCipher, DST_SPLIT), sgMac, ad.duplicate(), nonce, key));
+    }
+
+    @Test
+    public void secretBoxScatterMatchesContiguous()
+            throws StodiumException {
+        final SecretBox box = SecretBox.instance();
+
+        final ByteBuffer key   = TestBuffers.fill(box.keyBytes(), 1);
+        final ByteBuffer nonce = TestBuffers.fill(box.nonceBytes(), 3);
+        final ByteBuffer plain = TestBuffers.fill(200, 7);
+
+        final ByteBuffer cipher = ByteBuffer.allocateDirect(200);
+        final ByteBuffer mac    = ByteBuffer.allocateDirect(box.macBytes());
+        box.detached(cipher, mac, plain.duplicate(), nonce, key);
+
+        final ByteBuffer sgCipher = ByteBuffer.allocateDirect(200);
+        final ByteBuffer sgMac    = ByteBuffer.allocateDirect(box.macBytes());
+        box.detached(split(sgCipher, DST_SPLIT), sgMac, split(plain, SRC_SPLIT), nonce, key);
+        Assert.assertTrue(Stodium.isEqual(cipher, sgCipher));
+        Assert.assertTrue(Stodium.isEqual(mac, sgMac));
+
+        final ByteBuffer opened = ByteBuffer.allocateDirect(200);
+        Assert.assertTrue(box.detachedOpen(split(opened, SRC_SPLIT),
+                split(sgCipher, DST_SPLIT), sgMac, nonce, key));
+        Assert.assertTrue(Stodium.isEqual(plain, opened));
+    }
+
+    private static ByteBuffer[] split(final ByteBuffer buff,
+                                      final int[]      bounds) {
+        final ByteBuffer[] segments = new ByteBuffer[bounds.length - 1];
+        for (int i = 0; i < segments.length; i++) {
+            final ByteBuffer dup = buff.duplicate();
+            dup.position(bounds[i]).limit(bounds[i + 1]);
+            segments[i] = dup.slice();
+        }
+        return segments;
+    }
+}
@@ -0,0 +1,55 @@
+package eu.artemisc.stodium.auth;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class HmacTest {
+
+    @Test
+    public void precomputedKeyMatchesKey()
+            throws StodiumException {
+        final Auth[] specs = new Auth[] {
+                Auth.HmacSha256Instance(),
+                Auth.HmacSha512Instance(),
+                Auth.HmacSha512256Instance()
+        };
+
+        for (final Auth auth : specs) {
+            final ByteBuffer key = ByteBuffer.allocateDirect(auth.keyBytes());
+            final ByteBuffer src = ByteBuffer.allocateDirect(200);
+            final ByteBuffer mac = ByteBuffer.allocateDirect(auth.bytes());
+            final ByteBuffer pre = ByteBuffer.allocateDirect(auth.bytes());
+            for (int i = 0; i < key.capacity(); i++) {
+                key.put(i, (byte) (i + 1));
+            }
+            for (int i = 0; i < src.capacity(); i++) {
+                src.put(i, (byte) (i * 7));
+            }
+
+            final PrecomputedKey prepared = auth.precompute(key);
+            try {
+                auth.mac(mac, src, key);
+                auth.mac(pre, src, prepared);
+                Assert.assertTrue(Stodium.isEqual(mac, pre));
+
+                // The state is copied, so a second message starts from scratch
+                auth.mac(pre, src, prepared);
+                Assert.assertTrue(Stodium.isEqual(mac, pre));
+                Assert.assertTrue(auth.verify(mac, src, prepared));
+
+                src.put(0, (byte) 1);
+                Assert.assertFalse(auth.verify(mac, src, prepared));
+            } finally {
+                prepared.close();
+            }
+        }
+    }
+}
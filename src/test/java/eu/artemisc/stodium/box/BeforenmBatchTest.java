@@ -0,0 +1,55 @@
+package eu.artemisc.stodium.box;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class BeforenmBatchTest {
+
+    private static final int PEERS = 16;
+
+    @Test
+    public void batchMatchesSingleBeforenm()
+            throws StodiumException {
+        final Box box = Box.curve25519xsalsa20poly1305Instance();
+
+        final ByteBuffer pub  = ByteBuffer.allocateDirect(box.publicBytes());
+        final ByteBuffer priv = ByteBuffer.allocateDirect(box.secretBytes());
+        box.keypair(pub, priv);
+
+        final ByteBuffer peers = ByteBuffer.allocateDirect(PEERS * box.publicBytes());
+        for (int i = 0; i < PEERS; i++) {
+            final ByteBuffer peerPub  = ByteBuffer.allocateDirect(box.publicBytes());
+            final ByteBuffer peerPriv = ByteBuffer.allocateDirect(box.secretBytes());
+            box.keypair(peerPub, peerPriv);
+            peers.put(peerPub);
+        }
+        peers.flip();
+
+        for (final boolean parallel : new boolean[] { false, true }) {
+            final ByteBuffer keys   = ByteBuffer.allocateDirect(PEERS * box.beforenmBytes());
+            final int[]      status = new int[PEERS];
+            Assert.assertEquals(0, box.beforenmBatch(keys, peers, priv, status, parallel));
+
+            for (int i = 0; i < PEERS; i++) {
+                final ByteBuffer peer = peers.duplicate();
+                peer.position(i * box.publicBytes()).limit((i + 1) * box.publicBytes());
+
+                final ByteBuffer expected = ByteBuffer.allocateDirect(box.beforenmBytes());
+                box.beforenm(expected, peer, priv);
+
+                final ByteBuffer actual = keys.duplicate();
+                actual.position(i * box.beforenmBytes()).limit((i + 1) * box.beforenmBytes());
+                Assert.assertEquals(0, status[i]);
+                Assert.assertTrue(Stodium.isEqual(expected, actual.slice()));
+            }
+        }
+    }
+}
@@ -0,0 +1,54 @@
+package eu.artemisc.stodium.box;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class EnvelopeTest {
+
+    @Test
+    public void everyRecipientOpensEnvelope()
+            throws StodiumException {
+        final Box box = Box.curve25519xsalsa20poly1305Instance();
+
+        final ByteBuffer[] pubs  = new ByteBuffer[3];
+        final ByteBuffer[] privs = new ByteBuffer[3];
+        for (int i = 0; i < pubs.length; i++) {
+            pubs[i]  = ByteBuffer.allocateDirect(box.publicBytes());
+            privs[i] = ByteBuffer.allocateDirect(box.secretBytes());
+            box.keypair(pubs[i], privs[i]);
+        }
+
+        final ByteBuffer plain = ByteBuffer.allocateDirect(100);
+        for (int i = 0; i < plain.capacity(); i++) {
+            plain.put(i, (byte) i);
+        }
+
+        final ByteBuffer envelope = ByteBuffer.allocateDirect(Envelope.sealedLength(3, 100));
+        Envelope.seal(envelope, plain, pubs);
+        Assert.assertEquals(3, Envelope.recipients(envelope));
+
+        for (int i = 0; i < pubs.length; i++) {
+            final ByteBuffer opened = ByteBuffer.allocateDirect(100);
+            Assert.assertTrue(Envelope.open(opened, envelope, pubs[i], privs[i]));
+            Assert.assertTrue(Stodium.isEqual(plain, opened));
+        }
+
+        // a key pair that is not a recipient can not open the envelope
+        final ByteBuffer otherPub  = ByteBuffer.allocateDirect(box.publicBytes());
+        final ByteBuffer otherPriv = ByteBuffer.allocateDirect(box.secretBytes());
+        box.keypair(otherPub, otherPriv);
+        Assert.assertFalse(Envelope.open(ByteBuffer.allocateDirect(100), envelope, otherPub, otherPriv));
+
+        // neither can a recipient, once the header has been tampered with
+        envelope.put(0, (byte) (envelope.get(0) ^ 1));
+        Assert.assertFalse(Envelope.open(ByteBuffer.allocateDirect(100), envelope, pubs[0], privs[0]));
+    }
+}
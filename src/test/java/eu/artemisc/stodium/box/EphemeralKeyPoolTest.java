@@ -0,0 +1,52 @@
+package eu.artemisc.stodium.box;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class EphemeralKeyPoolTest {
+
+    @Test
+    public void pooledSealOpensWithSealOpen()
+            throws StodiumException {
+        final Box box = Box.curve25519xsalsa20poly1305Instance();
+        final EphemeralKeyPool pool = new EphemeralKeyPool(box, 2);
+
+        final ByteBuffer pub  = ByteBuffer.allocateDirect(box.publicBytes());
+        final ByteBuffer priv = ByteBuffer.allocateDirect(box.secretBytes());
+        box.keypair(pub, priv);
+
+        final ByteBuffer plain = ByteBuffer.allocateDirect(40);
+        for (int i = 0; i < plain.capacity(); i++) {
+            plain.put(i, (byte) i);
+        }
+
+        // more messages than the pool holds, so some use the inline fallback
+        final ByteBuffer first = ByteBuffer.allocateDirect(40 + box.sealBytes());
+        for (int i = 0; i < 5; i++) {
+            final ByteBuffer cipher = ByteBuffer.allocateDirect(40 + box.sealBytes());
+            box.seal(cipher, plain, pub, pool);
+
+            final ByteBuffer opened = ByteBuffer.allocateDirect(40);
+            Assert.assertTrue(box.sealOpen(opened, cipher, pub, priv));
+            Assert.assertTrue(Stodium.isEqual(plain, opened));
+
+            // every message uses a fresh ephemeral key
+            if (i == 0) {
+                first.put(cipher.duplicate()).flip();
+            } else {
+                Assert.assertFalse(Stodium.isEqual(first, cipher));
+            }
+        }
+
+        pool.close();
+        Assert.assertEquals(0, pool.available());
+    }
+}
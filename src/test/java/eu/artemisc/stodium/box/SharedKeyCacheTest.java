@@ -0,0 +1,97 @@
+package eu.artemisc.stodium.box;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class SharedKeyCacheTest {
+
+    @Test
+    public void cachedEasyMatchesInPlace()
+            throws StodiumException {
+        final Box box = Box.curve25519xchacha20poly1305Instance();
+        final SharedKeyCache cache = new SharedKeyCache(box, 2);
+
+        final ByteBuffer alicePub  = ByteBuffer.allocateDirect(box.publicBytes());
+        final ByteBuffer alicePriv = ByteBuffer.allocateDirect(box.secretBytes());
+        final ByteBuffer bobPub    = ByteBuffer.allocateDirect(box.publicBytes());
+        final ByteBuffer bobPriv   = ByteBuffer.allocateDirect(box.secretBytes());
+        box.keypair(alicePub, alicePriv);
+        box.keypair(bobPub, bobPriv);
+
+        final ByteBuffer nonce = ByteBuffer.allocateDirect(box.nonceBytes());
+        final ByteBuffer plain = ByteBuffer.allocateDirect(50);
+        for (int i = 0; i < plain.capacity(); i++) {
+            plain.put(i, (byte) i);
+        }
+
+        final ByteBuffer cipher = ByteBuffer.allocateDirect(50 + box.macBytes());
+        box.easy(cipher, plain, nonce, bobPub, alicePriv, cache);
+        box.easy(cipher, plain, nonce, bobPub, alicePriv, cache);
+        Assert.assertEquals(1, cache.size());
+
+        final ByteBuffer expected = ByteBuffer.allocateDirect(50 + box.macBytes());
+        expected.duplicate().put(plain.duplicate());
+        box.easyInPlace(expected, 50, nonce, bobPub, alicePriv);
+        Assert.assertTrue(Stodium.isEqual(expected, cipher));
+
+        final ByteBuffer opened = ByteBuffer.allocateDirect(50);
+        Assert.assertTrue(box.openEasy(opened, cipher, nonce, alicePub, bobPriv, cache));
+        Assert.assertTrue(Stodium.isEqual(plain, opened));
+        Assert.assertEquals(2, cache.size());
+
+        // a third pair evicts the least recently used key
+        box.easy(cipher, plain, nonce, alicePub, alicePriv, cache);
+        Assert.assertEquals(2, cache.size());
+
+        cache.close();
+        Assert.assertEquals(0, cache.size());
+    }
+
+    @Test
+    public void evictedKeyLivesUntilReleased()
+            throws StodiumException {
+        final Box box = Box.curve25519xsalsa20poly1305Instance();
+        final SharedKeyCache cache = new SharedKeyCache(box, 1);
+
+        final ByteBuffer pub  = ByteBuffer.allocateDirect(box.publicBytes());
+        final ByteBuffer priv = ByteBuffer.allocateDirect(box.secretBytes());
+        final ByteBuffer peer = ByteBuffer.allocateDirect(box.publicBytes());
+        box.keypair(pub, priv);
+        box.keypair(peer, ByteBuffer.allocateDirect(box.secretBytes()));
+
+        final SharedKey first = cache.acquire(box, pub, priv);
+        Assert.assertSame(first, cache.acquire(box, pub, priv));
+        first.release();
+
+        // a second pair evicts the first key, which is still in use
+        final SharedKey second = cache.acquire(box, peer, priv);
+        Assert.assertEquals(1, cache.size());
+        Assert.assertFalse(first.isClosed());
+
+        first.release();
+        Assert.assertTrue(first.isClosed());
+
+        // the evicted pair is computed again rather than reused, and evicts
+        // the second key in turn
+        final SharedKey again = cache.acquire(box, pub, priv);
+        Assert.assertNotSame(first, again);
+        Assert.assertEquals(1, cache.size());
+        Assert.assertFalse(second.isClosed());
+        second.release();
+        Assert.assertTrue(second.isClosed());
+
+        // closing the cache drops its reference to the cached key
+        again.release();
+        Assert.assertFalse(again.isClosed());
+        cache.close();
+        Assert.assertTrue(again.isClosed());
+    }
+}
@@ -1,8 +1,20 @@
 package eu.artemisc.stodium.generichash;
 
 import org.jetbrains.annotations.NotNull;
+import org.junit.Assert;
 import org.junit.Test;
 
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Multipart;
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.TestBuffers;
+import eu.artemisc.stodium.exceptions.StodiumException;
+import eu.artemisc.stodium.hash.Hash;
+
 /**
  * @author Jan van de Molengraft [jan@artemisc.eu]
  */
@@ -13,6 +25,168 @@ public class Blake2bTest {
         //Assert.assertArrayEquals();
     }
 
+    @Test
+    public void hashFileMatchesHash()
+            throws IOException, StodiumException {
+        final GenericHash blake = GenericHash.blake2bInstance();
+        final byte[]      data  = new byte[100000];
+        final File        file  = File.createTempFile("stodium", ".bin");
+        for (int i = 0; i < data.length; i++) {
+            data[i] = (byte) (i * 7);
+        }
+
+        try {
+            final FileOutputStream out = new FileOutputStream(file);
+            out.write(data);
+            out.close();
+
+            final ByteBuffer key      = ByteBuffer.allocateDirect(blake.keyBytes());
+            final ByteBuffer expected = ByteBuffer.allocateDirect(blake.bytes());
+            final ByteBuffer actual   = ByteBuffer.allocateDirect(blake.bytes());
+
+            // Whole file
+            blake.hash(expected, ByteBuffer.wrap(data));
+            blake.hashFile(actual, file.getPath(), 0L, -1L);
+            Assert.assertTrue(Stodium.isEqual(expected, actual));
+
+            // Keyed range that does not start on a page boundary
+            blake.hash(expected, ByteBuffer.wrap(data, 5000, 60000), key);
+            blake.hashFile(actual, file.getPath(), 5000L, 60000L, key);
+            Assert.assertTrue(Stodium.isEqual(expected, actual));
+        } finally {
+            Assert.assertTrue(file.delete());
+        }
+    }
+
+    @Test
+    public void hashTreeLeafUpdate()
+            throws StodiumException {
+        final GenericHash blake  = GenericHash.blake2bInstance();
+        final int         leaf   = 4096;
+        final ByteBuffer  data   = ByteBuffer.allocateDirect(10 * leaf + 100);
+        final ByteBuffer  leaves = ByteBuffer.allocateDirect(11 * blake.treeLeafBytes());
+        final ByteBuffer  root   = ByteBuffer.allocateDirect(blake.bytes());
+        final ByteBuffer  tree   = ByteBuffer.allocateDirect(blake.bytes());
+
+        blake.hashTreeLeaves(leaves, data, leaf, 0L, null);
+
+        // Change leaf 3, and only hash that leaf again
+        data.put(3 * leaf + 7, (byte) 1);
+        final ByteBuffer changed = data.duplicate();
+        changed.position(3 * leaf).limit(4 * leaf);
+        final ByteBuffer slot = leaves.duplicate();
+        slot.position(3 * blake.treeLeafBytes());
+        blake.hashTreeLeaves(slot, changed, leaf, 3L, null);
+
+        blake.hashTreeRoot(root, leaves, leaf, null);
+        blake.hashTree(tree, data, leaf, null);
+        Assert.assertTrue(Stodium.isEqual(tree, root));
+
+        blake.hash(root, data);
+        Assert.assertFalse(Stodium.isEqual(tree, root));
+    }
+
+    @Test
+    public void duplicateForksState()
+            throws StodiumException {
+        final GenericHash blake  = GenericHash.blake2bInstance();
+        final ByteBuffer  prefix = ByteBuffer.allocateDirect(3000);
+        final ByteBuffer  suffix = ByteBuffer.allocateDirect(100);
+        final ByteBuffer  forked = ByteBuffer.allocateDirect(blake.bytes());
+        final ByteBuffer  whole  = ByteBuffer.allocateDirect(blake.bytes());
+        for (int i = 0; i < prefix.capacity(); i++) {
+            prefix.put(i, (byte) i);
+        }
+        suffix.put(0, (byte) 1);
+
+        final Multipart<Hash> common = blake.init();
+        common.update(prefix.duplicate());
+
+        final Multipart<Hash> fork = common.duplicate();
+        fork.update(suffix.duplicate());
+        fork.doFinal(forked);
+        fork.release();
+
+        final Multipart<Hash> again = blake.init();
+        again.update(prefix.duplicate());
+        again.update(suffix.duplicate());
+        again.doFinal(whole);
+        again.release();
+        Assert.assertTrue(Stodium.isEqual(whole, forked));
+
+        // The original must be unaffected by the fork
+        common.doFinal(whole);
+        common.release();
+        blake.hash(forked, prefix);
+        Assert.assertTrue(Stodium.isEqual(forked, whole));
+    }
+
+    @Test
+    public void vectoredUpdateMatchesUpdate()
+            throws StodiumException {
+        final GenericHash  blake    = GenericHash.blake2bInstance();
+        final ByteBuffer   data     = ByteBuffer.allocateDirect(1000);
+        final ByteBuffer   gathered = ByteBuffer.allocateDirect(blake.bytes());
+        final ByteBuffer   single   = ByteBuffer.allocateDirect(blake.bytes());
+        final ByteBuffer[] segments = new ByteBuffer[5];
+        for (int i = 0; i < data.capacity(); i++) {
+            data.put(i, (byte) (i * 5));
+        }
+
+        // Mix direct, heap and read-only segments, and leave out the last one
+        final byte[] heap = new byte[300];
+        for (int i = 0; i < heap.length; i++) {
+            heap[i] = data.get(100 + i);
+        }
+        segments[0] = TestBuffers.window(data, 0, 100);
+        segments[1] = ByteBuffer.wrap(heap).asReadOnlyBuffer();
+        segments[2] = TestBuffers.window(data, 400, 500).asReadOnlyBuffer();
+        segments[3] = TestBuffers.window(data, 900, 100);
+        segments[4] = null;
+
+        final Multipart<Hash> vectored = blake.init();
+        vectored.update(segments, 0, 4);
+        vectored.doFinal(gathered);
+        vectored.release();
+
+        blake.hash(single, data);
+        Assert.assertTrue(Stodium.isEqual(single, gathered));
+    }
+
+    @Test
+    public void arrayMultipartMatchesBuffers()
+            throws StodiumException {
+        final GenericHash blake = GenericHash.blake2bInstance();
+        final ByteBuffer  key   = TestBuffers.fill(blake.keyBytes(), 3);
+        final ByteBuffer  data  = TestBuffers.fill(1000, 7);
+        final ByteBuffer  whole = ByteBuffer.allocateDirect(blake.bytes());
+
+        // Surround the key, data and digest with unrelated bytes
+        final byte[] keyArr  = new byte[key.capacity() + 5];
+        final byte[] dataArr = new byte[data.capacity() + 11];
+        final byte[] outArr  = new byte[blake.bytes() + 9];
+        for (int i = 0; i < key.capacity(); i++) {
+            keyArr[5 + i] = key.get(i);
+        }
+        for (int i = 0; i < data.capacity(); i++) {
+            dataArr[11 + i] = data.get(i);
+        }
+
+        final Multipart<Hash> buffers = blake.init(key, blake.bytes());
+        buffers.update(data);
+        buffers.doFinal(whole);
+        buffers.release();
+
+        final Multipart<Hash> arrays = blake.init(keyArr, 5, key.capacity(), blake.bytes());
+        arrays.update(dataArr, 11, 400);
+        arrays.update(dataArr, 411, 600);
+        arrays.doFinal(outArr, 9, blake.bytes());
+        arrays.release();
+
+        Assert.assertTrue(Stodium.isEqual(whole,
+                TestBuffers.window(ByteBuffer.wrap(outArr), 9, blake.bytes())));
+    }
+
     /**
      * For each triplet:
      * [0] : in_hex
@@ -0,0 +1,89 @@
+package eu.artemisc.stodium.generichash;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.exceptions.OperationFailedException;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class MerkleTreeTest {
+
+    private static final int LEAF = 1024;
+
+    @Test
+    public void updateMatchesRebuild()
+            throws StodiumException {
+        final ByteBuffer data = ByteBuffer.allocateDirect(37 * LEAF + 5);
+        for (int i = 0; i < data.capacity(); i++) {
+            data.put(i, (byte) (i * 3));
+        }
+
+        final MerkleTree tree = new MerkleTree(
+                ByteBuffer.allocateDirect(MerkleTree.storageBytes(data.capacity(), LEAF)),
+                data.capacity(), LEAF, null);
+        tree.build(data);
+
+        // Edit a range that straddles two leaves, plus the short last leaf
+        for (int i = 0; i < 100; i++) {
+            data.put(5 * LEAF - 50 + i, (byte) 0xff);
+        }
+        data.put(data.capacity() - 1, (byte) 0);
+        tree.markDirty(5 * LEAF - 50, 100);
+        tree.markDirty(data.capacity() - 1, 1);
+        Assert.assertTrue(tree.isDirty());
+        tree.update(data);
+        Assert.assertFalse(tree.isDirty());
+
+        final MerkleTree fresh = new MerkleTree(
+                ByteBuffer.allocateDirect(MerkleTree.storageBytes(data.capacity(), LEAF)),
+                data.capacity(), LEAF, null);
+        fresh.build(data);
+
+        final ByteBuffer updated = ByteBuffer.allocateDirect(32);
+        final ByteBuffer rebuilt = ByteBuffer.allocateDirect(32);
+        tree.root(updated);
+        fresh.root(rebuilt);
+        Assert.assertTrue(Stodium.isEqual(rebuilt, updated));
+    }
+
+    @Test
+    public void fileLeavesRequireTreeLength()
+            throws StodiumException, IOException {
+        final GenericHash blake  = GenericHash.blake2bInstance();
+        final byte[]      data   = new byte[3 * LEAF + 5];
+        final ByteBuffer  leaves = ByteBuffer.allocateDirect(4 * blake.treeLeafBytes());
+        final ByteBuffer  mapped = ByteBuffer.allocateDirect(4 * blake.treeLeafBytes());
+        final File        file   = File.createTempFile("stodium", ".bin");
+        for (int i = 0; i < data.length; i++) {
+            data[i] = (byte) (i * 3);
+        }
+
+        try {
+            final FileOutputStream out = new FileOutputStream(file);
+            out.write(data);
+            out.close();
+
+            blake.hashTreeLeaves(leaves, ByteBuffer.wrap(data), LEAF, 0L, null);
+            blake.hashTreeLeaves(mapped, file.getPath(), data.length, LEAF, 0L, null);
+            Assert.assertTrue(Stodium.isEqual(leaves, mapped));
+
+            // the file no longer has the length the leaves were computed for
+            try {
+                blake.hashTreeLeaves(mapped, file.getPath(), data.length - 1, LEAF, 0L, null);
+                Assert.fail();
+            } catch (final OperationFailedException ignored) {
+            }
+        } finally {
+            Assert.assertTrue(file.delete());
+        }
+    }
+}
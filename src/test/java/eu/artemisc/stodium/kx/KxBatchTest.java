@@ -0,0 +1,54 @@
+package eu.artemisc.stodium.kx;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.TestBuffers;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class KxBatchTest {
+
+    private static final int CLIENTS = 16;
+
+    @Test
+    public void batchMatchesSingleSessionKeys()
+            throws StodiumException {
+        final Kx  kx      = Kx.instance();
+        final int pkBytes = kx.publicKeyBytes();
+        final int skBytes = kx.sessionKeyBytes();
+
+        final ByteBuffer serverPk = ByteBuffer.allocateDirect(pkBytes);
+        final ByteBuffer serverSk = ByteBuffer.allocateDirect(kx.secretKeyBytes());
+        kx.keypair(serverPk, serverSk);
+
+        final ByteBuffer clientPks = ByteBuffer.allocateDirect(CLIENTS * pkBytes);
+        for (int i = 0; i < CLIENTS; i++) {
+            kx.keypair(TestBuffers.window(clientPks, i * pkBytes, pkBytes),
+                    ByteBuffer.allocateDirect(kx.secretKeyBytes()));
+        }
+
+        for (final boolean parallel : new boolean[] { false, true }) {
+            final ByteBuffer rx     = ByteBuffer.allocateDirect(CLIENTS * skBytes);
+            final ByteBuffer tx     = ByteBuffer.allocateDirect(CLIENTS * skBytes);
+            final int[]      status = new int[CLIENTS];
+            Assert.assertEquals(0, kx.serverSessionKeysBatch(rx, tx, serverPk, serverSk, clientPks, status, parallel));
+
+            for (int i = 0; i < CLIENTS; i++) {
+                final ByteBuffer expectedRx = ByteBuffer.allocateDirect(skBytes);
+                final ByteBuffer expectedTx = ByteBuffer.allocateDirect(skBytes);
+                kx.serverSessionKeys(expectedRx, expectedTx, serverPk, serverSk,
+                        TestBuffers.window(clientPks, i * pkBytes, pkBytes));
+
+                Assert.assertEquals(0, status[i]);
+                Assert.assertTrue(Stodium.isEqual(expectedRx, TestBuffers.window(rx, i * skBytes, skBytes)));
+                Assert.assertTrue(Stodium.isEqual(expectedTx, TestBuffers.window(tx, i * skBytes, skBytes)));
+            }
+        }
+    }
+}
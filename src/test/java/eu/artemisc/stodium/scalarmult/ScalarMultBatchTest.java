@@ -0,0 +1,48 @@
+package eu.artemisc.stodium.scalarmult;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.TestBuffers;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class ScalarMultBatchTest {
+
+    private static final int ELEMENTS = 16;
+
+    @Test
+    public void batchMatchesSingleScalarMult()
+            throws StodiumException {
+        final ScalarMult sm    = ScalarMult.instance();
+        final int        bytes = sm.bytes();
+
+        final ByteBuffer scalar = TestBuffers.fill(sm.scalarBytes(), 11);
+
+        // multiples of the base point are valid group elements
+        final ByteBuffer elements = ByteBuffer.allocateDirect(ELEMENTS * bytes);
+        for (int i = 0; i < ELEMENTS; i++) {
+            sm.scalarMultBase(TestBuffers.window(elements, i * bytes, bytes),
+                    TestBuffers.fill(sm.scalarBytes(), i + 1));
+        }
+
+        for (final boolean parallel : new boolean[] { false, true }) {
+            final ByteBuffer dst    = ByteBuffer.allocateDirect(ELEMENTS * bytes);
+            final int[]      status = new int[ELEMENTS];
+            Assert.assertEquals(0, sm.scalarMultBatch(dst, scalar, elements, status, parallel));
+
+            for (int i = 0; i < ELEMENTS; i++) {
+                final ByteBuffer expected = ByteBuffer.allocateDirect(bytes);
+                sm.scalarMult(expected, scalar, TestBuffers.window(elements, i * bytes, bytes));
+
+                Assert.assertEquals(0, status[i]);
+                Assert.assertTrue(Stodium.isEqual(expected, TestBuffers.window(dst, i * bytes, bytes)));
+            }
+        }
+    }
+}
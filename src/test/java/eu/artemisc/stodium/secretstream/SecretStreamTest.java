@@ -0,0 +1,71 @@
+package eu.artemisc.stodium.secretstream;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class SecretStreamTest {
+
+    @Test
+    public void pushPull()
+            throws StodiumException {
+        final SecretStream stream = SecretStream.instance();
+
+        final ByteBuffer key    = ByteBuffer.allocateDirect(stream.keyBytes());
+        final ByteBuffer header = ByteBuffer.allocateDirect(stream.headerBytes());
+        final ByteBuffer first  = ByteBuffer.allocateDirect(100);
+        final ByteBuffer last   = ByteBuffer.allocateDirect(17);
+        for (int i = 0; i < key.capacity(); i++) {
+            key.put(i, (byte) i);
+        }
+        for (int i = 0; i < first.capacity(); i++) {
+            first.put(i, (byte) (i * 3));
+        }
+
+        final ByteBuffer c1 = ByteBuffer.allocateDirect(first.capacity() + stream.aBytes());
+        final ByteBuffer c2 = ByteBuffer.allocateDirect(last.capacity() + stream.aBytes());
+
+        final SecretStreamPush push = stream.initPush(header, key);
+        push.push(c1, first, stream.tagMessage());
+        push.push(c2, last, stream.tagFinal());
+        Assert.assertTrue(push.isFinished());
+
+        final ByteBuffer p1 = ByteBuffer.allocateDirect(first.capacity());
+        final ByteBuffer p2 = ByteBuffer.allocateDirect(last.capacity());
+
+        final SecretStreamPull pull = stream.initPull(header, key);
+        Assert.assertEquals(stream.tagMessage(), pull.pull(p1, c1));
+        Assert.assertFalse(pull.isFinished());
+        Assert.assertEquals(stream.tagFinal(), pull.pull(p2, c2));
+        Assert.assertTrue(pull.isFinished());
+
+        Assert.assertTrue(Stodium.isEqual(first, p1));
+        Assert.assertTrue(Stodium.isEqual(last, p2));
+    }
+
+    @Test(expected = StodiumException.class)
+    public void reorderedChunk()
+            throws StodiumException {
+        final SecretStream stream = SecretStream.instance();
+
+        final ByteBuffer key    = ByteBuffer.allocateDirect(stream.keyBytes());
+        final ByteBuffer header = ByteBuffer.allocateDirect(stream.headerBytes());
+        final ByteBuffer plain  = ByteBuffer.allocateDirect(32);
+        final ByteBuffer c1     = ByteBuffer.allocateDirect(32 + stream.aBytes());
+        final ByteBuffer c2     = ByteBuffer.allocateDirect(32 + stream.aBytes());
+
+        final SecretStreamPush push = stream.initPush(header, key);
+        push.push(c1, plain, stream.tagMessage());
+        push.push(c2, plain, stream.tagMessage());
+
+        final SecretStreamPull pull = stream.initPull(header, key);
+        pull.pull(ByteBuffer.allocateDirect(32), c2);
+    }
+}
@@ -0,0 +1,52 @@
+package eu.artemisc.stodium.sign;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.TestBuffers;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class MultipartSignTest {
+
+    @Test
+    public void duplicateForksState()
+            throws StodiumException {
+        final Sign         sign   = Sign.ed25519Instance();
+        final ByteBuffer   pub    = ByteBuffer.allocateDirect(sign.publicKeyBytes());
+        final ByteBuffer   priv   = ByteBuffer.allocateDirect(sign.secretKeyBytes());
+        final ByteBuffer   prefix = TestBuffers.fill(3000, 1);
+        final ByteBuffer[] suffix = { TestBuffers.fill(100, 3), TestBuffers.fill(100, 5) };
+        sign.keypair(pub, priv);
+
+        final MultipartSign common = sign.init();
+        common.update(prefix.duplicate());
+
+        final ByteBuffer[] forked = new ByteBuffer[suffix.length];
+        for (int i = 0; i < suffix.length; i++) {
+            final ByteBuffer whole = ByteBuffer.allocateDirect(sign.bytes());
+            forked[i] = ByteBuffer.allocateDirect(sign.bytes());
+
+            final MultipartSign fork = common.duplicate();
+            fork.update(suffix[i].duplicate());
+            fork.doFinal(forked[i], priv);
+            fork.release();
+
+            // ed25519 signatures are deterministic, so a fresh state over the
+            // whole message must give the same signature
+            final MultipartSign again = sign.init();
+            again.update(prefix.duplicate());
+            again.update(suffix[i].duplicate());
+            again.doFinal(whole, priv);
+            again.release();
+            Assert.assertTrue(Stodium.isEqual(whole, forked[i]));
+        }
+        common.release();
+        Assert.assertFalse(Stodium.isEqual(forked[0], forked[1]));
+    }
+}
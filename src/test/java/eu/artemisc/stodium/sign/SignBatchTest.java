@@ -0,0 +1,67 @@
+package eu.artemisc.stodium.sign;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.TestBuffers;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class SignBatchTest {
+
+    private static final int COUNT = 8;
+
+    @Test
+    public void batchMatchesVerifyDetached()
+            throws StodiumException {
+        final Sign sign     = Sign.ed25519Instance();
+        final int  sigBytes = sign.bytes();
+        final int  pubBytes = sign.publicKeyBytes();
+
+        final int[] offsets = new int[COUNT];
+        final int[] lengths = new int[COUNT];
+        int total = 0;
+        for (int i = 0; i < COUNT; i++) {
+            offsets[i] = total;
+            lengths[i] = i * 37;
+            total     += lengths[i];
+        }
+
+        final ByteBuffer msgs = TestBuffers.fill(total, 7);
+        final ByteBuffer sigs = ByteBuffer.allocateDirect(COUNT * sigBytes);
+        final ByteBuffer pubs = ByteBuffer.allocateDirect(COUNT * pubBytes);
+        for (int i = 0; i < COUNT; i++) {
+            final ByteBuffer priv = ByteBuffer.allocateDirect(sign.secretKeyBytes());
+            sign.keypair(TestBuffers.window(pubs, i * pubBytes, pubBytes), priv);
+            sign.signDetached(TestBuffers.window(sigs, i * sigBytes, sigBytes),
+                    TestBuffers.window(msgs, offsets[i], lengths[i]),
+                    priv);
+        }
+
+        // corrupt the signature of message 2 and the contents of message 5
+        sigs.put(2 * sigBytes, (byte) (sigs.get(2 * sigBytes) ^ 1));
+        msgs.put(offsets[5], (byte) (msgs.get(offsets[5]) ^ 1));
+
+        final boolean[] valid = new boolean[COUNT];
+        Assert.assertFalse(sign.verifyBatch(sigs, msgs, offsets, lengths, pubs, valid));
+
+        final byte[] sigArray = new byte[sigs.capacity()];
+        final byte[] msgArray = new byte[msgs.capacity()];
+        final byte[] pubArray = new byte[pubs.capacity()];
+        sigs.duplicate().get(sigArray);
+        msgs.duplicate().get(msgArray);
+        pubs.duplicate().get(pubArray);
+
+        for (int i = 0; i < COUNT; i++) {
+            Assert.assertEquals(i != 2 && i != 5, valid[i]);
+            Assert.assertEquals(sign.verifyDetached(
+                    sigArray, i * sigBytes,
+                    msgArray, offsets[i], lengths[i],
+                    pubArray, i * pubBytes), valid[i]);
+        }
+    }
+}
@@ -0,0 +1,54 @@
+package eu.artemisc.stodium.stream;
+
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.nio.ByteBuffer;
+
+import eu.artemisc.stodium.Stodium;
+import eu.artemisc.stodium.TestBuffers;
+import eu.artemisc.stodium.exceptions.StodiumException;
+
+/**
+ * @author Jan van de Molengraft [jan@artemisc.eu]
+ */
+public class StreamTest {
+
+    @Test
+    public void xorAtMatchesFullStream()
+            throws StodiumException {
+        final Stream[] streams = new Stream[] {
+                Stream.xchacha20Instance(),
+                Stream.chacha20IetfInstance(),
+                Stream.xsalsa20Instance(),
+        };
+
+        for (final Stream stream : streams) {
+            final ByteBuffer key    = ByteBuffer.allocateDirect(stream.keyBytes());
+            final ByteBuffer nonce  = ByteBuffer.allocateDirect(stream.nonceBytes());
+            final ByteBuffer plain  = ByteBuffer.allocateDirect(1000);
+            final ByteBuffer cipher = ByteBuffer.allocateDirect(1000);
+            for (int i = 0; i < key.capacity(); i++) {
+                key.put(i, (byte) (i + 1));
+            }
+            for (int i = 0; i < plain.capacity(); i++) {
+                plain.put(i, (byte) (i * 11));
+            }
+
+            stream.xor(cipher, plain, nonce, key);
+
+            // Unaligned window spanning several blocks
+            final int offset = 3 * stream.blockBytes() + 17;
+            final int length = 300;
+            final ByteBuffer window = ByteBuffer.allocateDirect(length);
+            stream.xorAt(window, TestBuffers.window(cipher, offset, length), nonce, offset, key);
+            Assert.assertTrue(Stodium.isEqual(TestBuffers.window(plain, offset, length), window));
+
+            // Block aligned window through the block counter
+            final ByteBuffer block = ByteBuffer.allocateDirect(stream.blockBytes());
+            stream.xorIc(block, TestBuffers.window(cipher, 2 * stream.blockBytes(), stream.blockBytes()),
+                    nonce, 2, key);
+            Assert.assertTrue(Stodium.isEqual(TestBuffers.window(plain, 2 * stream.blockBytes(), stream.blockBytes()), block));
+        }
+    }
+}